@@ -0,0 +1,1187 @@
+#include "../src/DMA/DMAManager.h"
+#include "../src/DMA/SimulatedBackend.h"
+#include "../src/DMA/ReplayBackend.h"
+#include "../src/Scan/PatternScanner.h"
+#include "../src/Scan/SignatureIndex.h"
+#include "../src/Scan/ValueScanner.h"
+#include "../src/Synthetic/SyntheticImage.h"
+#include "../src/Synthetic/SyntheticNamePool.h"
+#include "../src/Synthetic/SyntheticObjectArray.h"
+#include "../src/Synthetic/SyntheticReflection.h"
+#include "../src/Unreal/LayoutIndexer.h"
+#include "../src/Unreal/NamePoolDumper.h"
+#include "../src/Unreal/ObjectEnumerator.h"
+#include "../src/Core/JsonWriter.h"
+#include "../src/Core/TextIndex.h"
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <sstream>
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <functional>
+#include <map>
+
+/*
+ * Headless benchmark suite for the scan engine and the read paths.
+ *
+ * Case names are stable ("<Area>/<variant>") so results from different
+ * commits can be compared by name. Use --json to write machine-readable
+ * results next to the human-readable table.
+ */
+
+namespace
+{
+    constexpr uint64_t MODULE_BASE = 0x140000000;
+    constexpr const char* PROCESS_NAME = "BenchGame-Win64-Shipping.exe";
+    constexpr uint64_t NAME_BLOCKS_BASE = 0x200000000;   // Synthetic FNamePool blocks (heap-like, above the module)
+    constexpr uint64_t OBJECT_ARRAY_BASE = 0x300000000;  // Synthetic GObjects chunks and object pools
+    constexpr uint64_t REFLECTION_BASE = 0x500000000;    // Synthetic UStructs, FFields and FFieldClasses
+
+    /**
+     * @brief Pattern string of a signature ("48 8B 05 ?? ...") as ScanSignature takes it
+     */
+    std::string FormatPattern(const UnrealSignature& sig)
+    {
+        std::ostringstream text;
+        for (size_t i = 0; i < sig.pattern.size(); ++i)
+        {
+            if (i != 0)
+                text << ' ';
+            if (sig.mask[i] == 'x')
+                text << std::uppercase << std::hex << std::setw(2) << std::setfill('0') << static_cast<int>(sig.pattern[i]);
+            else
+                text << "??";
+        }
+        return text.str();
+    }
+
+    /**
+     * @struct BenchOptions
+     * @brief Command line options
+     */
+    struct BenchOptions
+    {
+        std::string jsonPath;           ///< Output file for JSON results (empty = none)
+        std::string imagePath;          ///< Optional raw module dump to scan
+        std::string recordPath;         ///< Record one synthetic scan into this session file
+        std::string replayPath;         ///< Recorded DMA session to replay
+        std::string filter;             ///< Only run cases whose name contains this
+        size_t imageSizeMB = 64;        ///< Synthetic module size
+        double minSeconds = 0.5;        ///< Minimum measured time per case
+        double roundTripMicros = 8.0;   ///< Simulated link round trip cost
+        bool realTime = false;          ///< Sleep for simulated link time
+    };
+
+    /**
+     * @struct BenchResult
+     * @brief Measurements of a single benchmark case
+     */
+    struct BenchResult
+    {
+        std::string name;                       ///< Stable case name
+        uint64_t iterations = 0;                ///< Measured iterations
+        double nanosPerIteration = 0.0;         ///< Mean wall time per iteration
+        double bytesPerSecond = 0.0;            ///< Throughput (0 if not applicable)
+        std::map<std::string, double> counters; ///< Case-specific per-iteration counters
+    };
+
+    /**
+     * @class ScopedSilence
+     * @brief Redirects std::cout into a sink while the scanner logs
+     */
+    class ScopedSilence
+    {
+    public:
+        ScopedSilence() : m_format(nullptr), m_previous(std::cout.rdbuf(m_sink.rdbuf()))
+        {
+            m_format.copyfmt(std::cout);
+        }
+
+        ~ScopedSilence()
+        {
+            // The scanner leaves hex/fill manipulators behind
+            std::cout.copyfmt(m_format);
+            std::cout.rdbuf(m_previous);
+        }
+
+    private:
+        std::ostringstream m_sink;
+        std::ios m_format;
+        std::streambuf* m_previous;
+    };
+
+    /**
+     * @brief Run a case until minSeconds has elapsed (at least once)
+     * @param body Case body, returns bytes processed per iteration
+     */
+    BenchResult Measure(const std::string& name, double minSeconds, const std::function<size_t()>& body)
+    {
+        using Clock = std::chrono::steady_clock;
+
+        BenchResult result;
+        result.name = name;
+
+        // Warm-up run so first-touch page faults are not measured
+        body();
+
+        uint64_t totalBytes = 0;
+        auto start = Clock::now();
+        double elapsed = 0.0;
+        do
+        {
+            totalBytes += body();
+            result.iterations++;
+            elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+        } while (elapsed < minSeconds);
+
+        result.nanosPerIteration = elapsed * 1e9 / static_cast<double>(result.iterations);
+        result.bytesPerSecond = elapsed > 0.0 ? static_cast<double>(totalBytes) / elapsed : 0.0;
+        return result;
+    }
+
+    std::string ParseArgs(int argc, char* argv[], BenchOptions& options)
+    {
+        for (int i = 1; i < argc; ++i)
+        {
+            std::string arg = argv[i];
+            auto next = [&]() -> std::string { return i + 1 < argc ? argv[++i] : ""; };
+
+            if (arg == "--json") options.jsonPath = next();
+            else if (arg == "--image") options.imagePath = next();
+            else if (arg == "--record") options.recordPath = next();
+            else if (arg == "--replay") options.replayPath = next();
+            else if (arg == "--filter") options.filter = next();
+            else if (arg == "--size-mb") options.imageSizeMB = std::stoul(next());
+            else if (arg == "--min-time") options.minSeconds = std::stod(next());
+            else if (arg == "--round-trip-us") options.roundTripMicros = std::stod(next());
+            else if (arg == "--realtime") options.realTime = true;
+            else return arg;
+        }
+        return "";
+    }
+
+    void PrintUsage()
+    {
+        std::cout << "Usage: uof_bench [options]\n"
+                  << "  --json <file>          Write results as JSON\n"
+                  << "  --image <file>         Also scan a raw module dump (module bytes as in memory)\n"
+                  << "  --record <file>        Record one synthetic globals scan as a DMA session\n"
+                  << "  --replay <file>        Also scan a recorded DMA session (timing collapsed)\n"
+                  << "  --filter <text>        Only run cases whose name contains <text>\n"
+                  << "  --size-mb <n>          Synthetic module size (default 64)\n"
+                  << "  --min-time <seconds>   Minimum measured time per case (default 0.5)\n"
+                  << "  --round-trip-us <us>   Simulated DMA round trip cost (default 8)\n"
+                  << "  --realtime             Sleep for the simulated link time" << std::endl;
+    }
+
+    std::string FileStem(const std::string& path)
+    {
+        size_t slash = path.find_last_of("/\\");
+        std::string name = slash == std::string::npos ? path : path.substr(slash + 1);
+        size_t dot = name.find_last_of('.');
+        return dot == std::string::npos ? name : name.substr(0, dot);
+    }
+
+    /**
+     * @brief Set up the simulated target and run all enabled cases
+     * @return false if the target could not be set up
+     */
+    bool RunBenchmarks(const BenchOptions& options, std::vector<BenchResult>& results)
+    {
+        auto enabled = [&options](const std::string& name)
+        {
+            return options.filter.empty() || name.find(options.filter) != std::string::npos;
+        };
+
+        // Simulated target process shared by the scan and read cases
+        auto backend = std::make_unique<SimulatedBackend>();
+        SimulatedBackend* simulated = backend.get();
+        uint32_t processId = simulated->AddProcess(PROCESS_NAME);
+
+        // Everything planted at the end of .text: worst case for first-match scanning
+        SyntheticImageOptions imageOptions;
+        imageOptions.imageSize = static_cast<uint64_t>(options.imageSizeMB) * 1024 * 1024;
+        imageOptions.imageBase = MODULE_BASE;
+        imageOptions.placeAtEnd = true;
+        SyntheticImage synthetic(imageOptions);
+        const UnrealGlobals& expected = synthetic.GetManifest().expected;
+        std::vector<uint8_t> image = synthetic.Generate();
+
+        DMAManager dma;
+        simulated->AddModule(processId, PROCESS_NAME, MODULE_BASE, image);
+
+        std::string imageCase;
+        uint32_t imageProcessId = 0;
+        if (!options.imagePath.empty())
+        {
+            imageCase = FileStem(options.imagePath);
+            imageProcessId = simulated->AddProcess(imageCase + ".exe");
+            if (!simulated->LoadModuleDump(imageProcessId, imageCase + ".exe", MODULE_BASE, options.imagePath))
+            {
+                return false;
+            }
+        }
+
+        if (!dma.Initialize(std::move(backend)) || !dma.AttachToProcess(processId))
+        {
+            std::cerr << "Failed to set up simulated process" << std::endl;
+            return false;
+        }
+
+        // Pattern matcher over the in-memory image, one case per signature
+        std::map<std::string, double> referenceNanos;
+        for (const auto& sig : dma.GetUnrealSignatures())
+        {
+            std::string name = "FindPatternInBuffer/" + sig.name;
+            if (!enabled(name))
+                continue;
+
+            results.push_back(Measure(name, options.minSeconds, [&]()
+            {
+                volatile size_t offset = PatternScanner::FindPattern(image.data(), image.size(), sig.pattern, sig.mask);
+                (void)offset;
+                return image.size();
+            }));
+            referenceNanos[sig.name] = results.back().nanosPerIteration;
+        }
+
+        // Same search anchored on the rarest fixed bytes under the image's learned byte model;
+        // candidates are verified positions, compared with a filter on the first fixed byte
+        ByteFrequency learned;
+        learned.Learn(image.data(), image.size());
+        for (const auto& sig : dma.GetUnrealSignatures())
+        {
+            std::string name = "FindAnchored/" + sig.name;
+            if (!enabled(name))
+                continue;
+
+            CompiledPattern compiled(sig.pattern, sig.mask, learned);
+            size_t offset = SIZE_MAX;
+            BenchResult result = Measure(name, options.minSeconds, [&]()
+            {
+                offset = compiled.Find(image.data(), image.size());
+                return image.size();
+            });
+
+            uint64_t candidates = 0;
+            uint64_t defaultCandidates = 0;
+            compiled.Find(image.data(), image.size(), &candidates);
+            CompiledPattern(sig.pattern, sig.mask).Find(image.data(), image.size(), &defaultCandidates);
+
+            size_t first = sig.mask.find('x');
+            size_t last = std::min(offset, image.size() - sig.pattern.size());
+            uint64_t firstByteCandidates = 0;
+            for (size_t i = 0; i <= last; ++i)
+            {
+                if (image[i + first] == sig.pattern[first])
+                    firstByteCandidates++;
+            }
+
+            result.counters["anchor_offset"] = static_cast<double>(compiled.GetAnchorOffset());
+            result.counters["anchor_bytes"] = static_cast<double>(compiled.GetAnchorLength());
+            result.counters["candidates"] = static_cast<double>(candidates);
+            result.counters["builtin_candidates"] = static_cast<double>(defaultCandidates);
+            result.counters["first_byte_candidates"] = static_cast<double>(firstByteCandidates);
+            result.counters["reduction"] = static_cast<double>(firstByteCandidates) / std::max<uint64_t>(candidates, 1);
+            result.counters["found_reference"] =
+                offset == PatternScanner::FindPattern(image.data(), image.size(), sig.pattern, sig.mask) ? 1.0 : 0.0;
+            auto reference = referenceNanos.find(sig.name);
+            if (reference != referenceNanos.end())
+                result.counters["speedup"] = reference->second / result.nanosPerIteration;
+            results.push_back(result);
+        }
+
+        // Learned model against the built-in table over every signature: the globals scan learns
+        // once per module image and only pays off if its anchors verify fewer candidates in total
+        std::string learnName = "ByteFrequency/learn_" + std::to_string(options.imageSizeMB) + "MB";
+        if (enabled(learnName))
+        {
+            BenchResult result = Measure(learnName, options.minSeconds, [&]()
+            {
+                ByteFrequency frequency;
+                frequency.Learn(image.data(), image.size());
+                return image.size();
+            });
+
+            uint64_t learnedCandidates = 0;
+            uint64_t builtinCandidates = 0;
+            uint64_t worseVariants = 0;
+            for (const auto& sig : dma.GetUnrealSignatures())
+            {
+                uint64_t withLearned = 0;
+                uint64_t withBuiltin = 0;
+                CompiledPattern(sig.pattern, sig.mask, learned).Find(image.data(), image.size(), &withLearned);
+                CompiledPattern(sig.pattern, sig.mask).Find(image.data(), image.size(), &withBuiltin);
+                learnedCandidates += withLearned;
+                builtinCandidates += withBuiltin;
+                if (withLearned > withBuiltin)
+                    worseVariants++;
+            }
+            result.counters["learned_candidates"] = static_cast<double>(learnedCandidates);
+            result.counters["builtin_candidates"] = static_cast<double>(builtinCandidates);
+            result.counters["learned_worse_variants"] = static_cast<double>(worseVariants);
+            result.counters["reduction"] = static_cast<double>(builtinCandidates) / std::max<uint64_t>(learnedCandidates, 1);
+            results.push_back(result);
+        }
+
+        // Ad-hoc signature queries: every built-in signature through ScanSignature, reading the
+        // module from the device each time versus answering from a trigram index built once
+        std::string buildName = "SignatureIndex/build_" + std::to_string(options.imageSizeMB) + "MB";
+        if (enabled(buildName))
+        {
+            SignatureIndex index;
+            BenchResult result = Measure(buildName, options.minSeconds, [&]()
+            {
+                index.Build(image, MODULE_BASE);
+                return image.size();
+            });
+            result.counters["memory_bytes"] = static_cast<double>(index.GetMemoryBytes());
+            result.counters["bytes_per_image_byte"] = static_cast<double>(index.GetMemoryBytes()) / image.size();
+            results.push_back(result);
+        }
+
+        std::string deviceQueryName = "ScanSignature/device_" + std::to_string(options.imageSizeMB) + "MB";
+        std::string indexedQueryName = "ScanSignature/indexed_" + std::to_string(options.imageSizeMB) + "MB";
+        if (enabled(deviceQueryName) || enabled(indexedQueryName))
+        {
+            std::vector<std::string> patterns;
+            std::vector<uint64_t> expectedAddresses;
+            for (const auto& sig : dma.GetUnrealSignatures())
+            {
+                patterns.push_back(FormatPattern(sig));
+                size_t offset = PatternScanner::FindPattern(image.data(), image.size(), sig.pattern, sig.mask);
+                expectedAddresses.push_back(offset == SIZE_MAX ? 0 : MODULE_BASE + offset);
+            }
+
+            auto runQueries = [&](std::vector<uint64_t>& found)
+            {
+                found.clear();
+                for (const std::string& pattern : patterns)
+                {
+                    found.push_back(dma.ScanSignature(pattern));
+                }
+                return image.size() * patterns.size();
+            };
+
+            std::vector<uint64_t> found;
+            double deviceNanos = 0.0;
+            if (enabled(deviceQueryName))
+            {
+                dma.DropSignatureIndex();
+                simulated->ResetStats();
+                BenchResult result = Measure(deviceQueryName, options.minSeconds, [&]() { return runQueries(found); });
+                BackendStats stats = simulated->GetStats();
+                double runs = static_cast<double>(result.iterations + 1);
+                result.counters["queries"] = static_cast<double>(patterns.size());
+                result.counters["round_trips"] = stats.roundTrips / runs;
+                result.counters["found_reference"] = found == expectedAddresses ? 1.0 : 0.0;
+                deviceNanos = result.nanosPerIteration;
+                results.push_back(result);
+            }
+
+            if (enabled(indexedQueryName))
+            {
+                std::string error;
+                auto index = dma.BuildSignatureIndex(error);
+                if (!index)
+                {
+                    std::cerr << error << std::endl;
+                    return false;
+                }
+
+                simulated->ResetStats();
+                BenchResult result = Measure(indexedQueryName, options.minSeconds, [&]() { return runQueries(found); });
+                BackendStats stats = simulated->GetStats();
+                double runs = static_cast<double>(result.iterations + 1);
+                result.counters["queries"] = static_cast<double>(patterns.size());
+                result.counters["round_trips"] = stats.roundTrips / runs;
+                result.counters["memory_bytes"] = static_cast<double>(index->GetMemoryBytes());
+                result.counters["found_reference"] = found == expectedAddresses ? 1.0 : 0.0;
+                if (deviceNanos > 0.0)
+                    result.counters["speedup"] = deviceNanos / result.nanosPerIteration;
+                results.push_back(result);
+                dma.DropSignatureIndex();
+            }
+        }
+
+        // Full globals scan through DMAManager and the simulated device
+        std::string scanName = "ScanUnrealGlobals/synthetic_" + std::to_string(options.imageSizeMB) + "MB";
+        double scanNanos = 0.0;
+        if (enabled(scanName))
+        {
+            UnrealGlobals found;
+            simulated->ResetStats();
+            BenchResult result = Measure(scanName, options.minSeconds, [&]()
+            {
+                found = dma.ScanUnrealGlobals();
+                return image.size() * 3;
+            });
+
+            BackendStats stats = simulated->GetStats();
+            double runs = static_cast<double>(result.iterations + 1);
+            result.counters["round_trips"] = stats.roundTrips / runs;
+            result.counters["bytes_read"] = stats.bytesRead / runs;
+            result.counters["found_expected"] = (found.GWorld == expected.GWorld
+                && found.GNames == expected.GNames && found.GObjects == expected.GObjects) ? 1.0 : 0.0;
+            scanNanos = result.nanosPerIteration;
+            results.push_back(result);
+        }
+
+        // Same image with every global exported: the export table answers before any module read
+        std::string exportsName = "ScanUnrealGlobals/exports_" + std::to_string(options.imageSizeMB) + "MB";
+        if (enabled(exportsName))
+        {
+            SyntheticImageOptions exportedOptions = imageOptions;
+            exportedOptions.exports = { "GWorld", "GNames", "GObjects" };
+            SyntheticImage exported(exportedOptions);
+
+            auto exportedBackend = std::make_unique<SimulatedBackend>();
+            SimulatedBackend* exportedSimulated = exportedBackend.get();
+            uint32_t exportedProcessId = exportedBackend->AddProcess(PROCESS_NAME);
+            exportedBackend->AddModule(exportedProcessId, PROCESS_NAME, MODULE_BASE, exported.Generate());
+
+            DMAManager exportedDma;
+            if (!exportedDma.Initialize(std::move(exportedBackend)) || !exportedDma.AttachToProcess(exportedProcessId))
+            {
+                std::cerr << "Failed to set up exporting process" << std::endl;
+                return false;
+            }
+
+            UnrealGlobals found;
+            exportedSimulated->ResetStats();
+            BenchResult result = Measure(exportsName, options.minSeconds, [&]()
+            {
+                exportedDma.SetPdbFile("");     // Drops the cached resolver: every run reads the headers and exports again
+                found = exportedDma.ScanUnrealGlobals();
+                return exportedOptions.imageSize * 3;
+            });
+
+            BackendStats stats = exportedSimulated->GetStats();
+            double runs = static_cast<double>(result.iterations + 1);
+            result.counters["round_trips"] = stats.roundTrips / runs;
+            result.counters["bytes_read"] = stats.bytesRead / runs;
+            result.counters["found_expected"] = (found.GWorld == expected.GWorld && found.GNames == expected.GNames &&
+                found.GObjects == expected.GObjects && found.GWorldSource == GlobalSource::Export) ? 1.0 : 0.0;
+            if (scanNanos > 0.0)
+                result.counters["speedup"] = scanNanos / result.nanosPerIteration;
+            results.push_back(result);
+        }
+
+        // Modular build: the executable holds no references, the globals live in a CoreUObject DLL
+        // loaded among system and third-party DLLs
+        std::string allModulesName = "ScanUnrealGlobals/all_modules_" + std::to_string(options.imageSizeMB) + "MB";
+        if (enabled(allModulesName))
+        {
+            const std::string coreModule = "BenchGame-CoreUObject-Win64-Shipping.dll";
+            SyntheticImageOptions coreOptions = imageOptions;
+            coreOptions.imageBase = 0x7FF800000000;
+            SyntheticImage core(coreOptions);
+            const UnrealGlobals& coreExpected = core.GetManifest().expected;
+
+            SyntheticImageOptions emptyOptions = imageOptions;
+            emptyOptions.variants = { "-" };    // No signature names "-": decoys and near misses only
+
+            auto modularBackend = std::make_unique<SimulatedBackend>();
+            SimulatedBackend* modularSimulated = modularBackend.get();
+            uint32_t modularProcessId = modularBackend->AddProcess(PROCESS_NAME);
+            modularBackend->AddModule(modularProcessId, PROCESS_NAME, MODULE_BASE, SyntheticImage(emptyOptions).Generate());
+
+            const char* fillers[] = { "ntdll.dll", "KERNEL32.DLL", "steam_api64.dll", "BenchGame-Renderer-Win64-Shipping.dll" };
+            emptyOptions.imageSize = 1024 * 1024;
+            for (size_t i = 0; i < std::size(fillers); ++i)
+            {
+                emptyOptions.imageBase = 0x7FF900000000 + i * 0x10000000;
+                emptyOptions.seed = i + 2;
+                modularBackend->AddModule(modularProcessId, fillers[i], emptyOptions.imageBase, SyntheticImage(emptyOptions).Generate());
+            }
+            modularBackend->AddModule(modularProcessId, coreModule, coreOptions.imageBase, core.Generate());
+
+            DMAManager modularDma;
+            if (!modularDma.Initialize(std::move(modularBackend)) || !modularDma.AttachToProcess(modularProcessId))
+            {
+                std::cerr << "Failed to set up modular process" << std::endl;
+                return false;
+            }
+
+            UnrealGlobals found;
+            modularSimulated->ResetStats();
+            BenchResult result = Measure(allModulesName, options.minSeconds, [&]()
+            {
+                found = modularDma.ScanUnrealGlobals(true);
+                return coreOptions.imageSize;
+            });
+
+            BackendStats stats = modularSimulated->GetStats();
+            double runs = static_cast<double>(result.iterations + 1);
+            result.counters["round_trips"] = stats.roundTrips / runs;
+            result.counters["bytes_read"] = stats.bytesRead / runs;
+            result.counters["found_expected"] = (found.GWorld == coreExpected.GWorld && found.GNames == coreExpected.GNames &&
+                found.GObjects == coreExpected.GObjects && found.GNamesModule.name == coreModule &&
+                found.GNamesModule.base == coreOptions.imageBase) ? 1.0 : 0.0;
+            results.push_back(result);
+        }
+
+        // Version-ranked globals scan: only the last variant of each group is planted, so a scan
+        // without hits on the version tries every earlier variant before finding it
+        std::string coldName = "ScanUnrealGlobals/version_cold_" + std::to_string(options.imageSizeMB) + "MB";
+        std::string rankedName = "ScanUnrealGlobals/version_ranked_" + std::to_string(options.imageSizeMB) + "MB";
+        if (enabled(coldName) || enabled(rankedName))
+        {
+            SyntheticImageOptions versionedOptions = imageOptions;
+            versionedOptions.engineVersion = "5.1";
+            versionedOptions.variants = { "GWorld (Variant 9)", "GNames (Variant 4)", "GObjects (Variant 5)" };
+            SyntheticImage versioned(versionedOptions);
+            const UnrealGlobals& versionedExpected = versioned.GetManifest().expected;
+
+            auto versionedBackend = std::make_unique<SimulatedBackend>();
+            uint32_t versionedProcessId = versionedBackend->AddProcess(PROCESS_NAME);
+            versionedBackend->AddModule(versionedProcessId, PROCESS_NAME, MODULE_BASE, versioned.Generate());
+
+            DMAManager versionedDma;
+            if (!versionedDma.Initialize(std::move(versionedBackend)) || !versionedDma.AttachToProcess(versionedProcessId))
+            {
+                std::cerr << "Failed to set up versioned process" << std::endl;
+                return false;
+            }
+
+            UnrealGlobals found;
+            auto matchesExpected = [&]()
+            {
+                return (found.GWorld == versionedExpected.GWorld && found.GNames == versionedExpected.GNames &&
+                        found.GObjects == versionedExpected.GObjects) ? 1.0 : 0.0;
+            };
+
+            double coldNanos = 0.0;
+            if (enabled(coldName))
+            {
+                BenchResult result = Measure(coldName, options.minSeconds, [&]()
+                {
+                    versionedDma.ClearSignatureStats();
+                    found = versionedDma.ScanUnrealGlobals();
+                    return versioned.GetManifest().options.imageSize * 3;
+                });
+                result.counters["found_expected"] = matchesExpected();
+                coldNanos = result.nanosPerIteration;
+                results.push_back(result);
+            }
+
+            if (enabled(rankedName))
+            {
+                BenchResult result = Measure(rankedName, options.minSeconds, [&]()
+                {
+                    found = versionedDma.ScanUnrealGlobals();
+                    return versioned.GetManifest().options.imageSize * 3;
+                });
+                result.counters["found_expected"] = matchesExpected();
+                result.counters["engine_version"] = found.engineVersion.GetCode();
+                if (coldNanos > 0.0)
+                    result.counters["speedup"] = coldNanos / result.nanosPerIteration;
+                results.push_back(result);
+            }
+        }
+
+        if (!options.recordPath.empty())
+        {
+            if (!dma.StartSessionRecording(options.recordPath))
+            {
+                return false;
+            }
+            dma.ScanUnrealGlobals();
+            dma.StopSessionRecording();
+        }
+
+        if (!imageCase.empty())
+        {
+            std::string name = "ScanUnrealGlobals/image_" + imageCase;
+            if (enabled(name))
+            {
+                UnrealGlobals found;
+                dma.AttachToProcess(imageProcessId);
+                size_t imageSize = dma.GetCurrentProcessInfo().imageSize;
+                BenchResult result = Measure(name, options.minSeconds, [&]()
+                {
+                    found = dma.ScanUnrealGlobals();
+                    return imageSize * 3;
+                });
+                result.counters["globals_found"] = (found.GWorld ? 1 : 0) + (found.GNames ? 1 : 0) + (found.GObjects ? 1 : 0);
+                results.push_back(result);
+
+                dma.AttachToProcess(processId);
+            }
+        }
+
+        if (!options.replayPath.empty())
+        {
+            std::string name = "ScanUnrealGlobals/replay_" + FileStem(options.replayPath);
+            if (enabled(name))
+            {
+                auto replay = std::make_unique<ReplayBackend>();
+                if (!replay->Load(options.replayPath))
+                {
+                    return false;
+                }
+                ReplayBackend* replayed = replay.get();
+
+                DMAManager replayDma;
+                if (!replayDma.Initialize(std::move(replay)) || replayDma.GetProcessList()->empty())
+                {
+                    std::cerr << "Session has no process list: " << options.replayPath << std::endl;
+                    return false;
+                }
+
+                uint32_t replayProcessId = static_cast<uint32_t>(replayed->GetLastMarker("attach", replayDma.GetProcessList()->front().processId));
+                if (!replayDma.AttachToProcess(replayProcessId))
+                {
+                    std::cerr << "Failed to attach to recorded process " << replayProcessId << std::endl;
+                    return false;
+                }
+
+                UnrealGlobals found;
+                BenchResult result = Measure(name, options.minSeconds, [&]()
+                {
+                    found = replayDma.ScanUnrealGlobals();
+                    return 0;
+                });
+
+                ReplayStats stats = replayed->GetStats();
+                double runs = static_cast<double>(result.iterations + 1);
+                result.counters["served"] = stats.served / runs;
+                result.counters["misses"] = stats.misses / runs;
+                result.counters["globals_found"] = (found.GWorld ? 1 : 0) + (found.GNames ? 1 : 0) + (found.GObjects ? 1 : 0);
+                results.push_back(result);
+
+                replayDma.Shutdown();
+            }
+        }
+
+        // Whole FNamePool of one million names behind the synthetic GNames
+        if (enabled("DumpNames/synthetic_1M"))
+        {
+            SyntheticNamePoolOptions poolOptions;
+            poolOptions.nameCount = 1000000;
+            SyntheticNamePool pool(poolOptions);
+
+            std::vector<uint64_t> blockAddresses;
+            for (size_t i = 0; i < pool.GetBlocks().size(); ++i)
+            {
+                blockAddresses.push_back(NAME_BLOCKS_BASE + i * 2 * SyntheticNamePool::BLOCK_SIZE);
+                simulated->AddRegion(processId, blockAddresses.back(), pool.GetBlocks()[i]);
+            }
+            std::vector<uint8_t> header = pool.BuildHeader(blockAddresses);
+            simulated->Write(processId, expected.GNames, header.data(), header.size());
+
+            NamePoolDumper dumper(dma);
+            NameTable names;
+            std::string error;
+            simulated->ResetStats();
+            BenchResult result = Measure("DumpNames/synthetic_1M", options.minSeconds, [&]()
+            {
+                dumper.Dump(expected.GNames, names, error);
+                return static_cast<size_t>(dumper.GetLastStats().bytesRead);
+            });
+
+            BackendStats stats = simulated->GetStats();
+            double runs = static_cast<double>(result.iterations + 1);
+            result.counters["round_trips"] = stats.roundTrips / runs;
+            result.counters["names"] = static_cast<double>(names.GetCount());
+            result.counters["table_bytes"] = static_cast<double>(names.GetMemoryBytes());
+            result.counters["all_match"] = names.GetCount() == pool.GetNames().size()
+                && names.Find(pool.GetNames().back().index) == pool.GetNames().back().name ? 1.0 : 0.0;
+            results.push_back(result);
+        }
+
+        // Search over one million dumped names: index build, then a mix of selective and broad queries
+        if (enabled("TextIndex/build_names_1M") || enabled("TextIndex/query_names_1M") || enabled("TextIndex/query_short_names_1M"))
+        {
+            SyntheticNamePoolOptions poolOptions;
+            poolOptions.nameCount = 1000000;
+            SyntheticNamePool pool(poolOptions);
+            const std::vector<SyntheticName>& generated = pool.GetNames();
+            auto getName = [&generated](size_t i) { return std::string_view(generated[i].name); };
+
+            TextIndex index;
+            if (enabled("TextIndex/build_names_1M"))
+            {
+                size_t arenaBytes = 0;
+                for (const SyntheticName& name : generated)
+                {
+                    arenaBytes += name.name.size();
+                }
+                BenchResult result = Measure("TextIndex/build_names_1M", options.minSeconds, [&]()
+                {
+                    index.Build(generated.size(), getName);
+                    return arenaBytes;
+                });
+                result.counters["index_mb"] = index.GetMemoryBytes() / (1024.0 * 1024.0);
+                results.push_back(result);
+            }
+
+            // Each query set is checked against a linear lowercase scan, the filter the index replaces
+            auto measureQueries = [&](const std::string& name, const std::vector<std::pair<const char*, TextMatch>>& queries)
+            {
+                if (index.GetCount() == 0)
+                {
+                    index.Build(generated.size(), getName);
+                }
+
+                std::vector<uint32_t> matches;
+                size_t lastResults = 0;
+                bool allMatch = true;
+                for (const auto& [query, match] : queries)
+                {
+                    std::string lowered(query);
+                    std::transform(lowered.begin(), lowered.end(), lowered.begin(), ::tolower);
+                    std::vector<uint32_t> expectedMatches;
+                    for (uint32_t i = 0; i < generated.size(); ++i)
+                    {
+                        std::string text = generated[i].name;
+                        std::transform(text.begin(), text.end(), text.begin(), ::tolower);
+                        size_t found = text.find(lowered);
+                        if (match == TextMatch::Prefix ? found == 0 : found != std::string::npos)
+                            expectedMatches.push_back(i);
+                    }
+                    index.Search(query, match, SIZE_MAX, matches);
+                    allMatch = allMatch && matches == expectedMatches;
+                }
+
+                BenchResult result = Measure(name, options.minSeconds, [&]()
+                {
+                    for (const auto& [query, match] : queries)
+                    {
+                        index.Search(query, match, 100000, matches);
+                    }
+                    lastResults = matches.size();
+                    return queries.size() * sizeof(queries[0]);
+                });
+                result.counters["us_per_query"] = result.nanosPerIteration / 1000.0 / queries.size();
+                result.counters["last_results"] = static_cast<double>(lastResults);
+                result.counters["all_match"] = allMatch ? 1.0 : 0.0;
+                results.push_back(result);
+            };
+
+            if (enabled("TextIndex/query_names_1M"))
+            {
+                measureQueries("TextIndex/query_names_1M", {
+                    { "_123456", TextMatch::Substring }, { "healthammo_9", TextMatch::Substring },
+                    { "bp_weapon", TextMatch::Prefix }, { "intproperty", TextMatch::Prefix },
+                    { "CameraSocket", TextMatch::Substring }, { "zz", TextMatch::Substring },
+                });
+            }
+
+            // First keystrokes: one and two character substrings, rare and common
+            if (enabled("TextIndex/query_short_names_1M"))
+            {
+                measureQueries("TextIndex/query_short_names_1M", {
+                    { "q", TextMatch::Substring }, { "e", TextMatch::Substring }, { "zz", TextMatch::Substring },
+                    { "_9", TextMatch::Substring }, { "pr", TextMatch::Substring }, { "X", TextMatch::Substring },
+                });
+            }
+        }
+
+        // One million slot GObjects array behind the synthetic GObjects
+        std::unique_ptr<SyntheticObjectArray> objectArray;
+        if (enabled("EnumerateObjects/synthetic_1M") || enabled("ResyncObjects/synthetic_1M_1pct"))
+        {
+            SyntheticObjectArrayOptions arrayOptions;
+            arrayOptions.slotCount = 1000000;
+            arrayOptions.staleEvery = 997;
+            arrayOptions.baseAddress = OBJECT_ARRAY_BASE;
+            objectArray = std::make_unique<SyntheticObjectArray>(arrayOptions);
+            for (const SyntheticRegion& region : objectArray->GetRegions())
+            {
+                simulated->AddRegion(processId, region.address, region.bytes);
+            }
+            std::vector<uint8_t> header = objectArray->BuildHeader();
+            simulated->Write(processId, expected.GObjects, header.data(), header.size());
+        }
+
+        // Full walk
+        if (enabled("EnumerateObjects/synthetic_1M"))
+        {
+            const SyntheticObjectArray& array = *objectArray;
+            ObjectEnumerator enumerator(dma);
+            ObjectIndex objects;
+            std::string error;
+            simulated->ResetStats();
+            BenchResult result = Measure("EnumerateObjects/synthetic_1M", options.minSeconds, [&]()
+            {
+                enumerator.Enumerate(expected.GObjects, objects, error);
+                return static_cast<size_t>(enumerator.GetLastStats().bytesRead);
+            });
+
+            const std::vector<SyntheticObject>& generated = array.GetObjects();
+            bool allMatch = objects.GetCount() == generated.size();
+            for (size_t i = 0; allMatch && i < generated.size(); ++i)
+            {
+                allMatch = objects.GetSlots()[i] == generated[i].slot && objects.GetAddresses()[i] == generated[i].address
+                    && objects.GetClassSlots()[i] == generated[i].classSlot && objects.GetOuterSlots()[i] == generated[i].outerSlot
+                    && objects.GetNameIndices()[i] == generated[i].nameIndex;
+            }
+
+            const ObjectEnumStats& stats = enumerator.GetLastStats();
+            double runs = static_cast<double>(result.iterations + 1);
+            result.counters["round_trips"] = simulated->GetStats().roundTrips / runs;
+            result.counters["objects"] = static_cast<double>(objects.GetCount());
+            result.counters["spans"] = static_cast<double>(stats.spans);
+            result.counters["index_bytes"] = static_cast<double>(stats.memoryBytes);
+            result.counters["item_ms"] = stats.itemSeconds * 1000.0;
+            result.counters["object_ms"] = stats.objectSeconds * 1000.0;
+            result.counters["link_ms"] = stats.linkSeconds * 1000.0;
+            result.counters["all_match"] = allMatch ? 1.0 : 0.0;
+            results.push_back(result);
+        }
+
+        // Incremental resync after 1% of the slots churned; every iteration applies or reverts the churn
+        if (enabled("ResyncObjects/synthetic_1M_1pct"))
+        {
+            SyntheticChurn churn = objectArray->BuildChurn(100, OBJECT_ARRAY_BASE + 0x100000000);
+            simulated->AddRegion(processId, churn.objects.address, churn.objects.bytes);
+
+            ObjectEnumerator enumerator(dma);
+            auto objects = std::make_shared<ObjectIndex>();
+            std::string error;
+            enumerator.Enumerate(expected.GObjects, *objects, error);
+            uint64_t fullBytes = enumerator.GetLastStats().bytesRead;
+
+            bool applied = false;
+            uint64_t churnedSlots = 0;
+            uint64_t objectBytes = 0;
+            simulated->ResetStats();
+            BenchResult result = Measure("ResyncObjects/synthetic_1M_1pct", options.minSeconds, [&]()
+            {
+                for (const SyntheticWrite& write : applied ? churn.revert : churn.apply)
+                {
+                    simulated->Write(processId, write.address, &write.value, write.size);
+                }
+                applied = !applied;
+
+                auto next = std::make_shared<ObjectIndex>();
+                ObjectDelta delta;
+                enumerator.Resync(expected.GObjects, *objects, *next, delta, error);
+                objects = next;
+                churnedSlots = delta.added.size() + delta.removed.size() + delta.changed.size();
+                objectBytes = enumerator.GetLastStats().bytesRead - static_cast<uint64_t>(enumerator.GetLastStats().slots) * enumerator.GetLayout().itemSize;
+                return static_cast<size_t>(enumerator.GetLastStats().bytesRead);
+            });
+
+            // Reverting brings freed objects back at their old addresses, which a resync does not
+            // re-link; compare against a fresh full walk with the churn applied
+            if (!applied)
+            {
+                for (const SyntheticWrite& write : churn.apply)
+                {
+                    simulated->Write(processId, write.address, &write.value, write.size);
+                }
+                auto next = std::make_shared<ObjectIndex>();
+                ObjectDelta delta;
+                enumerator.Resync(expected.GObjects, *objects, *next, delta, error);
+                objects = next;
+            }
+            ObjectEnumerator reference(dma);
+            ObjectIndex fresh;
+            reference.Enumerate(expected.GObjects, fresh, error);
+            bool allMatch = fresh.GetCount() == objects->GetCount();
+            for (size_t i = 0; allMatch && i < fresh.GetCount(); ++i)
+            {
+                allMatch = fresh.GetSlots()[i] == objects->GetSlots()[i] && fresh.GetAddresses()[i] == objects->GetAddresses()[i]
+                    && fresh.GetClassSlots()[i] == objects->GetClassSlots()[i] && fresh.GetOuterSlots()[i] == objects->GetOuterSlots()[i]
+                    && fresh.GetNameIndices()[i] == objects->GetNameIndices()[i];
+            }
+
+            const ObjectEnumStats& stats = enumerator.GetLastStats();
+            double runs = static_cast<double>(result.iterations + 1);
+            result.counters["round_trips"] = simulated->GetStats().roundTrips / runs;
+            result.counters["churned_slots"] = static_cast<double>(churnedSlots);
+            result.counters["expected_churn"] = static_cast<double>(churn.added + churn.removed + churn.changed);
+            result.counters["changed_pages"] = static_cast<double>(stats.changedPages);
+            result.counters["item_ms"] = stats.itemSeconds * 1000.0;
+            result.counters["merge_ms"] = stats.linkSeconds * 1000.0;
+            result.counters["object_kb"] = objectBytes / 1024.0;
+            result.counters["full_walk_kb"] = fullBytes / 1024.0;
+            result.counters["all_match"] = allMatch ? 1.0 : 0.0;
+            results.push_back(result);
+        }
+
+        // Class and struct layouts of a 28K struct build: breadth-first walk, then the cached load
+        if (enabled("LayoutIndex/synthetic_walk") || enabled("LayoutIndex/cache_load"))
+        {
+            SyntheticReflectionOptions reflectionOptions;
+            reflectionOptions.baseAddress = REFLECTION_BASE;
+            SyntheticReflection reflection(reflectionOptions);
+            for (const SyntheticRegion& region : reflection.GetRegions())
+            {
+                simulated->AddRegion(processId, region.address, region.bytes);
+            }
+
+            LayoutIndexer indexer(dma);
+            LayoutIndex layouts;
+            std::string error;
+            if (enabled("LayoutIndex/synthetic_walk"))
+            {
+                simulated->ResetStats();
+                BenchResult result = Measure("LayoutIndex/synthetic_walk", options.minSeconds, [&]()
+                {
+                    indexer.Index(reflection.GetObjects(), reflection.GetNames(), layouts, error);
+                    return static_cast<size_t>(indexer.GetLastStats().bytesRead);
+                });
+
+                std::map<uint64_t, size_t> byAddress;
+                for (size_t i = 0; i < layouts.GetStructs().size(); ++i)
+                {
+                    byAddress[layouts.GetStructs()[i].address] = i;
+                }
+                bool allMatch = layouts.GetStructs().size() == reflection.GetStructs().size() &&
+                                layouts.GetProperties().size() == reflection.GetPropertyCount();
+                for (const SyntheticStruct& expectedStruct : reflection.GetStructs())
+                {
+                    auto it = byAddress.find(expectedStruct.address);
+                    if (!allMatch || it == byAddress.end())
+                    {
+                        allMatch = false;
+                        break;
+                    }
+                    const LayoutStruct& entry = layouts.GetStructs()[it->second];
+                    uint64_t super = entry.superIndex >= 0 ? layouts.GetStructs()[entry.superIndex].address : 0;
+                    allMatch = super == expectedStruct.superAddress && entry.nameIndex == expectedStruct.nameIndex &&
+                               entry.kindIndex == expectedStruct.kindIndex && entry.size == expectedStruct.size &&
+                               entry.propertyCount == expectedStruct.propertyCount;
+                }
+
+                const LayoutIndexStats& stats = indexer.GetLastStats();
+                double runs = static_cast<double>(result.iterations + 1);
+                result.counters["round_trips"] = simulated->GetStats().roundTrips / runs;
+                result.counters["structs"] = static_cast<double>(stats.structs);
+                result.counters["properties"] = static_cast<double>(stats.properties);
+                result.counters["rounds"] = static_cast<double>(stats.rounds);
+                result.counters["all_match"] = allMatch ? 1.0 : 0.0;
+                results.push_back(result);
+            }
+
+            if (enabled("LayoutIndex/cache_load"))
+            {
+                std::string cacheDirectory = std::filesystem::temp_directory_path().string();
+                BuildFingerprint fingerprint;
+                BuildFingerprint::Read(dma, fingerprint, error);
+                std::string cachePath = LayoutIndexer::GetCachePath(cacheDirectory, fingerprint);
+                std::filesystem::remove(cachePath);
+                indexer.IndexCached(&reflection.GetObjects(), &reflection.GetNames(), cacheDirectory, layouts, error);
+                size_t walkedProperties = layouts.GetProperties().size();
+
+                simulated->ResetStats();
+                BenchResult result = Measure("LayoutIndex/cache_load", options.minSeconds, [&]()
+                {
+                    indexer.IndexCached(nullptr, nullptr, cacheDirectory, layouts, error);
+                    return static_cast<size_t>(std::filesystem::file_size(cachePath));
+                });
+
+                double runs = static_cast<double>(result.iterations + 1);
+                result.counters["round_trips"] = simulated->GetStats().roundTrips / runs;
+                result.counters["structs"] = static_cast<double>(layouts.GetStructs().size());
+                result.counters["from_cache"] = indexer.GetLastStats().fromCache ? 1.0 : 0.0;
+                result.counters["all_match"] = layouts.GetProperties().size() == walkedProperties ? 1.0 : 0.0;
+                results.push_back(result);
+                std::filesystem::remove(cachePath);
+            }
+        }
+
+        // Value scan compare kernels over the in-memory image
+        const std::pair<const char*, ScanValueType> kernelCases[] = {
+            { "ValueScan/compare_int32_exact", ScanValueType::Int32 },
+            { "ValueScan/compare_float_exact", ScanValueType::Float },
+            { "ValueScan/compare_double_exact", ScanValueType::Double },
+            { "ValueScan/compare_int64_exact", ScanValueType::Int64 },
+        };
+        for (const auto& [name, type] : kernelCases)
+        {
+            if (!enabled(name))
+                continue;
+
+            size_t count = image.size() / ValueScanner::GetTypeSize(type);
+            std::vector<uint64_t> mask((count + 63) / 64);
+            BenchResult result = Measure(name, options.minSeconds, [&]()
+            {
+                std::fill(mask.begin(), mask.end(), 0);
+                ValueScanner::CompareValues(type, ScanCompare::Exact, image.data(), nullptr, count, 0x12345678, 0, mask.data());
+                return image.size();
+            });
+            results.push_back(result);
+        }
+
+        // First scan for zero (dense candidates) followed by an unchanged next scan
+        if (enabled("ValueScan/first_next_int32"))
+        {
+            ValueScanner scanner(dma);
+            ValueScanQuery query;
+            std::string error;
+            uint64_t batches = 0;
+
+            simulated->ResetStats();
+            BenchResult result = Measure("ValueScan/first_next_int32", options.minSeconds, [&]()
+            {
+                query.compare = ScanCompare::Exact;
+                scanner.FirstScan(query, error);
+                batches = scanner.GetLastStats().batches;
+                query.compare = ScanCompare::Unchanged;
+                scanner.NextScan(query, error);
+                batches += scanner.GetLastStats().batches;
+                return image.size();
+            });
+
+            BackendStats stats = simulated->GetStats();
+            double runs = static_cast<double>(result.iterations + 1);
+            result.counters["round_trips"] = stats.roundTrips / runs;
+            result.counters["batches"] = static_cast<double>(batches);
+            result.counters["candidates"] = static_cast<double>(scanner.GetCandidateCount());
+            result.counters["storage_bytes"] = static_cast<double>(scanner.GetLastStats().storageBytes);
+            results.push_back(result);
+        }
+
+        // Single vs. batched reads of scattered pointers over a costed link
+        LinkModel link;
+        link.roundTripMicros = options.roundTripMicros;
+        link.bytesPerSecond = 200.0 * 1024 * 1024;
+        link.realTime = options.realTime;
+        simulated->SetLinkModel(link);
+
+        constexpr size_t READ_COUNT = 1024;
+        constexpr size_t READ_STRIDE = 0x3A8;
+        std::vector<uint64_t> values(READ_COUNT);
+
+        auto addReadCounters = [&](BenchResult& result)
+        {
+            BackendStats stats = simulated->GetStats();
+            double runs = static_cast<double>(result.iterations + 1);
+            result.counters["round_trips"] = stats.roundTrips / runs;
+            result.counters["link_ns"] = stats.simulatedNanos / runs;
+        };
+
+        if (enabled("Read/single"))
+        {
+            simulated->ResetStats();
+            BenchResult result = Measure("Read/single", options.minSeconds, [&]()
+            {
+                for (size_t i = 0; i < READ_COUNT; ++i)
+                {
+                    dma.ReadMemory(MODULE_BASE + i * READ_STRIDE, &values[i], sizeof(uint64_t));
+                }
+                return READ_COUNT * sizeof(uint64_t);
+            });
+            addReadCounters(result);
+            results.push_back(result);
+        }
+
+        if (enabled("Read/batched"))
+        {
+            std::vector<ScatterRead> requests;
+            requests.reserve(READ_COUNT);
+            for (size_t i = 0; i < READ_COUNT; ++i)
+            {
+                requests.emplace_back(MODULE_BASE + i * READ_STRIDE, &values[i], sizeof(uint64_t));
+            }
+
+            simulated->ResetStats();
+            BenchResult result = Measure("Read/batched", options.minSeconds, [&]()
+            {
+                return dma.ReadMemoryBatch(requests);
+            });
+            addReadCounters(result);
+            results.push_back(result);
+        }
+
+        dma.Shutdown();
+        return true;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    BenchOptions options;
+    try
+    {
+        std::string unknown = ParseArgs(argc, argv, options);
+        if (!unknown.empty())
+        {
+            std::cerr << "Unknown argument: " << unknown << std::endl;
+            PrintUsage();
+            return 1;
+        }
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << "Invalid argument value: " << e.what() << std::endl;
+        return 1;
+    }
+
+    if (options.imageSizeMB == 0)
+    {
+        std::cerr << "--size-mb must be at least 1" << std::endl;
+        return 1;
+    }
+
+    std::vector<BenchResult> results;
+    {
+        // Scanner progress logging would drown the results
+        ScopedSilence silence;
+        if (!RunBenchmarks(options, results))
+        {
+            return 1;
+        }
+    }
+
+    // Human-readable table
+    std::cout << std::left << std::setw(44) << "Benchmark" << std::right
+              << std::setw(12) << "Iterations" << std::setw(16) << "ns/iter" << std::setw(12) << "MB/s" << std::endl;
+    for (const auto& result : results)
+    {
+        std::cout << std::left << std::setw(44) << result.name << std::right
+                  << std::setw(12) << result.iterations
+                  << std::setw(16) << std::fixed << std::setprecision(0) << result.nanosPerIteration
+                  << std::setw(12) << std::setprecision(1) << result.bytesPerSecond / (1024.0 * 1024.0);
+        for (const auto& [key, value] : result.counters)
+        {
+            std::cout << "  " << key << "=" << std::setprecision(0) << value;
+        }
+        std::cout << std::endl;
+    }
+
+    if (!options.jsonPath.empty())
+    {
+        JsonWriter json(true);
+        json.BeginObject();
+        json.UInt("schema_version", 1);
+        json.UInt("synthetic_image_bytes", static_cast<uint64_t>(options.imageSizeMB) * 1024 * 1024);
+        json.Double("round_trip_us", options.roundTripMicros);
+        json.BeginArray("benchmarks");
+        for (const auto& result : results)
+        {
+            json.BeginObject();
+            json.String("name", result.name);
+            json.UInt("iterations", result.iterations);
+            json.Double("ns_per_iter", result.nanosPerIteration);
+            json.Double("bytes_per_second", result.bytesPerSecond);
+            json.BeginObject("counters");
+            for (const auto& [key, value] : result.counters)
+            {
+                json.Double(key.c_str(), value);
+            }
+            json.EndObject();
+            json.EndObject();
+        }
+        json.EndArray();
+        json.EndObject();
+
+        std::ofstream file(options.jsonPath);
+        if (!file.is_open())
+        {
+            std::cerr << "Failed to open " << options.jsonPath << std::endl;
+            return 1;
+        }
+        file << json.Str() << std::endl;
+        std::cout << "Results written to " << options.jsonPath << std::endl;
+    }
+
+    return 0;
+}
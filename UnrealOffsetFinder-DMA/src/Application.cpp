@@ -1,13 +1,79 @@
 #include "Application.h"
 #include "UI/UIManager.h"
 #include "DMA/DMAManager.h"
+#include "Core/Trace.h"
 #include <imgui-SFML.h>
 #include <imgui.h>
 #include <fstream>
+#include <iomanip>
 #include <iostream>
+#include <sstream>
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <Windows.h>
+#else
+#include <time.h>
+#endif
+
+namespace
+{
+#ifdef _WIN32
+    /**
+     * @brief Convert kernel and user FILETIMEs (100 ns units) to seconds of CPU time
+     */
+    double ToSeconds(const FILETIME& kernel, const FILETIME& user)
+    {
+        uint64_t k = (static_cast<uint64_t>(kernel.dwHighDateTime) << 32) | kernel.dwLowDateTime;
+        uint64_t u = (static_cast<uint64_t>(user.dwHighDateTime) << 32) | user.dwLowDateTime;
+        return static_cast<double>(k + u) * 1e-7;
+    }
+#endif
+
+    /**
+     * @brief Get the CPU time (user + kernel) used by the whole process so far
+     * @return Seconds
+     */
+    double GetProcessCpuSeconds()
+    {
+#ifdef _WIN32
+        FILETIME creation, exit, kernel, user;
+        if (!GetProcessTimes(GetCurrentProcess(), &creation, &exit, &kernel, &user))
+            return 0.0;
+        return ToSeconds(kernel, user);
+#else
+        timespec now{};
+        clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &now);
+        return static_cast<double>(now.tv_sec) + now.tv_nsec * 1e-9;
+#endif
+    }
+
+    /**
+     * @brief Get the CPU time (user + kernel) used by the calling thread so far
+     * @return Seconds
+     */
+    double GetThreadCpuSeconds()
+    {
+#ifdef _WIN32
+        FILETIME creation, exit, kernel, user;
+        if (!GetThreadTimes(GetCurrentThread(), &creation, &exit, &kernel, &user))
+            return 0.0;
+        return ToSeconds(kernel, user);
+#else
+        timespec now{};
+        clock_gettime(CLOCK_THREAD_CPUTIME_ID, &now);
+        return static_cast<double>(now.tv_sec) + now.tv_nsec * 1e-9;
+#endif
+    }
+}
 
 Application::Application()
     : m_isRunning(false)
+    , m_renderedStateVersion(0)
+    , m_busy(false)
+    , m_busyProcessCpuStart(0.0)
+    , m_busyRenderCpu(0.0)
+    , m_busyFrames(0)
 {
 }
 
@@ -28,14 +94,37 @@ int Application::Run()
     
     while (m_isRunning && m_window->isOpen())
     {
-        sf::Time deltaTime = m_clock.restart();
-        float dt = deltaTime.asSeconds();
+        bool hadEvents = HandleEvents();
+
+        // Completed operations are delivered even while no frame is drawn
+        if (m_dmaManager)
+        {
+            m_dmaManager->Update();
+        }
+
+        bool busy = m_dmaManager && m_dmaManager->HasPendingOperations();
+        UpdateRenderStats(busy);
 
-        HandleEvents();
+        if (!ShouldRender(hadEvents))
+        {
+            sf::sleep(sf::milliseconds(IDLE_POLL_MS));
+            continue;
+        }
 
-        Update(dt);
+        double frameCpuStart = GetThreadCpuSeconds();
+        Update(m_frameClock.restart().asSeconds());
 
         Render();
+
+        if (m_dmaManager)
+        {
+            m_renderedStateVersion = m_dmaManager->GetStateVersion();
+        }
+        if (busy)
+        {
+            m_busyFrames++;
+            m_busyRenderCpu += GetThreadCpuSeconds() - frameCpuStart;
+        }
     }
 
     return 0;
@@ -70,6 +159,8 @@ bool Application::Initialize()
 
         InitializeStyle();
 
+        TraceRecorder::Get().SetCurrentThreadName("UI");
+
         m_uiManager = std::make_unique<UIManager>();
         m_dmaManager = std::make_unique<DMAManager>();
 
@@ -97,11 +188,14 @@ bool Application::Initialize()
     }
 }
 
-void Application::HandleEvents()
+bool Application::HandleEvents()
 {
+    bool hadEvents = false;
     sf::Event event;
     while (m_window->pollEvent(event))
     {
+        hadEvents = true;
+
         // Let ImGui handle the event first
         ImGui::SFML::ProcessEvent(event);
 
@@ -122,20 +216,81 @@ void Application::HandleEvents()
             break;
         }
     }
+
+    if (hadEvents)
+    {
+        m_inputClock.restart();
+    }
+    return hadEvents;
 }
 
-void Application::Update(float deltaTime)
+bool Application::ShouldRender(bool hadEvents)
 {
-    ImGui::SFML::Update(*m_window, sf::seconds(deltaTime));
+    float sinceFrame = m_frameClock.getElapsedTime().asSeconds();
 
+    // ImGui needs a few frames after input to settle hover, focus and animations
+    if (hadEvents || m_inputClock.getElapsedTime().asSeconds() < INPUT_ACTIVE_TIME)
+        return true;
+
+    if (m_dmaManager && m_dmaManager->GetStateVersion() != m_renderedStateVersion)
+        return true;
+
+    if (m_uiManager && m_uiManager->WantsRedraw())
+        return true;
+
+    if (m_busy && sinceFrame >= BUSY_FRAME_INTERVAL)
+        return true;
+
+    return sinceFrame >= IDLE_FRAME_INTERVAL;
+}
+
+void Application::UpdateRenderStats(bool busy)
+{
+    if (busy == m_busy)
+        return;
+
+    m_busy = busy;
+    if (busy)
+    {
+        m_busyClock.restart();
+        m_busyProcessCpuStart = GetProcessCpuSeconds();
+        m_busyRenderCpu = 0.0;
+        m_busyFrames = 0;
+        return;
+    }
+
+    // Compare against what the old fixed-rate loop would have drawn meanwhile; the frames that were
+    // drawn give the CPU cost of one
+    float seconds = m_busyClock.getElapsedTime().asSeconds();
+    double processCpu = GetProcessCpuSeconds() - m_busyProcessCpuStart;
+    uint64_t fixedFrames = static_cast<uint64_t>(seconds * TARGET_FPS);
+    if (seconds < 1.0f || fixedFrames == 0 || m_busyFrames == 0)
+        return;
+
+    uint64_t skipped = fixedFrames > m_busyFrames ? fixedFrames - m_busyFrames : 0;
+    double fixedRenderCpu = m_busyRenderCpu / m_busyFrames * fixedFrames;
+    std::ostringstream report;
+    report << std::fixed << std::setprecision(1)
+           << "Rendered " << m_busyFrames << " frames during " << seconds << "s of operations ("
+           << skipped << " of " << fixedFrames << " frames at " << TARGET_FPS << " FPS skipped, "
+           << (100.0 * skipped / fixedFrames) << "%)" << std::setprecision(2)
+           << "; render CPU " << m_busyRenderCpu << "s vs. " << fixedRenderCpu << "s at a fixed "
+           << TARGET_FPS << " FPS (" << (fixedRenderCpu - m_busyRenderCpu) << "s saved); process CPU "
+           << processCpu << "s";
+    std::cout << report.str() << std::endl;
     if (m_uiManager)
     {
-        m_uiManager->Update(deltaTime);
+        m_uiManager->AddLogMessage("[INFO] " + report.str());
     }
+}
 
-    if (m_dmaManager)
+void Application::Update(float deltaTime)
+{
+    ImGui::SFML::Update(*m_window, sf::seconds(deltaTime));
+
+    if (m_uiManager)
     {
-        m_dmaManager->Update(deltaTime);
+        m_uiManager->Update(deltaTime);
     }
 }
 
@@ -155,6 +310,12 @@ void Application::Render()
 
 void Application::Shutdown()
 {
+    // The UI reads through the DMA manager from background threads (memory viewer)
+    if (m_uiManager)
+    {
+        m_uiManager->SetDMAManager(nullptr);
+    }
+
     if (m_dmaManager)
     {
         m_dmaManager->Shutdown();
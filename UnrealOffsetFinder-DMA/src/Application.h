@@ -2,6 +2,7 @@
 
 #include <SFML/Graphics.hpp>
 #include <memory>
+#include <cstdint>
 
 // Forward declarations
 class UIManager;
@@ -42,8 +43,22 @@ private:
 
     /**
      * @brief Handle SFML events (window close, input, etc.)
+     * @return true if any event was received
      */
-    void HandleEvents();
+    bool HandleEvents();
+
+    /**
+     * @brief Decide whether the next loop iteration renders a frame
+     * @param hadEvents Whether input or window events arrived this iteration
+     * @return true to render now, false to sleep
+     */
+    bool ShouldRender(bool hadEvents);
+
+    /**
+     * @brief Track rendering during background operations and log the CPU saved once they finish
+     * @param busy Whether operations are pending
+     */
+    void UpdateRenderStats(bool busy);
 
     /**
      * @brief Update application state
@@ -74,7 +89,6 @@ private:
 private:
     // Core SFML components
     std::unique_ptr<sf::RenderWindow> m_window;     ///< Main application window
-    sf::Clock m_clock;                              ///< Clock for delta time calculation
     
     // Application subsystems
     std::unique_ptr<UIManager> m_uiManager;         ///< UI management system
@@ -83,9 +97,23 @@ private:
     // Application state
     bool m_isRunning;                               ///< Application running state
     
+    // Idle-aware rendering
+    sf::Clock m_frameClock;                         ///< Time since the last rendered frame
+    sf::Clock m_inputClock;                         ///< Time since the last input/window event
+    uint64_t m_renderedStateVersion;                ///< DMA state version shown by the last frame
+    bool m_busy;                                    ///< Operations were pending during the last iteration
+    sf::Clock m_busyClock;                          ///< Time since operations started
+    double m_busyProcessCpuStart;                   ///< Process CPU time when operations started (seconds)
+    double m_busyRenderCpu;                         ///< UI thread CPU spent on frames since operations started (seconds)
+    uint64_t m_busyFrames;                          ///< Frames rendered since operations started
+    
     // Window configuration constants
     static constexpr unsigned int DEFAULT_WINDOW_WIDTH = 1200;   ///< Default window width
     static constexpr unsigned int DEFAULT_WINDOW_HEIGHT = 800;   ///< Default window height  
     static constexpr const char* WINDOW_TITLE = "Unreal Offset Finder - DMA"; ///< Application title
     static constexpr unsigned int TARGET_FPS = 60;               ///< Target framerate
+    static constexpr float INPUT_ACTIVE_TIME = 0.5f;             ///< Render at full rate this long after input (seconds)
+    static constexpr float BUSY_FRAME_INTERVAL = 1.0f / 15.0f;   ///< Frame interval while operations run (spinner, progress)
+    static constexpr float IDLE_FRAME_INTERVAL = 1.0f;           ///< Frame interval when nothing changes
+    static constexpr int IDLE_POLL_MS = 10;                      ///< Sleep between event polls when not rendering
 }; 
\ No newline at end of file
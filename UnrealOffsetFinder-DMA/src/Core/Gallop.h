@@ -0,0 +1,27 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief lower_bound for a value expected close to first (doubling steps, then a binary search)
+ * @param first Start of an ascending range
+ * @param last End of the range
+ * @param value Value to find
+ * @return First element not less than value, last if none
+ */
+inline const uint32_t* Gallop(const uint32_t* first, const uint32_t* last, uint32_t value)
+{
+    if (first == last || *first >= value)
+    {
+        return first;
+    }
+    size_t count = static_cast<size_t>(last - first);
+    size_t step = 1;
+    while (step < count && first[step] < value)
+    {
+        step *= 2;
+    }
+    return std::lower_bound(first + step / 2 + 1, first + std::min(step + 1, count), value);
+}
@@ -0,0 +1,177 @@
+#include "JsonWriter.h"
+#include <cmath>
+#include <cstdio>
+
+JsonWriter::JsonWriter(bool pretty)
+    : m_pretty(pretty)
+{
+}
+
+JsonWriter& JsonWriter::BeginObject(const char* key)
+{
+    BeginValue(key);
+    m_stream << '{';
+    m_hasElements.push_back(false);
+    return *this;
+}
+
+JsonWriter& JsonWriter::EndObject()
+{
+    bool hadElements = !m_hasElements.empty() && m_hasElements.back();
+    if (!m_hasElements.empty())
+    {
+        m_hasElements.pop_back();
+    }
+    if (hadElements)
+    {
+        Indent();
+    }
+    m_stream << '}';
+    return *this;
+}
+
+JsonWriter& JsonWriter::BeginArray(const char* key)
+{
+    BeginValue(key);
+    m_stream << '[';
+    m_hasElements.push_back(false);
+    return *this;
+}
+
+JsonWriter& JsonWriter::EndArray()
+{
+    bool hadElements = !m_hasElements.empty() && m_hasElements.back();
+    if (!m_hasElements.empty())
+    {
+        m_hasElements.pop_back();
+    }
+    if (hadElements)
+    {
+        Indent();
+    }
+    m_stream << ']';
+    return *this;
+}
+
+JsonWriter& JsonWriter::String(const char* key, const std::string& value)
+{
+    BeginValue(key);
+    m_stream << '"' << Escape(value) << '"';
+    return *this;
+}
+
+JsonWriter& JsonWriter::Int(const char* key, int64_t value)
+{
+    BeginValue(key);
+    m_stream << value;
+    return *this;
+}
+
+JsonWriter& JsonWriter::UInt(const char* key, uint64_t value)
+{
+    BeginValue(key);
+    m_stream << value;
+    return *this;
+}
+
+JsonWriter& JsonWriter::Double(const char* key, double value)
+{
+    BeginValue(key);
+    if (!std::isfinite(value))
+    {
+        m_stream << "null";
+        return *this;
+    }
+
+    char buffer[64];
+    std::snprintf(buffer, sizeof(buffer), "%.15g", value);
+    m_stream << buffer;
+    return *this;
+}
+
+JsonWriter& JsonWriter::Bool(const char* key, bool value)
+{
+    BeginValue(key);
+    m_stream << (value ? "true" : "false");
+    return *this;
+}
+
+JsonWriter& JsonWriter::Null(const char* key)
+{
+    BeginValue(key);
+    m_stream << "null";
+    return *this;
+}
+
+std::string JsonWriter::Str() const
+{
+    return m_stream.str();
+}
+
+std::string JsonWriter::Escape(const std::string& value)
+{
+    std::string escaped;
+    escaped.reserve(value.size() + 8);
+
+    for (char c : value)
+    {
+        switch (c)
+        {
+        case '"':  escaped += "\\\""; break;
+        case '\\': escaped += "\\\\"; break;
+        case '\n': escaped += "\\n"; break;
+        case '\r': escaped += "\\r"; break;
+        case '\t': escaped += "\\t"; break;
+        default:
+            if (static_cast<unsigned char>(c) < 0x20)
+            {
+                char buffer[8];
+                std::snprintf(buffer, sizeof(buffer), "\\u%04x", static_cast<unsigned char>(c));
+                escaped += buffer;
+            }
+            else
+            {
+                escaped += c;
+            }
+            break;
+        }
+    }
+
+    return escaped;
+}
+
+void JsonWriter::BeginValue(const char* key)
+{
+    if (!m_hasElements.empty())
+    {
+        if (m_hasElements.back())
+        {
+            m_stream << ',';
+        }
+        m_hasElements.back() = true;
+        Indent();
+    }
+
+    if (key)
+    {
+        m_stream << '"' << Escape(key) << "\":";
+        if (m_pretty)
+        {
+            m_stream << ' ';
+        }
+    }
+}
+
+void JsonWriter::Indent()
+{
+    if (!m_pretty)
+    {
+        return;
+    }
+
+    m_stream << '\n';
+    for (size_t i = 0; i < m_hasElements.size(); ++i)
+    {
+        m_stream << "  ";
+    }
+}
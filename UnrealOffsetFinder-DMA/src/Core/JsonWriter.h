@@ -0,0 +1,107 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <sstream>
+
+/**
+ * @class JsonWriter
+ * @brief Minimal streaming JSON writer
+ *
+ * Used for trace export and machine-readable tool output. Keeps track of
+ * nesting so callers never have to place commas by hand.
+ */
+class JsonWriter
+{
+public:
+    /**
+     * @brief Constructor
+     * @param pretty Whether to emit newlines and indentation
+     */
+    explicit JsonWriter(bool pretty = false);
+
+    /**
+     * @brief Begin an object, optionally as the value of a key
+     * @param key Key name when inside an object, nullptr otherwise
+     */
+    JsonWriter& BeginObject(const char* key = nullptr);
+
+    /**
+     * @brief End the current object
+     */
+    JsonWriter& EndObject();
+
+    /**
+     * @brief Begin an array, optionally as the value of a key
+     * @param key Key name when inside an object, nullptr otherwise
+     */
+    JsonWriter& BeginArray(const char* key = nullptr);
+
+    /**
+     * @brief End the current array
+     */
+    JsonWriter& EndArray();
+
+    /**
+     * @brief Write a string value
+     * @param key Key name when inside an object, nullptr for array elements
+     * @param value String value (escaped on output)
+     */
+    JsonWriter& String(const char* key, const std::string& value);
+
+    /**
+     * @brief Write a signed integer value
+     */
+    JsonWriter& Int(const char* key, int64_t value);
+
+    /**
+     * @brief Write an unsigned integer value
+     */
+    JsonWriter& UInt(const char* key, uint64_t value);
+
+    /**
+     * @brief Write a floating point value
+     */
+    JsonWriter& Double(const char* key, double value);
+
+    /**
+     * @brief Write a boolean value
+     */
+    JsonWriter& Bool(const char* key, bool value);
+
+    /**
+     * @brief Write a null value
+     */
+    JsonWriter& Null(const char* key);
+
+    /**
+     * @brief Get the JSON document written so far
+     * @return JSON text
+     */
+    std::string Str() const;
+
+    /**
+     * @brief Escape a string for inclusion in a JSON document
+     * @param value Raw string
+     * @return Escaped string without surrounding quotes
+     */
+    static std::string Escape(const std::string& value);
+
+private:
+    /**
+     * @brief Emit separator, indentation and key before a value
+     * @param key Key name, nullptr inside arrays
+     */
+    void BeginValue(const char* key);
+
+    /**
+     * @brief Emit newline and indentation for the current depth
+     */
+    void Indent();
+
+private:
+    std::ostringstream m_stream;        ///< Output buffer
+    std::vector<bool> m_hasElements;    ///< Per nesting level: whether a value was already written
+    bool m_pretty;                      ///< Pretty-print output
+};
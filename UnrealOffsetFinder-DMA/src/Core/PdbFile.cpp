@@ -0,0 +1,283 @@
+#include "PdbFile.h"
+#include "StringUtils.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <vector>
+
+namespace
+{
+    constexpr char MSF_MAGIC[] = "Microsoft C/C++ MSF 7.00\r\n\x1A" "DS\0\0";
+    constexpr size_t MSF_MAGIC_SIZE = 32;
+    constexpr uint32_t NIL_STREAM = 0xFFFFFFFF;
+    constexpr uint32_t PDB_INFO_STREAM = 1;
+    constexpr uint32_t DBI_STREAM = 3;
+    constexpr size_t DBI_HEADER_SIZE = 64;
+    constexpr size_t SECTION_HEADER_DEBUG_STREAM = 5;   // Index into the DBI optional debug header
+    constexpr uint16_t S_LDATA32 = 0x110C;
+    constexpr uint16_t S_GDATA32 = 0x110D;
+    constexpr uint16_t S_PUB32 = 0x110E;
+    constexpr uint32_t CVPSF_FUNCTION = 0x2;
+
+    template<typename T>
+    T ReadAt(const uint8_t* data, size_t offset)
+    {
+        T value;
+        std::memcpy(&value, data + offset, sizeof(T));
+        return value;
+    }
+
+    /**
+     * @class MsfReader
+     * @brief Reads whole streams out of an MSF 7.0 container
+     */
+    class MsfReader
+    {
+    public:
+        bool Open(const std::string& filename, std::string& error)
+        {
+            m_file.open(filename, std::ios::binary);
+            if (!m_file.is_open())
+            {
+                error = "Failed to open PDB: " + filename;
+                return false;
+            }
+
+            uint8_t superBlock[56] = {};
+            if (!m_file.read(reinterpret_cast<char*>(superBlock), sizeof(superBlock)) ||
+                std::memcmp(superBlock, MSF_MAGIC, MSF_MAGIC_SIZE) != 0)
+            {
+                error = "Not an MSF 7.0 PDB: " + filename;
+                return false;
+            }
+
+            m_blockSize = ReadAt<uint32_t>(superBlock, 32);
+            m_blockCount = ReadAt<uint32_t>(superBlock, 40);
+            uint32_t directoryBytes = ReadAt<uint32_t>(superBlock, 44);
+            uint32_t blockMapBlock = ReadAt<uint32_t>(superBlock, 52);
+            if (m_blockSize < 512 || m_blockSize > 0x10000 || (m_blockSize & (m_blockSize - 1)) != 0 ||
+                directoryBytes < 4 || directoryBytes > PdbFile::MAX_STREAM_SIZE)
+            {
+                error = "Corrupt MSF super block: " + filename;
+                return false;
+            }
+
+            // Block map -> directory blocks -> directory (stream count, sizes, then each stream's blocks)
+            std::vector<uint32_t> directoryBlocks(BlocksFor(directoryBytes));
+            std::vector<uint8_t> directory;
+            if (!ReadBlocks(std::vector<uint32_t>{ blockMapBlock }, directoryBlocks.size() * 4, directory))
+            {
+                error = "Unreadable MSF block map: " + filename;
+                return false;
+            }
+            std::memcpy(directoryBlocks.data(), directory.data(), directoryBlocks.size() * 4);
+            if (!ReadBlocks(directoryBlocks, directoryBytes, directory))
+            {
+                error = "Unreadable MSF stream directory: " + filename;
+                return false;
+            }
+
+            uint32_t streamCount = ReadAt<uint32_t>(directory.data(), 0);
+            size_t position = 4 + static_cast<size_t>(streamCount) * 4;
+            if (streamCount > directoryBytes / 4 || position > directory.size())
+            {
+                error = "Corrupt MSF stream directory: " + filename;
+                return false;
+            }
+
+            m_streamSizes.resize(streamCount);
+            m_streamBlocks.resize(streamCount);
+            for (uint32_t i = 0; i < streamCount; ++i)
+            {
+                uint32_t size = ReadAt<uint32_t>(directory.data(), 4 + static_cast<size_t>(i) * 4);
+                m_streamSizes[i] = size;
+                size_t blocks = size == NIL_STREAM ? 0 : BlocksFor(size);
+                if (position + blocks * 4 > directory.size())
+                {
+                    error = "Corrupt MSF stream directory: " + filename;
+                    return false;
+                }
+                m_streamBlocks[i].resize(blocks);
+                std::memcpy(m_streamBlocks[i].data(), directory.data() + position, blocks * 4);
+                position += blocks * 4;
+            }
+            return true;
+        }
+
+        bool ReadStream(uint32_t index, std::vector<uint8_t>& data)
+        {
+            if (index >= m_streamSizes.size() || m_streamSizes[index] == NIL_STREAM || m_streamSizes[index] > PdbFile::MAX_STREAM_SIZE)
+            {
+                data.clear();
+                return false;
+            }
+            return ReadBlocks(m_streamBlocks[index], m_streamSizes[index], data);
+        }
+
+    private:
+        size_t BlocksFor(uint32_t bytes) const
+        {
+            return (static_cast<size_t>(bytes) + m_blockSize - 1) / m_blockSize;
+        }
+
+        bool ReadBlocks(const std::vector<uint32_t>& blocks, size_t size, std::vector<uint8_t>& data)
+        {
+            data.assign(size, 0);
+            if (blocks.size() < BlocksFor(static_cast<uint32_t>(size)))
+                return false;
+
+            // Streams are mostly laid out in consecutive blocks; each run is one read
+            size_t done = 0;
+            for (size_t i = 0; done < size;)
+            {
+                size_t run = 1;
+                while (i + run < blocks.size() && blocks[i + run] == blocks[i] + run && done + run * m_blockSize < size)
+                {
+                    run++;
+                }
+                if (blocks[i] >= m_blockCount)
+                    return false;
+
+                size_t bytes = std::min(run * m_blockSize, size - done);
+                m_file.seekg(static_cast<std::streamoff>(blocks[i]) * m_blockSize);
+                if (!m_file.read(reinterpret_cast<char*>(data.data() + done), static_cast<std::streamsize>(bytes)))
+                    return false;
+                done += bytes;
+                i += run;
+            }
+            return true;
+        }
+
+    private:
+        std::ifstream m_file;                               ///< PDB file
+        uint32_t m_blockSize = 0;                           ///< MSF block size
+        uint32_t m_blockCount = 0;                          ///< Blocks in the file
+        std::vector<uint32_t> m_streamSizes;                ///< Size of each stream (NIL_STREAM if absent)
+        std::vector<std::vector<uint32_t>> m_streamBlocks;  ///< Blocks of each stream
+    };
+}
+
+bool PdbFile::Load(const std::string& filename, std::string& error)
+{
+    m_symbols.clear();
+    m_guid = {};
+    m_age = 0;
+
+    MsfReader msf;
+    if (!msf.Open(filename, error))
+    {
+        return false;
+    }
+
+    // PDB info stream: version, signature, age, GUID
+    std::vector<uint8_t> info;
+    if (!msf.ReadStream(PDB_INFO_STREAM, info) || info.size() < 28)
+    {
+        error = "PDB has no info stream: " + filename;
+        return false;
+    }
+    std::memcpy(m_guid.data(), info.data() + 12, m_guid.size());
+
+    // DBI stream: age, symbol record stream, and after the substreams the optional debug header
+    std::vector<uint8_t> dbi;
+    if (!msf.ReadStream(DBI_STREAM, dbi) || dbi.size() < DBI_HEADER_SIZE)
+    {
+        error = "PDB has no DBI stream: " + filename;
+        return false;
+    }
+    m_age = ReadAt<uint32_t>(dbi.data(), 8);
+    uint16_t symbolStream = ReadAt<uint16_t>(dbi.data(), 20);
+    size_t debugHeader = DBI_HEADER_SIZE;
+    for (size_t field : { 24, 28, 32, 36, 40, 52 })
+    {
+        debugHeader += static_cast<uint32_t>(ReadAt<int32_t>(dbi.data(), field));
+    }
+    int32_t debugHeaderSize = ReadAt<int32_t>(dbi.data(), 48);
+    if (debugHeaderSize < static_cast<int32_t>((SECTION_HEADER_DEBUG_STREAM + 1) * 2) ||
+        debugHeader + static_cast<size_t>(debugHeaderSize) > dbi.size())
+    {
+        error = "PDB has no section header stream: " + filename;
+        return false;
+    }
+    uint16_t sectionStream = ReadAt<uint16_t>(dbi.data(), debugHeader + SECTION_HEADER_DEBUG_STREAM * 2);
+
+    // Symbols are addressed as section:offset; sections are numbered from 1
+    std::vector<uint8_t> sectionHeaders;
+    if (sectionStream == 0xFFFF || !msf.ReadStream(sectionStream, sectionHeaders))
+    {
+        error = "PDB has no section header stream: " + filename;
+        return false;
+    }
+    std::vector<uint32_t> sectionRvas;
+    for (size_t entry = 0; entry + 40 <= sectionHeaders.size(); entry += 40)
+    {
+        sectionRvas.push_back(ReadAt<uint32_t>(sectionHeaders.data(), entry + 12));
+    }
+
+    std::vector<uint8_t> records;
+    if (symbolStream == 0xFFFF || !msf.ReadStream(symbolStream, records))
+    {
+        error = "PDB has no symbol record stream: " + filename;
+        return false;
+    }
+
+    // Records: length (excluding itself), kind, then for data and publics: flags/type, offset, section, name
+    for (size_t position = 0; position + 4 <= records.size();)
+    {
+        uint16_t length = ReadAt<uint16_t>(records.data(), position);
+        uint16_t kind = ReadAt<uint16_t>(records.data(), position + 2);
+        size_t next = position + 2 + length;
+        if (length < 2 || next > records.size())
+        {
+            break;
+        }
+
+        bool data = kind == S_GDATA32 || kind == S_LDATA32 ||
+                    (kind == S_PUB32 && (ReadAt<uint32_t>(records.data(), position + 4) & CVPSF_FUNCTION) == 0);
+        if (data && length >= 14)
+        {
+            uint32_t offset = ReadAt<uint32_t>(records.data(), position + 8);
+            uint16_t section = ReadAt<uint16_t>(records.data(), position + 12);
+            const char* text = reinterpret_cast<const char*>(records.data() + position + 14);
+            std::string name(text, strnlen(text, next - position - 14));
+            if (section != 0 && section <= sectionRvas.size() && !name.empty())
+            {
+                uint32_t rva = sectionRvas[section - 1] + offset;
+                std::string plain = GetDecoratedGlobalName(name);
+                m_symbols.emplace(std::move(name), rva);
+                if (!plain.empty())
+                {
+                    m_symbols.emplace(std::move(plain), rva);
+                }
+            }
+        }
+        position = next;
+    }
+    return true;
+}
+
+bool PdbFile::Matches(const PeCodeView& codeView) const
+{
+    return codeView.guid == m_guid && codeView.age == m_age;
+}
+
+bool PdbFile::FindSymbol(const std::string& name, uint32_t& rva) const
+{
+    auto it = m_symbols.find(name);
+    if (it == m_symbols.end())
+    {
+        return false;
+    }
+    rva = it->second;
+    return true;
+}
+
+std::string PdbFile::FormatId(const std::array<uint8_t, 16>& guid, uint32_t age)
+{
+    char text[48];
+    snprintf(text, sizeof(text), "%08X%04X%04X%02X%02X%02X%02X%02X%02X%02X%02X%X",
+             ReadAt<uint32_t>(guid.data(), 0), ReadAt<uint16_t>(guid.data(), 4), ReadAt<uint16_t>(guid.data(), 6),
+             guid[8], guid[9], guid[10], guid[11], guid[12], guid[13], guid[14], guid[15], age);
+    return text;
+}
@@ -0,0 +1,80 @@
+#pragma once
+
+#include "PeImage.h"
+#include <array>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+
+/**
+ * @class PdbFile
+ * @brief Global data symbols of a PDB on disk
+ *
+ * Reads just enough of the MSF container to resolve variables: the PDB
+ * info stream (GUID and age, to match the image's CodeView record), the
+ * DBI stream (which streams hold the symbols and section headers), the
+ * section headers and the symbol record stream. Public symbols that are
+ * not functions and global/static data symbols are indexed by name with
+ * their RVA; decorated C++ globals ("?GWorld@@3...") are also indexed
+ * under their plain name. No symbol server or DIA is involved, so it works
+ * the same on Linux builds.
+ */
+class PdbFile
+{
+public:
+    /**
+     * @brief Load a PDB (replaces the previous contents)
+     * @param filename PDB file
+     * @param error Receives the reason on failure
+     * @return true if successful, false otherwise
+     */
+    bool Load(const std::string& filename, std::string& error);
+
+    /**
+     * @brief Check whether the PDB belongs to an image
+     * @param codeView CodeView record of the image
+     * @return true if GUID and age match
+     */
+    bool Matches(const PeCodeView& codeView) const;
+
+    /**
+     * @brief Look up a data symbol
+     * @param name Plain or decorated symbol name
+     * @param rva Receives the symbol's RVA
+     * @return true if found
+     */
+    bool FindSymbol(const std::string& name, uint32_t& rva) const;
+
+    /**
+     * @brief Get the number of indexed names
+     * @return Names
+     */
+    size_t GetSymbolCount() const { return m_symbols.size(); }
+
+    /**
+     * @brief Get the PDB signature GUID
+     * @return GUID bytes as stored
+     */
+    const std::array<uint8_t, 16>& GetGuid() const { return m_guid; }
+
+    /**
+     * @brief Get the PDB age (DBI stream)
+     * @return Age
+     */
+    uint32_t GetAge() const { return m_age; }
+
+    /**
+     * @brief Format a GUID and age as a symbol store key ("3F2504E04F8941D39A0C0305E82C33011")
+     * @param guid GUID bytes as stored
+     * @param age Age
+     * @return Key
+     */
+    static std::string FormatId(const std::array<uint8_t, 16>& guid, uint32_t age);
+
+    static constexpr uint32_t MAX_STREAM_SIZE = 0x40000000;    ///< Sanity limit on a single stream (1 GB)
+
+private:
+    std::array<uint8_t, 16> m_guid{};                       ///< PDB info stream GUID
+    uint32_t m_age = 0;                                     ///< DBI age
+    std::unordered_map<std::string, uint32_t> m_symbols;    ///< Data symbol RVAs by name
+};
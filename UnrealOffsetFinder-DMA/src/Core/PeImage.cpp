@@ -0,0 +1,270 @@
+#include "PeImage.h"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+namespace
+{
+    template<typename T>
+    T ReadAt(const uint8_t* data, size_t offset)
+    {
+        T value;
+        std::memcpy(&value, data + offset, sizeof(T));
+        return value;
+    }
+}
+
+bool PeImage::ParseHeaders(const uint8_t* data, size_t size, PeHeaders& headers)
+{
+    if (size < 0x40 || data[0] != 'M' || data[1] != 'Z')
+    {
+        return false;
+    }
+
+    uint32_t nt = ReadAt<uint32_t>(data, 0x3C);
+    if (nt > size || size - nt < 24 || std::memcmp(data + nt, "PE\0\0", 4) != 0)
+    {
+        return false;
+    }
+
+    // IMAGE_FILE_HEADER
+    size_t file = nt + 4;
+    uint16_t sectionCount = ReadAt<uint16_t>(data, file + 2);
+    uint16_t optionalSize = ReadAt<uint16_t>(data, file + 16);
+    headers.timeDateStamp = ReadAt<uint32_t>(data, file + 4);
+
+    // IMAGE_OPTIONAL_HEADER32/64
+    size_t opt = file + 20;
+    if (optionalSize < 64 || opt + optionalSize > size || sectionCount > MAX_SECTIONS)
+    {
+        return false;
+    }
+
+    uint16_t magic = ReadAt<uint16_t>(data, opt);
+    if (magic == 0x20B)
+    {
+        headers.is64 = true;
+        headers.imageBase = ReadAt<uint64_t>(data, opt + 24);
+    }
+    else if (magic == 0x10B)
+    {
+        headers.is64 = false;
+        headers.imageBase = ReadAt<uint32_t>(data, opt + 28);
+    }
+    else
+    {
+        return false;
+    }
+    headers.sizeOfImage = ReadAt<uint32_t>(data, opt + 56);
+    headers.sizeOfHeaders = ReadAt<uint32_t>(data, opt + 60);
+
+    // Data directories follow the fixed part of the optional header
+    size_t directories = opt + (headers.is64 ? 112 : 96);
+    uint32_t directoryCount = ReadAt<uint32_t>(data, opt + (headers.is64 ? 108 : 92));
+    auto readDirectory = [&](uint32_t index, PeDataDirectory& directory)
+    {
+        directory = PeDataDirectory();
+        size_t entry = directories + static_cast<size_t>(index) * 8;
+        if (index < directoryCount && entry + 8 <= opt + optionalSize)
+        {
+            directory.virtualAddress = ReadAt<uint32_t>(data, entry);
+            directory.size = ReadAt<uint32_t>(data, entry + 4);
+        }
+    };
+    readDirectory(0, headers.exportDirectory);
+    readDirectory(6, headers.debugDirectory);
+
+    size_t sectionTable = opt + optionalSize;
+    if (sectionTable + static_cast<size_t>(sectionCount) * 40 > size)
+    {
+        return false;
+    }
+
+    headers.sections.clear();
+    for (uint16_t i = 0; i < sectionCount; ++i)
+    {
+        const uint8_t* entry = data + sectionTable + static_cast<size_t>(i) * 40;
+
+        PeSection section;
+        section.name.assign(entry, std::find(entry, entry + 8, 0));
+        section.virtualSize = ReadAt<uint32_t>(entry, 8);
+        section.virtualAddress = ReadAt<uint32_t>(entry, 12);
+        section.rawSize = ReadAt<uint32_t>(entry, 16);
+        section.rawOffset = ReadAt<uint32_t>(entry, 20);
+        section.characteristics = ReadAt<uint32_t>(entry, 36);
+        headers.sections.push_back(section);
+    }
+
+    return headers.sizeOfImage != 0 && headers.sizeOfImage <= MAX_IMAGE_SIZE;
+}
+
+bool PeImage::MapFile(const std::string& filename, std::vector<uint8_t>& image, PeHeaders& headers)
+{
+    std::ifstream file(filename, std::ios::binary | std::ios::ate);
+    if (!file.is_open())
+    {
+        std::cerr << "Failed to open PE file: " << filename << std::endl;
+        return false;
+    }
+
+    std::vector<uint8_t> raw(static_cast<size_t>(file.tellg()));
+    file.seekg(0, std::ios::beg);
+    if (!file.read(reinterpret_cast<char*>(raw.data()), static_cast<std::streamsize>(raw.size())))
+    {
+        std::cerr << "Failed to read PE file: " << filename << std::endl;
+        return false;
+    }
+
+    if (!ParseHeaders(raw.data(), raw.size(), headers))
+    {
+        std::cerr << "Not a valid PE file: " << filename << std::endl;
+        return false;
+    }
+
+    image.assign(headers.sizeOfImage, 0);
+    std::memcpy(image.data(), raw.data(), std::min<size_t>({ headers.sizeOfHeaders, raw.size(), image.size() }));
+
+    for (const auto& section : headers.sections)
+    {
+        if (section.virtualAddress >= image.size() || section.rawOffset >= raw.size())
+        {
+            continue;   // Uninitialized data or truncated file
+        }
+
+        // The loader copies min(raw, virtual) bytes; a zero VirtualSize means "use the raw size"
+        size_t size = section.virtualSize ? std::min(section.rawSize, section.virtualSize) : section.rawSize;
+        size = std::min({ size, raw.size() - section.rawOffset, image.size() - section.virtualAddress });
+        std::memcpy(image.data() + section.virtualAddress, raw.data() + section.rawOffset, size);
+    }
+
+    std::cout << "Mapped PE file " << filename << ": " << headers.sections.size() << " sections, "
+              << headers.sizeOfImage << " bytes" << std::endl;
+    return true;
+}
+
+bool PeImage::ReadExports(const PeHeaders& headers, const PeRvaReader& reader, std::vector<PeExport>& exports)
+{
+    exports.clear();
+    const PeDataDirectory& directory = headers.exportDirectory;
+    if (directory.virtualAddress == 0 || directory.size == 0)
+    {
+        return true;
+    }
+    if (directory.size < 40 || directory.size > MAX_EXPORT_DIRECTORY)
+    {
+        return false;
+    }
+
+    // The linker places the tables and name strings inside the directory, so one read usually covers everything
+    std::vector<uint8_t> block(directory.size);
+    if (reader(directory.virtualAddress, block.data(), block.size()) != block.size())
+    {
+        return false;
+    }
+
+    std::vector<uint8_t> scratch;
+    auto view = [&](uint32_t rva, size_t size) -> const uint8_t*
+    {
+        if (rva >= directory.virtualAddress && rva - directory.virtualAddress + size <= block.size())
+        {
+            return block.data() + (rva - directory.virtualAddress);
+        }
+        scratch.resize(size);
+        return reader(rva, scratch.data(), size) == size ? scratch.data() : nullptr;
+    };
+
+    uint32_t functionCount = ReadAt<uint32_t>(block.data(), 20);
+    uint32_t nameCount = ReadAt<uint32_t>(block.data(), 24);
+    uint32_t functionsRva = ReadAt<uint32_t>(block.data(), 28);
+    uint32_t namesRva = ReadAt<uint32_t>(block.data(), 32);
+    uint32_t ordinalsRva = ReadAt<uint32_t>(block.data(), 36);
+    if (nameCount > functionCount || functionCount > MAX_EXPORT_DIRECTORY / 4)
+    {
+        return false;
+    }
+
+    const uint8_t* table = view(functionsRva, static_cast<size_t>(functionCount) * 4);
+    if (!table)
+        return false;
+    std::vector<uint32_t> functions(functionCount);
+    std::memcpy(functions.data(), table, functions.size() * 4);
+
+    table = view(namesRva, static_cast<size_t>(nameCount) * 4);
+    if (!table)
+        return false;
+    std::vector<uint32_t> names(nameCount);
+    std::memcpy(names.data(), table, names.size() * 4);
+
+    table = view(ordinalsRva, static_cast<size_t>(nameCount) * 2);
+    if (!table)
+        return false;
+    std::vector<uint16_t> ordinals(nameCount);
+    std::memcpy(ordinals.data(), table, ordinals.size() * 2);
+
+    exports.reserve(nameCount);
+    for (uint32_t i = 0; i < nameCount; ++i)
+    {
+        if (ordinals[i] >= functionCount)
+            continue;
+
+        // A function RVA inside the export directory is a forwarder string, not code or data
+        uint32_t rva = functions[ordinals[i]];
+        if (rva == 0 || (rva >= directory.virtualAddress && rva < directory.virtualAddress + directory.size))
+            continue;
+
+        PeExport entry;
+        entry.rva = rva;
+        if (names[i] >= directory.virtualAddress && names[i] < directory.virtualAddress + directory.size)
+        {
+            const char* text = reinterpret_cast<const char*>(block.data() + (names[i] - directory.virtualAddress));
+            entry.name.assign(text, strnlen(text, directory.virtualAddress + directory.size - names[i]));
+        }
+        else
+        {
+            char text[MAX_NAME_LENGTH + 1] = {};
+            reader(names[i], text, MAX_NAME_LENGTH);
+            entry.name = text;
+        }
+        exports.push_back(std::move(entry));
+    }
+    return true;
+}
+
+bool PeImage::ReadCodeView(const PeHeaders& headers, const PeRvaReader& reader, PeCodeView& codeView)
+{
+    const PeDataDirectory& directory = headers.debugDirectory;
+    constexpr size_t ENTRY_SIZE = 28;
+    constexpr uint32_t IMAGE_DEBUG_TYPE_CODEVIEW = 2;
+    if (directory.virtualAddress == 0 || directory.size < ENTRY_SIZE || directory.size > 64 * ENTRY_SIZE)
+    {
+        return false;
+    }
+
+    std::vector<uint8_t> entries(directory.size);
+    if (reader(directory.virtualAddress, entries.data(), entries.size()) != entries.size())
+    {
+        return false;
+    }
+
+    for (size_t entry = 0; entry + ENTRY_SIZE <= entries.size(); entry += ENTRY_SIZE)
+    {
+        uint32_t type = ReadAt<uint32_t>(entries.data(), entry + 12);
+        uint32_t size = ReadAt<uint32_t>(entries.data(), entry + 16);
+        uint32_t rva = ReadAt<uint32_t>(entries.data(), entry + 20);
+        if (type != IMAGE_DEBUG_TYPE_CODEVIEW || size < 24 || rva == 0)
+            continue;
+
+        // "RSDS", GUID, age, zero-terminated PDB path
+        std::vector<uint8_t> record(std::min<size_t>(size, 24 + MAX_NAME_LENGTH));
+        if (reader(rva, record.data(), record.size()) != record.size() || std::memcmp(record.data(), "RSDS", 4) != 0)
+            continue;
+
+        std::memcpy(codeView.guid.data(), record.data() + 4, 16);
+        codeView.age = ReadAt<uint32_t>(record.data(), 20);
+        const char* path = reinterpret_cast<const char*>(record.data() + 24);
+        codeView.pdbPath.assign(path, strnlen(path, record.size() - 24));
+        return true;
+    }
+    return false;
+}
@@ -0,0 +1,128 @@
+#pragma once
+
+#include <array>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <functional>
+
+/**
+ * @struct PeSection
+ * @brief Section table entry of a PE image
+ */
+struct PeSection
+{
+    std::string name;               ///< Section name (up to 8 characters)
+    uint32_t virtualAddress = 0;    ///< RVA of the section
+    uint32_t virtualSize = 0;       ///< Size in memory
+    uint32_t rawOffset = 0;         ///< File offset of the section data
+    uint32_t rawSize = 0;           ///< Size of the section data in the file
+    uint32_t characteristics = 0;   ///< IMAGE_SCN_* flags
+};
+
+/**
+ * @struct PeDataDirectory
+ * @brief Optional header data directory entry
+ */
+struct PeDataDirectory
+{
+    uint32_t virtualAddress = 0;    ///< RVA of the directory (0 if absent)
+    uint32_t size = 0;              ///< Size in bytes
+};
+
+/**
+ * @struct PeExport
+ * @brief Named export of a PE image
+ */
+struct PeExport
+{
+    std::string name;   ///< Exported name (decorated for C++ symbols)
+    uint32_t rva = 0;   ///< RVA of the exported function or variable
+};
+
+/**
+ * @struct PeCodeView
+ * @brief CodeView (RSDS) debug record linking an image to its PDB
+ */
+struct PeCodeView
+{
+    std::array<uint8_t, 16> guid{};     ///< PDB signature GUID
+    uint32_t age = 0;                   ///< PDB age
+    std::string pdbPath;                ///< PDB path recorded by the linker
+};
+
+/**
+ * @brief Reads image bytes by RVA (memory layout); returns the number of bytes read
+ */
+using PeRvaReader = std::function<size_t(uint32_t rva, void* buffer, size_t size)>;
+
+/**
+ * @struct PeHeaders
+ * @brief The parts of the PE headers needed to map and scan an image
+ */
+struct PeHeaders
+{
+    bool is64 = false;              ///< PE32+ (x64) image
+    uint64_t imageBase = 0;         ///< Preferred load address
+    uint32_t sizeOfImage = 0;       ///< Size of the mapped image
+    uint32_t sizeOfHeaders = 0;     ///< Size of all headers
+    uint32_t timeDateStamp = 0;     ///< Linker timestamp
+    PeDataDirectory exportDirectory;    ///< IMAGE_DIRECTORY_ENTRY_EXPORT
+    PeDataDirectory debugDirectory;     ///< IMAGE_DIRECTORY_ENTRY_DEBUG
+    std::vector<PeSection> sections;    ///< Section table
+};
+
+/**
+ * @class PeImage
+ * @brief Minimal PE header parser and file-to-memory mapper
+ *
+ * Only reads headers, the section table, named exports and the CodeView
+ * record; no relocations or imports are applied. That is enough for
+ * signature scanning and symbol lookups, which only depend on bytes and
+ * RVAs. Works on Linux builds as it does not use <windows.h>.
+ */
+class PeImage
+{
+public:
+    /**
+     * @brief Parse PE headers (identical in file and memory layout)
+     * @param data Image or file bytes starting at the DOS header
+     * @param size Number of bytes available
+     * @param headers Receives the parsed headers
+     * @return true if the data starts with valid PE headers
+     */
+    static bool ParseHeaders(const uint8_t* data, size_t size, PeHeaders& headers);
+
+    /**
+     * @brief Load a PE file from disk and lay its sections out as the loader would
+     * @param filename Executable or DLL on disk
+     * @param image Receives sizeOfImage bytes in memory layout
+     * @param headers Receives the parsed headers
+     * @return true if successful, false otherwise
+     */
+    static bool MapFile(const std::string& filename, std::vector<uint8_t>& image, PeHeaders& headers);
+
+    /**
+     * @brief Read the named exports (forwarders are skipped)
+     * @param headers Parsed headers of the image
+     * @param reader Reads image bytes by RVA
+     * @param exports Receives the exports (empty if the image exports nothing)
+     * @return false if the export directory is present but unreadable or malformed
+     */
+    static bool ReadExports(const PeHeaders& headers, const PeRvaReader& reader, std::vector<PeExport>& exports);
+
+    /**
+     * @brief Read the CodeView record naming the image's PDB
+     * @param headers Parsed headers of the image
+     * @param reader Reads image bytes by RVA
+     * @param codeView Receives the record
+     * @return true if the image has a readable RSDS record
+     */
+    static bool ReadCodeView(const PeHeaders& headers, const PeRvaReader& reader, PeCodeView& codeView);
+
+private:
+    static constexpr size_t MAX_SECTIONS = 96;                  ///< Loader limit on the section count
+    static constexpr uint32_t MAX_IMAGE_SIZE = 0x7FFFFFFF;      ///< Sanity limit on SizeOfImage
+    static constexpr uint32_t MAX_EXPORT_DIRECTORY = 0x4000000; ///< Sanity limit on the export directory size
+    static constexpr size_t MAX_NAME_LENGTH = 4096;             ///< Longest export name or PDB path read
+};
@@ -0,0 +1,40 @@
+#include "StringUtils.h"
+#include <algorithm>
+#include <cctype>
+
+std::string ToLower(const std::string& value)
+{
+    std::string lower = value;
+    std::transform(lower.begin(), lower.end(), lower.begin(),
+        [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    return lower;
+}
+
+bool EqualsIgnoreCase(const std::string& a, const std::string& b)
+{
+    if (a.size() != b.size())
+    {
+        return false;
+    }
+
+    for (size_t i = 0; i < a.size(); ++i)
+    {
+        if (std::tolower(static_cast<unsigned char>(a[i])) != std::tolower(static_cast<unsigned char>(b[i])))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+std::string GetDecoratedGlobalName(const std::string& name)
+{
+    // "?<name>@@3<type>" is a variable at global scope; nested scopes add further "@" parts before "@@"
+    size_t at = name.find('@');
+    if (name.size() < 4 || name[0] != '?' || at == std::string::npos || at < 2 || name.compare(at, 3, "@@3") != 0)
+    {
+        return std::string();
+    }
+    return name.substr(1, at - 1);
+}
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <string>
+
+/**
+ * @brief Convert an ASCII string to lowercase
+ * @param value Input string
+ * @return Lowercase copy
+ */
+std::string ToLower(const std::string& value);
+
+/**
+ * @brief Compare two ASCII strings ignoring case
+ * @param a First string
+ * @param b Second string
+ * @return true if equal ignoring case
+ */
+bool EqualsIgnoreCase(const std::string& a, const std::string& b);
+
+/**
+ * @brief Get the plain name of an MSVC-decorated global variable
+ * @param name Decorated name (e.g., "?GWorld@@3VUWorldProxy@@A")
+ * @return Variable name ("GWorld"), empty if the name is not a decorated global variable
+ */
+std::string GetDecoratedGlobalName(const std::string& name);
@@ -0,0 +1,249 @@
+#include "TaskExecutor.h"
+#include "Trace.h"
+#include <algorithm>
+#include <iostream>
+
+namespace
+{
+    // Task running on this thread, for IsCurrentTaskCancelled/ReportProgress
+    thread_local TaskExecutor* t_executor = nullptr;
+    thread_local const CancellationToken* t_token = nullptr;
+    thread_local void* t_task = nullptr;
+}
+
+TaskExecutor::TaskExecutor()
+    : m_nextId(1)
+    , m_running(0)
+    , m_exclusiveRunning(false)
+    , m_stopping(false)
+    , m_activeCount(0)
+{
+}
+
+TaskExecutor::~TaskExecutor()
+{
+    Stop();
+}
+
+void TaskExecutor::Start(size_t workerCount, const std::string& threadName)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!m_workers.empty())
+    {
+        return;
+    }
+
+    m_stopping = false;
+    for (size_t i = 0; i < std::max<size_t>(workerCount, 1); ++i)
+    {
+        m_workers.emplace_back(&TaskExecutor::WorkerThread, this, threadName + " " + std::to_string(i + 1));
+    }
+}
+
+void TaskExecutor::Stop()
+{
+    std::vector<std::thread> workers;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopping = true;
+
+        // Queued tasks are dropped; running ones are asked to finish early
+        m_tasks.erase(std::remove_if(m_tasks.begin(), m_tasks.end(),
+            [](const std::shared_ptr<Task>& task) { return !task->running; }), m_tasks.end());
+        for (const auto& task : m_tasks)
+        {
+            task->token.Cancel();
+        }
+        m_activeCount = m_tasks.size();
+        workers.swap(m_workers);
+    }
+    m_condition.notify_all();
+
+    for (auto& worker : workers)
+    {
+        worker.join();
+    }
+}
+
+bool TaskExecutor::Submit(TaskRequest request)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        if (!request.coalesceKey.empty())
+        {
+            for (const auto& task : m_tasks)
+            {
+                if (!task->running && !task->token.IsCancelled() && task->request.coalesceKey == request.coalesceKey)
+                {
+                    // Identical work already waiting: hand it our callback instead of queuing twice
+                    if (request.merge)
+                    {
+                        request.merge(task->request.state);
+                    }
+                    task->request.priority = std::max(task->request.priority, request.priority);
+                    return false;
+                }
+            }
+        }
+
+        auto task = std::make_shared<Task>();
+        task->id = m_nextId++;
+        task->request = std::move(request);
+        m_tasks.push_back(std::move(task));
+        m_activeCount++;
+    }
+    m_condition.notify_one();
+    return true;
+}
+
+void TaskExecutor::CancelAll()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (const auto& task : m_tasks)
+    {
+        task->token.Cancel();
+    }
+}
+
+std::vector<TaskStatus> TaskExecutor::GetStatus() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    std::vector<TaskStatus> status;
+    status.reserve(m_tasks.size());
+    for (const auto& task : m_tasks)
+    {
+        TaskStatus entry;
+        entry.id = task->id;
+        entry.description = task->request.description;
+        entry.priority = task->request.priority;
+        entry.running = task->running;
+        entry.cancelled = task->token.IsCancelled();
+        entry.progress = task->progress.load(std::memory_order_relaxed);
+        {
+            std::lock_guard<std::mutex> textLock(task->progressTextMutex);
+            entry.progressText = task->progressText;
+        }
+        status.push_back(entry);
+    }
+
+    std::stable_sort(status.begin(), status.end(), [](const TaskStatus& a, const TaskStatus& b)
+    {
+        if (a.running != b.running)
+            return a.running;
+        if (a.priority != b.priority)
+            return a.priority > b.priority;
+        return a.id < b.id;
+    });
+    return status;
+}
+
+bool TaskExecutor::IsCurrentTaskCancelled()
+{
+    return t_token && t_token->IsCancelled();
+}
+
+void TaskExecutor::ReportProgress(float fraction, const std::string& text)
+{
+    if (!t_executor || !t_task)
+    {
+        return;
+    }
+
+    // Called from tight scan loops: never take the executor lock here, it would contend with scheduling
+    Task* task = static_cast<Task*>(t_task);
+    task->progress.store(std::clamp(fraction, 0.0f, 1.0f), std::memory_order_relaxed);
+    if (!text.empty())
+    {
+        std::lock_guard<std::mutex> lock(task->progressTextMutex);
+        task->progressText = text;
+    }
+}
+
+size_t TaskExecutor::PickNextTask() const
+{
+    if (m_exclusiveRunning)
+    {
+        return SIZE_MAX;
+    }
+
+    size_t best = SIZE_MAX;
+    for (size_t i = 0; i < m_tasks.size(); ++i)
+    {
+        const Task& task = *m_tasks[i];
+        if (task.running)
+            continue;
+
+        if (best == SIZE_MAX || task.request.priority > m_tasks[best]->request.priority)
+        {
+            best = i;
+        }
+    }
+
+    // An exclusive task waits for the running ones to drain and holds back everything behind it
+    if (best != SIZE_MAX && m_tasks[best]->request.exclusive && m_running > 0)
+    {
+        return SIZE_MAX;
+    }
+    return best;
+}
+
+void TaskExecutor::WorkerThread(std::string threadName)
+{
+    TraceRecorder::Get().SetCurrentThreadName(threadName);
+    t_executor = this;
+
+    while (true)
+    {
+        std::shared_ptr<Task> task;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            size_t next = SIZE_MAX;
+            m_condition.wait(lock, [this, &next]()
+            {
+                next = PickNextTask();
+                return m_stopping || next != SIZE_MAX;
+            });
+
+            if (m_stopping)
+            {
+                break;
+            }
+
+            task = m_tasks[next];
+            task->running = true;
+            m_running++;
+            m_exclusiveRunning = task->request.exclusive;
+        }
+
+        t_token = &task->token;
+        t_task = task.get();
+        try
+        {
+            task->request.work(task->token);
+        }
+        catch (const std::exception& e)
+        {
+            std::cerr << "Exception in worker thread: " << e.what() << std::endl;
+        }
+        t_token = nullptr;
+        t_task = nullptr;
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_tasks.erase(std::find(m_tasks.begin(), m_tasks.end(), task));
+            m_running--;
+            if (task->request.exclusive)
+            {
+                m_exclusiveRunning = false;
+            }
+            m_activeCount--;
+        }
+
+        // Finished tasks may unblock an exclusive task or a task held back by one
+        m_condition.notify_all();
+    }
+
+    t_executor = nullptr;
+}
@@ -0,0 +1,197 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * @enum TaskPriority
+ * @brief Scheduling priority of a task (higher runs first)
+ */
+enum class TaskPriority
+{
+    Background = 0,     ///< Long scans
+    Normal = 1,         ///< Default
+    Interactive = 2     ///< Quick lookups the user is waiting for
+};
+
+/**
+ * @class CancellationToken
+ * @brief Shared cancellation flag; copies observe the same flag
+ */
+class CancellationToken
+{
+public:
+    CancellationToken() : m_cancelled(std::make_shared<std::atomic<bool>>(false)) {}
+
+    /**
+     * @brief Request cancellation
+     */
+    void Cancel() const { m_cancelled->store(true, std::memory_order_relaxed); }
+
+    /**
+     * @brief Check whether cancellation was requested
+     * @return true if cancelled
+     */
+    bool IsCancelled() const { return m_cancelled->load(std::memory_order_relaxed); }
+
+private:
+    std::shared_ptr<std::atomic<bool>> m_cancelled;
+};
+
+/**
+ * @struct TaskRequest
+ * @brief Work submitted to the executor
+ */
+struct TaskRequest
+{
+    std::string description;                            ///< Shown in progress reports
+    TaskPriority priority = TaskPriority::Normal;       ///< Scheduling priority
+    std::string coalesceKey;                            ///< Pending tasks with the same non-empty key are merged
+    bool exclusive = false;                             ///< Runs alone (no other task starts or runs meanwhile)
+    std::function<void(const CancellationToken&)> work; ///< Task body
+
+    /**
+     * @brief Shared state of the task, handed to merge() of later identical requests
+     */
+    std::shared_ptr<void> state;
+
+    /**
+     * @brief Called (under the executor lock) with the pending task's state when this request is coalesced
+     */
+    std::function<void(const std::shared_ptr<void>& pendingState)> merge;
+};
+
+/**
+ * @struct TaskStatus
+ * @brief Snapshot of a queued or running task
+ */
+struct TaskStatus
+{
+    uint64_t id = 0;                                ///< Task ID
+    std::string description;                        ///< Task description
+    TaskPriority priority = TaskPriority::Normal;   ///< Scheduling priority
+    bool running = false;                           ///< Started (false = queued)
+    bool cancelled = false;                         ///< Cancellation requested
+    float progress = -1.0f;                         ///< 0..1, negative if not reported
+    std::string progressText;                       ///< Last reported progress message
+};
+
+/**
+ * @class TaskExecutor
+ * @brief Worker pool with priorities, coalescing and cooperative cancellation
+ *
+ * Tasks are started highest priority first, FIFO within a priority. Running
+ * tasks are never interrupted; long loops poll IsCurrentTaskCancelled() and
+ * call ReportProgress(), both of which refer to the task running on the
+ * calling thread and are no-ops elsewhere (e.g. synchronous calls).
+ */
+class TaskExecutor
+{
+public:
+    /**
+     * @brief Constructor
+     */
+    TaskExecutor();
+
+    /**
+     * @brief Destructor - stops the workers
+     */
+    ~TaskExecutor();
+
+    /**
+     * @brief Start the worker threads
+     * @param workerCount Number of workers
+     * @param threadName Thread name used in traces
+     */
+    void Start(size_t workerCount, const std::string& threadName);
+
+    /**
+     * @brief Drop queued tasks, cancel running ones and join the workers
+     */
+    void Stop();
+
+    /**
+     * @brief Queue a task, or merge it into an identical pending one
+     * @param request Task to queue
+     * @return true if queued, false if merged into a pending task
+     */
+    bool Submit(TaskRequest request);
+
+    /**
+     * @brief Cancel every queued and running task
+     *
+     * Queued tasks still run, with their token already cancelled, so their
+     * completion handling (e.g. reporting "cancelled") is not skipped.
+     */
+    void CancelAll();
+
+    /**
+     * @brief Get the number of queued plus running tasks
+     * @return Task count
+     */
+    size_t GetActiveCount() const { return m_activeCount.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Get a snapshot of all queued and running tasks
+     * @return Running tasks first, then queued tasks in start order
+     */
+    std::vector<TaskStatus> GetStatus() const;
+
+    /**
+     * @brief Check whether the task running on this thread was cancelled
+     * @return true if cancelled, false if not or if no task runs on this thread
+     */
+    static bool IsCurrentTaskCancelled();
+
+    /**
+     * @brief Report progress of the task running on this thread
+     * @param fraction Completed fraction (0..1)
+     * @param text Optional progress message
+     */
+    static void ReportProgress(float fraction, const std::string& text = "");
+
+private:
+    /**
+     * @struct Task
+     * @brief Queued or running task
+     */
+    struct Task
+    {
+        uint64_t id = 0;
+        TaskRequest request;
+        CancellationToken token;
+        bool running = false;
+        std::atomic<float> progress{ -1.0f };   ///< Written by the running task without m_mutex
+        std::mutex progressTextMutex;           ///< Guards progressText (taken after m_mutex, never before)
+        std::string progressText;
+    };
+
+    /**
+     * @brief Worker thread function
+     */
+    void WorkerThread(std::string threadName);
+
+    /**
+     * @brief Find the next task allowed to start (caller holds m_mutex)
+     * @return Index into m_tasks, or SIZE_MAX if none may start now
+     */
+    size_t PickNextTask() const;
+
+private:
+    mutable std::mutex m_mutex;                 ///< Guards everything below
+    std::condition_variable m_condition;        ///< Signals new tasks, finished tasks and stop
+    std::vector<std::shared_ptr<Task>> m_tasks; ///< Queued and running tasks
+    std::vector<std::thread> m_workers;         ///< Worker threads
+    uint64_t m_nextId;                          ///< Next task ID (also the FIFO order)
+    size_t m_running;                           ///< Running task count
+    bool m_exclusiveRunning;                    ///< An exclusive task is running
+    bool m_stopping;                            ///< Workers should exit
+    std::atomic<size_t> m_activeCount;          ///< Queued + running, readable without the lock
+};
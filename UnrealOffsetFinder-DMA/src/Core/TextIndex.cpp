@@ -0,0 +1,288 @@
+#include "TextIndex.h"
+#include "Gallop.h"
+#include "Trace.h"
+#include <algorithm>
+#include <bit>
+#include <string>
+
+namespace
+{
+    char ToLower(char c)
+    {
+        return c >= 'A' && c <= 'Z' ? static_cast<char>(c - 'A' + 'a') : c;
+    }
+}
+
+uint32_t TextIndex::Bucket(const char* text)
+{
+    uint32_t key = static_cast<uint8_t>(text[0]) | static_cast<uint8_t>(text[1]) << 8 | static_cast<uint32_t>(static_cast<uint8_t>(text[2])) << 16;
+    return (key * 0x9E3779B1u) >> (32 - BUCKET_BITS);
+}
+
+uint32_t TextIndex::AnchorBucket(std::string_view text)
+{
+    // "\x01\x01a" for texts starting with a, "\x01ab" for texts starting with ab
+    char anchored[3] = { ANCHOR, ANCHOR, ANCHOR };
+    if (text.size() == 1)
+    {
+        anchored[2] = text[0];
+    }
+    else
+    {
+        anchored[1] = text[0];
+        anchored[2] = text[1];
+    }
+    return Bucket(anchored);
+}
+
+uint32_t TextIndex::ShortKey(std::string_view text)
+{
+    // Characters take keys 0-255, pairs the 64K keys after them
+    uint32_t first = static_cast<uint8_t>(text[0]);
+    return text.size() == 1 ? first : 256 + (first << 8 | static_cast<uint8_t>(text[1]));
+}
+
+void TextIndex::Clear()
+{
+    m_arena.clear();
+    m_offsets.assign(1, 0);
+    m_bucketStarts.clear();
+    m_postings.clear();
+    m_shortStarts.clear();
+    m_shortPostings.clear();
+    m_shortBitmapSlots.clear();
+    m_shortBitmaps.clear();
+}
+
+void TextIndex::Build(size_t count, const std::function<std::string_view(size_t)>& getText)
+{
+    TRACE_SCOPE("BuildTextIndex", "ui");
+
+    Clear();
+    m_offsets.reserve(count + 1);
+    for (size_t i = 0; i < count; ++i)
+    {
+        std::string_view text = getText(i);
+        size_t start = m_arena.size();
+        m_arena.resize(start + text.size());
+        std::transform(text.begin(), text.end(), m_arena.begin() + start, ToLower);
+        m_offsets.push_back(static_cast<uint32_t>(m_arena.size()));
+    }
+    m_arena.shrink_to_fit();
+
+    // Calls visit(key, id) once per text and distinct key of that text, in ascending id order
+    std::vector<uint32_t> lastId;
+    auto forEachPosting = [&](uint32_t keyCount, auto&& forEachKey, auto&& visit)
+    {
+        lastId.assign(keyCount, UINT32_MAX);
+        for (uint32_t id = 0; id < static_cast<uint32_t>(count); ++id)
+        {
+            std::string_view text(m_arena.data() + m_offsets[id], m_offsets[id + 1] - m_offsets[id]);
+            forEachKey(text, [&](uint32_t key)
+            {
+                if (lastId[key] != id)
+                {
+                    lastId[key] = id;
+                    visit(key, id);
+                }
+            });
+        }
+    };
+    auto trigrams = [](std::string_view text, auto&& add)
+    {
+        if (!text.empty())
+        {
+            add(AnchorBucket(text.substr(0, 1)));
+        }
+        if (text.size() >= 2)
+        {
+            add(AnchorBucket(text.substr(0, 2)));
+        }
+        for (size_t i = 0; i + 3 <= text.size(); ++i)
+        {
+            add(Bucket(text.data() + i));
+        }
+    };
+    auto shortGrams = [](std::string_view text, auto&& add)
+    {
+        for (size_t i = 0; i < text.size(); ++i)
+        {
+            add(ShortKey(text.substr(i, 1)));
+            if (i + 2 <= text.size())
+            {
+                add(ShortKey(text.substr(i, 2)));
+            }
+        }
+    };
+
+    // Two passes over the same trigrams: count per bucket, then fill
+    m_bucketStarts.assign(BUCKET_COUNT + 1, 0);
+    forEachPosting(BUCKET_COUNT, trigrams, [this](uint32_t bucket, uint32_t) { m_bucketStarts[bucket + 1]++; });
+    for (uint32_t bucket = 0; bucket < BUCKET_COUNT; ++bucket)
+    {
+        m_bucketStarts[bucket + 1] += m_bucketStarts[bucket];
+    }
+
+    m_postings.resize(m_bucketStarts[BUCKET_COUNT]);
+    std::vector<uint32_t> cursors(m_bucketStarts.begin(), m_bucketStarts.end() - 1);
+    forEachPosting(BUCKET_COUNT, trigrams, [this, &cursors](uint32_t bucket, uint32_t id) { m_postings[cursors[bucket]++] = id; });
+
+    // Characters and character pairs are keyed exactly, for substrings too short to have a trigram. A key
+    // in more than one text in DENSE_FRACTION is stored as a bitmap over all texts, the smaller form then
+    std::vector<uint32_t> shortCounts(SHORT_KEY_COUNT, 0);
+    forEachPosting(SHORT_KEY_COUNT, shortGrams, [&shortCounts](uint32_t key, uint32_t) { shortCounts[key]++; });
+
+    const size_t words = GetBitmapWords();
+    uint32_t bitmaps = 0;
+    m_shortStarts.assign(SHORT_KEY_COUNT + 1, 0);
+    m_shortBitmapSlots.assign(SHORT_KEY_COUNT, NO_BITMAP);
+    for (uint32_t key = 0; key < SHORT_KEY_COUNT; ++key)
+    {
+        if (shortCounts[key] > count / DENSE_FRACTION)
+        {
+            m_shortBitmapSlots[key] = bitmaps++;
+        }
+        m_shortStarts[key + 1] = m_shortStarts[key] + (m_shortBitmapSlots[key] == NO_BITMAP ? shortCounts[key] : 0);
+    }
+
+    m_shortPostings.resize(m_shortStarts[SHORT_KEY_COUNT]);
+    m_shortBitmaps.assign(bitmaps * words, 0);
+    cursors.assign(m_shortStarts.begin(), m_shortStarts.end() - 1);
+    forEachPosting(SHORT_KEY_COUNT, shortGrams, [this, &cursors, words](uint32_t key, uint32_t id)
+    {
+        if (m_shortBitmapSlots[key] != NO_BITMAP)
+        {
+            m_shortBitmaps[m_shortBitmapSlots[key] * words + id / 64] |= 1ULL << (id % 64);
+        }
+        else
+        {
+            m_shortPostings[cursors[key]++] = id;
+        }
+    });
+}
+
+bool TextIndex::Matches(uint32_t id, std::string_view query, TextMatch match) const
+{
+    std::string_view text(m_arena.data() + m_offsets[id], m_offsets[id + 1] - m_offsets[id]);
+    return match == TextMatch::Prefix ? text.substr(0, query.size()) == query : text.find(query) != std::string_view::npos;
+}
+
+bool TextIndex::Search(std::string_view query, TextMatch match, size_t maxResults, std::vector<uint32_t>& results,
+                       const std::function<bool(uint32_t)>& accept) const
+{
+    results.clear();
+    std::string lowered(query.size(), '\0');
+    std::transform(query.begin(), query.end(), lowered.begin(), ToLower);
+
+    auto consider = [&](uint32_t id)
+    {
+        if (Matches(id, lowered, match) && (!accept || accept(id)))
+        {
+            results.push_back(id);
+        }
+        return results.size() < maxResults;
+    };
+
+    if (lowered.empty() || m_bucketStarts.empty())
+    {
+        for (uint32_t id = 0; id < static_cast<uint32_t>(GetCount()); ++id)
+        {
+            if (!consider(id))
+                return false;
+        }
+        return true;
+    }
+
+    // One or two characters have no trigram; their exact key lists precisely the texts containing them
+    if (match == TextMatch::Substring && lowered.size() < 3)
+    {
+        auto add = [&](uint32_t id)
+        {
+            if (!accept || accept(id))
+            {
+                results.push_back(id);
+            }
+            return results.size() < maxResults;
+        };
+
+        uint32_t key = ShortKey(lowered);
+        if (m_shortBitmapSlots[key] != NO_BITMAP)
+        {
+            const size_t words = GetBitmapWords();
+            const uint64_t* bits = m_shortBitmaps.data() + m_shortBitmapSlots[key] * words;
+            for (size_t word = 0; word < words; ++word)
+            {
+                for (uint64_t remaining = bits[word]; remaining != 0; remaining &= remaining - 1)
+                {
+                    if (!add(static_cast<uint32_t>(word * 64 + std::countr_zero(remaining))))
+                        return false;
+                }
+            }
+            return true;
+        }
+
+        const uint32_t* last = m_shortPostings.data() + m_shortStarts[key + 1];
+        for (const uint32_t* id = m_shortPostings.data() + m_shortStarts[key]; id != last; ++id)
+        {
+            if (!add(*id))
+                return false;
+        }
+        return true;
+    }
+
+    // A match contains every query trigram (and starts with the anchored one for prefixes)
+    std::vector<uint32_t> buckets;
+    if (match == TextMatch::Prefix)
+    {
+        buckets.push_back(AnchorBucket(std::string_view(lowered).substr(0, 2)));
+    }
+    for (size_t i = 0; i + 3 <= lowered.size(); ++i)
+    {
+        buckets.push_back(Bucket(lowered.data() + i));
+    }
+    auto listSize = [this](uint32_t bucket) { return m_bucketStarts[bucket + 1] - m_bucketStarts[bucket]; };
+    std::sort(buckets.begin(), buckets.end());
+    buckets.erase(std::unique(buckets.begin(), buckets.end()), buckets.end());
+    std::sort(buckets.begin(), buckets.end(), [&](uint32_t a, uint32_t b) { return listSize(a) < listSize(b); });
+    // Much longer lists cost more to skip through than verifying the candidates does
+    size_t keep = 1;
+    while (keep < buckets.size() && keep < MAX_INTERSECTED && listSize(buckets[keep]) <= listSize(buckets[0]) * INTERSECT_RATIO)
+    {
+        keep++;
+    }
+    buckets.resize(keep);
+
+    // Walk the shortest list; the others only move forward, so each is passed once
+    std::vector<const uint32_t*> cursors;
+    for (uint32_t bucket : buckets)
+    {
+        cursors.push_back(m_postings.data() + m_bucketStarts[bucket]);
+    }
+    const uint32_t* last = m_postings.data() + m_bucketStarts[buckets[0] + 1];
+    for (const uint32_t* candidate = cursors[0]; candidate != last; ++candidate)
+    {
+        bool inAll = true;
+        for (size_t k = 1; k < buckets.size() && inAll; ++k)
+        {
+            const uint32_t* end = m_postings.data() + m_bucketStarts[buckets[k] + 1];
+            cursors[k] = Gallop(cursors[k], end, *candidate);
+            if (cursors[k] == end)
+            {
+                return true;
+            }
+            inAll = *cursors[k] == *candidate;
+        }
+        if (inAll && !consider(*candidate))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+uint64_t TextIndex::GetMemoryBytes() const
+{
+    return m_arena.capacity() + m_offsets.capacity() * sizeof(uint32_t) +
+           (m_bucketStarts.capacity() + m_postings.capacity() + m_shortStarts.capacity() + m_shortPostings.capacity() +
+            m_shortBitmapSlots.capacity()) * sizeof(uint32_t) + m_shortBitmaps.capacity() * sizeof(uint64_t);
+}
@@ -0,0 +1,127 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <functional>
+#include <string_view>
+#include <vector>
+
+/**
+ * @enum TextMatch
+ * @brief How a query is matched against the indexed texts
+ */
+enum class TextMatch
+{
+    Prefix,     ///< Text starts with the query
+    Substring   ///< Text contains the query
+};
+
+/**
+ * @class TextIndex
+ * @brief Case-insensitive prefix and substring search over a fixed set of texts
+ *
+ * Build() copies the texts lowercased into one arena and records, for every
+ * trigram, the texts containing it (postings hashed into BUCKET_COUNT
+ * buckets and stored back to back). The first one and two characters of a
+ * text are also posted as anchored trigrams, so prefixes of any length hit
+ * the postings. A query intersects the postings of its rarest trigrams and
+ * verifies the survivors; hash collisions only cost a verification.
+ * Every character and character pair is also posted under its own exact key
+ * (as a bitmap over all texts when it occurs in many), so substrings shorter
+ * than three characters are answered straight from their list. Texts are identified by their position in the Build() input.
+ */
+class TextIndex
+{
+public:
+    /**
+     * @brief Index a set of texts (replaces the previous contents)
+     * @param count Number of texts
+     * @param getText Returns text i; the view only has to stay valid during the call
+     */
+    void Build(size_t count, const std::function<std::string_view(size_t)>& getText);
+
+    /**
+     * @brief Remove all texts
+     */
+    void Clear();
+
+    /**
+     * @brief Get the number of indexed texts
+     * @return Texts
+     */
+    size_t GetCount() const { return m_offsets.size() - 1; }
+
+    /**
+     * @brief Find texts matching a query
+     * @param query Text to look for (case-insensitive; empty matches everything)
+     * @param match Prefix or substring match
+     * @param maxResults Stop after this many results
+     * @param results Receives the matching text ids in ascending order
+     * @param accept Optional extra filter on text ids
+     * @return true if every match was returned, false if the search stopped at maxResults
+     */
+    bool Search(std::string_view query, TextMatch match, size_t maxResults, std::vector<uint32_t>& results,
+                const std::function<bool(uint32_t)>& accept = nullptr) const;
+
+    /**
+     * @brief Get the memory held by the index
+     * @return Allocated bytes
+     */
+    uint64_t GetMemoryBytes() const;
+
+    static constexpr uint32_t BUCKET_BITS = 18;                     ///< log2 of the trigram buckets
+    static constexpr uint32_t BUCKET_COUNT = 1u << BUCKET_BITS;     ///< Trigram buckets
+    static constexpr size_t MAX_INTERSECTED = 4;                    ///< Posting lists intersected per query
+    static constexpr uint32_t INTERSECT_RATIO = 8;                  ///< Longest list intersected, relative to the shortest
+    static constexpr uint32_t SHORT_KEY_COUNT = 256 + 65536;        ///< Exact keys of single characters and character pairs
+    static constexpr uint32_t DENSE_FRACTION = 32;                  ///< Short keys in more than 1/DENSE_FRACTION of the texts are bitmaps
+    static constexpr uint32_t NO_BITMAP = UINT32_MAX;               ///< Bitmap slot of a short key stored as a list
+    static constexpr char ANCHOR = '\x01';                          ///< Stands for "start of text" in anchored trigrams
+
+private:
+    /**
+     * @brief Check a single text against a lowercased query
+     * @param id Text id
+     * @param query Lowercased query
+     * @param match Prefix or substring match
+     * @return true if the text matches
+     */
+    bool Matches(uint32_t id, std::string_view query, TextMatch match) const;
+
+    /**
+     * @brief Hash three lowercased characters into a bucket
+     * @param text Pointer to the first character
+     * @return Bucket index
+     */
+    static uint32_t Bucket(const char* text);
+
+    /**
+     * @brief Get the bucket of the anchored trigram of a one or two character prefix
+     * @param text Lowercased prefix (first two characters used)
+     * @return Bucket index
+     */
+    static uint32_t AnchorBucket(std::string_view text);
+
+    /**
+     * @brief Get the exact key of one or two lowercased characters
+     * @param text One or two characters (first two used)
+     * @return Key below SHORT_KEY_COUNT
+     */
+    static uint32_t ShortKey(std::string_view text);
+
+    /**
+     * @brief Get the size of one short key bitmap
+     * @return 64-bit words covering every text
+     */
+    size_t GetBitmapWords() const { return (GetCount() + 63) / 64; }
+
+private:
+    std::vector<char> m_arena;                  ///< Lowercased texts back to back
+    std::vector<uint32_t> m_offsets = { 0 };    ///< Arena offset of each text, plus the end of the last one
+    std::vector<uint32_t> m_bucketStarts;       ///< First posting of each bucket, plus the end of the last one
+    std::vector<uint32_t> m_postings;           ///< Text ids per bucket, ascending and without duplicates
+    std::vector<uint32_t> m_shortStarts;        ///< First short posting of each exact key, plus the end of the last one
+    std::vector<uint32_t> m_shortPostings;      ///< Text ids per character or character pair, ascending and without duplicates
+    std::vector<uint32_t> m_shortBitmapSlots;   ///< Bitmap slot of each exact key (NO_BITMAP: stored in m_shortPostings)
+    std::vector<uint64_t> m_shortBitmaps;       ///< Bitmaps of the dense keys, GetBitmapWords() words each
+};
@@ -0,0 +1,261 @@
+#include "Trace.h"
+#include "JsonWriter.h"
+#include <fstream>
+#include <iostream>
+#include <ctime>
+
+std::atomic<bool> TraceRecorder::s_enabled(false);
+
+TraceRecorder& TraceRecorder::Get()
+{
+    static TraceRecorder recorder;
+    return recorder;
+}
+
+TraceRecorder::TraceRecorder()
+    : m_origin(std::chrono::steady_clock::now())
+    , m_armedForNextTask(false)
+    , m_taskCaptureActive(false)
+    , m_exportCount(0)
+{
+}
+
+void TraceRecorder::Start()
+{
+    ReleaseEvents();
+
+    s_enabled.store(true, std::memory_order_relaxed);
+    std::cout << "Trace recording started" << std::endl;
+}
+
+void TraceRecorder::Stop()
+{
+    s_enabled.store(false, std::memory_order_relaxed);
+    std::cout << "Trace recording stopped" << std::endl;
+}
+
+bool TraceRecorder::ExportChromeTrace(const std::string& filename) const
+{
+    try
+    {
+        JsonWriter json;
+        json.BeginObject();
+        json.String("displayTimeUnit", "ms");
+        json.BeginArray("traceEvents");
+
+        size_t eventCount = 0;
+
+        std::lock_guard<std::mutex> lock(m_registryMutex);
+        for (const auto& buffer : m_buffers)
+        {
+            std::lock_guard<std::mutex> bufferLock(buffer->mutex);
+
+            json.BeginObject();
+            json.String("name", "thread_name");
+            json.String("ph", "M");
+            json.UInt("pid", 1);
+            json.UInt("tid", buffer->threadIndex);
+            json.BeginObject("args");
+            json.String("name", buffer->threadName);
+            json.EndObject();
+            json.EndObject();
+
+            for (const auto& event : buffer->events)
+            {
+                json.BeginObject();
+                json.String("name", event.name);
+                json.String("cat", event.category);
+                json.String("ph", "X");
+                json.Double("ts", static_cast<double>(event.startNs) / 1000.0);
+                json.Double("dur", static_cast<double>(event.durationNs) / 1000.0);
+                json.UInt("pid", 1);
+                json.UInt("tid", buffer->threadIndex);
+
+                if (!event.detail.empty() || event.argName)
+                {
+                    json.BeginObject("args");
+                    if (!event.detail.empty())
+                    {
+                        json.String("detail", event.detail);
+                    }
+                    if (event.argName)
+                    {
+                        json.UInt(event.argName, event.argValue);
+                    }
+                    json.EndObject();
+                }
+
+                json.EndObject();
+                eventCount++;
+            }
+        }
+
+        json.EndArray();
+        json.EndObject();
+
+        std::ofstream file(filename, std::ios::binary);
+        if (!file.is_open())
+        {
+            std::cerr << "Failed to create trace file: " << filename << std::endl;
+            return false;
+        }
+
+        file << json.Str();
+        std::cout << "Exported " << eventCount << " trace events to " << filename << std::endl;
+        return true;
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << "Exception during trace export: " << e.what() << std::endl;
+        return false;
+    }
+}
+
+void TraceRecorder::SetCurrentThreadName(const std::string& name)
+{
+    ThreadBuffer& buffer = GetThreadBuffer();
+    std::lock_guard<std::mutex> lock(buffer.mutex);
+    buffer.threadName = name;
+}
+
+void TraceRecorder::SetArmedForNextTask(bool armed)
+{
+    m_armedForNextTask = armed;
+}
+
+bool TraceRecorder::IsArmedForNextTask() const
+{
+    return m_armedForNextTask;
+}
+
+bool TraceRecorder::BeginTaskCapture()
+{
+    bool expected = true;
+    if (!m_armedForNextTask.compare_exchange_strong(expected, false))
+    {
+        return false;
+    }
+
+    m_taskCaptureActive = true;
+    Start();
+    return true;
+}
+
+std::string TraceRecorder::FinishTaskCapture()
+{
+    if (!m_taskCaptureActive.exchange(false))
+    {
+        return "";
+    }
+
+    Stop();
+
+    std::string filename = "trace_" + std::to_string(time(nullptr)) + ".json";
+    bool exported = ExportChromeTrace(filename);
+
+    // A capture can hold up to MAX_EVENTS_PER_THREAD events per thread; do not keep them around
+    ReleaseEvents();
+
+    if (!exported)
+    {
+        return "";
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_exportMutex);
+        m_lastExportPath = filename;
+    }
+    m_exportCount++;
+
+    return filename;
+}
+
+uint32_t TraceRecorder::GetExportCount() const
+{
+    return m_exportCount;
+}
+
+std::string TraceRecorder::GetLastExportPath() const
+{
+    std::lock_guard<std::mutex> lock(m_exportMutex);
+    return m_lastExportPath;
+}
+
+uint64_t TraceRecorder::NowNs() const
+{
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - m_origin).count());
+}
+
+void TraceRecorder::Record(TraceEvent&& event)
+{
+    ThreadBuffer& buffer = GetThreadBuffer();
+    std::lock_guard<std::mutex> lock(buffer.mutex);
+    if (buffer.events.size() < MAX_EVENTS_PER_THREAD)
+    {
+        buffer.events.push_back(std::move(event));
+    }
+}
+
+void TraceRecorder::ReleaseEvents()
+{
+    std::lock_guard<std::mutex> lock(m_registryMutex);
+    for (auto& buffer : m_buffers)
+    {
+        std::lock_guard<std::mutex> bufferLock(buffer->mutex);
+        std::vector<TraceEvent>().swap(buffer->events);
+    }
+}
+
+TraceRecorder::ThreadBuffer& TraceRecorder::GetThreadBuffer()
+{
+    thread_local std::shared_ptr<ThreadBuffer> t_buffer;
+
+    if (!t_buffer)
+    {
+        auto buffer = std::make_shared<ThreadBuffer>();
+
+        std::lock_guard<std::mutex> lock(m_registryMutex);
+        buffer->threadIndex = static_cast<uint32_t>(m_buffers.size() + 1);
+        buffer->threadName = "Thread " + std::to_string(buffer->threadIndex);
+        m_buffers.push_back(buffer);
+        t_buffer = buffer;
+    }
+
+    return *t_buffer;
+}
+
+ScopedTrace::ScopedTrace(const char* name, const char* category, const char* argName, uint64_t argValue)
+    : m_active(TraceRecorder::IsEnabled())
+{
+    if (m_active)
+    {
+        m_event.name = name;
+        m_event.category = category;
+        m_event.argName = argName;
+        m_event.argValue = argValue;
+        m_event.startNs = TraceRecorder::Get().NowNs();
+    }
+}
+
+ScopedTrace::ScopedTrace(const char* name, const char* category, const std::string& detail)
+    : m_active(TraceRecorder::IsEnabled())
+{
+    if (m_active)
+    {
+        m_event.name = name;
+        m_event.category = category;
+        m_event.detail = detail;
+        m_event.startNs = TraceRecorder::Get().NowNs();
+    }
+}
+
+ScopedTrace::~ScopedTrace()
+{
+    if (m_active)
+    {
+        TraceRecorder& recorder = TraceRecorder::Get();
+        m_event.durationNs = recorder.NowNs() - m_event.startNs;
+        recorder.Record(std::move(m_event));
+    }
+}
@@ -0,0 +1,213 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <mutex>
+#include <atomic>
+#include <memory>
+#include <chrono>
+
+/**
+ * @struct TraceEvent
+ * @brief A single completed timeline event
+ */
+struct TraceEvent
+{
+    const char* name = "";          ///< Event name (string literal)
+    const char* category = "";      ///< Event category (string literal)
+    std::string detail;             ///< Optional dynamic detail (signature name, task description)
+    const char* argName = nullptr;  ///< Optional numeric argument name (string literal)
+    uint64_t argValue = 0;          ///< Optional numeric argument value
+    uint64_t startNs = 0;           ///< Start time relative to the trace origin (nanoseconds)
+    uint64_t durationNs = 0;        ///< Duration (nanoseconds)
+};
+
+/**
+ * @class TraceRecorder
+ * @brief Records scoped timeline events into per-thread buffers
+ *
+ * Events are exported as Chrome trace JSON which can be opened in Perfetto
+ * (ui.perfetto.dev) or chrome://tracing. When recording is disabled the only
+ * cost of a trace scope is a single relaxed atomic load.
+ */
+class TraceRecorder
+{
+public:
+    /**
+     * @brief Get the process-wide recorder
+     * @return Recorder instance
+     */
+    static TraceRecorder& Get();
+
+    /**
+     * @brief Check whether events are currently being recorded
+     * @return true if recording
+     */
+    static bool IsEnabled() { return s_enabled.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Discard previous events and start recording
+     */
+    void Start();
+
+    /**
+     * @brief Stop recording (recorded events are kept for export)
+     */
+    void Stop();
+
+    /**
+     * @brief Write recorded events as Chrome trace JSON
+     * @param filename Output file
+     * @return true if successful, false otherwise
+     */
+    bool ExportChromeTrace(const std::string& filename) const;
+
+    /**
+     * @brief Name the calling thread in exported traces
+     * @param name Thread name
+     */
+    void SetCurrentThreadName(const std::string& name);
+
+    /**
+     * @brief Arm or disarm recording of the next async task
+     * @param armed Whether the next task should be recorded
+     */
+    void SetArmedForNextTask(bool armed);
+
+    /**
+     * @brief Check whether the next async task will be recorded
+     * @return true if armed
+     */
+    bool IsArmedForNextTask() const;
+
+    /**
+     * @brief Start a task capture if armed (called by the task worker)
+     * @return true if this task started a capture
+     */
+    bool BeginTaskCapture();
+
+    /**
+     * @brief Stop the active task capture, export it and release its events
+     *
+     * Writes the whole capture synchronously; call it from the worker that ran
+     * the task, never from the UI thread.
+     * @return Path of the exported trace, empty on failure
+     */
+    std::string FinishTaskCapture();
+
+    /**
+     * @brief Get the number of task captures exported so far
+     * @return Export counter (changes whenever a new trace is written)
+     */
+    uint32_t GetExportCount() const;
+
+    /**
+     * @brief Get the path of the most recent exported trace
+     * @return File path, empty if none
+     */
+    std::string GetLastExportPath() const;
+
+    /**
+     * @brief Get current time relative to the trace origin
+     * @return Nanoseconds since the recorder was created
+     */
+    uint64_t NowNs() const;
+
+    /**
+     * @brief Append a completed event to the calling thread's buffer
+     * @param event Event to record
+     */
+    void Record(TraceEvent&& event);
+
+private:
+    /**
+     * @struct ThreadBuffer
+     * @brief Event storage owned by a single writer thread
+     */
+    struct ThreadBuffer
+    {
+        uint32_t threadIndex = 0;       ///< Stable index used as tid in the export
+        std::string threadName;         ///< Display name
+        std::mutex mutex;               ///< Uncontended except during export/clear
+        std::vector<TraceEvent> events; ///< Recorded events
+    };
+
+    /**
+     * @brief Constructor
+     */
+    TraceRecorder();
+
+    /**
+     * @brief Get (and register on first use) the calling thread's buffer
+     * @return Thread buffer
+     */
+    ThreadBuffer& GetThreadBuffer();
+
+    /**
+     * @brief Drop all recorded events and free their storage
+     */
+    void ReleaseEvents();
+
+private:
+    static std::atomic<bool> s_enabled;                     ///< Global recording switch
+
+    std::chrono::steady_clock::time_point m_origin;         ///< Time origin for all events
+    mutable std::mutex m_registryMutex;                     ///< Mutex for buffer registry
+    std::vector<std::shared_ptr<ThreadBuffer>> m_buffers;   ///< All thread buffers ever registered
+
+    std::atomic<bool> m_armedForNextTask;                   ///< Record the next async task
+    std::atomic<bool> m_taskCaptureActive;                  ///< A task capture is in progress
+    mutable std::mutex m_exportMutex;                       ///< Mutex for export bookkeeping
+    std::string m_lastExportPath;                           ///< Last written trace file
+    std::atomic<uint32_t> m_exportCount;                    ///< Number of task traces written
+
+    static constexpr size_t MAX_EVENTS_PER_THREAD = 1000000; ///< Cap to keep runaway captures bounded
+};
+
+/**
+ * @class ScopedTrace
+ * @brief RAII helper that records a complete event for its lifetime
+ */
+class ScopedTrace
+{
+public:
+    /**
+     * @brief Begin a scoped event
+     * @param name Event name (string literal)
+     * @param category Event category (string literal)
+     * @param argName Optional numeric argument name (string literal)
+     * @param argValue Optional numeric argument value
+     */
+    ScopedTrace(const char* name, const char* category, const char* argName = nullptr, uint64_t argValue = 0);
+
+    /**
+     * @brief Begin a scoped event with a dynamic detail string
+     * @param name Event name (string literal)
+     * @param category Event category (string literal)
+     * @param detail Detail string (only copied while recording)
+     */
+    ScopedTrace(const char* name, const char* category, const std::string& detail);
+
+    /**
+     * @brief End the event and record it
+     */
+    ~ScopedTrace();
+
+    ScopedTrace(const ScopedTrace&) = delete;
+    ScopedTrace& operator=(const ScopedTrace&) = delete;
+
+private:
+    TraceEvent m_event;     ///< Event being timed
+    bool m_active;          ///< Whether recording was enabled at scope entry
+};
+
+#define TRACE_CONCAT_INNER(a, b) a##b
+#define TRACE_CONCAT(a, b) TRACE_CONCAT_INNER(a, b)
+
+/**
+ * @brief Record a timeline event for the enclosing scope
+ *
+ * Usage: TRACE_SCOPE("ReadMemory", "dma", "size", size);
+ */
+#define TRACE_SCOPE(...) ScopedTrace TRACE_CONCAT(_traceScope, __LINE__)(__VA_ARGS__)
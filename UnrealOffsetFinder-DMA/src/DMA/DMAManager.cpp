@@ -1,6 +1,19 @@
 #include "DMAManager.h"
-#include <leechcore.h>
-#include <vmmdll.h>
+#include "../Core/Trace.h"
+#include "../Core/StringUtils.h"
+#include "../Scan/ModuleScanner.h"
+#include "../Scan/PatternScanner.h"
+#include "../Scan/SignatureIndex.h"
+#include "../Scan/ValueScanner.h"
+#include "../Unreal/NamePoolDumper.h"
+#include "../Unreal/ObjectEnumerator.h"
+#include "../Unreal/LayoutIndexer.h"
+#include "../Unreal/SymbolResolver.h"
+#include "../Core/PdbFile.h"
+#include "RecordingBackend.h"
+#ifndef UOF_NO_VMMDLL
+#include "VmmBackend.h"
+#endif
 #include <iostream>
 #include <sstream>
 #include <iomanip>
@@ -10,19 +23,25 @@
 #include <thread>
 #include <chrono>
 #include <cstring>
-#include <iomanip>
 #include <mutex>
 #include <condition_variable>
+#include <unordered_map>
 
 DMAManager::DMAManager()
-    : m_hLeechCore(nullptr)
-    , m_hVMM(nullptr)
+    : m_recorder(nullptr)
     , m_isInitialized(false)
     , m_isConnected(false)
     , m_currentProcessId(0)
-    , m_processRefreshTimer(0.0f)
-    , m_shouldStop(false)
-    , m_pendingOperations(0)
+    , m_processSnapshot(std::make_shared<const ProcessSnapshot>())
+    , m_snapshotGeneration(0)
+    , m_processList(std::make_shared<const std::vector<ProcessInfo>>())
+    , m_processListRefreshRequested(false)
+    , m_processListStopping(false)
+    , m_stateVersion(0)
+    , m_signatureStatsDirty(false)
+    , m_engineVersionGeneration(0)
+    , m_symbolResolverGeneration(0)
+    , m_signatureIndexGeneration(0)
 {
 }
 
@@ -32,26 +51,50 @@ DMAManager::~DMAManager()
 }
 
 bool DMAManager::Initialize()
+{
+#ifdef UOF_NO_VMMDLL
+    std::cerr << "Built without VMMDLL support - a memory backend must be supplied" << std::endl;
+    return false;
+#else
+    std::cout << "Initializing DMA Manager..." << std::endl;
+    
+    // Initialize LeechCore device
+    auto backend = std::make_unique<VmmBackend>();
+    if (!backend->Initialize())
+    {
+        std::cerr << "Failed to initialize LeechCore device" << std::endl;
+        return false;
+    }
+    
+    return Initialize(std::move(backend));
+#endif
+}
+
+bool DMAManager::Initialize(std::unique_ptr<MemoryBackend> backend)
 {
     try
     {
-        std::cout << "Initializing DMA Manager..." << std::endl;
-        
-        // Initialize LeechCore device
-        if (!InitializeDevice())
+        if (!backend)
         {
-            std::cerr << "Failed to initialize LeechCore device" << std::endl;
+            std::cerr << "No memory backend supplied" << std::endl;
             return false;
         }
         
+        // Every backend goes through the recorder so sessions can be captured at any time
+        auto recorder = std::make_unique<RecordingBackend>(std::move(backend));
+        m_recorder = recorder.get();
+        m_backend = std::move(recorder);
+        std::cout << "Using " << m_backend->GetName() << " memory backend" << std::endl;
+        
         m_isInitialized = true;
         
-        // Start worker thread
-        m_shouldStop = false;
-        m_workerThread = std::thread(&DMAManager::WorkerThread, this);
+        // Start worker threads
+        m_executor.Start(WORKER_THREADS, "DMA Worker");
         
-        // Initial process list refresh
+        // Initial process list refresh, later ones run in the background
         RefreshProcessList();
+        m_processListStopping = false;
+        m_processListThread = std::thread(&DMAManager::ProcessListThread, this);
         
         std::cout << "DMA Manager initialized successfully with async support" << std::endl;
         return true;
@@ -63,47 +106,64 @@ bool DMAManager::Initialize()
     }
 }
 
-void DMAManager::Update(float deltaTime)
+void DMAManager::Update()
 {
     if (!m_isInitialized)
         return;
     
-    // Update process refresh timer
-    m_processRefreshTimer += deltaTime;
+    // Process completed async tasks on main thread
+    bool changed = ProcessCompletedTasks();
+    
+    // Progress alone does not count; running operations are redrawn at the busy frame rate anyway
+    std::vector<TaskStatus> status = m_executor.GetStatus();
+    changed |= !std::equal(status.begin(), status.end(), m_operationStatus.begin(), m_operationStatus.end(),
+        [](const TaskStatus& a, const TaskStatus& b) {
+            return a.id == b.id && a.running == b.running && a.cancelled == b.cancelled;
+        });
+    m_operationStatus = std::move(status);
+    
+    auto snapshot = m_processSnapshot.load();
+    auto processList = m_processList.load();
+    changed |= snapshot != m_observedSnapshot || processList != m_observedProcessList;
+    m_observedSnapshot = std::move(snapshot);
+    m_observedProcessList = std::move(processList);
     
-    // Auto-refresh process list periodically
-    if (m_processRefreshTimer >= PROCESS_REFRESH_INTERVAL)
+    if (changed)
     {
-        RefreshProcessList();
-        m_processRefreshTimer = 0.0f;
+        m_stateVersion++;
     }
-    
-    // Process completed async tasks on main thread
-    ProcessCompletedTasks();
 }
 
 void DMAManager::Shutdown()
 {
-    // Stop worker thread
-    if (m_workerThread.joinable())
+    // Stop the process list refresher
     {
-        {
-            std::lock_guard<std::mutex> lock(m_taskQueueMutex);
-            m_shouldStop = true;
-        }
-        m_taskCondition.notify_all();
-        m_workerThread.join();
+        std::lock_guard<std::mutex> lock(m_processListMutex);
+        m_processListStopping = true;
+    }
+    m_processListCondition.notify_all();
+    if (m_processListThread.joinable())
+    {
+        m_processListThread.join();
     }
     
+    // Stop worker threads (running scans are cancelled, queued tasks dropped)
+    m_executor.Stop();
+    FlushSignatureStats();
+    m_operationStatus.clear();
+    m_observedSnapshot.reset();
+    m_observedProcessList.reset();
+    
     if (m_isConnected)
     {
         DetachFromProcess();
     }
     
-    CleanupDevice();
+    m_recorder = nullptr;
+    m_backend.reset();
     
     m_isInitialized = false;
-    m_processList.clear();
+    m_processList.store(std::make_shared<const std::vector<ProcessInfo>>());
     
     // Clear any remaining callbacks
     {
@@ -132,15 +192,16 @@ bool DMAManager::AttachToProcess(const std::string& processName)
         std::cout << "Attempting to attach to process: " << processName << std::endl;
         
         // Find process in the list
-        auto it = std::find_if(m_processList.begin(), m_processList.end(),
+        auto processes = m_processList.load();
+        auto it = std::find_if(processes->begin(), processes->end(),
             [&processName](const ProcessInfo& info) {
                 return info.processName == processName;
             });
         
-        if (it == m_processList.end())
+        if (it == processes->end())
         {
             std::cerr << "Process not found: " << processName << std::endl;
-            RefreshProcessList(); // Try refreshing the list
+            RequestProcessListRefresh(); // Try refreshing the list
             return false;
         }
         
@@ -163,34 +224,42 @@ bool DMAManager::AttachToProcess(uint32_t processId)
     
     try
     {
+        TRACE_SCOPE("AttachToProcess", "dma", "pid", processId);
         std::cout << "Attempting to attach to PID: " << processId << std::endl;
         
         // Find process info
-        auto it = std::find_if(m_processList.begin(), m_processList.end(),
+        auto processes = m_processList.load();
+        auto it = std::find_if(processes->begin(), processes->end(),
             [processId](const ProcessInfo& info) {
                 return info.processId == processId;
             });
         
-        if (it == m_processList.end())
+        if (it == processes->end())
         {
             std::cerr << "Process ID not found: " << processId << std::endl;
             return false;
         }
         
-        m_currentProcess = *it;
+        // Snapshot first, so a reader that sees the new PID also finds its process info
+        PublishProcessSnapshot(*it);
         m_currentProcessId = processId;
         m_isConnected = true;
         
-        // Get the real main module information now that we're attached
-        std::cout << "Getting main module information for attached process..." << std::endl;
-        uint64_t realMainBase = GetMainModuleBase(); // This will update m_currentProcess with correct info
-        if (realMainBase != 0)
+        if (m_recorder)
+        {
+            m_recorder->AddMarker("attach", processId);
+        }
+        
+        // Fetch the module map once; later module lookups are served from it
+        std::cout << "Getting module map for attached process..." << std::endl;
+        auto snapshot = LoadModuleMap(GetProcessSnapshot());
+        if (snapshot->modules && !snapshot->modules->GetModules().empty())
         {
             std::cout << "Updated process info with real main module data" << std::endl;
         }
         
-        std::cout << "Successfully attached to process: " << m_currentProcess.processName 
-                  << " (PID: " << m_currentProcess.processId << ")" << std::endl;
+        std::cout << "Successfully attached to process: " << it->processName 
+                  << " (PID: " << it->processId << ")" << std::endl;
         
         return true;
     }
@@ -205,11 +274,11 @@ void DMAManager::DetachFromProcess()
 {
     if (m_isConnected)
     {
-        std::cout << "Detaching from process: " << m_currentProcess.processName << std::endl;
+        std::cout << "Detaching from process: " << GetCurrentProcessInfo().processName << std::endl;
         
         m_isConnected = false;
-        m_currentProcess = ProcessInfo();
         m_currentProcessId = 0;
+        PublishProcessSnapshot(ProcessInfo());
         
         std::cout << "Process detached successfully" << std::endl;
     }
@@ -217,12 +286,34 @@ void DMAManager::DetachFromProcess()
 
 ProcessInfo DMAManager::GetCurrentProcessInfo() const
 {
-    return m_currentProcess;
+    return m_processSnapshot.load()->process;
+}
+
+std::shared_ptr<const ProcessSnapshot> DMAManager::GetProcessSnapshot() const
+{
+    return m_processSnapshot.load();
+}
+
+void DMAManager::PublishProcessSnapshot(const ProcessInfo& process)
+{
+    auto snapshot = std::make_shared<ProcessSnapshot>();
+    snapshot->process = process;
+    snapshot->generation = ++m_snapshotGeneration;
+    m_processSnapshot.store(std::move(snapshot));
 }
 
-std::vector<ProcessInfo> DMAManager::GetProcessList() const
+std::shared_ptr<const std::vector<ProcessInfo>> DMAManager::GetProcessList() const
 {
-    return m_processList;
+    return m_processList.load();
+}
+
+void DMAManager::RequestProcessListRefresh()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_processListMutex);
+        m_processListRefreshRequested = true;
+    }
+    m_processListCondition.notify_one();
 }
 
 size_t DMAManager::ReadMemory(uint64_t address, void* buffer, size_t size) const
@@ -238,11 +329,13 @@ size_t DMAManager::ReadMemory(uint64_t address, void* buffer, size_t size) const
         return 0;
     }
     
+    TRACE_SCOPE("ReadMemory", "dma", "size", size);
+
     try
     {
-        if (!m_hVMM)
+        if (!m_backend)
         {
-            // Mock read when VMM is not available
+            // Mock read when no backend is available
             std::cout << "Mock reading " << size << " bytes from address 0x" 
                       << std::hex << address << std::dec << std::endl;
             
@@ -254,31 +347,47 @@ size_t DMAManager::ReadMemory(uint64_t address, void* buffer, size_t size) const
             return size;
         }
         
-        // Real memory read using VMMDLL
-        DWORD cbRead = 0;
-        BOOL success = VMMDLL_MemReadEx(
-            static_cast<VMM_HANDLE>(m_hVMM),
-            m_currentProcessId,
-            address,
-            static_cast<PBYTE>(buffer),
-            static_cast<DWORD>(size),
-            &cbRead,
-            0  // flags
-        );
-        
-        if (success)
+        size_t bytesRead = m_backend->Read(m_currentProcessId, address, buffer, size);
+        if (bytesRead == 0)
         {
-            return static_cast<size_t>(cbRead);
+            std::cerr << "Memory read failed for address 0x" << std::hex << address << std::dec << std::endl;
         }
-        else
+        return bytesRead;
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << "Exception during memory read: " << e.what() << std::endl;
+        return 0;
+    }
+}
+
+size_t DMAManager::ReadMemoryBatch(std::vector<ScatterRead>& requests) const
+{
+    if (!IsConnected() || requests.empty())
+    {
+        return 0;
+    }
+    
+    TRACE_SCOPE("ReadMemoryBatch", "dma", "count", requests.size());
+    
+    try
+    {
+        if (!m_backend)
         {
-            std::cerr << "VMMDLL_MemRead failed for address 0x" << std::hex << address << std::dec << std::endl;
-            return 0;
+            size_t totalBytesRead = 0;
+            for (auto& request : requests)
+            {
+                request.bytesRead = ReadMemory(request.address, request.buffer, request.size);
+                totalBytesRead += request.bytesRead;
+            }
+            return totalBytesRead;
         }
+        
+        return m_backend->ReadScatter(m_currentProcessId, requests.data(), requests.size());
     }
     catch (const std::exception& e)
     {
-        std::cerr << "Exception during memory read: " << e.what() << std::endl;
+        std::cerr << "Exception during batched memory read: " << e.what() << std::endl;
         return 0;
     }
 }
@@ -298,32 +407,20 @@ size_t DMAManager::WriteMemory(uint64_t address, const void* buffer, size_t size
     
     try
     {
-        if (!m_hVMM)
+        if (!m_backend)
         {
-            // Mock write when VMM is not available
+            // Mock write when no backend is available
             std::cout << "Mock writing " << size << " bytes to address 0x" 
                       << std::hex << address << std::dec << std::endl;
             return size;
         }
         
-        // Real memory write using VMMDLL
-        BOOL success = VMMDLL_MemWrite(
-            static_cast<VMM_HANDLE>(m_hVMM),
-            m_currentProcessId,
-            address,
-            static_cast<PBYTE>(const_cast<void*>(buffer)),
-            static_cast<DWORD>(size)
-        );
-        
-        if (success)
-        {
-            return size;
-        }
-        else
+        size_t bytesWritten = m_backend->Write(m_currentProcessId, address, buffer, size);
+        if (bytesWritten == 0)
         {
-            std::cerr << "VMMDLL_MemWrite failed for address 0x" << std::hex << address << std::dec << std::endl;
-            return 0;
+            std::cerr << "Memory write failed for address 0x" << std::hex << address << std::dec << std::endl;
         }
+        return bytesWritten;
     }
     catch (const std::exception& e)
     {
@@ -405,348 +502,261 @@ std::string DMAManager::FormatHexAddress(uint64_t address, bool uppercase)
     return ss.str();
 }
 
-bool DMAManager::InitializeDevice()
+void DMAManager::RefreshProcessList()
 {
     try
     {
-        std::cout << "Initializing DMA device..." << std::endl;
+        if (!m_backend)
+        {
+            auto processes = std::make_shared<std::vector<ProcessInfo>>();
+            processes->emplace_back(1234, "There is no current process list.", 0x140000000, 0x10000000);
+            std::cout << "Error loading process list. Found " << processes->size() << " processes." << std::endl;
+            m_processList.store(std::move(processes));
+            return;
+        }
         
-        // First try with memory map, then fallback without
-        bool success = false;
+        TRACE_SCOPE("RefreshProcessList", "dma");
+        std::vector<ProcessInfo> fresh = m_backend->GetProcessList();
         
-        // Try with memory map first
-        if (CheckMemoryMapExists())
+        // Diff by PID (and name, as PIDs get reused): keep the known entries in
+        // their order, drop exited ones and append new ones
+        std::unordered_map<uint32_t, const ProcessInfo*> freshById;
+        freshById.reserve(fresh.size());
+        for (const auto& process : fresh)
         {
-            std::cout << "Found memory map, attempting initialization with mmap.txt..." << std::endl;
-            success = InitializeWithArgs(true);
+            freshById.emplace(process.processId, &process);
         }
         
-        // Fallback without memory map if first attempt failed
-        if (!success)
+        auto current = m_processList.load();
+        std::unordered_map<uint32_t, const ProcessInfo*> currentById;
+        currentById.reserve(current->size());
+        
+        auto merged = std::make_shared<std::vector<ProcessInfo>>();
+        merged->reserve(fresh.size());
+        size_t exited = 0;
+        for (const auto& process : *current)
         {
-            std::cout << "Attempting initialization without memory map..." << std::endl;
-            success = InitializeWithArgs(false);
+            auto it = freshById.find(process.processId);
+            if (it != freshById.end() && it->second->processName == process.processName)
+            {
+                merged->push_back(process);
+                currentById.emplace(process.processId, &process);
+            }
+            else
+            {
+                exited++;
+            }
         }
         
-        if (success)
+        size_t started = 0;
+        for (const auto& process : fresh)
         {
-            std::cout << "DMA device initialized successfully!" << std::endl;
-            return true;
+            if (currentById.find(process.processId) == currentById.end())
+            {
+                merged->push_back(process);
+                started++;
+            }
         }
-        else
+        
+        // Unchanged lists keep the published snapshot, so readers see no churn
+        if (started == 0 && exited == 0)
         {
-            std::cerr << "Failed to initialize DMA device" << std::endl;
-            return false;
+            return;
         }
+        
+        std::cout << "Process list refreshed. Found " << merged->size() << " processes ("
+                  << started << " new, " << exited << " exited)." << std::endl;
+        m_processList.store(std::move(merged));
     }
     catch (const std::exception& e)
     {
-        std::cerr << "Exception during device initialization: " << e.what() << std::endl;
-        return false;
+        std::cerr << "Exception during process list refresh: " << e.what() << std::endl;
     }
 }
 
-void DMAManager::CleanupDevice()
+void DMAManager::ProcessListThread()
 {
-    if (m_hVMM)
-    {
-        std::cout << "Closing VMM handle..." << std::endl;
-        VMMDLL_Close(static_cast<VMM_HANDLE>(m_hVMM));
-        m_hVMM = nullptr;
-    }
-    
-    if (m_hLeechCore)
-    {
-        // LeechCore is typically closed automatically when VMM is closed
-        m_hLeechCore = nullptr;
-    }
+    TraceRecorder::Get().SetCurrentThreadName("Process List");
     
-    std::cout << "DMA device cleanup complete" << std::endl;
-}
-
-void DMAManager::RefreshProcessList()
-{
-    try
+    std::unique_lock<std::mutex> lock(m_processListMutex);
+    while (true)
     {
-        m_processList.clear();
-        
-        if (!m_hVMM)
-        {
-            m_processList.emplace_back(1234, "There is no current process list.", 0x140000000, 0x10000000);
-            std::cout << "Error loading process list. Found " << m_processList.size() << " processes." << std::endl;
-            return;
-        }
-        
-        // Get actual process list using VMMDLL
-        SIZE_T cPIDs = 0;
-        
-        // First call to get the number of processes
-        if (!VMMDLL_PidList(static_cast<VMM_HANDLE>(m_hVMM), nullptr, &cPIDs))
-        {
-            std::cerr << "Failed to get process count" << std::endl;
-            return;
-        }
-        
-        if (cPIDs == 0)
-        {
-            std::cout << "No processes found" << std::endl;
-            return;
-        }
-        
-        // Allocate buffer for PIDs
-        std::vector<DWORD> pids(cPIDs);
+        m_processListCondition.wait_for(lock, std::chrono::duration<float>(PROCESS_REFRESH_INTERVAL),
+            [this]() { return m_processListStopping || m_processListRefreshRequested; });
         
-        // Second call to get actual PIDs
-        if (!VMMDLL_PidList(static_cast<VMM_HANDLE>(m_hVMM), pids.data(), &cPIDs))
+        if (m_processListStopping)
         {
-            std::cerr << "Failed to enumerate processes" << std::endl;
-            return;
-        }
-        
-        // Get information for each process
-        for (size_t i = 0; i < cPIDs; ++i)
-        {
-            DWORD pid = pids[i];
-            
-            // Get process information
-            SIZE_T cbProcessInfo = sizeof(VMMDLL_PROCESS_INFORMATION);
-            VMMDLL_PROCESS_INFORMATION processInfo = { 0 };
-            processInfo.magic = VMMDLL_PROCESS_INFORMATION_MAGIC;
-            processInfo.wVersion = VMMDLL_PROCESS_INFORMATION_VERSION;
-            
-            if (VMMDLL_ProcessGetInformation(static_cast<VMM_HANDLE>(m_hVMM), pid, &processInfo, &cbProcessInfo))
-            {
-                // Calculate approximate size (this is a rough estimate)
-                uint64_t baseSize = 0x1000000; // Default 16MB
-                
-                // Add process to list
-                m_processList.emplace_back(
-                    pid,
-                    processInfo.szName,
-                    processInfo.win.vaPEB ? processInfo.win.vaPEB : 0x140000000,
-                    baseSize
-                );
-            }
+            break;
         }
+        m_processListRefreshRequested = false;
         
-        std::cout << "Process list refreshed. Found " << m_processList.size() << " processes." << std::endl;
-    }
-    catch (const std::exception& e)
-    {
-        std::cerr << "Exception during process list refresh: " << e.what() << std::endl;
+        lock.unlock();
+        RefreshProcessList();
+        lock.lock();
     }
 }
 
-bool DMAManager::CheckMemoryMapExists()
+uint64_t DMAManager::GetModuleBase(const std::string& moduleName) const
 {
-    std::ifstream file("mmap.txt");
-    return file.good();
+    ProcessInfo module;
+    return FindModule(moduleName, module) ? module.baseAddress : 0;
 }
 
-bool DMAManager::InitializeWithArgs(bool useMemoryMap)
+uint64_t DMAManager::GetMainModuleBase() const
 {
-    // Clean up any existing VMM handle
-    if (m_hVMM)
+    if (!IsConnected() || !m_backend)
     {
-        std::cout << "Closing existing VMM handle..." << std::endl;
-        VMMDLL_Close(static_cast<VMM_HANDLE>(m_hVMM));
-        m_hVMM = nullptr;
+        return 0;
     }
 
-    // Build initialization arguments
-    std::vector<LPCSTR> initArgs;
-    
-    // Device connection string for FPGA
-    initArgs.push_back("-device");
-    initArgs.push_back("fpga");
-    
-    // Essential arguments
-    initArgs.push_back("-waitinitialize");    // Wait for full initialization
-    initArgs.push_back("-norefresh");         // Disable background refreshes
-    initArgs.push_back("-disable-python");   // Disable Python plugin system
-    initArgs.push_back("-disable-symbolserver"); // Disable symbol server
-    initArgs.push_back("-disable-symbols");  // Disable symbol lookups
-    initArgs.push_back("-disable-infodb");   // Disable infodb
-    
-    // Add memory map if requested and available
-    if (useMemoryMap && CheckMemoryMapExists())
+    // An empty map means the fetch failed at attach; retry now and then
+    auto snapshot = GetModuleSnapshot(false);
+    if (snapshot->modules && snapshot->modules->GetModules().empty())
     {
-        initArgs.push_back("-memmap");
-        initArgs.push_back("mmap.txt");
+        snapshot = GetModuleSnapshot(true);
     }
 
-    // Convert to array for VMMDLL_Initialize
-    std::vector<LPCSTR> argsArray(initArgs.begin(), initArgs.end());
-    
-    std::cout << "Initializing DMA device with " << argsArray.size() << " arguments..." << std::endl;
-    
-    // Initialize VMM
-    VMM_HANDLE hVMM = VMMDLL_Initialize(static_cast<DWORD>(argsArray.size()), argsArray.data());
-    
-    if (!hVMM)
+    return snapshot->GetMainModuleBase();
+}
+
+std::vector<ProcessInfo> DMAManager::GetModuleList() const
+{
+    if (!IsConnected() || !m_backend)
+    {
+        return {};
+    }
+
+    auto snapshot = GetModuleSnapshot(false);
+    return snapshot->modules ? snapshot->modules->GetModules() : std::vector<ProcessInfo>();
+}
+
+bool DMAManager::RefreshModuleMap()
+{
+    if (!IsConnected() || !m_backend)
     {
-        std::cerr << "VMMDLL_Initialize failed" << std::endl;
         return false;
     }
 
-    m_hVMM = hVMM;
-    std::cout << "VMM initialized successfully" << std::endl;
-    
-    return true;
+    auto snapshot = LoadModuleMap(m_processSnapshot.load());
+    return snapshot->modules && !snapshot->modules->GetModules().empty();
 }
 
-uint64_t DMAManager::GetModuleBase(const std::string& moduleName) const
+std::vector<MemoryRegion> DMAManager::GetMemoryRegions() const
 {
-    if (!IsConnected() || !m_hVMM)
+    if (!IsConnected() || !m_backend)
     {
-        return 0;
+        return {};
     }
 
+    TRACE_SCOPE("GetMemoryRegions", "dma");
+
     try
     {
-        // Use VMMDLL_ProcessGetModuleBaseU for direct module base lookup
-        ULONG64 moduleBase = VMMDLL_ProcessGetModuleBaseU(
-            static_cast<VMM_HANDLE>(m_hVMM), 
-            m_currentProcessId, 
-            moduleName.c_str()
-        );
-        
-        return static_cast<uint64_t>(moduleBase);
+        return m_backend->GetMemoryRegions(m_currentProcessId);
     }
     catch (const std::exception& e)
     {
-        std::cerr << "Exception in GetModuleBase: " << e.what() << std::endl;
-        return 0;
+        std::cerr << "Exception while enumerating memory regions: " << e.what() << std::endl;
+        return {};
     }
 }
 
-uint64_t DMAManager::GetMainModuleBase() const
+bool DMAManager::FindModule(const std::string& moduleName, ProcessInfo& module) const
 {
-    if (!IsConnected() || !m_hVMM)
+    if (!IsConnected() || !m_backend)
     {
-        return 0;
+        return false;
     }
 
-    try
+    TRACE_SCOPE("ModuleBaseLookup", "dma", moduleName);
+
+    auto snapshot = GetModuleSnapshot(false);
+    const ProcessInfo* entry = snapshot->modules ? snapshot->modules->Find(moduleName) : nullptr;
+    if (!entry)
     {
-        // Get the main executable module using VMMDLL
-        PVMMDLL_MAP_MODULE pModuleMap = NULL;
-        
-        if (!VMMDLL_Map_GetModuleU(static_cast<VMM_HANDLE>(m_hVMM), m_currentProcessId, &pModuleMap, VMMDLL_MODULE_FLAG_NORMAL))
-        {
-            std::cerr << "Failed to get module map for main module detection" << std::endl;
-            return m_currentProcess.baseAddress; // Fallback to process base
-        }
+        // The module may have been loaded since the map was fetched
+        snapshot = GetModuleSnapshot(true);
+        entry = snapshot->modules ? snapshot->modules->Find(moduleName) : nullptr;
+    }
 
-        if (!pModuleMap || pModuleMap->cMap == 0)
-        {
-            if (pModuleMap)
-                VMMDLL_MemFree(pModuleMap);
-            return m_currentProcess.baseAddress; // Fallback to process base
-        }
+    if (!entry)
+    {
+        return false;
+    }
+    module = *entry;
+    return true;
+}
 
-        // Find the main executable module (usually the first one or the one matching process name)
-        uint64_t mainModuleBase = 0;
-        size_t mainModuleSize = 0;
-        
-        // First, try to find module with same name as process
-        std::string processBaseName = m_currentProcess.processName;
-        
-        for (DWORD i = 0; i < pModuleMap->cMap; ++i)
-        {
-            const auto& moduleEntry = pModuleMap->pMap[i];
-            std::string moduleName = moduleEntry.uszText;
-            
-            // Check if this module matches our process name
-            if (_stricmp(moduleName.c_str(), processBaseName.c_str()) == 0)
-            {
-                mainModuleBase = moduleEntry.vaBase;
-                mainModuleSize = moduleEntry.cbImageSize;
-                std::cout << "Found main module by name: " << moduleName 
-                          << " (Base: " << FormatHexAddress(mainModuleBase) 
-                          << ", Size: " << FormatHexAddress(mainModuleSize) << ")" << std::endl;
-                break;
-            }
-        }
-        
-        // If not found by name, use the first module (usually the main executable)
-        if (mainModuleBase == 0 && pModuleMap->cMap > 0)
-        {
-            const auto& moduleEntry = pModuleMap->pMap[0];
-            mainModuleBase = moduleEntry.vaBase;
-            mainModuleSize = moduleEntry.cbImageSize;
-            std::cout << "Using first module as main: " << moduleEntry.uszText 
-                      << " (Base: " << FormatHexAddress(mainModuleBase) 
-                      << ", Size: " << FormatHexAddress(mainModuleSize) << ")" << std::endl;
-        }
+std::shared_ptr<const ProcessSnapshot> DMAManager::GetModuleSnapshot(bool missed) const
+{
+    auto snapshot = m_processSnapshot.load();
+    if (!snapshot->modules)
+    {
+        return LoadModuleMap(snapshot);
+    }
 
-        VMMDLL_MemFree(pModuleMap);
-        
-        // Update the current process info with correct module size
-        if (mainModuleBase != 0 && mainModuleSize != 0)
+    if (missed)
+    {
+        // Misses refetch at most once per interval so lookups of absent modules stay cheap
+        float age = std::chrono::duration<float>(std::chrono::steady_clock::now() - snapshot->modules->GetFetchTime()).count();
+        if (age >= MODULE_MAP_MISS_REFRESH_INTERVAL)
         {
-            const_cast<DMAManager*>(this)->m_currentProcess.baseAddress = mainModuleBase;
-            const_cast<DMAManager*>(this)->m_currentProcess.imageSize = mainModuleSize;
+            return LoadModuleMap(snapshot);
         }
-        
-        return mainModuleBase != 0 ? mainModuleBase : m_currentProcess.baseAddress;
-    }
-    catch (const std::exception& e)
-    {
-        std::cerr << "Exception in GetMainModuleBase: " << e.what() << std::endl;
-        return m_currentProcess.baseAddress;
     }
+    return snapshot;
 }
 
-std::vector<ProcessInfo> DMAManager::GetModuleList() const
+std::shared_ptr<const ProcessSnapshot> DMAManager::LoadModuleMap(std::shared_ptr<const ProcessSnapshot> snapshot) const
 {
-    std::vector<ProcessInfo> moduleList;
-
-    if (!IsConnected() || !m_hVMM)
+    if (snapshot->process.processId == 0 || !m_backend)
     {
-        return moduleList;
+        return snapshot;
     }
 
+    TRACE_SCOPE("ModuleMapLookup", "dma");
+
     try
     {
-        PVMMDLL_MAP_MODULE pModuleMap = NULL;
-        
-        // Get module map using VMMDLL_Map_GetModuleU
-        if (!VMMDLL_Map_GetModuleU(static_cast<VMM_HANDLE>(m_hVMM), m_currentProcessId, &pModuleMap, VMMDLL_MODULE_FLAG_NORMAL))
-        {
-            return moduleList;
-        }
+        auto modules = std::make_shared<const ModuleMap>(
+            m_backend->GetModuleList(snapshot->process.processId), snapshot->process.processName);
+
+        auto updated = std::make_shared<ProcessSnapshot>(*snapshot);
+        updated->modules = modules;
 
-        if (!pModuleMap || pModuleMap->cMap == 0)
+        // Find the main executable module (the one matching the process name, else the first one)
+        if (const ProcessInfo* mainModule = modules->GetMainModule())
         {
-            if (pModuleMap)
+            std::cout << "Main module: " << mainModule->processName 
+                      << " (Base: " << FormatHexAddress(mainModule->baseAddress) 
+                      << ", Size: " << FormatHexAddress(mainModule->imageSize) << ", "
+                      << modules->GetModules().size() << " modules loaded)" << std::endl;
+            
+            if (mainModule->baseAddress != 0 && mainModule->imageSize != 0)
             {
-                VMMDLL_MemFree(pModuleMap);
+                updated->process.baseAddress = mainModule->baseAddress;
+                updated->process.imageSize = mainModule->imageSize;
             }
-            return moduleList;
         }
-
-        // Convert to ProcessInfo structures
-        for (DWORD i = 0; i < pModuleMap->cMap; ++i)
+        else
         {
-            const auto& moduleEntry = pModuleMap->pMap[i];
-            
-            moduleList.emplace_back(
-                0, // No PID for modules
-                std::string(moduleEntry.uszText),
-                moduleEntry.vaBase,
-                moduleEntry.cbImageSize
-            );
+            std::cerr << "Failed to get module map for main module detection" << std::endl;
         }
 
-        VMMDLL_MemFree(pModuleMap);
+        // Publish unless the snapshot was replaced (re-attach, concurrent refresh) meanwhile
+        std::shared_ptr<const ProcessSnapshot> expected = snapshot;
+        std::shared_ptr<const ProcessSnapshot> published = updated;
+        if (m_processSnapshot.compare_exchange_strong(expected, published))
+        {
+            return published;
+        }
+        return expected;
     }
     catch (const std::exception& e)
     {
-        std::cerr << "Exception in GetModuleList: " << e.what() << std::endl;
+        std::cerr << "Exception while loading module map: " << e.what() << std::endl;
+        return snapshot;
     }
-
-    return moduleList;
 }
 
 uint64_t DMAManager::ScanSignature(const std::string& pattern, uint64_t startAddress, size_t scanSize) const
@@ -781,23 +791,54 @@ uint64_t DMAManager::ScanSignature(const std::string& pattern, uint64_t startAdd
     // If no scan size specified, use main module size
     if (scanSize == 0)
     {
-        scanSize = m_currentProcess.imageSize;
+        scanSize = GetCurrentProcessInfo().imageSize;
         if (scanSize == 0)
         {
             scanSize = 0x1000000; // Default 16MB
         }
     }
 
+    TRACE_SCOPE("ScanSignature", "scan", pattern);
     std::cout << "Scanning for pattern: " << pattern << std::endl;
     std::cout << "Start: 0x" << std::hex << startAddress << ", Size: 0x" << scanSize << std::dec << std::endl;
 
+    // A range the main module capture read in full is answered from its index without any device read
+    if (auto index = GetSignatureIndex())
+    {
+        uint64_t indexBase = index->GetBaseAddress();
+        if (startAddress >= indexBase && startAddress - indexBase + scanSize <= index->GetImageSize() &&
+            index->IsCaptured(static_cast<size_t>(startAddress - indexBase), static_cast<size_t>(startAddress - indexBase + scanSize)))
+        {
+            size_t begin = static_cast<size_t>(startAddress - indexBase);
+            std::vector<uint32_t> offsets;
+            SignatureQueryStats stats;
+            index->Search(patternBytes, mask, begin, begin + scanSize, 1, offsets, &stats);
+            std::cout << "Index query: " << (stats.indexed ? std::to_string(stats.lists) + " posting lists, " : "linear scan, ")
+                      << stats.candidates << " candidates verified" << std::endl;
+            if (offsets.empty())
+            {
+                std::cout << "Pattern not found" << std::endl;
+                return 0;
+            }
+            std::cout << "Pattern found at: 0x" << std::hex << indexBase + offsets[0] << std::dec << std::endl;
+            return indexBase + offsets[0];
+        }
+    }
+
     // Scan in chunks to avoid memory issues
     const size_t CHUNK_SIZE = 0x10000; // 64KB chunks
     std::vector<uint8_t> buffer(CHUNK_SIZE);
 
     for (size_t offset = 0; offset < scanSize; offset += CHUNK_SIZE - patternBytes.size())
     {
-        size_t currentChunkSize = min(CHUNK_SIZE, scanSize - offset);
+        if (TaskExecutor::IsCurrentTaskCancelled())
+        {
+            std::cout << "Signature scan cancelled" << std::endl;
+            return 0;
+        }
+        TaskExecutor::ReportProgress(static_cast<float>(offset) / scanSize);
+
+        size_t currentChunkSize = std::min(CHUNK_SIZE, scanSize - offset);
         uint64_t currentAddress = startAddress + offset;
 
         size_t bytesRead = ReadMemory(currentAddress, buffer.data(), currentChunkSize);
@@ -807,6 +848,7 @@ uint64_t DMAManager::ScanSignature(const std::string& pattern, uint64_t startAdd
         }
 
         // Search for pattern in this chunk
+        TRACE_SCOPE("MatchChunk", "scan", "offset", offset);
         size_t patternOffset = FindPatternInBuffer(buffer.data(), bytesRead, patternBytes, mask);
         if (patternOffset != SIZE_MAX)
         {
@@ -828,36 +870,23 @@ uint64_t DMAManager::ScanSignatureInModule(const std::string& pattern, const std
     }
 
     // Get the module information
-    uint64_t moduleBase = GetModuleBase(moduleName);
-    if (moduleBase == 0)
+    ProcessInfo module;
+    if (!FindModule(moduleName, module))
     {
         std::cerr << "Module not found: " << moduleName << std::endl;
         return 0;
     }
 
-    // Get module list to find the size
-    auto modules = GetModuleList();
-    size_t moduleSize = 0;
-    
-    for (const auto& module : modules)
-    {
-        if (_stricmp(module.processName.c_str(), moduleName.c_str()) == 0)
-        {
-            moduleSize = module.imageSize;
-            break;
-        }
-    }
-
-    if (moduleSize == 0)
+    if (module.imageSize == 0)
     {
         std::cerr << "Failed to get module size for: " << moduleName << std::endl;
         return 0;
     }
 
-    std::cout << "Scanning in module: " << moduleName << " (Base: 0x" << std::hex << moduleBase 
-              << ", Size: 0x" << moduleSize << ")" << std::dec << std::endl;
+    std::cout << "Scanning in module: " << moduleName << " (Base: 0x" << std::hex << module.baseAddress 
+              << ", Size: 0x" << module.imageSize << ")" << std::dec << std::endl;
 
-    return ScanSignature(pattern, moduleBase, moduleSize);
+    return ScanSignature(pattern, module.baseAddress, module.imageSize);
 }
 
 uint64_t DMAManager::ReadMultiLevelPointer(uint64_t baseAddress, const std::vector<uint64_t>& offsets) const
@@ -933,83 +962,118 @@ size_t DMAManager::ReadMemoryEx(uint64_t address, void* buffer, size_t size, int
 
 bool DMAManager::ParseSignaturePattern(const std::string& pattern, std::vector<uint8_t>& bytes, std::string& mask) const
 {
-    bytes.clear();
-    mask.clear();
-
-    std::istringstream iss(pattern);
-    std::string token;
-
-    while (iss >> token)
-    {
-        if (token == "??" || token == "?")
-        {
-            // Wildcard byte
-            bytes.push_back(0x00);
-            mask += '?';
-        }
-        else
-        {
-            // Regular hex byte
-            try
-            {
-                unsigned long value = std::stoul(token, nullptr, 16);
-                if (value > 0xFF)
-                {
-                    return false; // Invalid byte value
-                }
-                bytes.push_back(static_cast<uint8_t>(value));
-                mask += 'x';
-            }
-            catch (const std::exception&)
-            {
-                return false; // Invalid hex string
-            }
-        }
-    }
-
-    return !bytes.empty();
+    return PatternScanner::ParsePattern(pattern, bytes, mask);
 }
 
 size_t DMAManager::FindPatternInBuffer(const uint8_t* buffer, size_t bufferSize, 
                                       const std::vector<uint8_t>& pattern, const std::string& mask) const
 {
-    if (!buffer || bufferSize == 0 || pattern.empty() || pattern.size() != mask.size())
+    return CompiledPattern(pattern, mask).Find(buffer, bufferSize);
+}
+
+std::shared_ptr<const SignatureIndex> DMAManager::BuildSignatureIndex(std::string& error)
+{
+    if (!IsConnected())
     {
-        return SIZE_MAX;
+        error = "Not connected to any process";
+        return nullptr;
     }
 
-    if (pattern.size() > bufferSize)
+    auto snapshot = m_processSnapshot.load();
+    uint64_t moduleBase = GetMainModuleBase();
+    size_t moduleSize = GetCurrentProcessInfo().imageSize;
+    if (moduleBase == 0 || moduleSize == 0)
     {
-        return SIZE_MAX;
+        error = "Main module base or size unknown";
+        return nullptr;
+    }
+    if (moduleSize > SignatureIndex::MAX_IMAGE_SIZE)
+    {
+        error = "Main module too large to index: " + FormatHexAddress(moduleSize);
+        return nullptr;
     }
 
-    for (size_t i = 0; i <= bufferSize - pattern.size(); ++i)
+    // Read page by page so the pages that fail are known; queries touching them go to the device
+    std::vector<uint8_t> image(moduleSize);
+    std::vector<std::pair<size_t, size_t>> missing;
+    size_t bytesRead = 0;
     {
-        bool found = true;
-        
-        for (size_t j = 0; j < pattern.size(); ++j)
+        TRACE_SCOPE("ReadModuleImage", "dma", "size", moduleSize);
+        std::vector<ScatterRead> requests;
+        for (size_t batchStart = 0; batchStart < moduleSize; batchStart += INDEX_READ_BATCH)
         {
-            if (mask[j] == 'x' && buffer[i + j] != pattern[j])
+            if (TaskExecutor::IsCurrentTaskCancelled())
             {
-                found = false;
-                break;
+                error = "Signature indexing cancelled";
+                return nullptr;
             }
-        }
-        
-        if (found)
-        {
-            return i;
-        }
-    }
+            TaskExecutor::ReportProgress(0.5f * batchStart / moduleSize, "Reading main module");
 
-    return SIZE_MAX;
-}
+            size_t batchEnd = std::min(moduleSize, batchStart + INDEX_READ_BATCH);
+            requests.clear();
+            for (size_t offset = batchStart; offset < batchEnd; offset += INDEX_READ_PAGE)
+            {
+                requests.emplace_back(moduleBase + offset, image.data() + offset, std::min(INDEX_READ_PAGE, batchEnd - offset));
+            }
+            bytesRead += ReadMemoryBatch(requests);
 
-std::vector<UnrealSignature> DMAManager::GetUnrealSignatures() const
-{
+            for (const ScatterRead& request : requests)
+            {
+                if (request.bytesRead == request.size)
+                    continue;
+
+                size_t begin = static_cast<size_t>(request.address - moduleBase);
+                std::fill_n(image.begin() + begin, request.size, 0);
+                if (!missing.empty() && missing.back().second == begin)
+                {
+                    missing.back().second = begin + request.size;
+                }
+                else
+                {
+                    missing.emplace_back(begin, begin + request.size);
+                }
+            }
+        }
+    }
+    if (bytesRead == 0)
+    {
+        error = "Failed to read main module at " + FormatHexAddress(moduleBase);
+        return nullptr;
+    }
+
+    TaskExecutor::ReportProgress(0.5f, "Indexing trigrams");
+    auto index = std::make_shared<SignatureIndex>();
+    index->Build(std::move(image), moduleBase, std::move(missing));
+
+    std::lock_guard<std::mutex> lock(m_signatureIndexMutex);
+    m_signatureIndex = index;
+    m_signatureIndexGeneration = snapshot->generation;
+    return index;
+}
+
+std::shared_ptr<const SignatureIndex> DMAManager::GetSignatureIndex() const
+{
+    auto snapshot = m_processSnapshot.load();
+    std::lock_guard<std::mutex> lock(m_signatureIndexMutex);
+    if (m_signatureIndexGeneration != 0 && m_signatureIndexGeneration == snapshot->generation)
+    {
+        return m_signatureIndex;
+    }
+    return nullptr;
+}
+
+void DMAManager::DropSignatureIndex()
+{
+    std::lock_guard<std::mutex> lock(m_signatureIndexMutex);
+    m_signatureIndex.reset();
+    m_signatureIndexGeneration = 0;
+}
+
+std::vector<UnrealSignature> DMAManager::GetUnrealSignatures()
+{
     std::vector<UnrealSignature> signatures;
 
-    // GWorld signatures
+    // GWorld signatures (no version hints: ranked by recorded hits, then table order)
     signatures.emplace_back("GWorld (Variant 1)",
         std::vector<uint8_t>{0x48, 0x89, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8B, 0x00, 0x00, 0x00, 0xF6, 0x86, 0x3B, 0x01, 0x00, 0x00, 0x40},
         "xxx?????x???xxxxxxx", "GWorld");
@@ -1046,24 +1110,24 @@ std::vector<UnrealSignature> DMAManager::GetUnrealSignatures() const
         std::vector<uint8_t>{0x48, 0x8B, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8B, 0x5C, 0x24, 0x00, 0x48, 0x8B, 0xC7},
         "xxx????xxxx?xxx", "GWorld");
 
-    // GNames signatures
+    // GNames signatures (lea rcx up to UE 4.27, mov rax from UE 5.0; see AdjustFoundOffsetForGroup)
     signatures.emplace_back("GNames (Variant 1)",
         std::vector<uint8_t>{0x48, 0x8D, 0x0D, 0x00, 0x00, 0x00, 0x00, 0xE8, 0x00, 0x00, 0xFE, 0xFF, 0x4C, 0x8B, 0xC0, 0xC6, 0x05, 0x00, 0x00, 0x00, 0x00, 0x01},
-        "xxx????x??xxxxxxx????x", "GNames");
+        "xxx????x??xxxxxxx????x", "GNames", 0, 427);
 
     signatures.emplace_back("GNames (Variant 2)",
         std::vector<uint8_t>{0x48, 0x8D, 0x0D, 0x00, 0x00, 0x00, 0x03, 0xE8, 0x00, 0x00, 0xFF, 0xFF, 0x4C, 0x00, 0xC0},
-        "xxx???xx??xxx?x", "GNames");
+        "xxx???xx??xxx?x", "GNames", 0, 427);
 
     signatures.emplace_back("GNames (Variant 3)",
         std::vector<uint8_t>{0x48, 0x8D, 0x0D, 0x00, 0x00, 0x00, 0x00, 0xE8, 0x00, 0x00, 0xFF, 0xFF, 0x48, 0x8B, 0xD0, 0xC6, 0x05, 0x00, 0x00, 0x00, 0x00, 0x01},
-        "xxx????x??xxxxxxx????x", "GNames");
+        "xxx????x??xxxxxxx????x", "GNames", 0, 427);
 
     signatures.emplace_back("GNames (Variant 4)",
         std::vector<uint8_t>{0x48, 0x8B, 0x05, 0x00, 0x00, 0x00, 0x02, 0x48, 0x85, 0xC0, 0x75, 0x5F, 0xB9, 0x08, 0x08, 0x00},
-        "xxx???xxxxxxxxx?", "GNames");
+        "xxx???xxxxxxxxx?", "GNames", 500, 0);
 
-    // GObjects signatures
+    // GObjects signatures (no version hints: ranked by recorded hits, then table order)
     signatures.emplace_back("GObjects (Variant 1)",
         std::vector<uint8_t>{0x4C, 0x8B, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x99, 0x0F, 0xB7, 0xD2},
         "xxx????xxxx", "GObjects");
@@ -1087,7 +1151,131 @@ std::vector<UnrealSignature> DMAManager::GetUnrealSignatures() const
     return signatures;
 }
 
-UnrealGlobals DMAManager::ScanUnrealGlobals() const
+EngineVersion DMAManager::GetEngineVersion() const
+{
+    auto snapshot = m_processSnapshot.load();
+    {
+        std::lock_guard<std::mutex> lock(m_signatureMutex);
+        if (m_engineVersionGeneration != 0 && m_engineVersionGeneration == snapshot->generation)
+        {
+            return m_engineVersion;
+        }
+    }
+
+    if (!IsConnected())
+    {
+        return EngineVersion();
+    }
+
+    TRACE_SCOPE("DetectEngineVersion", "scan");
+    EngineVersion version;
+    std::string error;
+    if (EngineVersion::Read(*this, version, error))
+    {
+        std::cout << "Engine version: " << version.ToString() << std::endl;
+    }
+    else
+    {
+        std::cout << "Engine version not detected: " << error << std::endl;
+    }
+
+    std::lock_guard<std::mutex> lock(m_signatureMutex);
+    m_engineVersion = version;
+    m_engineVersionGeneration = snapshot->generation;
+    return version;
+}
+
+bool DMAManager::SetSignatureStatsFile(const std::string& filename)
+{
+    // Hits recorded so far belong to the previous file
+    FlushSignatureStats();
+
+    std::lock_guard<std::mutex> lock(m_signatureMutex);
+    m_signatureStatsFile = filename;
+    if (filename.empty())
+    {
+        return true;
+    }
+
+    if (!std::ifstream(filename).is_open())
+    {
+        std::cout << "No signature stats yet, will create " << filename << std::endl;
+        return true;
+    }
+
+    std::string error;
+    if (!m_signatureStats.LoadFromFile(filename, error))
+    {
+        // Keep the broken file for inspection instead of overwriting it on the next match
+        std::cerr << error << std::endl;
+        m_signatureStatsFile.clear();
+        return false;
+    }
+    std::cout << "Loaded " << m_signatureStats.GetCount() << " signature stats from " << filename << std::endl;
+    return true;
+}
+
+void DMAManager::ClearSignatureStats()
+{
+    std::lock_guard<std::mutex> lock(m_signatureMutex);
+    m_signatureStats.Clear();
+    m_signatureStatsDirty = true;
+}
+
+void DMAManager::FlushSignatureStats() const
+{
+    // The file lock is taken first so concurrent flushes write their copies in order
+    std::lock_guard<std::mutex> fileLock(m_signatureStatsFileMutex);
+
+    SignatureStats stats;
+    std::string filename;
+    {
+        std::lock_guard<std::mutex> lock(m_signatureMutex);
+        if (!m_signatureStatsDirty || m_signatureStatsFile.empty())
+        {
+            return;
+        }
+        stats = m_signatureStats;
+        filename = m_signatureStatsFile;
+        m_signatureStatsDirty = false;
+    }
+
+    // Written without m_signatureMutex so scans ranking or recording variants meanwhile do not wait on the file
+    std::string error;
+    if (!stats.SaveToFile(filename, error))
+    {
+        std::cerr << error << std::endl;
+    }
+}
+
+SignatureStats DMAManager::GetSignatureStats() const
+{
+    std::lock_guard<std::mutex> lock(m_signatureMutex);
+    return m_signatureStats;
+}
+
+std::vector<UnrealSignature> DMAManager::GetRankedSignatures(const std::string& groupName, const EngineVersion& version) const
+{
+    std::vector<UnrealSignature> signatures;
+    for (auto& sig : GetUnrealSignatures())
+    {
+        if (sig.group == groupName)
+            signatures.push_back(std::move(sig));
+    }
+
+    std::lock_guard<std::mutex> lock(m_signatureMutex);
+    m_signatureStats.Rank(version, signatures);
+    return signatures;
+}
+
+void DMAManager::RecordSignatureHit(const EngineVersion& version, const std::string& signature) const
+{
+    std::lock_guard<std::mutex> lock(m_signatureMutex);
+    m_signatureStats.Record(version, signature);
+    m_signatureStatsDirty = true;
+}
+
+UnrealGlobals DMAManager::ScanUnrealGlobals(bool allModules) const
 {
     UnrealGlobals globals;
     
@@ -1097,73 +1285,265 @@ UnrealGlobals DMAManager::ScanUnrealGlobals() const
         return globals;
     }
 
+    TRACE_SCOPE("ScanUnrealGlobals", "scan");
     std::cout << "Scanning for Unreal Engine globals..." << std::endl;
-    std::cout << "Current process: " << m_currentProcess.processName 
-              << " (PID: " << m_currentProcess.processId << ")" << std::endl;
-    std::cout << "Process base: " << FormatHexAddress(m_currentProcess.baseAddress) 
-              << ", size: " << FormatHexAddress(m_currentProcess.imageSize) << std::endl;
+    ProcessInfo process = GetCurrentProcessInfo();
+    std::cout << "Current process: " << process.processName 
+              << " (PID: " << process.processId << ")" << std::endl;
+    std::cout << "Process base: " << FormatHexAddress(process.baseAddress) 
+              << ", size: " << FormatHexAddress(process.imageSize) << std::endl;
+    globals.moduleBase = GetMainModuleBase();
+    globals.engineVersion = GetEngineVersion();
 
     // Scan for each global type
-    globals.GWorld = ScanUnrealGlobal("GWorld");
-    globals.GNames = ScanUnrealGlobal("GNames");
-    globals.GObjects = ScanUnrealGlobal("GObjects");
+    const char* groups[] = { "GWorld", "GNames", "GObjects" };
+    uint64_t* results[] = { &globals.GWorld, &globals.GNames, &globals.GObjects };
+    GlobalSource* sources[] = { &globals.GWorldSource, &globals.GNamesSource, &globals.GObjectsSource };
+    GlobalModule* modules[] = { &globals.GWorldModule, &globals.GNamesModule, &globals.GObjectsModule };
+    MainModuleImage image;  // Read at most once, by the first group that needs a signature scan
+    for (size_t i = 0; i < 3; ++i)
+    {
+        if (TaskExecutor::IsCurrentTaskCancelled())
+        {
+            std::cout << "Unreal globals scan cancelled" << std::endl;
+            return globals;
+        }
+        TaskExecutor::ReportProgress(i / 3.0f, std::string("Scanning for ") + groups[i]);
+        if (!allModules)
+        {
+            *results[i] = ResolveUnrealGlobal(groups[i], sources[i], &image);
+        }
+        else if (auto resolver = GetSymbolResolver())
+        {
+            // Symbols first; whatever they miss is left to the all-modules scan below
+            std::string symbol;
+            *results[i] = resolver->Resolve(groups[i], *sources[i], symbol);
+        }
+
+        if (*results[i])
+        {
+            *modules[i] = { process.processName, globals.moduleBase };
+        }
+    }
+
+    if (allModules && !TaskExecutor::IsCurrentTaskCancelled())
+    {
+        std::vector<UnrealSignature> signatures;
+        for (size_t i = 0; i < 3; ++i)
+        {
+            if (*results[i] == 0)
+            {
+                auto ranked = GetRankedSignatures(groups[i], globals.engineVersion);
+                signatures.insert(signatures.end(), ranked.begin(), ranked.end());
+            }
+        }
+
+        // Symbols may have covered every global
+        if (!signatures.empty())
+        {
+            ModuleScanner scanner(*this);
+            std::vector<ModuleScanHit> hits;
+            std::string error;
+            if (!scanner.Scan(signatures, hits, error))
+            {
+                std::cerr << error << std::endl;
+            }
+            else
+            {
+                const ModuleScanStats& stats = scanner.GetLastStats();
+                std::cout << "Scanned " << stats.modulesScanned << " of " << stats.modules << " modules: "
+                          << stats.bytesRead << " bytes in " << stats.batches << " batches, "
+                          << std::fixed << std::setprecision(3) << stats.seconds << std::defaultfloat << "s" << std::endl;
+                for (const ModuleScanHit& hit : hits)
+                {
+                    size_t i = static_cast<size_t>(std::find(std::begin(groups), std::end(groups), hit.group) - std::begin(groups));
+                    if (i >= 3)
+                        continue;
+
+                    *results[i] = hit.address;
+                    *sources[i] = GlobalSource::Signature;
+                    *modules[i] = { hit.moduleName, hit.moduleBase };
+                    RecordSignatureHit(globals.engineVersion, hit.signature);
+                }
+            }
+        }
+    }
+    TaskExecutor::ReportProgress(1.0f);
+    FlushSignatureStats();
 
     // Log results
     std::cout << "Unreal Engine globals scan results:" << std::endl;
-    std::cout << "  GWorld:   " << (globals.GWorld ? FormatHexAddress(globals.GWorld) : "Not found") << std::endl;
-    std::cout << "  GNames:   " << (globals.GNames ? FormatHexAddress(globals.GNames) : "Not found") << std::endl;
-    std::cout << "  GObjects: " << (globals.GObjects ? FormatHexAddress(globals.GObjects) : "Not found") << std::endl;
+    std::cout << "  Engine:   " << globals.engineVersion.ToString() << std::endl;
+    const char* labels[] = { "  GWorld:   ", "  GNames:   ", "  GObjects: " };
+    for (size_t i = 0; i < 3; ++i)
+    {
+        std::cout << labels[i];
+        if (*results[i])
+            std::cout << FormatHexAddress(*results[i]) << " (" << SymbolResolver::GetSourceName(*sources[i]) << ", "
+                      << modules[i]->name << "+" << FormatHexAddress(*results[i] - modules[i]->base) << ")" << std::endl;
+        else
+            std::cout << "Not found" << std::endl;
+    }
 
     return globals;
 }
 
-uint64_t DMAManager::ScanUnrealGlobal(const std::string& groupName) const
+uint64_t DMAManager::ResolveUnrealGlobal(const std::string& groupName, GlobalSource* source, MainModuleImage* image) const
+{
+    GlobalSource found = GlobalSource::None;
+    uint64_t address = 0;
+
+    if (auto resolver = GetSymbolResolver())
+    {
+        std::string symbol;
+        address = resolver->Resolve(groupName, found, symbol);
+        if (address != 0)
+        {
+            std::cout << groupName << " resolved from " << SymbolResolver::GetSourceName(found) << " symbol "
+                      << symbol << ": " << FormatHexAddress(address) << std::endl;
+        }
+    }
+
+    if (address == 0 && !TaskExecutor::IsCurrentTaskCancelled())
+    {
+        address = image ? ScanUnrealGlobal(groupName, *image) : ScanUnrealGlobal(groupName);
+        found = address != 0 ? GlobalSource::Signature : GlobalSource::None;
+    }
+
+    if (source)
+        *source = found;
+    return address;
+}
+
+bool DMAManager::SetPdbFile(const std::string& filename)
 {
+    std::shared_ptr<PdbFile> pdb;
+    if (!filename.empty())
+    {
+        pdb = std::make_shared<PdbFile>();
+        std::string error;
+        if (!pdb->Load(filename, error))
+        {
+            std::cerr << error << std::endl;
+            return false;
+        }
+        std::cout << "Loaded " << pdb->GetSymbolCount() << " data symbols from " << filename
+                  << " (" << PdbFile::FormatId(pdb->GetGuid(), pdb->GetAge()) << ")" << std::endl;
+    }
+
+    std::lock_guard<std::mutex> lock(m_symbolMutex);
+    m_pdbFile = std::move(pdb);
+    m_symbolResolver.reset();
+    m_symbolResolverGeneration = 0;
+    return true;
+}
+
+std::shared_ptr<const SymbolResolver> DMAManager::GetSymbolResolver() const
+{
+    auto snapshot = m_processSnapshot.load();
+    std::shared_ptr<const PdbFile> pdb;
+    {
+        std::lock_guard<std::mutex> lock(m_symbolMutex);
+        if (m_symbolResolverGeneration != 0 && m_symbolResolverGeneration == snapshot->generation)
+        {
+            return m_symbolResolver;
+        }
+        pdb = m_pdbFile;
+    }
+
     if (!IsConnected())
     {
-        return 0;
+        return nullptr;
+    }
+
+    TRACE_SCOPE("LoadSymbolResolver", "scan");
+    auto resolver = std::make_shared<SymbolResolver>();
+    std::string error;
+    if (resolver->Load(*this, pdb, error))
+    {
+        std::cout << "Main module: " << resolver->GetExportCount() << " exports, PDB " << resolver->GetPdbStatus() << std::endl;
     }
+    else
+    {
+        std::cout << "Symbol lookup unavailable: " << error << std::endl;
+        resolver.reset();
+    }
+
+    std::lock_guard<std::mutex> lock(m_symbolMutex);
+    m_symbolResolver = resolver;
+    m_symbolResolverGeneration = snapshot->generation;
+    return resolver;
+}
+
+uint64_t DMAManager::ScanUnrealGlobal(const std::string& groupName) const
+{
+    MainModuleImage image;
+    return ScanUnrealGlobal(groupName, image);
+}
+
+bool DMAManager::LoadMainModuleImage(MainModuleImage& image) const
+{
+    image.loaded = true;
 
     uint64_t mainModuleBase = GetMainModuleBase();
     if (mainModuleBase == 0)
     {
         std::cerr << "Failed to get main module base address" << std::endl;
-        return 0;
+        return false;
     }
 
-    size_t moduleSize = m_currentProcess.imageSize;
+    size_t moduleSize = GetCurrentProcessInfo().imageSize;
     if (moduleSize == 0)
     {
         moduleSize = 0x1000000; // Default 16MB
     }
+    image.base = mainModuleBase;
 
-    std::cout << "Scanning for " << groupName << " in main module (Base: " << FormatHexAddress(mainModuleBase) 
-              << ", Size: " << FormatHexAddress(moduleSize) << ")..." << std::endl;
+    // A capture that read every page already holds the module; no device read needed
+    auto index = GetSignatureIndex();
+    if (index && index->GetBaseAddress() == mainModuleBase && index->GetImageSize() == moduleSize &&
+        index->IsCaptured(0, moduleSize))
+    {
+        image.index = index;
+        image.data = index->GetImage().data();
+        image.size = index->GetImageSize();
+        image.frequency.Learn(image.data, image.size);
+        std::cout << "Using the indexed main module image (" << image.size << " bytes)" << std::endl;
+        return true;
+    }
 
     // Try to read the entire module at once (like GSpots does)
-    std::vector<uint8_t> moduleBuffer(moduleSize);
-    size_t totalBytesRead = ReadMemoryEx(mainModuleBase, moduleBuffer.data(), moduleSize, 1);
-    
+    image.storage.resize(moduleSize);
+    size_t totalBytesRead = 0;
+    {
+        TRACE_SCOPE("ReadModuleImage", "dma", "size", moduleSize);
+        totalBytesRead = ReadMemoryEx(mainModuleBase, image.storage.data(), moduleSize, 1);
+    }
+
     if (totalBytesRead == 0)
     {
-        std::cout << "Failed to read module memory, trying chunked approach..." << std::endl;
-        return ScanUnrealGlobalChunked(groupName, mainModuleBase, moduleSize);
+        image.storage.clear();
+        image.storage.shrink_to_fit();
+        return false;
     }
+    image.data = image.storage.data();
+    image.size = totalBytesRead;
+    image.frequency.Learn(image.data, image.size);
 
     std::cout << "Read " << totalBytesRead << " bytes from module memory (requested: " << moduleSize << ")" << std::endl;
     
     // Add debug output to show first few bytes of the module
     std::cout << "First 32 bytes of module: ";
-    for (size_t i = 0; i < min(32ULL, totalBytesRead); ++i)
+    for (size_t i = 0; i < std::min<size_t>(32, totalBytesRead); ++i)
     {
-        std::cout << std::hex << std::setfill('0') << std::setw(2) << (int)moduleBuffer[i] << " ";
+        std::cout << std::hex << std::setfill('0') << std::setw(2) << (int)image.data[i] << " ";
     }
     std::cout << std::dec << std::endl;
     
     // Validate PE header
     if (totalBytesRead >= 2)
     {
-        uint16_t dosSignature = *reinterpret_cast<const uint16_t*>(moduleBuffer.data());
+        uint16_t dosSignature = *reinterpret_cast<const uint16_t*>(image.data);
         if (dosSignature == 0x5A4D) // "MZ"
         {
             std::cout << "✓ Valid PE header detected (MZ signature found)" << std::endl;
@@ -1175,25 +1555,67 @@ uint64_t DMAManager::ScanUnrealGlobal(const std::string& groupName) const
             std::cout << "This indicates we're reading from wrong memory address!" << std::endl;
         }
     }
+    return true;
+}
+
+uint64_t DMAManager::ScanUnrealGlobal(const std::string& groupName, MainModuleImage& image) const
+{
+    if (!IsConnected())
+    {
+        return 0;
+    }
+
+    TRACE_SCOPE("ScanUnrealGlobal", "scan", groupName);
+
+    if (!image.loaded)
+    {
+        LoadMainModuleImage(image);
+    }
+
+    if (image.base == 0)
+    {
+        return 0;
+    }
+
+    if (!image.data)
+    {
+        size_t moduleSize = GetCurrentProcessInfo().imageSize;
+        std::cout << "Failed to read module memory, trying chunked approach..." << std::endl;
+        return ScanUnrealGlobalChunked(groupName, image.base, moduleSize ? moduleSize : 0x1000000);
+    }
+
+    std::cout << "Scanning for " << groupName << " in main module (Base: " << FormatHexAddress(image.base) 
+              << ", Size: " << FormatHexAddress(image.size) << ")..." << std::endl;
+
+    const uint8_t* moduleBuffer = image.data;
+    size_t totalBytesRead = image.size;
+    uint64_t mainModuleBase = image.base;
+
+    // Likeliest variant for this engine version first; the scan stops at the first valid match
+    EngineVersion version = GetEngineVersion();
+    auto signatures = GetRankedSignatures(groupName, version);
 
-    // Get signatures for this group
-    auto signatures = GetUnrealSignatures();
-    
-    // Try each signature for this group
     for (const auto& sig : signatures)
     {
-        if (sig.group != groupName)
-            continue;
+        if (TaskExecutor::IsCurrentTaskCancelled())
+            return 0;
 
-        std::cout << "Trying " << sig.name << "..." << std::endl;
+        // Anchors ranked by the byte frequencies of this module rather than the built-in model
+        CompiledPattern compiled(sig.pattern, sig.mask, image.frequency);
+        std::cout << "Trying " << sig.name << " (anchor +" << compiled.GetAnchorOffset() << ", "
+                  << compiled.GetAnchorLength() << " bytes)..." << std::endl;
 
-        size_t patternOffset = FindPatternInBuffer(moduleBuffer.data(), totalBytesRead, sig.pattern, sig.mask);
+        size_t patternOffset = SIZE_MAX;
+        {
+            TRACE_SCOPE("MatchSignature", "scan", sig.name);
+            patternOffset = compiled.Find(moduleBuffer, totalBytesRead);
+        }
         if (patternOffset != SIZE_MAX)
         {
             std::cout << "Found " << sig.name << " at file offset: 0x" << std::hex << patternOffset << std::dec << std::endl;
             
             // Adjust offset for group-specific prefixes (like GSpots does)
-            size_t adjustedOffset = AdjustFoundOffsetForGroup(moduleBuffer.data(), totalBytesRead, patternOffset, groupName);
+            size_t adjustedOffset = AdjustFoundOffsetForGroup(moduleBuffer, totalBytesRead, patternOffset, groupName);
             
             if (adjustedOffset + 7 > totalBytesRead)
             {
@@ -1221,6 +1643,7 @@ uint64_t DMAManager::ScanUnrealGlobal(const std::string& groupName) const
             // Validate the address is reasonable
             if (targetAddress > 0x10000 && targetAddress < 0x7FFFFFFFFFFF)
             {
+                RecordSignatureHit(version, sig.name);
                 return targetAddress;
             }
             else
@@ -1234,7 +1657,27 @@ uint64_t DMAManager::ScanUnrealGlobal(const std::string& groupName) const
     return 0;
 }
 
-size_t DMAManager::AdjustFoundOffsetForGroup(const uint8_t* buffer, size_t bufferSize, size_t foundOffset, const std::string& group) const
+uint64_t DMAManager::ResolveGlobalReference(const uint8_t* buffer, size_t bufferSize, size_t matchOffset,
+                                            const std::string& groupName, uint64_t bufferAddress)
+{
+    // Same decoding as ScanUnrealGlobal: the group's instruction near the match, disp32 at +3, 7 bytes long
+    size_t instructionOffset = AdjustFoundOffsetForGroup(buffer, bufferSize, matchOffset, groupName);
+    if (instructionOffset + 7 > bufferSize)
+    {
+        return 0;
+    }
+
+    int32_t displacement;
+    std::memcpy(&displacement, &buffer[instructionOffset + 3], sizeof(displacement));
+    uint64_t targetAddress = bufferAddress + instructionOffset + 7 + displacement;
+    if (targetAddress <= 0x10000 || targetAddress >= 0x7FFFFFFFFFFF)
+    {
+        return 0;
+    }
+    return targetAddress;
+}
+
+size_t DMAManager::AdjustFoundOffsetForGroup(const uint8_t* buffer, size_t bufferSize, size_t foundOffset, const std::string& group)
 {
     std::vector<std::vector<uint8_t>> prefixes;
     
@@ -1316,10 +1759,12 @@ uint64_t DMAManager::CalculateRVAFromInstruction(const uint8_t* buffer, size_t b
 
 uint64_t DMAManager::ScanUnrealGlobalChunked(const std::string& groupName, uint64_t moduleBase, size_t moduleSize) const
 {
+    TRACE_SCOPE("ScanUnrealGlobalChunked", "scan", groupName);
     std::cout << "Using chunked memory scanning for " << groupName << "..." << std::endl;
     
-    // Get signatures for this group
-    auto signatures = GetUnrealSignatures();
+    // Likeliest variant for this engine version first
+    EngineVersion version = GetEngineVersion();
+    auto signatures = GetRankedSignatures(groupName, version);
     
     // Scan in chunks
     const size_t CHUNK_SIZE = 0x10000; // 64KB chunks
@@ -1327,8 +1772,11 @@ uint64_t DMAManager::ScanUnrealGlobalChunked(const std::string& groupName, uint6
 
     for (size_t offset = 0; offset < moduleSize; offset += CHUNK_SIZE - 64) // Leave overlap for patterns
     {
+        if (TaskExecutor::IsCurrentTaskCancelled())
+            return 0;
+
         uint64_t currentAddress = moduleBase + offset;
-        size_t currentChunkSize = min(CHUNK_SIZE, moduleSize - offset);
+        size_t currentChunkSize = std::min(CHUNK_SIZE, moduleSize - offset);
 
         size_t bytesRead = ReadMemory(currentAddress, buffer.data(), currentChunkSize);
         if (bytesRead == 0)
@@ -1337,11 +1785,9 @@ uint64_t DMAManager::ScanUnrealGlobalChunked(const std::string& groupName, uint6
         }
 
         // Try each signature for this group
+        TRACE_SCOPE("MatchChunk", "scan", "offset", offset);
         for (const auto& sig : signatures)
         {
-            if (sig.group != groupName)
-                continue;
-
             size_t patternOffset = FindPatternInBuffer(buffer.data(), bytesRead, sig.pattern, sig.mask);
             if (patternOffset != SIZE_MAX)
             {
@@ -1368,6 +1814,7 @@ uint64_t DMAManager::ScanUnrealGlobalChunked(const std::string& groupName, uint6
                 // Validate the address is reasonable
                 if (targetAddress > 0x10000 && targetAddress < 0x7FFFFFFFFFFF)
                 {
+                    RecordSignatureHit(version, sig.name);
                     return targetAddress;
                 }
             }
@@ -1377,209 +1824,392 @@ uint64_t DMAManager::ScanUnrealGlobalChunked(const std::string& groupName, uint6
     return 0; // Not found
 }
 
-void DMAManager::WorkerThread()
+bool DMAManager::ProcessCompletedTasks()
 {
-    while (true)
+    // Run the callbacks outside the lock so workers finishing meanwhile are not blocked
+    std::vector<std::function<void()>> callbacks;
     {
-        std::unique_lock<std::mutex> lock(m_taskQueueMutex);
-        m_taskCondition.wait(lock, [this]() { return !m_taskQueue.empty() || m_shouldStop; });
+        std::lock_guard<std::mutex> lock(m_callbackMutex);
+        callbacks.swap(m_completedCallbacks);
+    }
 
-        if (m_shouldStop)
+    for (const auto& callback : callbacks)
+    {
+        TRACE_SCOPE("DeliverCallback", "ui");
+        callback();
+    }
+    return !callbacks.empty();
+}
+
+template<typename T>
+void DMAManager::AddAsyncTask(const AsyncTask& task, std::function<AsyncResult<T>()> body,
+                              std::function<void(const AsyncResult<T>&)> callback)
+{
+    // Callbacks of every request coalesced into this task
+    using CallbackList = std::vector<std::function<void(const AsyncResult<T>&)>>;
+    auto callbacks = std::make_shared<CallbackList>();
+    callbacks->push_back(callback);
+
+    TaskRequest request;
+    request.description = task.description;
+    request.priority = task.priority;
+    request.coalesceKey = task.taskId;
+    request.exclusive = task.exclusive;
+    request.state = callbacks;
+    request.merge = [callback](const std::shared_ptr<void>& pendingState)
+    {
+        std::static_pointer_cast<CallbackList>(pendingState)->push_back(callback);
+    };
+    request.work = [this, body, callbacks, description = task.description](const CancellationToken& token)
+    {
+        bool traced = TraceRecorder::Get().BeginTaskCapture();
+
+        AsyncResult<T> result;
+        if (token.IsCancelled())
         {
-            break;
+            result = AsyncResult<T>(T{}, false, "", "Operation cancelled");
         }
-
-        if (!m_taskQueue.empty())
+        else
         {
-            auto task = m_taskQueue.front();
-            m_taskQueue.pop();
-            lock.unlock();
-
             try
             {
-                task.task();
-                m_pendingOperations--;
+                TRACE_SCOPE("Task", "task", description);
+                result = body();
+                if (token.IsCancelled())
+                {
+                    // A cancelled scan returns whatever it had; do not report that as the answer
+                    result = AsyncResult<T>(T{}, false, "", "Operation cancelled");
+                }
             }
             catch (const std::exception& e)
             {
-                std::cerr << "Exception in worker thread: " << e.what() << std::endl;
-                m_pendingOperations--;
+                result = AsyncResult<T>(T{}, false, "", e.what());
             }
         }
-    }
-}
 
-void DMAManager::ProcessCompletedTasks()
-{
-    std::lock_guard<std::mutex> lock(m_callbackMutex);
-    for (const auto& callback : m_completedCallbacks)
-    {
-        callback();
-    }
-    m_completedCallbacks.clear();
-}
+        if (traced)
+        {
+            // Export here rather than from a completion callback: writing the capture takes a
+            // while and must not stall the UI thread or other workers waiting on m_callbackMutex
+            TraceRecorder::Get().FinishTaskCapture();
+        }
 
-void DMAManager::AddAsyncTask(const AsyncTask& task)
-{
+        std::lock_guard<std::mutex> lock(m_callbackMutex);
+        for (const auto& cb : *callbacks)
+        {
+            if (cb)
+            {
+                m_completedCallbacks.push_back([cb, result]() { cb(result); });
+            }
+        }
+    };
+
+    if (!m_executor.Submit(std::move(request)))
     {
-        std::lock_guard<std::mutex> lock(m_taskQueueMutex);
-        m_taskQueue.push(task);
-        m_pendingOperations++;
+        std::cout << "Merged with identical pending operation: " << task.description << std::endl;
     }
-    m_taskCondition.notify_one();
 }
 
 bool DMAManager::HasPendingOperations() const
 {
-    return m_pendingOperations > 0;
+    return m_executor.GetActiveCount() > 0;
 }
 
 size_t DMAManager::GetPendingOperationCount() const
 {
-    return m_pendingOperations;
+    return m_executor.GetActiveCount();
 }
 
 void DMAManager::CancelAllOperations()
 {
-    std::lock_guard<std::mutex> lock(m_taskQueueMutex);
-    while (!m_taskQueue.empty())
+    m_executor.CancelAll();
+}
+
+bool DMAManager::StartSessionRecording(const std::string& filename)
+{
+    if (!m_recorder)
+    {
+        std::cerr << "Cannot record session: no memory backend" << std::endl;
+        return false;
+    }
+    
+    if (!m_recorder->Start(filename))
+    {
+        return false;
+    }
+    
+    // Replays need to know which process the session was working on
+    if (IsConnected())
+    {
+        m_recorder->AddMarker("attach", m_currentProcessId);
+    }
+    return true;
+}
+
+void DMAManager::StopSessionRecording()
+{
+    if (m_recorder)
     {
-        m_taskQueue.pop();
-        m_pendingOperations--;
+        m_recorder->Stop();
     }
 }
 
+bool DMAManager::IsSessionRecording() const
+{
+    return m_recorder && m_recorder->IsRecording();
+}
+
 void DMAManager::AttachToProcessAsync(const std::string& processName, std::function<void(const AsyncResult<bool>&)> callback)
 {
     std::string taskId = "attach_" + processName;
     std::cout << "Queuing async process attachment: " << processName << std::endl;
     
-    AsyncTask task(AsyncTaskType::AttachToProcess, "Attaching to process: " + processName,
-        [this, processName, callback]() {
-            AsyncResult<bool> result;
-            try
-            {
-                bool success = AttachToProcess(processName);
-                result = AsyncResult<bool>(success, success, 
-                    success ? "Successfully attached to " + processName : "",
-                    success ? "" : "Failed to attach to " + processName);
-            }
-            catch (const std::exception& e)
-            {
-                result = AsyncResult<bool>(false, false, "", e.what());
-            }
-            
-            if (callback)
-            {
-                std::lock_guard<std::mutex> lock(m_callbackMutex);
-                m_completedCallbacks.push_back([callback, result]() { callback(result); });
-            }
-        }, taskId);
+    // Attaching swaps the current process under every other task, so it runs alone
+    AsyncTask task(AsyncTaskType::AttachToProcess, "Attaching to process: " + processName, taskId,
+        TaskPriority::Interactive, true);
     
-    AddAsyncTask(task);
+    AddAsyncTask<bool>(task,
+        [this, processName]() {
+            bool success = AttachToProcess(processName);
+            return AsyncResult<bool>(success, success, 
+                success ? "Successfully attached to " + processName : "",
+                success ? "" : "Failed to attach to " + processName);
+        }, callback);
 }
 
-void DMAManager::ScanUnrealGlobalsAsync(std::function<void(const AsyncResult<UnrealGlobals>&)> callback)
+void DMAManager::ScanUnrealGlobalsAsync(std::function<void(const AsyncResult<UnrealGlobals>&)> callback, bool allModules)
 {
     std::cout << "Queuing async Unreal globals scan..." << std::endl;
     
-    AsyncTask task(AsyncTaskType::ScanUnrealGlobals, "Scanning for Unreal Engine globals",
-        [this, callback]() {
-            AsyncResult<UnrealGlobals> result;
-            try
+    AsyncTask task(AsyncTaskType::ScanUnrealGlobals,
+        allModules ? "Scanning all modules for Unreal Engine globals" : "Scanning for Unreal Engine globals",
+        allModules ? "scan_globals_all" : "scan_globals", TaskPriority::Background);
+    
+    AddAsyncTask<UnrealGlobals>(task,
+        [this, allModules]() {
+            UnrealGlobals globals = ScanUnrealGlobals(allModules);
+            bool success = globals.IsValid();
+            
+            std::string logMsg;
+            if (success)
             {
-                UnrealGlobals globals = ScanUnrealGlobals();
-                bool success = globals.IsValid();
-                
-                std::string logMsg;
-                if (success)
-                {
-                    logMsg = "Unreal globals found - ";
-                    if (globals.GWorld != 0) logMsg += "GWorld: " + FormatHexAddress(globals.GWorld) + " ";
-                    if (globals.GNames != 0) logMsg += "GNames: " + FormatHexAddress(globals.GNames) + " ";
-                    if (globals.GObjects != 0) logMsg += "GObjects: " + FormatHexAddress(globals.GObjects) + " ";
-                }
-                else
-                {
-                    logMsg = "No Unreal Engine globals found";
-                }
-                
-                result = AsyncResult<UnrealGlobals>(globals, success, logMsg, 
-                    success ? "" : "Failed to find any Unreal Engine globals");
+                logMsg = "Unreal globals found - ";
+                if (globals.GWorld != 0) logMsg += "GWorld: " + FormatHexAddress(globals.GWorld) + " ";
+                if (globals.GNames != 0) logMsg += "GNames: " + FormatHexAddress(globals.GNames) + " ";
+                if (globals.GObjects != 0) logMsg += "GObjects: " + FormatHexAddress(globals.GObjects) + " ";
             }
-            catch (const std::exception& e)
+            else
             {
-                result = AsyncResult<UnrealGlobals>(UnrealGlobals{}, false, "", e.what());
+                logMsg = "No Unreal Engine globals found";
             }
             
-            if (callback)
-            {
-                std::lock_guard<std::mutex> lock(m_callbackMutex);
-                m_completedCallbacks.push_back([callback, result]() { callback(result); });
-            }
-        });
-    
-    AddAsyncTask(task);
+            return AsyncResult<UnrealGlobals>(globals, success, logMsg, 
+                success ? "" : "Failed to find any Unreal Engine globals");
+        }, callback);
 }
 
 void DMAManager::GetMainModuleBaseAsync(std::function<void(const AsyncResult<uint64_t>&)> callback)
 {
     std::cout << "Queuing async main module base lookup..." << std::endl;
     
-    AsyncTask task(AsyncTaskType::GetMainModuleBase, "Getting main module base address",
-        [this, callback]() {
-            AsyncResult<uint64_t> result;
-            try
+    AsyncTask task(AsyncTaskType::GetMainModuleBase, "Getting main module base address", "main_module_base",
+        TaskPriority::Interactive);
+    
+    AddAsyncTask<uint64_t>(task,
+        [this]() {
+            uint64_t baseAddress = GetMainModuleBase();
+            bool success = baseAddress != 0;
+            
+            return AsyncResult<uint64_t>(baseAddress, success,
+                success ? "Main module base: " + FormatHexAddress(baseAddress) : "",
+                success ? "" : "Failed to get main module base address");
+        }, callback);
+}
+
+void DMAManager::ScanSignatureAsync(const std::string& pattern, std::function<void(const AsyncResult<uint64_t>&)> callback)
+{
+    std::cout << "Queuing async signature scan: " << pattern << std::endl;
+    
+    AsyncTask task(AsyncTaskType::ScanSignature, "Scanning signature: " + pattern, "signature_" + pattern);
+    
+    AddAsyncTask<uint64_t>(task,
+        [this, pattern]() {
+            uint64_t address = ScanSignature(pattern);
+            bool success = address != 0;
+            
+            return AsyncResult<uint64_t>(address, success,
+                success ? "Signature found at: " + FormatHexAddress(address) : "",
+                success ? "" : "Signature not found: " + pattern);
+        }, callback);
+}
+
+void DMAManager::BuildSignatureIndexAsync(std::function<void(const AsyncResult<std::shared_ptr<const SignatureIndex>>&)> callback)
+{
+    std::cout << "Queuing async signature index build..." << std::endl;
+    
+    AsyncTask task(AsyncTaskType::IndexSignatures, "Indexing main module for signature queries", "index_signatures");
+    
+    AddAsyncTask<std::shared_ptr<const SignatureIndex>>(task,
+        [this]() {
+            auto start = std::chrono::steady_clock::now();
+            std::string error;
+            auto index = BuildSignatureIndex(error);
+            if (!index)
             {
-                uint64_t baseAddress = GetMainModuleBase();
-                bool success = baseAddress != 0;
-                
-                result = AsyncResult<uint64_t>(baseAddress, success,
-                    success ? "Main module base: " + FormatHexAddress(baseAddress) : "",
-                    success ? "" : "Failed to get main module base address");
+                return AsyncResult<std::shared_ptr<const SignatureIndex>>(nullptr, false, "", error);
             }
-            catch (const std::exception& e)
+            
+            double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            std::ostringstream log;
+            log << "Indexed " << index->GetImageSize() / 1024 << " KB of the main module in " << std::fixed
+                << std::setprecision(2) << seconds * 1000.0 << " ms (" << index->GetMemoryBytes() / (1024 * 1024) << " MB held)";
+            if (index->GetMissingBytes() != 0)
             {
-                result = AsyncResult<uint64_t>(0, false, "", e.what());
+                log << "; " << index->GetMissingBytes() / 1024 << " KB unreadable, scans touching it read the device";
             }
-            
-            if (callback)
+            return AsyncResult<std::shared_ptr<const SignatureIndex>>(index, true, log.str());
+        }, callback);
+}
+
+void DMAManager::ValueScanAsync(std::shared_ptr<ValueScanner> scanner, const ValueScanQuery& query, bool nextScan,
+                                std::function<void(const AsyncResult<uint64_t>&)> callback)
+{
+    std::string description = std::string(nextScan ? "Next scan: " : "First scan: ") +
+        ValueScanner::GetCompareName(query.compare) + " " + ValueScanner::GetTypeName(query.type);
+    std::cout << "Queuing async value scan: " << description << std::endl;
+    
+    // Never coalesced: scans change the scanner's candidates, so every request has to run and get its own result
+    AsyncTask task(AsyncTaskType::ValueScan, description);
+    
+    AddAsyncTask<uint64_t>(task,
+        [scanner, query, nextScan]() {
+            std::string error;
+            bool success = nextScan ? scanner->NextScan(query, error) : scanner->FirstScan(query, error);
+            if (!success)
             {
-                std::lock_guard<std::mutex> lock(m_callbackMutex);
-                m_completedCallbacks.push_back([callback, result]() { callback(result); });
+                return AsyncResult<uint64_t>(0, false, "", error);
             }
-        });
+            
+            ValueScanStats stats = scanner->GetLastStats();
+            std::ostringstream log;
+            log << (nextScan ? "Next scan" : "First scan") << ": " << stats.candidates << " candidates in "
+                << stats.regions << " regions (" << std::fixed << std::setprecision(2) << stats.seconds << " s, "
+                << stats.batches << " batches, " << stats.bytesRead / 1024 << " KB read, "
+                << stats.storageBytes / 1024 << " KB stored)";
+            return AsyncResult<uint64_t>(stats.candidates, true, log.str());
+        }, callback);
+}
+
+void DMAManager::DumpNamesAsync(uint64_t gnamesAddress, std::function<void(const AsyncResult<std::shared_ptr<const NameTable>>&)> callback)
+{
+    std::cout << "Queuing async name dump: " << FormatHexAddress(gnamesAddress) << std::endl;
+    
+    AsyncTask task(AsyncTaskType::DumpNames, "Dumping GNames", "dump_names_" + FormatHexAddress(gnamesAddress));
     
-    AddAsyncTask(task);
+    AddAsyncTask<std::shared_ptr<const NameTable>>(task,
+        [this, gnamesAddress]() {
+            auto names = std::make_shared<NameTable>();
+            NamePoolDumper dumper(*this);
+            std::string error;
+            if (!dumper.Dump(gnamesAddress, *names, error))
+            {
+                return AsyncResult<std::shared_ptr<const NameTable>>(nullptr, false, "", error);
+            }
+            
+            const NameDumpStats& stats = dumper.GetLastStats();
+            std::ostringstream log;
+            log << "Dumped " << stats.entries << " names (" << stats.wideEntries << " wide) from " << stats.blocks
+                << " blocks in " << std::fixed << std::setprecision(2) << stats.seconds << " s ("
+                << stats.batches << " batches, " << stats.bytesRead / 1024 << " KB read, "
+                << stats.memoryBytes / 1024 << " KB table)";
+            return AsyncResult<std::shared_ptr<const NameTable>>(names, true, log.str());
+        }, callback);
 }
 
-void DMAManager::ScanSignatureAsync(const std::string& pattern, std::function<void(const AsyncResult<uint64_t>&)> callback)
+void DMAManager::EnumerateObjectsAsync(std::shared_ptr<ObjectEnumerator> enumerator, uint64_t gobjectsAddress,
+                                       std::shared_ptr<const ObjectIndex> previous,
+                                       std::function<void(const AsyncResult<ObjectSyncResult>&)> callback)
 {
-    std::cout << "Queuing async signature scan: " << pattern << std::endl;
+    bool incremental = previous && enumerator->HasSnapshot(gobjectsAddress);
+    std::cout << "Queuing async object " << (incremental ? "resync" : "enumeration") << ": " << FormatHexAddress(gobjectsAddress) << std::endl;
     
-    AsyncTask task(AsyncTaskType::ScanSignature, "Scanning signature: " + pattern,
-        [this, pattern, callback]() {
-            AsyncResult<uint64_t> result;
-            try
+    // Only requests for the same array and mode are interchangeable
+    AsyncTask task(AsyncTaskType::EnumerateObjects, incremental ? "Resyncing GObjects" : "Enumerating GObjects",
+        std::string(incremental ? "resync_objects_" : "enumerate_objects_") + FormatHexAddress(gobjectsAddress));
+    
+    AddAsyncTask<ObjectSyncResult>(task,
+        [enumerator, gobjectsAddress, previous, incremental]() {
+            ObjectSyncResult sync;
+            auto objects = std::make_shared<ObjectIndex>();
+            std::string error;
+            std::ostringstream log;
+            if (incremental && enumerator->Resync(gobjectsAddress, *previous, *objects, sync.delta, error))
+            {
+                const ObjectEnumStats& stats = enumerator->GetLastStats();
+                log << "Resynced " << stats.objects << " objects in " << std::fixed << std::setprecision(2)
+                    << stats.seconds * 1000.0 << " ms (+" << sync.delta.added.size() << " -" << sync.delta.removed.size()
+                    << " ~" << sync.delta.changed.size() << ", " << stats.changedPages << "/" << stats.pages
+                    << " pages changed, " << stats.bytesRead / 1024 << " KB read)";
+                sync.incremental = true;
+            }
+            else
             {
-                uint64_t address = ScanSignature(pattern);
-                bool success = address != 0;
+                if (incremental)
+                {
+                    log << "Resync failed (" << error << "), ";
+                    error.clear();
+                }
+                if (!enumerator->Enumerate(gobjectsAddress, *objects, error))
+                {
+                    return AsyncResult<ObjectSyncResult>(sync, false, "", error);
+                }
                 
-                result = AsyncResult<uint64_t>(address, success,
-                    success ? "Signature found at: " + FormatHexAddress(address) : "",
-                    success ? "" : "Signature not found: " + pattern);
+                const ObjectEnumStats& stats = enumerator->GetLastStats();
+                log << "Enumerated " << stats.objects << " objects of " << stats.slots << " slots in "
+                    << std::fixed << std::setprecision(2) << stats.seconds << " s (" << stats.stale << " stale, "
+                    << stats.spans << " spans, " << stats.batches << " batches, " << stats.bytesRead / 1024 << " KB read, "
+                    << stats.memoryBytes / 1024 << " KB index)";
             }
-            catch (const std::exception& e)
+            
+            sync.objects = objects;
+            return AsyncResult<ObjectSyncResult>(sync, true, log.str());
+        }, callback);
+}
+
+void DMAManager::IndexLayoutsAsync(std::shared_ptr<const ObjectIndex> objects, std::shared_ptr<const NameTable> names,
+                                   const std::string& cacheDirectory,
+                                   std::function<void(const AsyncResult<std::shared_ptr<const LayoutIndex>>&)> callback)
+{
+    std::cout << "Queuing async layout indexing (cache: " << cacheDirectory << ")" << std::endl;
+    
+    // Inputs are immutable snapshots, so their addresses identify them while the task holds them
+    AsyncTask task(AsyncTaskType::IndexLayouts, "Indexing class layouts",
+        "index_layouts_" + FormatHexAddress(reinterpret_cast<uintptr_t>(objects.get())) + "_" +
+        FormatHexAddress(reinterpret_cast<uintptr_t>(names.get())) + "_" + cacheDirectory);
+    
+    AddAsyncTask<std::shared_ptr<const LayoutIndex>>(task,
+        [this, objects, names, cacheDirectory]() {
+            auto layouts = std::make_shared<LayoutIndex>();
+            LayoutIndexer indexer(*this);
+            std::string error;
+            if (!indexer.IndexCached(objects.get(), names.get(), cacheDirectory, *layouts, error))
             {
-                result = AsyncResult<uint64_t>(0, false, "", e.what());
+                return AsyncResult<std::shared_ptr<const LayoutIndex>>(nullptr, false, "", error);
             }
             
-            if (callback)
+            const LayoutIndexStats& stats = indexer.GetLastStats();
+            std::ostringstream log;
+            if (stats.fromCache)
             {
-                std::lock_guard<std::mutex> lock(m_callbackMutex);
-                m_completedCallbacks.push_back([callback, result]() { callback(result); });
+                log << "Loaded " << stats.structs << " layouts (" << stats.properties << " properties) from cache in "
+                    << std::fixed << std::setprecision(2) << stats.seconds * 1000.0 << " ms";
             }
-        });
-    
-    AddAsyncTask(task);
-} 
\ No newline at end of file
+            else
+            {
+                log << "Indexed " << stats.structs << " layouts (" << stats.properties << " properties, "
+                    << stats.fieldClasses << " property types) in " << std::fixed << std::setprecision(2) << stats.seconds
+                    << " s (" << stats.rounds << " rounds, " << stats.batches << " batches, " << stats.bytesRead / 1024 << " KB read)";
+            }
+            return AsyncResult<std::shared_ptr<const LayoutIndex>>(layouts, true, log.str());
+        }, callback);
+}
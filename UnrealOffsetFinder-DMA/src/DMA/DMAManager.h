@@ -1,15 +1,33 @@
 #pragma once
 
+#include "MemoryBackend.h"
+#include "ModuleMap.h"
+#include "../Core/TaskExecutor.h"
+#include "../Scan/ByteFrequency.h"
+#include "../Unreal/EngineVersion.h"
+#include "../Unreal/SignatureStats.h"
 #include <string>
 #include <vector>
 #include <cstdint>
 #include <functional>
 #include <thread>
 #include <mutex>
-#include <queue>
 #include <condition_variable>
 #include <atomic>
 #include <future>
+#include <memory>
+
+class RecordingBackend;
+class ValueScanner;
+struct ValueScanQuery;
+class NameTable;
+class ObjectIndex;
+class ObjectEnumerator;
+struct ObjectSyncResult;
+class LayoutIndex;
+class PdbFile;
+class SymbolResolver;
+class SignatureIndex;
 
 /**
  * @struct UnrealSignature
@@ -21,9 +39,34 @@ struct UnrealSignature
     std::vector<uint8_t> pattern;  ///< Byte pattern to search for
     std::string mask;               ///< Pattern mask ('x' = exact match, '?' = wildcard)
     std::string group;              ///< Group category (GWorld, GNames, GObjects)
+    uint32_t minVersion;            ///< Oldest engine version the variant is known from (EngineVersion::GetCode, 0 = open)
+    uint32_t maxVersion;            ///< Newest engine version the variant is known from (0 = open)
     
-    UnrealSignature(const std::string& n, const std::vector<uint8_t>& p, const std::string& m, const std::string& g)
-        : name(n), pattern(p), mask(m), group(g) {}
+    UnrealSignature(const std::string& n, const std::vector<uint8_t>& p, const std::string& m, const std::string& g,
+                    uint32_t minV = 0, uint32_t maxV = 0)
+        : name(n), pattern(p), mask(m), group(g), minVersion(minV), maxVersion(maxV) {}
+};
+
+/**
+ * @enum GlobalSource
+ * @brief How an Unreal global was located
+ */
+enum class GlobalSource
+{
+    None,       ///< Not found
+    Export,     ///< Export table of the main module
+    Pdb,        ///< Matching PDB supplied on disk
+    Signature   ///< Signature scan of the main module (or of all modules)
+};
+
+/**
+ * @struct GlobalModule
+ * @brief Module an Unreal global belongs to
+ */
+struct GlobalModule
+{
+    std::string name;       ///< Module name
+    uint64_t base = 0;      ///< Module base (the global's offset is relative to it)
 };
 
 /**
@@ -35,24 +78,56 @@ struct UnrealGlobals
     uint64_t GWorld = 0;    ///< GWorld global address
     uint64_t GNames = 0;    ///< GNames global address  
     uint64_t GObjects = 0;  ///< GObjects global address
+    uint64_t moduleBase = 0;    ///< Main module base the scan ran against (offsets are relative to it)
+    EngineVersion engineVersion;    ///< Engine version detected in the main module (unknown if not found)
+    GlobalSource GWorldSource = GlobalSource::None;     ///< How GWorld was located
+    GlobalSource GNamesSource = GlobalSource::None;     ///< How GNames was located
+    GlobalSource GObjectsSource = GlobalSource::None;   ///< How GObjects was located
+    GlobalModule GWorldModule;      ///< Module holding GWorld
+    GlobalModule GNamesModule;      ///< Module holding GNames
+    GlobalModule GObjectsModule;    ///< Module holding GObjects
     
     bool IsValid() const { return GWorld != 0 || GNames != 0 || GObjects != 0; }
 };
 
 /**
- * @struct ProcessInfo
- * @brief Contains information about a target process
+ * @struct MainModuleImage
+ * @brief Main module bytes read once and shared by the group scans of one globals scan
+ */
+struct MainModuleImage
+{
+    uint64_t base = 0;                              ///< Virtual address of data[0]
+    const uint8_t* data = nullptr;                  ///< Module bytes (null if the read failed)
+    size_t size = 0;                                ///< Valid bytes at data
+    bool loaded = false;                            ///< A read was attempted
+    ByteFrequency frequency;                        ///< Byte model learned from the image, ranks signature anchors
+    std::vector<uint8_t> storage;                   ///< Owns the bytes when they were read for this scan
+    std::shared_ptr<const SignatureIndex> index;    ///< Owns the bytes when they come from the signature index
+};
+
+/**
+ * @struct ProcessSnapshot
+ * @brief Immutable view of the attached process
+ *
+ * Never modified once published: attach, detach and module map loads
+ * publish a new snapshot, so readers on any thread can keep using the one
+ * they loaded without locking.
  */
-struct ProcessInfo
+struct ProcessSnapshot
 {
-    uint32_t processId;         ///< Process ID
-    std::string processName;    ///< Process executable name
-    uint64_t baseAddress;       ///< Base address of the process
-    uint64_t imageSize;         ///< Size of the process image
+    ProcessInfo process;        ///< Attached process (base/size of the main module once resolved)
+    std::shared_ptr<const ModuleMap> modules;   ///< Module map, nullptr until fetched
+    uint64_t generation = 0;    ///< Incremented on every attach/detach
     
-    ProcessInfo(uint32_t pid = 0, const std::string& name = "", 
-                uint64_t base = 0, uint64_t size = 0)
-        : processId(pid), processName(name), baseAddress(base), imageSize(size) {}
+    /**
+     * @brief Get the main module base without touching the device
+     * @return Main module base from the module map, else the process base (0 when detached)
+     */
+    uint64_t GetMainModuleBase() const
+    {
+        const ProcessInfo* mainModule = modules ? modules->GetMainModule() : nullptr;
+        return mainModule ? mainModule->baseAddress : process.baseAddress;
+    }
 };
 
 /**
@@ -82,6 +157,11 @@ enum class AsyncTaskType
     ScanUnrealGlobals,
     GetMainModuleBase,
     ScanSignature,
+    IndexSignatures,
+    ValueScan,
+    DumpNames,
+    EnumerateObjects,
+    IndexLayouts,
     AttachToProcess,
     DetachFromProcess
 };
@@ -94,11 +174,13 @@ struct AsyncTask
 {
     AsyncTaskType type;
     std::string description;
-    std::function<void()> task;
-    std::string taskId;
+    std::string taskId;             ///< Pending tasks with the same non-empty ID are coalesced
+    TaskPriority priority;          ///< Scheduling priority
+    bool exclusive;                 ///< Runs alone (changes the attached process)
     
-    AsyncTask(AsyncTaskType t, const std::string& desc, std::function<void()> taskFunc, const std::string& id = "")
-        : type(t), description(desc), task(taskFunc), taskId(id) {}
+    AsyncTask(AsyncTaskType t, const std::string& desc, const std::string& id = "",
+              TaskPriority prio = TaskPriority::Normal, bool excl = false)
+        : type(t), description(desc), taskId(id), priority(prio), exclusive(excl) {}
 };
 
 /**
@@ -107,7 +189,9 @@ struct AsyncTask
  * 
  * This class provides an interface for DMA operations including process
  * attachment, memory reading/writing, and process enumeration.
- * Now includes async operation support to prevent UI blocking.
+ * Now includes async operation support to prevent UI blocking: async
+ * operations run on a small worker pool (see TaskExecutor).
+ * Device access goes through a MemoryBackend (VMMDLL by default).
  */
 class DMAManager
 {
@@ -128,11 +212,17 @@ public:
      */
     bool Initialize();
 
+    /**
+     * @brief Initialize the DMA Manager with a specific memory backend
+     * @param backend Backend to use for all device access
+     * @return true if initialization successful, false otherwise
+     */
+    bool Initialize(std::unique_ptr<MemoryBackend> backend);
+
     /**
      * @brief Update DMA state (called each frame)
-     * @param deltaTime Time since last update
      */
-    void Update(float deltaTime);
+    void Update();
 
     /**
      * @brief Shutdown and cleanup DMA resources
@@ -171,10 +261,24 @@ public:
     ProcessInfo GetCurrentProcessInfo() const;
 
     /**
-     * @brief Get a list of all available processes
-     * @return Vector of ProcessInfo structures
+     * @brief Get the current immutable process snapshot (safe from any thread)
+     * @return Snapshot; its process ID is 0 when detached
+     */
+    std::shared_ptr<const ProcessSnapshot> GetProcessSnapshot() const;
+
+    /**
+     * @brief Get the list of all available processes (safe from any thread)
+     *
+     * The list is refreshed in the background and replaced, never modified,
+     * so the returned snapshot can be kept and iterated without copying.
+     * @return Immutable process list snapshot
+     */
+    std::shared_ptr<const std::vector<ProcessInfo>> GetProcessList() const;
+
+    /**
+     * @brief Refresh the process list in the background now instead of at the next interval
      */
-    std::vector<ProcessInfo> GetProcessList() const;
+    void RequestProcessListRefresh();
 
     /**
      * @brief Read memory from the target process
@@ -185,6 +289,13 @@ public:
      */
     size_t ReadMemory(uint64_t address, void* buffer, size_t size) const;
 
+    /**
+     * @brief Read several memory ranges in one batched (scatter) request
+     * @param requests Read requests (bytesRead is filled for each entry)
+     * @return Total number of bytes read
+     */
+    size_t ReadMemoryBatch(std::vector<ScatterRead>& requests) const;
+
     /**
      * @brief Write memory to the target process
      * @param address Virtual address to write to
@@ -244,24 +355,42 @@ public:
     static std::string FormatHexAddress(uint64_t address, bool uppercase = true);
 
     /**
-     * @brief Get the base address of a specific module
+     * @brief Get the base address of a specific module (from the cached module map)
      * @param moduleName Name of the module (e.g., "ntdll.dll", "kernel32.dll")
      * @return Base address of the module, 0 if not found
      */
     uint64_t GetModuleBase(const std::string& moduleName) const;
 
     /**
-     * @brief Get the main module (executable) base address
+     * @brief Get the main module (executable) base address (from the cached module map)
      * @return Base address of the main executable module
      */
     uint64_t GetMainModuleBase() const;
 
     /**
-     * @brief Get list of all loaded modules in the target process
+     * @brief Get list of all loaded modules in the target process (from the cached module map)
      * @return Vector of module information structures
      */
     std::vector<ProcessInfo> GetModuleList() const;
 
+    /**
+     * @brief Fetch the module map of the attached process again
+     *
+     * The map is fetched once per attach. Lookups of unknown modules refetch
+     * it on their own (rate limited); call this after the target loaded or
+     * unloaded modules to pick up changes immediately.
+     * @return true if a non-empty module map was loaded
+     */
+    bool RefreshModuleMap();
+
+    /**
+     * @brief Enumerate the committed, readable memory regions of the attached process
+     *
+     * Not cached: the address space changes constantly, so every call asks the device.
+     * @return Regions in ascending address order
+     */
+    std::vector<MemoryRegion> GetMemoryRegions() const;
+
     /**
      * @brief Scan for a byte pattern (signature) in process memory
      * @param pattern Byte pattern to search for (e.g., "48 8B 05 ?? ?? ?? ??")
@@ -279,6 +408,29 @@ public:
      */
     uint64_t ScanSignatureInModule(const std::string& pattern, const std::string& moduleName) const;
 
+    /**
+     * @brief Capture the main module and index its trigrams for signature queries
+     *
+     * Until the next attach, ScanSignature calls inside the main module are
+     * answered from the captured image instead of reading it again. The module
+     * is read page by page; ranges touching a page that failed are still
+     * scanned on the device. Rebuild after the target patches its code.
+     * @param error Receives the reason on failure
+     * @return Index, null on failure
+     */
+    std::shared_ptr<const SignatureIndex> BuildSignatureIndex(std::string& error);
+
+    /**
+     * @brief Get the signature index of the attached process
+     * @return Index, null if none was built since the last attach
+     */
+    std::shared_ptr<const SignatureIndex> GetSignatureIndex() const;
+
+    /**
+     * @brief Drop the signature index (later scans read the device again)
+     */
+    void DropSignatureIndex();
+
     /**
      * @brief Follow a multi-level pointer chain
      * @param baseAddress Starting address
@@ -306,9 +458,10 @@ public:
 
     /**
      * @brief Scan for Unreal Engine globals (GWorld, GNames, GObjects)
+     * @param allModules Signature scan every loaded module (ranked, in parallel) instead of only the main module
      * @return UnrealGlobals structure with found addresses
      */
-    UnrealGlobals ScanUnrealGlobals() const;
+    UnrealGlobals ScanUnrealGlobals(bool allModules = false) const;
 
     /**
      * @brief Scan for a specific Unreal Engine global by group name
@@ -317,6 +470,36 @@ public:
      */
     uint64_t ScanUnrealGlobal(const std::string& groupName) const;
 
+    /**
+     * @brief Scan for a specific Unreal Engine global in a shared main module image
+     * @param groupName Group to scan for ("GWorld", "GNames", "GObjects")
+     * @param image Module image, read on first use and reused by later groups
+     * @return Address of the global, 0 if not found
+     */
+    uint64_t ScanUnrealGlobal(const std::string& groupName, MainModuleImage& image) const;
+
+    /**
+     * @brief Locate an Unreal global: main module exports, then the PDB, then the signature scan
+     * @param groupName Global to locate ("GWorld", "GNames", "GObjects")
+     * @param source Receives how the global was located (optional)
+     * @param image Module image shared by the groups of one scan (optional, read on first use)
+     * @return Address of the global, 0 if not found
+     */
+    uint64_t ResolveUnrealGlobal(const std::string& groupName, GlobalSource* source = nullptr, MainModuleImage* image = nullptr) const;
+
+    /**
+     * @brief Use a PDB on disk for symbol lookups (only if it matches the attached build)
+     * @param filename PDB file, empty to stop using one
+     * @return false if the file could not be loaded
+     */
+    bool SetPdbFile(const std::string& filename);
+
+    /**
+     * @brief Get the export/PDB resolver of the main module (loaded once per attach)
+     * @return Resolver, null if not connected or the module headers are unreadable
+     */
+    std::shared_ptr<const SymbolResolver> GetSymbolResolver() const;
+
     /**
      * @brief Scan for Unreal Engine global using chunked memory reading (fallback method)
      * @param groupName Group to scan for ("GWorld", "GNames", "GObjects")
@@ -326,11 +509,52 @@ public:
      */
     uint64_t ScanUnrealGlobalChunked(const std::string& groupName, uint64_t moduleBase, size_t moduleSize) const;
 
+    /**
+     * @brief Resolve the RIP-relative global referenced near a signature match
+     * @param buffer Memory buffer containing the match
+     * @param bufferSize Valid bytes in buffer
+     * @param matchOffset Offset of the match in buffer
+     * @param groupName Group of the signature ("GWorld", "GNames", "GObjects")
+     * @param bufferAddress Virtual address of buffer[0]
+     * @return Address of the global, 0 if the instruction is truncated or the target implausible
+     */
+    static uint64_t ResolveGlobalReference(const uint8_t* buffer, size_t bufferSize, size_t matchOffset,
+                                           const std::string& groupName, uint64_t bufferAddress);
+
     /**
      * @brief Get all predefined Unreal Engine signatures
      * @return Vector of UnrealSignature structures
      */
-    std::vector<UnrealSignature> GetUnrealSignatures() const;
+    static std::vector<UnrealSignature> GetUnrealSignatures();
+
+    /**
+     * @brief Get the engine version of the main module (detected once per attach)
+     * @return Detected version, unknown if the module has no engine branch name
+     */
+    EngineVersion GetEngineVersion() const;
+
+    /**
+     * @brief Persist signature hit statistics in a file (loaded now, written after each globals scan and at shutdown)
+     * @param filename Stats file; missing files start empty, an empty name keeps the stats in memory only
+     * @return false if an existing file could not be loaded
+     */
+    bool SetSignatureStatsFile(const std::string& filename);
+
+    /**
+     * @brief Forget all signature hits (the stats file is rewritten on the next flush)
+     */
+    void ClearSignatureStats();
+
+    /**
+     * @brief Write the signature hit statistics to the stats file if they changed since the last write
+     */
+    void FlushSignatureStats() const;
+
+    /**
+     * @brief Get a copy of the signature hit statistics
+     * @return Hits per engine version and variant
+     */
+    SignatureStats GetSignatureStats() const;
 
     // Async methods (new)
     /**
@@ -343,8 +567,9 @@ public:
     /**
      * @brief Scan for Unreal Engine globals asynchronously
      * @param callback Callback function for result
+     * @param allModules Signature scan every loaded module (see ScanUnrealGlobals)
      */
-    void ScanUnrealGlobalsAsync(std::function<void(const AsyncResult<UnrealGlobals>&)> callback = nullptr);
+    void ScanUnrealGlobalsAsync(std::function<void(const AsyncResult<UnrealGlobals>&)> callback = nullptr, bool allModules = false);
 
     /**
      * @brief Get main module base asynchronously
@@ -359,6 +584,60 @@ public:
      */
     void ScanSignatureAsync(const std::string& pattern, std::function<void(const AsyncResult<uint64_t>&)> callback = nullptr);
 
+    /**
+     * @brief Capture and index the main module asynchronously (see BuildSignatureIndex)
+     * @param callback Callback function for result (the index)
+     */
+    void BuildSignatureIndexAsync(std::function<void(const AsyncResult<std::shared_ptr<const SignatureIndex>>&)> callback = nullptr);
+
+    /**
+     * @brief Run a value scan asynchronously (cancellable, reports progress)
+     * @param scanner Scanner holding the candidate set (kept alive by the task)
+     * @param query Scan parameters
+     * @param nextScan false for a first scan, true to filter the current candidates
+     * @param callback Callback function for result (candidate count)
+     */
+    void ValueScanAsync(std::shared_ptr<ValueScanner> scanner, const ValueScanQuery& query, bool nextScan,
+                        std::function<void(const AsyncResult<uint64_t>&)> callback = nullptr);
+
+    /**
+     * @brief Read every FName of the GNames pool asynchronously (cancellable, reports progress)
+     * @param gnamesAddress GNames address found by the globals scan
+     * @param callback Callback function for result (the name table)
+     */
+    void DumpNamesAsync(uint64_t gnamesAddress, std::function<void(const AsyncResult<std::shared_ptr<const NameTable>>&)> callback = nullptr);
+
+    /**
+     * @brief Walk GObjects into an object index asynchronously (cancellable, reports progress)
+     *
+     * With a previous index from the same enumerator only the changed items
+     * are re-read (ObjectEnumerator::Resync) and the delta is reported; if
+     * the resync is impossible a full walk is done instead.
+     *
+     * @param enumerator Enumerator keeping the snapshot between walks
+     * @param gobjectsAddress GObjects address found by the globals scan
+     * @param previous Index to resync, nullptr for a full walk
+     * @param callback Callback function for result (the object index and delta)
+     */
+    void EnumerateObjectsAsync(std::shared_ptr<ObjectEnumerator> enumerator, uint64_t gobjectsAddress,
+                               std::shared_ptr<const ObjectIndex> previous,
+                               std::function<void(const AsyncResult<ObjectSyncResult>&)> callback = nullptr);
+
+    /**
+     * @brief Build the class and struct layouts of the attached build asynchronously (cancellable, reports progress)
+     *
+     * Loads the layouts from the cache of this build fingerprint when there
+     * is one; otherwise walks the reflection data and writes the cache.
+     *
+     * @param objects Enumerated GObjects (may be null if only the cache is wanted)
+     * @param names Dumped name table (may be null if only the cache is wanted)
+     * @param cacheDirectory Directory holding the layout caches
+     * @param callback Callback function for result (the layout index)
+     */
+    void IndexLayoutsAsync(std::shared_ptr<const ObjectIndex> objects, std::shared_ptr<const NameTable> names,
+                           const std::string& cacheDirectory,
+                           std::function<void(const AsyncResult<std::shared_ptr<const LayoutIndex>>&)> callback = nullptr);
+
     /**
      * @brief Check if there are any pending async operations
      * @return true if operations are pending
@@ -372,56 +651,104 @@ public:
     size_t GetPendingOperationCount() const;
 
     /**
-     * @brief Cancel all pending operations
+     * @brief Cancel all pending operations and ask running scans to stop early
+     *
+     * Callbacks of cancelled operations still run, with an unsuccessful result.
      */
     void CancelAllOperations();
 
+    /**
+     * @brief Get queued and running operations with their progress
+     * @return Snapshot refreshed once per Update() (main thread only)
+     */
+    const std::vector<TaskStatus>& GetOperationStatus() const { return m_operationStatus; }
+
+    /**
+     * @brief Get a counter that changes whenever Update() observed something the UI shows
+     *
+     * Bumped when callbacks were delivered, an operation was queued, started,
+     * cancelled or finished, or a new process snapshot or process list was
+     * published. Progress updates alone do not bump it; GetOperationStatus()
+     * still returns the latest progress. Lets the render loop skip frames
+     * while nothing changes.
+     * @return State version (main thread only)
+     */
+    uint64_t GetStateVersion() const { return m_stateVersion; }
+
+    /**
+     * @brief Start recording every backend call into a session file for later replay
+     * @param filename Session file to create
+     * @return true if recording started, false otherwise
+     */
+    bool StartSessionRecording(const std::string& filename);
+
+    /**
+     * @brief Stop an active session recording
+     */
+    void StopSessionRecording();
+
+    /**
+     * @brief Check if a session recording is active
+     * @return true if recording, false otherwise
+     */
+    bool IsSessionRecording() const;
+
 private:
     // Threading methods
     /**
-     * @brief Worker thread function
+     * @brief Queue an async operation; its callback runs on the main thread in Update()
+     * @tparam T Result type
+     * @param task Scheduling information (coalesced by taskId)
+     * @param body Operation, runs on a worker thread
+     * @param callback Result callback (may be empty)
      */
-    void WorkerThread();
+    template<typename T>
+    void AddAsyncTask(const AsyncTask& task, std::function<AsyncResult<T>()> body,
+                      std::function<void(const AsyncResult<T>&)> callback);
 
     /**
-     * @brief Add a task to the async queue
-     * @param task Task to add
+     * @brief Process completed async tasks and call callbacks
+     * @return true if any callback ran
      */
-    void AddAsyncTask(const AsyncTask& task);
+    bool ProcessCompletedTasks();
 
     /**
-     * @brief Process completed async tasks and call callbacks
+     * @brief Fetch the process list and publish it if processes started or exited
      */
-    void ProcessCompletedTasks();
+    void RefreshProcessList();
 
     /**
-     * @brief Initialize LeechCore device
-     * @return true if successful, false otherwise
+     * @brief Background thread refreshing the process list periodically
      */
-    bool InitializeDevice();
+    void ProcessListThread();
 
     /**
-     * @brief Cleanup LeechCore resources
+     * @brief Look up a module in the cached module map, refetching it on a miss
+     * @param moduleName Module name (case-insensitive)
+     * @param module Receives the module entry
+     * @return true if found
      */
-    void CleanupDevice();
+    bool FindModule(const std::string& moduleName, ProcessInfo& module) const;
 
     /**
-     * @brief Refresh the process list
+     * @brief Get the current snapshot with a module map, loading it if needed
+     * @param missed Whether the caller missed in the current map (refetch if old enough)
+     * @return Snapshot to use for the lookup
      */
-    void RefreshProcessList();
+    std::shared_ptr<const ProcessSnapshot> GetModuleSnapshot(bool missed) const;
 
     /**
-     * @brief Check if memory map file exists
-     * @return true if mmap.txt exists, false otherwise
+     * @brief Fetch the module list and publish it with the given snapshot's process
+     * @param snapshot Snapshot the map belongs to
+     * @return The published snapshot, or the one that replaced it meanwhile
      */
-    bool CheckMemoryMapExists();
+    std::shared_ptr<const ProcessSnapshot> LoadModuleMap(std::shared_ptr<const ProcessSnapshot> snapshot) const;
 
     /**
-     * @brief Initialize VMMDLL with specified arguments
-     * @param useMemoryMap Whether to use memory map
-     * @return true if successful, false otherwise
+     * @brief Publish a new process snapshot
+     * @param process Attached process, or a default ProcessInfo when detaching
      */
-    bool InitializeWithArgs(bool useMemoryMap);
+    void PublishProcessSnapshot(const ProcessInfo& process);
 
     /**
      * @brief Parse a signature pattern string into bytes and wildcards
@@ -443,6 +770,28 @@ private:
     size_t FindPatternInBuffer(const uint8_t* buffer, size_t bufferSize, 
                               const std::vector<uint8_t>& pattern, const std::string& mask) const;
 
+    /**
+     * @brief Get the signatures of a group, likeliest variant for the engine version first
+     * @param groupName Group to scan for ("GWorld", "GNames", "GObjects")
+     * @param version Engine version of the main module
+     * @return Ranked variants of the group
+     */
+    std::vector<UnrealSignature> GetRankedSignatures(const std::string& groupName, const EngineVersion& version) const;
+
+    /**
+     * @brief Count a variant match (written to the stats file by the next flush)
+     * @param version Engine version of the main module
+     * @param signature Variant that matched
+     */
+    void RecordSignatureHit(const EngineVersion& version, const std::string& signature) const;
+
+    /**
+     * @brief Fill a module image from the signature index, or else read the main module
+     * @param image Image to fill (marked loaded even if the read fails)
+     * @return true if any bytes are available
+     */
+    bool LoadMainModuleImage(MainModuleImage& image) const;
+
     /**
      * @brief Adjust found offset based on group-specific instruction prefixes
      * @param buffer Memory buffer containing the found pattern
@@ -450,7 +799,7 @@ private:
      * @param group Unreal Engine group name (GWorld, GNames, GObjects)
      * @return Adjusted offset pointing to the correct instruction
      */
-    size_t AdjustFoundOffsetForGroup(const uint8_t* buffer, size_t bufferSize, size_t foundOffset, const std::string& group) const;
+    static size_t AdjustFoundOffsetForGroup(const uint8_t* buffer, size_t bufferSize, size_t foundOffset, const std::string& group);
 
     /**
      * @brief Calculate RVA from instruction offset
@@ -462,27 +811,51 @@ private:
     uint64_t CalculateRVAFromInstruction(const uint8_t* buffer, size_t bufferSize, size_t instructionOffset, uint64_t baseAddress) const;
 
 private:
-    // LeechCore handles (using void* to avoid including headers here)
-    void* m_hLeechCore;             ///< LeechCore device handle
-    void* m_hVMM;                   ///< VMM handle
+    // Device access
+    std::unique_ptr<MemoryBackend> m_backend;  ///< Active memory backend (always a RecordingBackend wrapper)
+    RecordingBackend* m_recorder;               ///< Recording wrapper around the backend (owned by m_backend)
     
-    // Current state
+    // Current state (read lock-free by any thread; written by attach/detach)
     std::atomic<bool> m_isInitialized;      ///< Whether DMA is initialized
     std::atomic<bool> m_isConnected;        ///< Whether DMA is connected to target
-    ProcessInfo m_currentProcess;           ///< Currently attached process info
-    std::atomic<uint32_t> m_currentProcessId;   ///< Currently attached process ID
+    std::atomic<uint32_t> m_currentProcessId;   ///< Currently attached process ID (hot read path)
+    mutable std::atomic<std::shared_ptr<const ProcessSnapshot>> m_processSnapshot;  ///< Currently attached process info (refined by const lookups)
+    std::atomic<uint64_t> m_snapshotGeneration; ///< Last snapshot generation handed out
     
     // Process management
-    std::vector<ProcessInfo> m_processList;  ///< Cached process list
-    float m_processRefreshTimer;             ///< Timer for auto-refreshing process list
+    std::atomic<std::shared_ptr<const std::vector<ProcessInfo>>> m_processList;  ///< Cached process list
+    std::thread m_processListThread;                ///< Background process list refresher
+    std::mutex m_processListMutex;                  ///< Guards the refresher flags below
+    std::condition_variable m_processListCondition; ///< Wakes the refresher early
+    bool m_processListRefreshRequested;             ///< Refresh requested before the interval elapsed
+    bool m_processListStopping;                     ///< Refresher should exit
     
     // Threading
-    std::thread m_workerThread;                 ///< Background worker thread
-    std::atomic<bool> m_shouldStop;             ///< Flag to stop worker thread
-    std::mutex m_taskQueueMutex;                ///< Mutex for task queue
-    std::condition_variable m_taskCondition;    ///< Condition variable for task queue
-    std::queue<AsyncTask> m_taskQueue;          ///< Queue of pending async tasks
-    std::atomic<size_t> m_pendingOperations;    ///< Number of pending operations
+    TaskExecutor m_executor;                    ///< Worker pool running async operations
+    std::vector<TaskStatus> m_operationStatus;  ///< Operation snapshot for the UI (main thread)
+    uint64_t m_stateVersion;                    ///< Bumped by Update() on visible changes (main thread)
+    std::shared_ptr<const ProcessSnapshot> m_observedSnapshot;                  ///< Process snapshot seen by the last Update()
+    std::shared_ptr<const std::vector<ProcessInfo>> m_observedProcessList;      ///< Process list seen by the last Update()
+    
+    // Signature ranking (written by scans on worker threads)
+    mutable std::mutex m_signatureMutex;        ///< Guards the members below
+    mutable SignatureStats m_signatureStats;    ///< Variant hits per engine version
+    std::string m_signatureStatsFile;           ///< File the stats are persisted in (empty = memory only)
+    mutable bool m_signatureStatsDirty;         ///< Stats changed since they were last written
+    mutable std::mutex m_signatureStatsFileMutex;   ///< Serializes stats file writes (taken before m_signatureMutex)
+    mutable EngineVersion m_engineVersion;      ///< Engine version of the attached build
+    mutable uint64_t m_engineVersionGeneration; ///< Snapshot generation m_engineVersion was detected for (0 = none)
+    
+    // Symbol lookups before signature scans
+    mutable std::mutex m_symbolMutex;           ///< Guards the members below
+    std::shared_ptr<const PdbFile> m_pdbFile;   ///< PDB supplied on disk (null = none)
+    mutable std::shared_ptr<const SymbolResolver> m_symbolResolver;    ///< Resolver of the attached build
+    mutable uint64_t m_symbolResolverGeneration;    ///< Snapshot generation m_symbolResolver was loaded for (0 = none)
+    
+    // Captured main module for repeated signature queries
+    mutable std::mutex m_signatureIndexMutex;   ///< Guards the members below
+    std::shared_ptr<const SignatureIndex> m_signatureIndex;    ///< Index of the main module (null = none)
+    uint64_t m_signatureIndexGeneration;        ///< Snapshot generation m_signatureIndex was built for (0 = none)
     
     // Callback storage
     std::mutex m_callbackMutex;                 ///< Mutex for callback access
@@ -490,4 +863,8 @@ private:
     
     // Configuration
     static constexpr float PROCESS_REFRESH_INTERVAL = 5.0f;  ///< Process list refresh interval (seconds)
+    static constexpr float MODULE_MAP_MISS_REFRESH_INTERVAL = 2.0f;  ///< Minimum module map age before a lookup miss refetches it (seconds)
+    static constexpr size_t INDEX_READ_PAGE = 0x1000;          ///< Read granularity of the signature index capture
+    static constexpr size_t INDEX_READ_BATCH = 0x800000;       ///< Bytes per scatter batch of the signature index capture (8 MB)
+    static constexpr size_t WORKER_THREADS = 3;               ///< Async workers (a long scan leaves room for quick lookups)
 }; 
\ No newline at end of file
@@ -0,0 +1,30 @@
+#include "MemoryBackend.h"
+#include <algorithm>
+
+size_t MemoryBackend::ReadScatter(uint32_t processId, ScatterRead* requests, size_t count)
+{
+    // Fallback for backends without native scatter support: one round trip per entry
+    size_t totalBytesRead = 0;
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        requests[i].bytesRead = Read(processId, requests[i].address, requests[i].buffer, requests[i].size);
+        totalBytesRead += requests[i].bytesRead;
+    }
+
+    return totalBytesRead;
+}
+
+std::vector<MemoryRegion> MemoryBackend::GetMemoryRegions(uint32_t processId)
+{
+    // Fallback for backends without a memory map: the module images only
+    std::vector<MemoryRegion> regions;
+    for (const auto& module : GetModuleList(processId))
+    {
+        regions.emplace_back(module.baseAddress, module.imageSize, true, true, true);
+    }
+
+    std::sort(regions.begin(), regions.end(),
+        [](const MemoryRegion& a, const MemoryRegion& b) { return a.baseAddress < b.baseAddress; });
+    return regions;
+}
@@ -0,0 +1,135 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+/**
+ * @struct ProcessInfo
+ * @brief Contains information about a target process
+ */
+struct ProcessInfo
+{
+    uint32_t processId;         ///< Process ID
+    std::string processName;    ///< Process executable name
+    uint64_t baseAddress;       ///< Base address of the process
+    uint64_t imageSize;         ///< Size of the process image
+
+    ProcessInfo(uint32_t pid = 0, const std::string& name = "",
+                uint64_t base = 0, uint64_t size = 0)
+        : processId(pid), processName(name), baseAddress(base), imageSize(size) {}
+};
+
+/**
+ * @struct MemoryRegion
+ * @brief A committed, readable range of a process address space
+ */
+struct MemoryRegion
+{
+    uint64_t baseAddress;   ///< Region start address
+    uint64_t size;          ///< Region size in bytes
+    bool writable;          ///< Pages can be written
+    bool executable;        ///< Pages can be executed
+    bool image;             ///< Backed by a module image
+
+    MemoryRegion(uint64_t base = 0, uint64_t regionSize = 0, bool write = false, bool execute = false, bool isImage = false)
+        : baseAddress(base), size(regionSize), writable(write), executable(execute), image(isImage) {}
+};
+
+/**
+ * @struct ScatterRead
+ * @brief A single entry of a batched (scatter) memory read
+ */
+struct ScatterRead
+{
+    uint64_t address = 0;   ///< Virtual address to read from
+    void* buffer = nullptr; ///< Destination buffer
+    size_t size = 0;        ///< Number of bytes requested
+    size_t bytesRead = 0;   ///< Number of bytes actually read (filled by the backend)
+
+    ScatterRead() = default;
+    ScatterRead(uint64_t addr, void* buf, size_t sz)
+        : address(addr), buffer(buf), size(sz) {}
+};
+
+/**
+ * @class MemoryBackend
+ * @brief Abstract source of process and memory information
+ *
+ * DMAManager performs all device access through a backend. The default
+ * backend talks to an FPGA through VMMDLL; other backends serve memory from
+ * simulated images so the scan engine can run and be measured without a
+ * DMA device. Implementations must allow concurrent calls to the read methods.
+ */
+class MemoryBackend
+{
+public:
+    /**
+     * @brief Destructor
+     */
+    virtual ~MemoryBackend() = default;
+
+    /**
+     * @brief Get a short name describing the backend
+     * @return Backend name (e.g., "vmmdll", "simulated")
+     */
+    virtual std::string GetName() const = 0;
+
+    /**
+     * @brief Enumerate all processes
+     * @return Vector of ProcessInfo structures
+     */
+    virtual std::vector<ProcessInfo> GetProcessList() = 0;
+
+    /**
+     * @brief Enumerate loaded modules of a process
+     * @param processId Target process ID
+     * @return Vector of module entries (processName holds the module name)
+     */
+    virtual std::vector<ProcessInfo> GetModuleList(uint32_t processId) = 0;
+
+    /**
+     * @brief Get the base address of a module
+     * @param processId Target process ID
+     * @param moduleName Module name
+     * @return Module base address, 0 if not found
+     */
+    virtual uint64_t GetModuleBase(uint32_t processId, const std::string& moduleName) = 0;
+
+    /**
+     * @brief Enumerate the committed, readable memory regions of a process
+     * @param processId Target process ID
+     * @return Regions in ascending address order
+     */
+    virtual std::vector<MemoryRegion> GetMemoryRegions(uint32_t processId);
+
+    /**
+     * @brief Read memory from a process
+     * @param processId Target process ID
+     * @param address Virtual address to read from
+     * @param buffer Buffer to store the read data
+     * @param size Number of bytes to read
+     * @return Number of bytes actually read, 0 on failure
+     */
+    virtual size_t Read(uint32_t processId, uint64_t address, void* buffer, size_t size) = 0;
+
+    /**
+     * @brief Read several memory ranges in a single device round trip
+     * @param processId Target process ID
+     * @param requests Read requests (bytesRead is filled for each entry)
+     * @param count Number of requests
+     * @return Total number of bytes read
+     */
+    virtual size_t ReadScatter(uint32_t processId, ScatterRead* requests, size_t count);
+
+    /**
+     * @brief Write memory to a process
+     * @param processId Target process ID
+     * @param address Virtual address to write to
+     * @param buffer Data to write
+     * @param size Number of bytes to write
+     * @return Number of bytes actually written, 0 on failure
+     */
+    virtual size_t Write(uint32_t processId, uint64_t address, const void* buffer, size_t size) = 0;
+};
@@ -0,0 +1,37 @@
+#include "ModuleMap.h"
+#include "../Core/StringUtils.h"
+#include <cstdint>
+
+ModuleMap::ModuleMap(std::vector<ProcessInfo> modules, const std::string& processName)
+    : m_modules(std::move(modules))
+    , m_mainModule(SIZE_MAX)
+    , m_fetchTime(std::chrono::steady_clock::now())
+{
+    m_byName.reserve(m_modules.size());
+    for (size_t i = 0; i < m_modules.size(); ++i)
+    {
+        // First entry wins, like the loader's own lookup
+        m_byName.emplace(ToLower(m_modules[i].processName), i);
+    }
+
+    auto it = m_byName.find(ToLower(processName));
+    if (it != m_byName.end())
+    {
+        m_mainModule = it->second;
+    }
+    else if (!m_modules.empty())
+    {
+        m_mainModule = 0;   // Usually the main executable
+    }
+}
+
+const ProcessInfo* ModuleMap::Find(const std::string& moduleName) const
+{
+    auto it = m_byName.find(ToLower(moduleName));
+    return it != m_byName.end() ? &m_modules[it->second] : nullptr;
+}
+
+const ProcessInfo* ModuleMap::GetMainModule() const
+{
+    return m_mainModule != SIZE_MAX ? &m_modules[m_mainModule] : nullptr;
+}
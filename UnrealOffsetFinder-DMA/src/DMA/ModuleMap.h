@@ -0,0 +1,57 @@
+#pragma once
+
+#include "MemoryBackend.h"
+#include <chrono>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @class ModuleMap
+ * @brief Immutable, name-indexed module list of one process
+ *
+ * Built once per attach (and again on explicit refresh) from a single
+ * backend module list call, so module lookups never touch the device.
+ * Names are matched case-insensitively, as Windows does.
+ */
+class ModuleMap
+{
+public:
+    /**
+     * @brief Build the map
+     * @param modules Module list as returned by the backend
+     * @param processName Process executable name, used to pick the main module
+     */
+    ModuleMap(std::vector<ProcessInfo> modules, const std::string& processName);
+
+    /**
+     * @brief Find a module by name
+     * @param moduleName Module name (case-insensitive)
+     * @return Module entry, nullptr if not loaded
+     */
+    const ProcessInfo* Find(const std::string& moduleName) const;
+
+    /**
+     * @brief Get the main executable module
+     * @return Module matching the process name, else the first module; nullptr if the map is empty
+     */
+    const ProcessInfo* GetMainModule() const;
+
+    /**
+     * @brief Get all modules in backend order
+     * @return Module list
+     */
+    const std::vector<ProcessInfo>& GetModules() const { return m_modules; }
+
+    /**
+     * @brief Get the time the module list was fetched
+     * @return Fetch time
+     */
+    std::chrono::steady_clock::time_point GetFetchTime() const { return m_fetchTime; }
+
+private:
+    std::vector<ProcessInfo> m_modules;                     ///< Modules in backend order
+    std::unordered_map<std::string, size_t> m_byName;       ///< Lower-case name -> index
+    size_t m_mainModule;                                    ///< Index of the main module (SIZE_MAX if none)
+    std::chrono::steady_clock::time_point m_fetchTime;      ///< When the list was fetched
+};
@@ -0,0 +1,428 @@
+#include "OffsetRefresher.h"
+#include "DMAManager.h"
+#include "../Core/Trace.h"
+#include <algorithm>
+#include <cstring>
+#include <iomanip>
+#include <sstream>
+
+namespace
+{
+    const char* const TYPE_NAMES[] = { "uint8", "int32", "uint32", "int64", "uint64", "float", "double", "pointer" };
+
+    /// Wait while paused or without targets
+    constexpr auto IDLE_WAIT = std::chrono::milliseconds(250);
+}
+
+OffsetRefresher::OffsetRefresher(const DMAManager& dmaManager)
+    : m_dmaManager(dmaManager)
+    , m_stopping(false)
+    , m_targetsChanged(false)
+    , m_interval(0.0f)
+    , m_refreshRequested(false)
+    , m_moduleBase(0)
+    , m_values(std::make_shared<const ValueMap>())
+    , m_version(0)
+{
+}
+
+OffsetRefresher::~OffsetRefresher()
+{
+    Stop();
+}
+
+void OffsetRefresher::SetTargets(std::vector<OffsetTarget> targets)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_targets = std::move(targets);
+        m_targetsChanged = true;
+        m_refreshRequested = true;
+
+        if (!m_worker.joinable() && !m_stopping)
+        {
+            m_worker = std::thread(&OffsetRefresher::WorkerThread, this);
+        }
+    }
+    m_condition.notify_one();
+}
+
+void OffsetRefresher::SetVisible(std::vector<uint64_t> ids)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (ids != m_visible)
+    {
+        m_visible = std::move(ids);
+        m_refreshRequested = true;
+        m_condition.notify_one();
+    }
+}
+
+void OffsetRefresher::SetInterval(float seconds)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    seconds = std::max(seconds, 0.0f);
+    if (seconds != m_interval)
+    {
+        m_interval = seconds;
+        m_condition.notify_one();
+    }
+}
+
+void OffsetRefresher::RefreshNow()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_refreshRequested = true;
+    }
+    m_condition.notify_one();
+}
+
+void OffsetRefresher::Stop()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopping = true;
+    }
+    m_condition.notify_all();
+
+    if (m_worker.joinable())
+    {
+        m_worker.join();
+    }
+}
+
+void OffsetRefresher::WorkerThread()
+{
+    TraceRecorder::Get().SetCurrentThreadName("Offset Refresher");
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (!m_stopping)
+    {
+        auto wait = m_interval > 0.0f ? std::chrono::duration<float>(m_interval) : std::chrono::duration<float>(IDLE_WAIT);
+        m_condition.wait_for(lock, wait, [this]() { return m_stopping || m_refreshRequested; });
+        if (m_stopping)
+        {
+            break;
+        }
+
+        // Paused: only explicit requests (new targets, scrolling, Read) trigger a tick
+        if (m_interval <= 0.0f && !m_refreshRequested)
+        {
+            continue;
+        }
+        m_refreshRequested = false;
+
+        lock.unlock();
+        Tick();
+        lock.lock();
+    }
+}
+
+void OffsetRefresher::Tick()
+{
+    std::vector<uint64_t> visible;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        visible = m_visible;
+
+        if (m_targetsChanged)
+        {
+            // Keep the resolved chains of targets that did not change
+            std::unordered_map<uint64_t, TargetState> states;
+            for (const auto& target : m_targets)
+            {
+                auto it = m_states.find(target.id);
+                if (it != m_states.end() && it->second.target.offset == target.offset &&
+                    it->second.target.pointerChain == target.pointerChain)
+                {
+                    it->second.target.type = target.type;
+                    states.emplace(target.id, std::move(it->second));
+                }
+                else
+                {
+                    TargetState state;
+                    state.target = target;
+                    state.linkAddresses.assign(target.pointerChain.size() + 1, 0);
+                    states.emplace(target.id, std::move(state));
+                }
+            }
+            m_states = std::move(states);
+            m_targetsChanged = false;
+        }
+    }
+
+    auto previous = m_values.load();
+    if (!m_dmaManager.IsConnected())
+    {
+        if (!previous->empty())
+        {
+            m_values.store(std::make_shared<const ValueMap>());
+            m_version++;
+        }
+        return;
+    }
+
+    // Chains are resolved relative to the module base; start over when it moves
+    uint64_t moduleBase = m_dmaManager.GetProcessSnapshot()->GetMainModuleBase();
+    if (moduleBase != m_moduleBase)
+    {
+        for (auto& [id, state] : m_states)
+        {
+            std::fill(state.linkAddresses.begin(), state.linkAddresses.end(), 0);
+        }
+        m_moduleBase = moduleBase;
+    }
+
+    // Every target reads its known links plus the value in one batch. A link that moved or was not
+    // resolved yet is followed in another batch of the same tick, at most one more per chain level
+    enum class Outcome { Pending, Resolved, Broken };
+    struct Pending
+    {
+        TargetState* state;
+        size_t level = 0;           ///< First level read by the current batch
+        size_t firstRequest = 0;    ///< First request of the current batch
+        size_t requestCount = 0;    ///< Requests in the current batch
+        Outcome outcome = Outcome::Pending;
+        bool valid = false;         ///< Value read in full (Resolved only)
+        uint64_t raw = 0;           ///< Value bits (Resolved only)
+    };
+    std::vector<Pending> pending;
+    pending.reserve(visible.size());
+    for (uint64_t id : visible)
+    {
+        auto it = m_states.find(id);
+        if (it == m_states.end())
+            continue;
+
+        it->second.linkAddresses[0] = m_moduleBase + it->second.target.offset;
+        pending.push_back({ &it->second });
+    }
+
+    std::vector<ScatterRead> requests;
+    std::vector<uint64_t> buffers;
+    bool active = !pending.empty();
+    while (active)
+    {
+        size_t requestTotal = 0;
+        for (auto& entry : pending)
+        {
+            if (entry.outcome != Outcome::Pending)
+                continue;
+
+            const auto& links = entry.state->linkAddresses;
+            size_t end = entry.level;
+            while (end < links.size() && links[end] != 0)
+                end++;
+            entry.firstRequest = requestTotal;
+            entry.requestCount = end - entry.level;
+            requestTotal += entry.requestCount;
+        }
+
+        requests.clear();
+        requests.reserve(requestTotal);
+        buffers.assign(requestTotal, 0);
+        for (const auto& entry : pending)
+        {
+            if (entry.outcome != Outcome::Pending)
+                continue;
+
+            const TargetState& state = *entry.state;
+            size_t levels = state.target.pointerChain.size();
+            for (size_t i = 0; i < entry.requestCount; ++i)
+            {
+                size_t level = entry.level + i;
+                size_t size = level < levels ? sizeof(uint64_t) : GetTypeSize(state.target.type);
+                requests.emplace_back(state.linkAddresses[level], &buffers[entry.firstRequest + i], size);
+            }
+        }
+
+        if (!requests.empty())
+        {
+            TRACE_SCOPE("RefreshOffsets", "dma", "count", requests.size());
+            m_dmaManager.ReadMemoryBatch(requests);
+        }
+
+        // Follow the links read by this batch; a moved link invalidates the deeper ones
+        active = false;
+        for (auto& entry : pending)
+        {
+            if (entry.outcome != Outcome::Pending)
+                continue;
+
+            auto& links = entry.state->linkAddresses;
+            const auto& chain = entry.state->target.pointerChain;
+            entry.outcome = Outcome::Broken;
+            for (size_t i = 0; i < entry.requestCount; ++i)
+            {
+                size_t level = entry.level + i;
+                const ScatterRead& request = requests[entry.firstRequest + i];
+                uint64_t data = buffers[entry.firstRequest + i];
+                if (level == chain.size())
+                {
+                    entry.outcome = Outcome::Resolved;
+                    entry.valid = request.bytesRead == request.size;
+                    entry.raw = entry.valid ? data : 0;
+                    break;
+                }
+
+                uint64_t next = (request.bytesRead == sizeof(uint64_t) && data != 0) ? data + chain[level] : 0;
+                if (next != links[level + 1])
+                {
+                    links[level + 1] = next;
+                    std::fill(links.begin() + level + 2, links.end(), 0);
+                    if (next != 0)
+                    {
+                        // Deeper reads of this batch used the old path
+                        entry.outcome = Outcome::Pending;
+                        entry.level = level + 1;
+                        active = true;
+                    }
+                    break;
+                }
+                if (next == 0)
+                    break;
+            }
+        }
+    }
+
+    auto values = std::make_shared<ValueMap>();
+    bool changed = false;
+    auto now = std::chrono::steady_clock::now();
+    for (const auto& entry : pending)
+    {
+        TargetState& state = *entry.state;
+        uint64_t id = state.target.id;
+
+        auto previousIt = previous->find(id);
+        OffsetValue value = previousIt != previous->end() ? previousIt->second : OffsetValue();
+
+        if (entry.outcome == Outcome::Broken)
+        {
+            if (value.valid || value.address != 0 || value.text.empty())
+            {
+                value.valid = false;
+                value.address = 0;
+                value.text = "??";
+                value.lastChange = now;
+            }
+        }
+        else
+        {
+            if (entry.valid != value.valid || entry.raw != value.raw || value.text.empty() || value.type != state.target.type)
+            {
+                if (value.valid && entry.valid)
+                {
+                    value.lastChange = now;
+                }
+                value.valid = entry.valid;
+                value.raw = entry.raw;
+                value.type = state.target.type;
+                value.text = entry.valid ? FormatValue(state.target.type, entry.raw) : "??";
+            }
+            value.address = state.linkAddresses.back();
+        }
+
+        if (previousIt == previous->end() || previousIt->second.valid != value.valid ||
+            previousIt->second.raw != value.raw || previousIt->second.address != value.address ||
+            previousIt->second.text != value.text || previousIt->second.type != value.type)
+        {
+            changed = true;
+        }
+        values->emplace(id, std::move(value));
+    }
+
+    // Entries scrolled out of view keep their last value
+    for (const auto& [id, value] : *previous)
+    {
+        if (m_states.count(id) && values->find(id) == values->end())
+        {
+            values->emplace(id, value);
+        }
+        else if (!m_states.count(id))
+        {
+            changed = true;
+        }
+    }
+
+    if (changed)
+    {
+        m_values.store(std::move(values));
+        m_version++;
+    }
+}
+
+size_t OffsetRefresher::GetTypeSize(OffsetValueType type)
+{
+    switch (type)
+    {
+    case OffsetValueType::UInt8:
+        return 1;
+    case OffsetValueType::Int32:
+    case OffsetValueType::UInt32:
+    case OffsetValueType::Float:
+        return 4;
+    default:
+        return 8;
+    }
+}
+
+const char* OffsetRefresher::GetTypeName(OffsetValueType type)
+{
+    size_t index = static_cast<size_t>(type);
+    return index < static_cast<size_t>(OffsetValueType::Count) ? TYPE_NAMES[index] : "";
+}
+
+bool OffsetRefresher::ParseTypeName(const std::string& name, OffsetValueType& type)
+{
+    for (size_t i = 0; i < static_cast<size_t>(OffsetValueType::Count); ++i)
+    {
+        if (name == TYPE_NAMES[i])
+        {
+            type = static_cast<OffsetValueType>(i);
+            return true;
+        }
+    }
+    return false;
+}
+
+std::string OffsetRefresher::FormatValue(OffsetValueType type, uint64_t raw)
+{
+    std::ostringstream ss;
+    switch (type)
+    {
+    case OffsetValueType::UInt8:
+        ss << static_cast<uint32_t>(raw & 0xFF);
+        break;
+    case OffsetValueType::Int32:
+        ss << static_cast<int32_t>(static_cast<uint32_t>(raw));
+        break;
+    case OffsetValueType::UInt32:
+        ss << static_cast<uint32_t>(raw);
+        break;
+    case OffsetValueType::Int64:
+        ss << static_cast<int64_t>(raw);
+        break;
+    case OffsetValueType::UInt64:
+        ss << raw;
+        break;
+    case OffsetValueType::Float:
+    {
+        uint32_t bits = static_cast<uint32_t>(raw);
+        float value;
+        std::memcpy(&value, &bits, sizeof(value));
+        ss << std::setprecision(6) << value;
+        break;
+    }
+    case OffsetValueType::Double:
+    {
+        double value;
+        std::memcpy(&value, &raw, sizeof(value));
+        ss << std::setprecision(10) << value;
+        break;
+    }
+    default:
+        return DMAManager::FormatHexAddress(raw);
+    }
+    return ss.str();
+}
@@ -0,0 +1,197 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+class DMAManager;
+
+/**
+ * @enum OffsetValueType
+ * @brief How the value at an offset is read and shown
+ */
+enum class OffsetValueType : uint8_t
+{
+    UInt8 = 0,
+    Int32,
+    UInt32,
+    Int64,
+    UInt64,
+    Float,
+    Double,
+    Pointer,
+    Count
+};
+
+/**
+ * @struct OffsetTarget
+ * @brief One offset to keep refreshed
+ *
+ * The value is read at moduleBase + offset, or, with a pointer chain,
+ * by reading a pointer there and adding each chain offset to the pointer
+ * read at the previous level (Cheat Engine style).
+ */
+struct OffsetTarget
+{
+    uint64_t id = 0;                                ///< Caller's entry ID
+    uint64_t offset = 0;                            ///< Offset from the main module base
+    OffsetValueType type = OffsetValueType::UInt64; ///< Value type
+    std::vector<uint64_t> pointerChain;             ///< Offsets applied after each dereference
+};
+
+/**
+ * @struct OffsetValue
+ * @brief Latest refresh result of one offset
+ */
+struct OffsetValue
+{
+    uint64_t address = 0;       ///< Resolved address of the value (0 while unresolved)
+    bool valid = false;         ///< Value (and every pointer of the chain) could be read
+    uint64_t raw = 0;           ///< Raw value bits
+    OffsetValueType type = OffsetValueType::UInt64;    ///< Type the text was formatted as
+    std::string text;           ///< Formatted value
+    std::chrono::steady_clock::time_point lastChange;  ///< When the value last changed
+};
+
+/**
+ * @class OffsetRefresher
+ * @brief Keeps the values of offset entries up to date from a background thread
+ *
+ * Each tick reads every visible entry with one scatter batch: the value and,
+ * for pointer chains, every link at the addresses resolved before. Links
+ * that moved or were not resolved yet are followed within the same tick, with
+ * at most one more batch per chain level, so a published value was always
+ * read through the path of that tick. Results are published as an immutable
+ * map the UI reads without waiting on the device.
+ */
+class OffsetRefresher
+{
+public:
+    using ValueMap = std::unordered_map<uint64_t, OffsetValue>;
+
+    /**
+     * @brief Constructor
+     * @param dmaManager DMA manager to read through (must outlive the refresher)
+     */
+    explicit OffsetRefresher(const DMAManager& dmaManager);
+
+    /**
+     * @brief Destructor - stops the worker
+     */
+    ~OffsetRefresher();
+
+    /**
+     * @brief Replace the set of offsets
+     * @param targets Offsets to refresh
+     */
+    void SetTargets(std::vector<OffsetTarget> targets);
+
+    /**
+     * @brief Set which offsets are on screen (only those are read)
+     * @param ids Visible entry IDs
+     */
+    void SetVisible(std::vector<uint64_t> ids);
+
+    /**
+     * @brief Set the refresh rate
+     * @param seconds Interval between ticks, 0 to pause (RefreshNow still works)
+     */
+    void SetInterval(float seconds);
+
+    /**
+     * @brief Run a tick as soon as possible
+     */
+    void RefreshNow();
+
+    /**
+     * @brief Get the latest values
+     * @return Immutable value map by entry ID
+     */
+    std::shared_ptr<const ValueMap> GetValues() const { return m_values.load(); }
+
+    /**
+     * @brief Get a counter bumped whenever values were published
+     * @return Version
+     */
+    uint64_t GetVersion() const { return m_version.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Stop the worker thread
+     */
+    void Stop();
+
+    /**
+     * @brief Get the size of a value type in bytes
+     * @param type Value type
+     * @return Size
+     */
+    static size_t GetTypeSize(OffsetValueType type);
+
+    /**
+     * @brief Get the display name of a value type
+     * @param type Value type
+     * @return Name, e.g. "uint32"
+     */
+    static const char* GetTypeName(OffsetValueType type);
+
+    /**
+     * @brief Parse a value type name
+     * @param name Name as returned by GetTypeName
+     * @param type Receives the type
+     * @return true if recognised
+     */
+    static bool ParseTypeName(const std::string& name, OffsetValueType& type);
+
+    /**
+     * @brief Format raw value bits
+     * @param type Value type
+     * @param raw Raw bits (little endian, zero extended)
+     * @return Formatted value
+     */
+    static std::string FormatValue(OffsetValueType type, uint64_t raw);
+
+private:
+    /**
+     * @struct TargetState
+     * @brief Worker-side state of one target
+     */
+    struct TargetState
+    {
+        OffsetTarget target;
+        std::vector<uint64_t> linkAddresses;    ///< Resolved address of each level (0 = unknown)
+    };
+
+    /**
+     * @brief Worker thread function
+     */
+    void WorkerThread();
+
+    /**
+     * @brief Read every visible target (one scatter batch per unresolved chain level) and publish the values
+     */
+    void Tick();
+
+private:
+    const DMAManager& m_dmaManager;                 ///< Source of memory reads
+    mutable std::mutex m_mutex;                     ///< Guards the fields up to m_refreshRequested
+    std::condition_variable m_condition;            ///< Wakes the worker
+    std::thread m_worker;                           ///< Refresh thread (started on first SetTargets)
+    bool m_stopping;                                ///< Worker should exit
+    std::vector<OffsetTarget> m_targets;            ///< Offsets to refresh
+    bool m_targetsChanged;                          ///< m_targets was replaced since the worker last looked
+    std::vector<uint64_t> m_visible;                ///< Visible entry IDs
+    float m_interval;                               ///< Seconds between ticks (0 = paused)
+    bool m_refreshRequested;                        ///< RefreshNow was called
+
+    std::unordered_map<uint64_t, TargetState> m_states;     ///< Worker-side state by ID (worker only)
+    uint64_t m_moduleBase;                                  ///< Module base the link addresses were resolved against (worker only)
+    std::atomic<std::shared_ptr<const ValueMap>> m_values;  ///< Published values
+    std::atomic<uint64_t> m_version;                        ///< Bumped on publish
+};
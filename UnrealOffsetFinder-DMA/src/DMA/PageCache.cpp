@@ -0,0 +1,260 @@
+#include "PageCache.h"
+#include "DMAManager.h"
+#include "../Core/Trace.h"
+#include <algorithm>
+#include <iostream>
+
+namespace
+{
+    /// Sleep between checks while nothing needs fetching
+    constexpr auto IDLE_WAIT = std::chrono::milliseconds(100);
+
+    float SecondsSince(std::chrono::steady_clock::time_point then, std::chrono::steady_clock::time_point now)
+    {
+        return std::chrono::duration<float>(now - then).count();
+    }
+}
+
+PageCache::PageCache(const DMAManager& dmaManager)
+    : m_dmaManager(dmaManager)
+    , m_stopping(false)
+    , m_viewStart(0)
+    , m_viewEnd(0)
+    , m_refreshInterval(0.0f)
+    , m_generation(0)
+    , m_version(0)
+{
+}
+
+PageCache::~PageCache()
+{
+    Stop();
+}
+
+void PageCache::SetView(uint64_t start, uint64_t end)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (start == m_viewStart && end == m_viewEnd && m_worker.joinable())
+        {
+            return;
+        }
+
+        m_viewStart = start;
+        m_viewEnd = end;
+
+        if (!m_worker.joinable() && !m_stopping && end > start)
+        {
+            m_worker = std::thread(&PageCache::WorkerThread, this);
+        }
+    }
+    m_condition.notify_one();
+}
+
+void PageCache::SetRefreshInterval(float seconds)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_refreshInterval = std::max(seconds, 0.0f);
+    }
+    m_condition.notify_one();
+}
+
+std::shared_ptr<const PageCache::Page> PageCache::GetPage(uint64_t address) const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_pages.find(address & ~(PAGE_SIZE - 1));
+    return it != m_pages.end() ? it->second : nullptr;
+}
+
+void PageCache::Clear()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_pages.clear();
+    }
+    m_version++;
+    m_condition.notify_one();
+}
+
+void PageCache::Stop()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopping = true;
+    }
+    m_condition.notify_all();
+
+    if (m_worker.joinable())
+    {
+        m_worker.join();
+    }
+}
+
+void PageCache::WorkerThread()
+{
+    TraceRecorder::Get().SetCurrentThreadName("Page Cache");
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (!m_stopping)
+    {
+        // Pages of another process (or of none) are useless
+        uint64_t generation = m_dmaManager.GetProcessSnapshot()->generation;
+        if (generation != m_generation)
+        {
+            m_pages.clear();
+            m_generation = generation;
+            m_version++;
+        }
+
+        std::vector<uint64_t> stale;
+        if (m_dmaManager.IsConnected())
+        {
+            stale = CollectStalePages(std::chrono::steady_clock::now());
+        }
+
+        if (stale.empty())
+        {
+            auto wait = std::chrono::duration<float>(IDLE_WAIT);
+            if (m_refreshInterval > 0.0f)
+            {
+                wait = std::min(wait, std::chrono::duration<float>(m_refreshInterval));
+            }
+            m_condition.wait_for(lock, wait);
+            continue;
+        }
+
+        lock.unlock();
+        FetchPages(stale, generation);
+        lock.lock();
+    }
+}
+
+std::vector<uint64_t> PageCache::CollectStalePages(std::chrono::steady_clock::time_point now) const
+{
+    std::vector<uint64_t> stale;
+    if (m_viewEnd <= m_viewStart)
+    {
+        return stale;
+    }
+
+    uint64_t firstVisible = m_viewStart & ~(PAGE_SIZE - 1);
+    uint64_t lastVisible = (m_viewEnd - 1) & ~(PAGE_SIZE - 1);
+    uint64_t first = firstVisible >= PREFETCH_PAGES * PAGE_SIZE ? firstVisible - PREFETCH_PAGES * PAGE_SIZE : 0;
+    uint64_t last = lastVisible <= UINT64_MAX - PREFETCH_PAGES * PAGE_SIZE ? lastVisible + PREFETCH_PAGES * PAGE_SIZE : lastVisible;
+
+    auto isStale = [&](uint64_t address, bool visible)
+    {
+        auto it = m_pages.find(address);
+        if (it == m_pages.end())
+            return true;
+
+        float age = SecondsSince(it->second->fetchTime, now);
+        if (visible && m_refreshInterval > 0.0f)
+            return age >= m_refreshInterval;
+        return age >= PAGE_TTL;
+    };
+
+    // Visible pages first so a batch never delays what is on screen for prefetch
+    for (uint64_t address = firstVisible; address <= lastVisible; address += PAGE_SIZE)
+    {
+        if (isStale(address, true))
+            stale.push_back(address);
+    }
+    for (uint64_t address = first; address <= last; address += PAGE_SIZE)
+    {
+        bool visible = address >= firstVisible && address <= lastVisible;
+        if (!visible && isStale(address, false))
+            stale.push_back(address);
+    }
+    return stale;
+}
+
+void PageCache::FetchPages(const std::vector<uint64_t>& addresses, uint64_t generation)
+{
+    for (size_t batchStart = 0; batchStart < addresses.size(); batchStart += MAX_BATCH_PAGES)
+    {
+        size_t batchSize = std::min(MAX_BATCH_PAGES, addresses.size() - batchStart);
+        TRACE_SCOPE("FetchPages", "dma", "count", batchSize);
+
+        std::vector<std::shared_ptr<Page>> pages(batchSize);
+        std::vector<ScatterRead> requests;
+        requests.reserve(batchSize);
+        for (size_t i = 0; i < batchSize; ++i)
+        {
+            pages[i] = std::make_shared<Page>();
+            pages[i]->address = addresses[batchStart + i];
+            pages[i]->data.assign(PAGE_SIZE, 0);
+            requests.emplace_back(pages[i]->address, pages[i]->data.data(), PAGE_SIZE);
+        }
+
+        m_dmaManager.ReadMemoryBatch(requests);
+        auto now = std::chrono::steady_clock::now();
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (m_stopping || generation != m_generation || m_dmaManager.GetProcessSnapshot()->generation != generation)
+            {
+                return;
+            }
+
+            for (size_t i = 0; i < batchSize; ++i)
+            {
+                Page& page = *pages[i];
+                page.bytesRead = requests[i].bytesRead;
+                page.fetchTime = now;
+                page.changed.assign(PAGE_SIZE, 0);
+
+                // Highlight bytes that differ from the previous fetch of the same page
+                auto it = m_pages.find(page.address);
+                if (it != m_pages.end())
+                {
+                    const Page& previous = *it->second;
+                    page.changeTime = previous.changeTime;
+                    size_t comparable = std::min(page.bytesRead, previous.bytesRead);
+                    bool anyChanged = false;
+                    for (size_t b = 0; b < comparable; ++b)
+                    {
+                        if (page.data[b] != previous.data[b])
+                        {
+                            page.changed[b] = 1;
+                            anyChanged = true;
+                        }
+                    }
+                    if (anyChanged)
+                    {
+                        page.changeTime = now;
+                    }
+                    else
+                    {
+                        // Keep the last changes so the viewer can fade them out
+                        page.changed = previous.changed;
+                    }
+                }
+
+                m_pages[page.address] = std::move(pages[i]);
+            }
+            EvictPages();
+        }
+        m_version++;
+    }
+}
+
+void PageCache::EvictPages()
+{
+    if (m_pages.size() <= MAX_PAGES)
+    {
+        return;
+    }
+
+    uint64_t margin = PREFETCH_PAGES * PAGE_SIZE;
+    uint64_t keepStart = m_viewStart >= margin ? m_viewStart - margin : 0;
+    uint64_t keepEnd = m_viewEnd <= UINT64_MAX - margin ? m_viewEnd + margin : UINT64_MAX;
+    for (auto it = m_pages.begin(); it != m_pages.end();)
+    {
+        if (it->first + PAGE_SIZE <= keepStart || it->first >= keepEnd)
+            it = m_pages.erase(it);
+        else
+            ++it;
+    }
+}
@@ -0,0 +1,132 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+class DMAManager;
+
+/**
+ * @class PageCache
+ * @brief Background page fetcher for memory views
+ *
+ * The viewer reports the address range on screen every frame; a worker
+ * thread fetches the visible pages plus a prefetch margin in scatter
+ * batches, refreshes visible pages at the live refresh rate and keeps
+ * off-screen pages for a short TTL. Pages are immutable once published,
+ * so the UI reads them without waiting on the device.
+ */
+class PageCache
+{
+public:
+    /**
+     * @struct Page
+     * @brief One fetched page
+     */
+    struct Page
+    {
+        uint64_t address = 0;                   ///< Page address (PAGE_SIZE aligned)
+        std::vector<uint8_t> data;              ///< Page bytes (PAGE_SIZE)
+        std::vector<uint8_t> changed;           ///< Non-zero for bytes that changed at changeTime
+        size_t bytesRead = 0;                   ///< Readable bytes from the start of the page
+        std::chrono::steady_clock::time_point fetchTime;    ///< When the page was read
+        std::chrono::steady_clock::time_point changeTime;   ///< When a byte last changed
+    };
+
+    /**
+     * @brief Constructor
+     * @param dmaManager DMA manager to read through (must outlive the cache)
+     */
+    explicit PageCache(const DMAManager& dmaManager);
+
+    /**
+     * @brief Destructor - stops the worker
+     */
+    ~PageCache();
+
+    /**
+     * @brief Set the address range currently on screen
+     * @param start First visible address
+     * @param end One past the last visible address (end <= start pauses fetching)
+     */
+    void SetView(uint64_t start, uint64_t end);
+
+    /**
+     * @brief Set the live refresh interval of visible pages
+     * @param seconds Interval, 0 to only fetch pages that are missing or expired
+     */
+    void SetRefreshInterval(float seconds);
+
+    /**
+     * @brief Get a cached page
+     * @param address Any address inside the page
+     * @return Page, nullptr if not fetched yet
+     */
+    std::shared_ptr<const Page> GetPage(uint64_t address) const;
+
+    /**
+     * @brief Drop every cached page
+     */
+    void Clear();
+
+    /**
+     * @brief Get a counter bumped whenever pages were published
+     * @return Version
+     */
+    uint64_t GetVersion() const { return m_version.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Stop the worker thread
+     */
+    void Stop();
+
+    static constexpr uint64_t PAGE_SIZE = 0x1000;       ///< Fetch granularity
+    static constexpr uint64_t PREFETCH_PAGES = 4;       ///< Pages fetched ahead of and behind the view
+    static constexpr size_t MAX_BATCH_PAGES = 64;       ///< Pages per scatter batch
+    static constexpr size_t MAX_PAGES = 1024;           ///< Cached pages before off-screen ones are evicted
+    static constexpr float PAGE_TTL = 2.0f;             ///< Age after which a cached page is fetched again (seconds)
+
+private:
+    /**
+     * @brief Worker thread function
+     */
+    void WorkerThread();
+
+    /**
+     * @brief Collect the pages of the current view that need fetching (caller holds m_mutex)
+     * @param now Current time
+     * @return Page addresses, visible pages first
+     */
+    std::vector<uint64_t> CollectStalePages(std::chrono::steady_clock::time_point now) const;
+
+    /**
+     * @brief Read pages in scatter batches and publish them
+     * @param addresses Page addresses
+     * @param generation Process snapshot generation the pages belong to
+     */
+    void FetchPages(const std::vector<uint64_t>& addresses, uint64_t generation);
+
+    /**
+     * @brief Evict pages outside the view and its prefetch margin when over capacity (caller holds m_mutex)
+     */
+    void EvictPages();
+
+private:
+    const DMAManager& m_dmaManager;             ///< Source of memory reads
+    mutable std::mutex m_mutex;                 ///< Guards everything below
+    std::condition_variable m_condition;        ///< Wakes the worker on view changes and stop
+    std::thread m_worker;                       ///< Fetch thread (started on first SetView)
+    bool m_stopping;                            ///< Worker should exit
+    uint64_t m_viewStart;                       ///< First visible address
+    uint64_t m_viewEnd;                         ///< One past the last visible address
+    float m_refreshInterval;                    ///< Live refresh interval (0 = off)
+    uint64_t m_generation;                      ///< Process snapshot generation of the cached pages
+    std::unordered_map<uint64_t, std::shared_ptr<const Page>> m_pages; ///< Cached pages by address
+    std::atomic<uint64_t> m_version;            ///< Bumped on publish
+};
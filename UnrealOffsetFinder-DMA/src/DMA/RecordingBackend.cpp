@@ -0,0 +1,419 @@
+#include "RecordingBackend.h"
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <iostream>
+
+using SessionFormat::RecordType;
+
+namespace
+{
+    uint64_t Mix64(uint64_t value)
+    {
+        // MurmurHash3 finalizer
+        value ^= value >> 33;
+        value *= 0xFF51AFD7ED558CCDULL;
+        value ^= value >> 33;
+        value *= 0xC4CEB9FE1A85EC53ULL;
+        value ^= value >> 33;
+        return value;
+    }
+}
+
+size_t RecordingBackend::BlobKey::Hasher::operator()(const BlobKey& key) const
+{
+    return static_cast<size_t>(key.low ^ key.high);
+}
+
+RecordingBackend::BlobKey RecordingBackend::HashBlob(const uint8_t* data, size_t size)
+{
+    // Two 64-bit lanes over 8-byte words, keyed with the length so equal prefixes of different sizes differ
+    uint64_t low = 0x9E3779B97F4A7C15ULL ^ size;
+    uint64_t high = 0xC2B2AE3D27D4EB4FULL + size;
+    for (size_t offset = 0; offset < size; offset += sizeof(uint64_t))
+    {
+        uint64_t word = 0;
+        std::memcpy(&word, data + offset, std::min(sizeof(uint64_t), size - offset));
+        low = std::rotl(low ^ (word * 0x87C37B91114253D5ULL), 31) * 0x4CF5AD432745937FULL;
+        high = std::rotl(high + (word * 0x52DCE729DA3ED1B5ULL), 29) * 0x9FB21C651E98DF25ULL ^ low;
+    }
+    return { Mix64(low), Mix64(high ^ low) };
+}
+
+RecordingBackend::RecordingBackend(std::unique_ptr<MemoryBackend> inner)
+    : m_inner(std::move(inner))
+    , m_recording(false)
+{
+}
+
+RecordingBackend::~RecordingBackend()
+{
+    Stop();
+}
+
+bool RecordingBackend::Start(const std::string& filename)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        if (m_recording)
+        {
+            std::cerr << "Session recording already active: " << m_filename << std::endl;
+            return false;
+        }
+
+        m_file.open(filename, std::ios::binary | std::ios::trunc);
+        if (!m_file.is_open())
+        {
+            std::cerr << "Failed to create session file: " << filename << std::endl;
+            return false;
+        }
+
+        SessionFormat::Writer writer(m_file);
+        writer.PutBytes(SessionFormat::MAGIC, sizeof(SessionFormat::MAGIC));
+        writer.Put<uint32_t>(SessionFormat::VERSION);
+        writer.Put<uint32_t>(static_cast<uint32_t>(SessionFormat::PAGE_SIZE));
+        if (!m_file)
+        {
+            std::cerr << "Failed to write session file: " << filename << std::endl;
+            m_file.close();
+            return false;
+        }
+
+        m_filename = filename;
+        m_blobIndex.clear();
+        m_stats = RecordingStats();
+        m_startTime = std::chrono::steady_clock::now();
+        m_recording = true;
+    }
+
+    // Replays start from the process list, so capture it even if nobody asks for it
+    GetProcessList();
+
+    std::cout << "Recording DMA session to " << filename << std::endl;
+    return true;
+}
+
+void RecordingBackend::Stop()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    if (!m_recording)
+    {
+        return;
+    }
+
+    m_recording = false;
+    m_file.close();
+    m_blobIndex.clear();
+    if (m_file.fail())
+    {
+        std::cerr << "Failed to finish session file: " << m_filename << std::endl;
+    }
+
+    std::cout << "DMA session recording stopped (" << m_stats.calls << " calls, "
+              << m_stats.bytesReturned << " bytes returned, " << m_stats.bytesStored << " bytes stored)" << std::endl;
+}
+
+void RecordingBackend::AddMarker(const std::string& name, uint64_t value)
+{
+    if (!IsRecording())
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!m_recording)
+    {
+        return;
+    }
+
+    SessionFormat::Writer writer(m_file);
+    writer.Put<uint8_t>(static_cast<uint8_t>(RecordType::Marker));
+    writer.Put<uint64_t>(static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - m_startTime).count()));
+    writer.PutString(name);
+    writer.Put<uint64_t>(value);
+    CheckWrite();
+}
+
+RecordingStats RecordingBackend::GetStats() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_stats;
+}
+
+std::string RecordingBackend::GetFilename() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_filename;
+}
+
+std::string RecordingBackend::GetName() const
+{
+    return m_inner->GetName();
+}
+
+std::vector<ProcessInfo> RecordingBackend::GetProcessList()
+{
+    if (!IsRecording())
+    {
+        return m_inner->GetProcessList();
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<ProcessInfo> result = m_inner->GetProcessList();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_recording)
+    {
+        WriteCallHeader(RecordType::ProcessList, start);
+        WriteProcessList(result);
+        CheckWrite();
+    }
+    return result;
+}
+
+std::vector<ProcessInfo> RecordingBackend::GetModuleList(uint32_t processId)
+{
+    if (!IsRecording())
+    {
+        return m_inner->GetModuleList(processId);
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<ProcessInfo> result = m_inner->GetModuleList(processId);
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_recording)
+    {
+        WriteCallHeader(RecordType::ModuleList, start);
+        SessionFormat::Writer(m_file).Put<uint32_t>(processId);
+        WriteProcessList(result);
+        CheckWrite();
+    }
+    return result;
+}
+
+uint64_t RecordingBackend::GetModuleBase(uint32_t processId, const std::string& moduleName)
+{
+    if (!IsRecording())
+    {
+        return m_inner->GetModuleBase(processId, moduleName);
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    uint64_t result = m_inner->GetModuleBase(processId, moduleName);
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_recording)
+    {
+        WriteCallHeader(RecordType::ModuleBase, start);
+        SessionFormat::Writer writer(m_file);
+        writer.Put<uint32_t>(processId);
+        writer.PutString(moduleName);
+        writer.Put<uint64_t>(result);
+        CheckWrite();
+    }
+    return result;
+}
+
+std::vector<MemoryRegion> RecordingBackend::GetMemoryRegions(uint32_t processId)
+{
+    if (!IsRecording())
+    {
+        return m_inner->GetMemoryRegions(processId);
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<MemoryRegion> result = m_inner->GetMemoryRegions(processId);
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_recording)
+    {
+        WriteCallHeader(RecordType::RegionList, start);
+        SessionFormat::Writer writer(m_file);
+        writer.Put<uint32_t>(processId);
+        writer.Put<uint32_t>(static_cast<uint32_t>(result.size()));
+        for (const auto& region : result)
+        {
+            writer.Put<uint64_t>(region.baseAddress);
+            writer.Put<uint64_t>(region.size);
+            writer.Put<uint8_t>((region.writable ? SessionFormat::REGION_WRITABLE : 0) |
+                                (region.executable ? SessionFormat::REGION_EXECUTABLE : 0) |
+                                (region.image ? SessionFormat::REGION_IMAGE : 0));
+        }
+        CheckWrite();
+    }
+    return result;
+}
+
+size_t RecordingBackend::Read(uint32_t processId, uint64_t address, void* buffer, size_t size)
+{
+    if (!IsRecording())
+    {
+        return m_inner->Read(processId, address, buffer, size);
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    size_t bytesRead = m_inner->Read(processId, address, buffer, size);
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_recording)
+    {
+        std::vector<uint32_t> blobs;
+        StoreSegments(address, bytesRead, buffer, blobs);
+
+        WriteCallHeader(RecordType::Read, start);
+        SessionFormat::Writer(m_file).Put<uint32_t>(processId);
+        WriteReadEntry(address, size, bytesRead, blobs);
+        m_stats.bytesReturned += bytesRead;
+        CheckWrite();
+    }
+    return bytesRead;
+}
+
+size_t RecordingBackend::ReadScatter(uint32_t processId, ScatterRead* requests, size_t count)
+{
+    if (!IsRecording())
+    {
+        return m_inner->ReadScatter(processId, requests, count);
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    size_t totalBytesRead = m_inner->ReadScatter(processId, requests, count);
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_recording)
+    {
+        std::vector<std::vector<uint32_t>> blobs(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            StoreSegments(requests[i].address, requests[i].bytesRead, requests[i].buffer, blobs[i]);
+        }
+
+        WriteCallHeader(RecordType::Scatter, start);
+        SessionFormat::Writer writer(m_file);
+        writer.Put<uint32_t>(processId);
+        writer.Put<uint32_t>(static_cast<uint32_t>(count));
+        for (size_t i = 0; i < count; ++i)
+        {
+            WriteReadEntry(requests[i].address, requests[i].size, requests[i].bytesRead, blobs[i]);
+        }
+        m_stats.bytesReturned += totalBytesRead;
+        CheckWrite();
+    }
+    return totalBytesRead;
+}
+
+size_t RecordingBackend::Write(uint32_t processId, uint64_t address, const void* buffer, size_t size)
+{
+    if (!IsRecording())
+    {
+        return m_inner->Write(processId, address, buffer, size);
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    size_t result = m_inner->Write(processId, address, buffer, size);
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_recording)
+    {
+        WriteCallHeader(RecordType::Write, start);
+        SessionFormat::Writer writer(m_file);
+        writer.Put<uint32_t>(processId);
+        writer.Put<uint64_t>(address);
+        writer.Put<uint64_t>(size);
+        writer.Put<uint64_t>(result);
+        CheckWrite();
+    }
+    return result;
+}
+
+void RecordingBackend::WriteCallHeader(RecordType type, std::chrono::steady_clock::time_point start)
+{
+    auto now = std::chrono::steady_clock::now();
+
+    SessionFormat::Writer writer(m_file);
+    writer.Put<uint8_t>(static_cast<uint8_t>(type));
+    writer.Put<uint64_t>(static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(start - m_startTime).count()));
+    writer.Put<uint64_t>(static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(now - start).count()));
+    m_stats.calls++;
+}
+
+void RecordingBackend::WriteProcessList(const std::vector<ProcessInfo>& list)
+{
+    SessionFormat::Writer writer(m_file);
+    writer.Put<uint32_t>(static_cast<uint32_t>(list.size()));
+    for (const auto& entry : list)
+    {
+        writer.Put<uint32_t>(entry.processId);
+        writer.PutString(entry.processName);
+        writer.Put<uint64_t>(entry.baseAddress);
+        writer.Put<uint64_t>(entry.imageSize);
+    }
+}
+
+void RecordingBackend::StoreSegments(uint64_t address, size_t bytesRead, const void* buffer, std::vector<uint32_t>& blobs)
+{
+    const uint8_t* data = static_cast<const uint8_t*>(buffer);
+    size_t offset = 0;
+    while (offset < bytesRead)
+    {
+        uint64_t current = address + offset;
+        uint64_t pageEnd = (current & ~(SessionFormat::PAGE_SIZE - 1)) + SessionFormat::PAGE_SIZE;
+        size_t segment = static_cast<size_t>(std::min<uint64_t>(pageEnd - current, bytesRead - offset));
+
+        blobs.push_back(StoreBlob(data + offset, segment));
+        offset += segment;
+    }
+}
+
+void RecordingBackend::WriteReadEntry(uint64_t address, size_t size, size_t bytesRead, const std::vector<uint32_t>& blobs)
+{
+    SessionFormat::Writer writer(m_file);
+    writer.Put<uint64_t>(address);
+    writer.Put<uint64_t>(size);
+    writer.Put<uint64_t>(bytesRead);
+    writer.Put<uint32_t>(static_cast<uint32_t>(blobs.size()));
+    for (uint32_t blob : blobs)
+    {
+        writer.Put<uint32_t>(blob);
+    }
+}
+
+void RecordingBackend::CheckWrite()
+{
+    if (m_file)
+    {
+        return;
+    }
+
+    // A truncated record would desynchronize the whole replay; keep what was written before it
+    std::cerr << "Failed to write session file, recording stopped: " << m_filename << std::endl;
+    m_recording = false;
+    m_file.close();
+    m_blobIndex.clear();
+}
+
+uint32_t RecordingBackend::StoreBlob(const uint8_t* data, size_t size)
+{
+    // 128-bit content keys: a collision would need ~2^64 distinct pages, so equal keys are taken as equal bytes
+    BlobKey key = HashBlob(data, size);
+    auto it = m_blobIndex.find(key);
+    if (it != m_blobIndex.end())
+    {
+        return it->second;
+    }
+
+    uint32_t index = m_stats.blobs++;
+    m_blobIndex.emplace(key, index);
+
+    SessionFormat::Writer writer(m_file);
+    writer.Put<uint8_t>(static_cast<uint8_t>(RecordType::Blob));
+    writer.Put<uint32_t>(index);
+    writer.Put<uint32_t>(static_cast<uint32_t>(size));
+    writer.PutBytes(data, size);
+    m_stats.bytesStored += size;
+    return index;
+}
@@ -0,0 +1,159 @@
+#pragma once
+
+#include "MemoryBackend.h"
+#include "SessionFormat.h"
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+/**
+ * @struct RecordingStats
+ * @brief Counters of the active (or last) recording
+ */
+struct RecordingStats
+{
+    uint64_t calls = 0;         ///< Backend calls recorded
+    uint64_t bytesReturned = 0; ///< Memory bytes returned to callers
+    uint64_t bytesStored = 0;   ///< Memory bytes written to the file after deduplication
+    uint32_t blobs = 0;         ///< Distinct page contents stored
+};
+
+/**
+ * @class RecordingBackend
+ * @brief Pass-through backend that can log every call into a session file
+ *
+ * DMAManager wraps every backend in one of these. While not recording the
+ * only overhead is an atomic load per call. While recording, each call is
+ * written with its arguments, timing and returned bytes (deduplicated per
+ * page content) so ReplayBackend can reproduce the session.
+ */
+class RecordingBackend : public MemoryBackend
+{
+public:
+    /**
+     * @brief Constructor
+     * @param inner Backend performing the actual device access
+     */
+    explicit RecordingBackend(std::unique_ptr<MemoryBackend> inner);
+
+    /**
+     * @brief Destructor - finishes an active recording
+     */
+    ~RecordingBackend() override;
+
+    /**
+     * @brief Start recording into a file (snapshots the process list first)
+     * @param filename Session file to create
+     * @return true if successful, false otherwise
+     */
+    bool Start(const std::string& filename);
+
+    /**
+     * @brief Stop recording and close the file
+     */
+    void Stop();
+
+    /**
+     * @brief Check if a recording is active
+     * @return true if recording, false otherwise
+     */
+    bool IsRecording() const { return m_recording.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Record a named session event (e.g. the attached PID)
+     * @param name Marker name
+     * @param value Marker value
+     */
+    void AddMarker(const std::string& name, uint64_t value);
+
+    /**
+     * @brief Get counters of the active or last recording
+     * @return Counter snapshot
+     */
+    RecordingStats GetStats() const;
+
+    /**
+     * @brief Get the file name of the active or last recording
+     * @return File name
+     */
+    std::string GetFilename() const;
+
+    std::string GetName() const override;
+    std::vector<ProcessInfo> GetProcessList() override;
+    std::vector<ProcessInfo> GetModuleList(uint32_t processId) override;
+    uint64_t GetModuleBase(uint32_t processId, const std::string& moduleName) override;
+    std::vector<MemoryRegion> GetMemoryRegions(uint32_t processId) override;
+    size_t Read(uint32_t processId, uint64_t address, void* buffer, size_t size) override;
+    size_t ReadScatter(uint32_t processId, ScatterRead* requests, size_t count) override;
+    size_t Write(uint32_t processId, uint64_t address, const void* buffer, size_t size) override;
+
+private:
+    /**
+     * @struct BlobKey
+     * @brief 128-bit hash of a blob's content and length
+     */
+    struct BlobKey
+    {
+        uint64_t low = 0;
+        uint64_t high = 0;
+
+        bool operator==(const BlobKey& other) const { return low == other.low && high == other.high; }
+
+        struct Hasher
+        {
+            size_t operator()(const BlobKey& key) const;
+        };
+    };
+
+    /**
+     * @brief Hash a page segment for deduplication
+     */
+    static BlobKey HashBlob(const uint8_t* data, size_t size);
+
+    /**
+     * @brief Write a call header: type and timing
+     * @param type Record type
+     * @param start Call start time
+     */
+    void WriteCallHeader(SessionFormat::RecordType type, std::chrono::steady_clock::time_point start);
+
+    /**
+     * @brief Write a process/module list body
+     */
+    void WriteProcessList(const std::vector<ProcessInfo>& list);
+
+    /**
+     * @brief Split returned memory at page boundaries and store unseen contents as blobs
+     * @param blobs Receives the blob index of every segment
+     */
+    void StoreSegments(uint64_t address, size_t bytesRead, const void* buffer, std::vector<uint32_t>& blobs);
+
+    /**
+     * @brief Write one read entry referencing previously stored blobs
+     */
+    void WriteReadEntry(uint64_t address, size_t size, size_t bytesRead, const std::vector<uint32_t>& blobs);
+
+    /**
+     * @brief Get the blob index for a page segment, storing it if new
+     */
+    uint32_t StoreBlob(const uint8_t* data, size_t size);
+
+    /**
+     * @brief Stop recording if the last record could not be written (m_mutex held)
+     */
+    void CheckWrite();
+
+private:
+    std::unique_ptr<MemoryBackend> m_inner;     ///< Wrapped backend
+    std::atomic<bool> m_recording;              ///< Whether calls are being recorded
+
+    mutable std::mutex m_mutex;                 ///< Guards the file and the blob table
+    std::ofstream m_file;                       ///< Session file
+    std::string m_filename;                     ///< Session file name
+    std::chrono::steady_clock::time_point m_startTime;  ///< Recording start
+    std::unordered_map<BlobKey, uint32_t, BlobKey::Hasher> m_blobIndex; ///< Content hash -> blob index
+    RecordingStats m_stats;                     ///< Counters
+};
@@ -0,0 +1,401 @@
+#include "ReplayBackend.h"
+#include "SessionFormat.h"
+#include "../Core/StringUtils.h"
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <thread>
+
+using SessionFormat::RecordType;
+
+ReplayBackend::ReplayBackend()
+    : m_timing(ReplayTiming::Collapse)
+{
+}
+
+bool ReplayBackend::Load(const std::string& filename)
+{
+    std::ifstream file(filename, std::ios::binary | std::ios::ate);
+    if (!file.is_open())
+    {
+        std::cerr << "Failed to open session file: " << filename << std::endl;
+        return false;
+    }
+
+    std::vector<uint8_t> data(static_cast<size_t>(file.tellg()));
+    file.seekg(0, std::ios::beg);
+    if (!file.read(reinterpret_cast<char*>(data.data()), static_cast<std::streamsize>(data.size())))
+    {
+        std::cerr << "Failed to read session file: " << filename << std::endl;
+        return false;
+    }
+
+    SessionFormat::Reader reader(data.data(), data.size());
+    const uint8_t* magic = reader.GetBytes(sizeof(SessionFormat::MAGIC));
+    uint32_t version = reader.Get<uint32_t>();
+    uint32_t pageSize = reader.Get<uint32_t>();
+    if (!magic || std::memcmp(magic, SessionFormat::MAGIC, sizeof(SessionFormat::MAGIC)) != 0
+        || version == 0 || version > SessionFormat::VERSION || pageSize != SessionFormat::PAGE_SIZE)
+    {
+        std::cerr << "Not a supported session file: " << filename << std::endl;
+        return false;
+    }
+
+    auto readList = [&reader]()
+    {
+        std::vector<ProcessInfo> entries(reader.Get<uint32_t>());
+        for (auto& entry : entries)
+        {
+            entry.processId = reader.Get<uint32_t>();
+            entry.processName = reader.GetString();
+            entry.baseAddress = reader.Get<uint64_t>();
+            entry.imageSize = reader.Get<uint64_t>();
+        }
+        return entries;
+    };
+
+    auto readEntry = [&reader, this](uint32_t processId, uint64_t durationNs)
+    {
+        uint64_t address = reader.Get<uint64_t>();
+        uint64_t size = reader.Get<uint64_t>();
+
+        RecordedRead read;
+        read.durationNs = durationNs;
+        read.bytesRead = reader.Get<uint64_t>();
+        read.blobs.resize(reader.Get<uint32_t>());
+        for (auto& blob : read.blobs)
+        {
+            blob = reader.Get<uint32_t>();
+        }
+
+        m_reads[ReadKey(processId, address, size)].items.push_back(std::move(read));
+    };
+
+    size_t records = 0;
+    while (!reader.AtEnd() && !reader.Failed())
+    {
+        RecordType type = static_cast<RecordType>(reader.Get<uint8_t>());
+
+        if (type == RecordType::Blob)
+        {
+            uint32_t index = reader.Get<uint32_t>();
+            uint32_t size = reader.Get<uint32_t>();
+            const uint8_t* bytes = reader.GetBytes(size);
+            if (!bytes)
+                break;
+            if (index >= m_blobs.size())
+                m_blobs.resize(index + 1);
+            m_blobs[index].assign(bytes, bytes + size);
+            continue;
+        }
+
+        if (type == RecordType::Marker)
+        {
+            SessionMarker marker;
+            marker.timeNs = reader.Get<uint64_t>();
+            marker.name = reader.GetString();
+            marker.value = reader.Get<uint64_t>();
+            m_markers.push_back(marker);
+            continue;
+        }
+
+        reader.Get<uint64_t>(); // Start time (not needed for argument-matched replay)
+        uint64_t durationNs = reader.Get<uint64_t>();
+        records++;
+
+        switch (type)
+        {
+        case RecordType::ProcessList:
+            m_processLists.items.push_back({ durationNs, readList() });
+            break;
+
+        case RecordType::ModuleList:
+        {
+            uint32_t processId = reader.Get<uint32_t>();
+            m_moduleLists[processId].items.push_back({ durationNs, readList() });
+            break;
+        }
+
+        case RecordType::RegionList:
+        {
+            uint32_t processId = reader.Get<uint32_t>();
+            RecordedRegions recorded{ durationNs, {} };
+            recorded.regions.resize(reader.Get<uint32_t>());
+            for (auto& region : recorded.regions)
+            {
+                region.baseAddress = reader.Get<uint64_t>();
+                region.size = reader.Get<uint64_t>();
+                uint8_t flags = reader.Get<uint8_t>();
+                region.writable = (flags & SessionFormat::REGION_WRITABLE) != 0;
+                region.executable = (flags & SessionFormat::REGION_EXECUTABLE) != 0;
+                region.image = (flags & SessionFormat::REGION_IMAGE) != 0;
+            }
+            m_regionLists[processId].items.push_back(std::move(recorded));
+            break;
+        }
+
+        case RecordType::ModuleBase:
+        {
+            uint32_t processId = reader.Get<uint32_t>();
+            std::string name = ToLower(reader.GetString());
+            uint64_t result = reader.Get<uint64_t>();
+            m_moduleBases[{ processId, name }].items.push_back({ durationNs, result });
+            break;
+        }
+
+        case RecordType::Read:
+        {
+            uint32_t processId = reader.Get<uint32_t>();
+            readEntry(processId, durationNs);
+            break;
+        }
+
+        case RecordType::Scatter:
+        {
+            uint32_t processId = reader.Get<uint32_t>();
+            uint32_t count = reader.Get<uint32_t>();
+            for (uint32_t i = 0; i < count && !reader.Failed(); ++i)
+            {
+                readEntry(processId, i == 0 ? durationNs : 0);
+            }
+            break;
+        }
+
+        case RecordType::Write:
+        {
+            uint32_t processId = reader.Get<uint32_t>();
+            uint64_t address = reader.Get<uint64_t>();
+            uint64_t size = reader.Get<uint64_t>();
+            uint64_t result = reader.Get<uint64_t>();
+            m_writes[ReadKey(processId, address, size)].items.push_back({ durationNs, result });
+            break;
+        }
+
+        default:
+            std::cerr << "Unknown record type " << static_cast<int>(type) << " in " << filename << std::endl;
+            return false;
+        }
+    }
+
+    if (reader.Failed())
+    {
+        // A recording cut short (e.g. crash) is still usable up to the last complete record
+        std::cerr << "Session file truncated, replaying the complete part only: " << filename << std::endl;
+    }
+
+    m_filename = filename;
+    std::cout << "Loaded DMA session " << filename << ": " << records << " calls, "
+              << m_blobs.size() << " distinct pages" << std::endl;
+    return true;
+}
+
+uint64_t ReplayBackend::GetLastMarker(const std::string& name, uint64_t fallback) const
+{
+    for (auto it = m_markers.rbegin(); it != m_markers.rend(); ++it)
+    {
+        if (it->name == name)
+        {
+            return it->value;
+        }
+    }
+    return fallback;
+}
+
+ReplayStats ReplayBackend::GetStats() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_stats;
+}
+
+std::string ReplayBackend::GetName() const
+{
+    return "replay";
+}
+
+std::vector<ProcessInfo> ReplayBackend::GetProcessList()
+{
+    std::vector<ProcessInfo> result;
+    uint64_t durationNs = 0;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        const RecordedList* list = m_processLists.Take();
+        if (!list)
+        {
+            m_stats.misses++;
+            return result;
+        }
+        result = list->entries;
+        durationNs = list->durationNs;
+    }
+
+    Serve(durationNs);
+    return result;
+}
+
+std::vector<ProcessInfo> ReplayBackend::GetModuleList(uint32_t processId)
+{
+    std::vector<ProcessInfo> result;
+    uint64_t durationNs = 0;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_moduleLists.find(processId);
+        const RecordedList* list = it != m_moduleLists.end() ? it->second.Take() : nullptr;
+        if (!list)
+        {
+            m_stats.misses++;
+            return result;
+        }
+        result = list->entries;
+        durationNs = list->durationNs;
+    }
+
+    Serve(durationNs);
+    return result;
+}
+
+std::vector<MemoryRegion> ReplayBackend::GetMemoryRegions(uint32_t processId)
+{
+    std::vector<MemoryRegion> result;
+    uint64_t durationNs = 0;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_regionLists.find(processId);
+        const RecordedRegions* recorded = it != m_regionLists.end() ? it->second.Take() : nullptr;
+        if (!recorded)
+        {
+            m_stats.misses++;
+            return result;
+        }
+        result = recorded->regions;
+        durationNs = recorded->durationNs;
+    }
+
+    Serve(durationNs);
+    return result;
+}
+
+uint64_t ReplayBackend::GetModuleBase(uint32_t processId, const std::string& moduleName)
+{
+    uint64_t result = 0;
+    uint64_t durationNs = 0;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_moduleBases.find({ processId, ToLower(moduleName) });
+        const RecordedValue* value = it != m_moduleBases.end() ? it->second.Take() : nullptr;
+        if (!value)
+        {
+            m_stats.misses++;
+            return 0;
+        }
+        result = value->value;
+        durationNs = value->durationNs;
+    }
+
+    Serve(durationNs);
+    return result;
+}
+
+size_t ReplayBackend::Read(uint32_t processId, uint64_t address, void* buffer, size_t size)
+{
+    const RecordedRead* read = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_reads.find(ReadKey(processId, address, size));
+        read = it != m_reads.end() ? it->second.Take() : nullptr;
+        if (!read)
+        {
+            m_stats.misses++;
+            return 0;
+        }
+    }
+
+    // Recorded entries are never modified after Load, so copying outside the lock is safe
+    size_t bytesRead = CopyRead(*read, buffer, size);
+    Serve(read->durationNs);
+    return bytesRead;
+}
+
+size_t ReplayBackend::ReadScatter(uint32_t processId, ScatterRead* requests, size_t count)
+{
+    std::vector<const RecordedRead*> reads(count, nullptr);
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (size_t i = 0; i < count; ++i)
+        {
+            auto it = m_reads.find(ReadKey(processId, requests[i].address, requests[i].size));
+            reads[i] = it != m_reads.end() ? it->second.Take() : nullptr;
+            if (!reads[i])
+            {
+                m_stats.misses++;
+            }
+        }
+    }
+
+    size_t totalBytesRead = 0;
+    uint64_t durationNs = 0;
+    for (size_t i = 0; i < count; ++i)
+    {
+        requests[i].bytesRead = reads[i] ? CopyRead(*reads[i], requests[i].buffer, requests[i].size) : 0;
+        totalBytesRead += requests[i].bytesRead;
+        durationNs += reads[i] ? reads[i]->durationNs : 0;
+    }
+
+    Serve(durationNs);
+    return totalBytesRead;
+}
+
+size_t ReplayBackend::Write(uint32_t processId, uint64_t address, const void*, size_t size)
+{
+    uint64_t result = 0;
+    uint64_t durationNs = 0;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_writes.find(ReadKey(processId, address, size));
+        const RecordedValue* value = it != m_writes.end() ? it->second.Take() : nullptr;
+        if (!value)
+        {
+            m_stats.misses++;
+            return 0;
+        }
+        result = value->value;
+        durationNs = value->durationNs;
+    }
+
+    // Writes are never forwarded anywhere; only the recorded result is reproduced
+    Serve(durationNs);
+    return static_cast<size_t>(result);
+}
+
+void ReplayBackend::Serve(uint64_t durationNs)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stats.served++;
+        m_stats.replayedNanos += durationNs;
+    }
+
+    if (m_timing == ReplayTiming::Preserve && durationNs > 0)
+    {
+        std::this_thread::sleep_for(std::chrono::nanoseconds(durationNs));
+    }
+}
+
+size_t ReplayBackend::CopyRead(const RecordedRead& read, void* buffer, size_t size) const
+{
+    uint8_t* out = static_cast<uint8_t*>(buffer);
+    size_t copied = 0;
+
+    for (uint32_t blob : read.blobs)
+    {
+        if (blob >= m_blobs.size())
+            break;
+
+        const std::vector<uint8_t>& bytes = m_blobs[blob];
+        size_t chunk = std::min(bytes.size(), size - copied);
+        std::memcpy(out + copied, bytes.data(), chunk);
+        copied += chunk;
+    }
+
+    return std::min<size_t>(copied, static_cast<size_t>(read.bytesRead));
+}
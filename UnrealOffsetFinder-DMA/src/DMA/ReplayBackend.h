@@ -0,0 +1,190 @@
+#pragma once
+
+#include "MemoryBackend.h"
+#include <algorithm>
+#include <map>
+#include <mutex>
+#include <tuple>
+
+/**
+ * @enum ReplayTiming
+ * @brief How recorded call durations are reproduced
+ */
+enum class ReplayTiming
+{
+    Collapse,   ///< Return immediately
+    Preserve    ///< Sleep for the recorded duration of every call
+};
+
+/**
+ * @struct SessionMarker
+ * @brief Named event recorded during a session
+ */
+struct SessionMarker
+{
+    uint64_t timeNs;    ///< Time since recording start
+    std::string name;   ///< Marker name
+    uint64_t value;     ///< Marker value
+};
+
+/**
+ * @struct ReplayStats
+ * @brief Counters collected while replaying
+ */
+struct ReplayStats
+{
+    uint64_t served = 0;        ///< Calls answered from the recording
+    uint64_t misses = 0;        ///< Calls with no matching recorded call
+    uint64_t replayedNanos = 0; ///< Sum of recorded durations of served calls
+};
+
+/**
+ * @class ReplayBackend
+ * @brief Memory backend answering calls from a recorded DMA session
+ *
+ * Calls are matched by their arguments, not by global order, so scans that
+ * issue the same reads from several threads still replay bit-exactly. A
+ * call repeated more often than recorded keeps returning its last result.
+ */
+class ReplayBackend : public MemoryBackend
+{
+public:
+    /**
+     * @brief Constructor
+     */
+    ReplayBackend();
+
+    /**
+     * @brief Load a session file written by RecordingBackend
+     * @param filename Session file
+     * @return true if successful, false otherwise
+     */
+    bool Load(const std::string& filename);
+
+    /**
+     * @brief Set how recorded durations are reproduced
+     * @param timing Timing mode
+     */
+    void SetTiming(ReplayTiming timing) { m_timing = timing; }
+
+    /**
+     * @brief Get markers recorded in the session
+     * @return Markers in recording order
+     */
+    const std::vector<SessionMarker>& GetMarkers() const { return m_markers; }
+
+    /**
+     * @brief Get the value of the last marker with the given name
+     * @param name Marker name
+     * @param fallback Value returned when the marker was never recorded
+     * @return Marker value
+     */
+    uint64_t GetLastMarker(const std::string& name, uint64_t fallback = 0) const;
+
+    /**
+     * @brief Get replay counters
+     * @return Counter snapshot
+     */
+    ReplayStats GetStats() const;
+
+    std::string GetName() const override;
+    std::vector<ProcessInfo> GetProcessList() override;
+    std::vector<ProcessInfo> GetModuleList(uint32_t processId) override;
+    uint64_t GetModuleBase(uint32_t processId, const std::string& moduleName) override;
+    std::vector<MemoryRegion> GetMemoryRegions(uint32_t processId) override;
+    size_t Read(uint32_t processId, uint64_t address, void* buffer, size_t size) override;
+    size_t ReadScatter(uint32_t processId, ScatterRead* requests, size_t count) override;
+    size_t Write(uint32_t processId, uint64_t address, const void* buffer, size_t size) override;
+
+private:
+    /**
+     * @struct ReplayQueue
+     * @brief Recorded results of one call signature in recording order
+     */
+    template<typename T>
+    struct ReplayQueue
+    {
+        std::vector<T> items;   ///< Recorded results
+        size_t next = 0;        ///< Next result to hand out
+
+        const T* Take()
+        {
+            if (items.empty())
+                return nullptr;
+            const T* item = &items[std::min(next, items.size() - 1)];
+            if (next < items.size())
+                next++;
+            return item;
+        }
+    };
+
+    /**
+     * @struct RecordedList
+     * @brief Recorded process or module list
+     */
+    struct RecordedList
+    {
+        uint64_t durationNs;
+        std::vector<ProcessInfo> entries;
+    };
+
+    /**
+     * @struct RecordedRegions
+     * @brief Recorded memory region list
+     */
+    struct RecordedRegions
+    {
+        uint64_t durationNs;
+        std::vector<MemoryRegion> regions;
+    };
+
+    /**
+     * @struct RecordedValue
+     * @brief Recorded scalar result (module base, write result)
+     */
+    struct RecordedValue
+    {
+        uint64_t durationNs;
+        uint64_t value;
+    };
+
+    /**
+     * @struct RecordedRead
+     * @brief Recorded read result
+     */
+    struct RecordedRead
+    {
+        uint64_t durationNs;            ///< Call duration (whole batch on the first scatter entry)
+        uint64_t bytesRead;             ///< Bytes returned
+        std::vector<uint32_t> blobs;    ///< Page segments making up the returned bytes
+    };
+
+    using ReadKey = std::tuple<uint32_t, uint64_t, uint64_t>;   ///< PID, address, size
+
+    /**
+     * @brief Account a served call and wait if timing is preserved
+     */
+    void Serve(uint64_t durationNs);
+
+    /**
+     * @brief Copy a recorded read into the caller's buffer
+     * @return Bytes returned
+     */
+    size_t CopyRead(const RecordedRead& read, void* buffer, size_t size) const;
+
+private:
+    mutable std::mutex m_mutex;                                         ///< Guards queue positions and stats
+    ReplayTiming m_timing;                                              ///< Timing mode
+    std::string m_filename;                                             ///< Loaded session file
+
+    std::vector<std::vector<uint8_t>> m_blobs;                          ///< Page contents by index
+    ReplayQueue<RecordedList> m_processLists;                           ///< GetProcessList results
+    std::map<uint32_t, ReplayQueue<RecordedList>> m_moduleLists;        ///< GetModuleList results by PID
+    std::map<uint32_t, ReplayQueue<RecordedRegions>> m_regionLists;     ///< GetMemoryRegions results by PID
+    std::map<std::pair<uint32_t, std::string>, ReplayQueue<RecordedValue>> m_moduleBases;  ///< By PID and lower-case name
+    std::map<ReadKey, ReplayQueue<RecordedRead>> m_reads;               ///< Read and scatter entries
+    std::map<ReadKey, ReplayQueue<RecordedValue>> m_writes;             ///< Write results
+    std::vector<SessionMarker> m_markers;                               ///< Session markers
+
+    ReplayStats m_stats;                                                ///< Counters
+};
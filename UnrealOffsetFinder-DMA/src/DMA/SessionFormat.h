@@ -0,0 +1,132 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <ostream>
+#include <string>
+#include <vector>
+
+/*
+ * Binary layout of recorded DMA sessions (.uofrec).
+ *
+ * File: MAGIC, VERSION, PAGE_SIZE, then a flat sequence of records, each
+ * starting with a RecordType byte. Returned memory is split at page
+ * boundaries and stored once per distinct content as a Blob record; call
+ * records reference blobs by index. All integers are little-endian.
+ */
+namespace SessionFormat
+{
+    constexpr char MAGIC[8] = { 'U', 'O', 'F', 'R', 'E', 'C', '\0', '\0' };
+    constexpr uint32_t VERSION = 2;            ///< 2 added RegionList; version 1 files still load
+    constexpr uint64_t PAGE_SIZE = 0x1000;
+
+    /**
+     * @enum RecordType
+     * @brief Tag of a record in the session file
+     */
+    enum class RecordType : uint8_t
+    {
+        Blob = 1,       ///< u32 index, u32 size, bytes
+        ProcessList,    ///< timing, u32 count, processes
+        ModuleList,     ///< timing, u32 pid, u32 count, modules
+        ModuleBase,     ///< timing, u32 pid, string name, u64 result
+        Read,           ///< timing, u32 pid, read entry
+        Scatter,        ///< timing, u32 pid, u32 count, read entries
+        Write,          ///< timing, u32 pid, u64 address, u64 size, u64 result
+        Marker,         ///< u64 time, string name, u64 value
+        RegionList      ///< timing, u32 pid, u32 count, regions (u64 base, u64 size, u8 flags)
+    };
+
+    /// MemoryRegion flag bits of a RegionList entry
+    constexpr uint8_t REGION_WRITABLE = 0x01;
+    constexpr uint8_t REGION_EXECUTABLE = 0x02;
+    constexpr uint8_t REGION_IMAGE = 0x04;
+
+    /**
+     * @class Writer
+     * @brief Little helper for appending primitive values to a stream
+     */
+    class Writer
+    {
+    public:
+        explicit Writer(std::ostream& stream) : m_stream(stream) {}
+
+        template<typename T>
+        void Put(T value)
+        {
+            m_stream.write(reinterpret_cast<const char*>(&value), sizeof(T));
+        }
+
+        void PutString(const std::string& value)
+        {
+            Put<uint16_t>(static_cast<uint16_t>(value.size()));
+            m_stream.write(value.data(), static_cast<std::streamsize>(static_cast<uint16_t>(value.size())));
+        }
+
+        void PutBytes(const void* data, size_t size)
+        {
+            m_stream.write(static_cast<const char*>(data), static_cast<std::streamsize>(size));
+        }
+
+    private:
+        std::ostream& m_stream;
+    };
+
+    /**
+     * @class Reader
+     * @brief Bounds-checked cursor over a loaded session file
+     */
+    class Reader
+    {
+    public:
+        Reader(const uint8_t* data, size_t size) : m_data(data), m_size(size), m_position(0), m_failed(false) {}
+
+        template<typename T>
+        T Get()
+        {
+            T value{};
+            if (m_position + sizeof(T) > m_size)
+            {
+                m_failed = true;
+                return value;
+            }
+            std::memcpy(&value, m_data + m_position, sizeof(T));
+            m_position += sizeof(T);
+            return value;
+        }
+
+        std::string GetString()
+        {
+            uint16_t length = Get<uint16_t>();
+            if (m_failed || m_position + length > m_size)
+            {
+                m_failed = true;
+                return "";
+            }
+            std::string value(reinterpret_cast<const char*>(m_data + m_position), length);
+            m_position += length;
+            return value;
+        }
+
+        const uint8_t* GetBytes(size_t size)
+        {
+            if (m_position + size > m_size)
+            {
+                m_failed = true;
+                return nullptr;
+            }
+            const uint8_t* bytes = m_data + m_position;
+            m_position += size;
+            return bytes;
+        }
+
+        bool AtEnd() const { return m_position >= m_size; }
+        bool Failed() const { return m_failed; }
+
+    private:
+        const uint8_t* m_data;
+        size_t m_size;
+        size_t m_position;
+        bool m_failed;
+    };
+}
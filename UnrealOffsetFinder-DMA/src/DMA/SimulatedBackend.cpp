@@ -0,0 +1,296 @@
+#include "SimulatedBackend.h"
+#include "../Core/StringUtils.h"
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <thread>
+
+SimulatedBackend::SimulatedBackend()
+    : m_nextProcessId(1000)
+    , m_roundTrips(0)
+    , m_scatterEntries(0)
+    , m_bytesRead(0)
+    , m_simulatedNanos(0)
+{
+}
+
+uint32_t SimulatedBackend::AddProcess(const std::string& processName, uint32_t processId)
+{
+    std::unique_lock<std::shared_mutex> lock(m_mutex);
+
+    if (processId == 0)
+    {
+        processId = m_nextProcessId;
+    }
+    m_nextProcessId = std::max(m_nextProcessId, processId + 4);
+
+    m_processes[processId].name = processName;
+    return processId;
+}
+
+void SimulatedBackend::AddModule(uint32_t processId, const std::string& moduleName, uint64_t baseAddress, std::vector<uint8_t> image)
+{
+    std::unique_lock<std::shared_mutex> lock(m_mutex);
+
+    SimulatedProcess& process = m_processes[processId];
+    process.modules.emplace_back(0, moduleName, baseAddress, image.size());
+    process.regions[baseAddress] = std::move(image);
+}
+
+void SimulatedBackend::AddRegion(uint32_t processId, uint64_t baseAddress, std::vector<uint8_t> data)
+{
+    std::unique_lock<std::shared_mutex> lock(m_mutex);
+    m_processes[processId].regions[baseAddress] = std::move(data);
+}
+
+bool SimulatedBackend::LoadModuleDump(uint32_t processId, const std::string& moduleName, uint64_t baseAddress, const std::string& filename)
+{
+    std::ifstream file(filename, std::ios::binary | std::ios::ate);
+    if (!file.is_open())
+    {
+        std::cerr << "Failed to open module dump: " << filename << std::endl;
+        return false;
+    }
+
+    std::streamsize fileSize = file.tellg();
+    file.seekg(0, std::ios::beg);
+
+    std::vector<uint8_t> image(static_cast<size_t>(fileSize));
+    if (!file.read(reinterpret_cast<char*>(image.data()), fileSize))
+    {
+        std::cerr << "Failed to read module dump: " << filename << std::endl;
+        return false;
+    }
+
+    AddModule(processId, moduleName, baseAddress, std::move(image));
+    return true;
+}
+
+void SimulatedBackend::SetLinkModel(const LinkModel& model)
+{
+    std::unique_lock<std::shared_mutex> lock(m_mutex);
+    m_linkModel = model;
+}
+
+BackendStats SimulatedBackend::GetStats() const
+{
+    BackendStats stats;
+    stats.roundTrips = m_roundTrips;
+    stats.scatterEntries = m_scatterEntries;
+    stats.bytesRead = m_bytesRead;
+    stats.simulatedNanos = m_simulatedNanos;
+    return stats;
+}
+
+void SimulatedBackend::ResetStats()
+{
+    m_roundTrips = 0;
+    m_scatterEntries = 0;
+    m_bytesRead = 0;
+    m_simulatedNanos = 0;
+}
+
+std::string SimulatedBackend::GetName() const
+{
+    return "simulated";
+}
+
+std::vector<ProcessInfo> SimulatedBackend::GetProcessList()
+{
+    std::shared_lock<std::shared_mutex> lock(m_mutex);
+
+    std::vector<ProcessInfo> processList;
+    for (const auto& [processId, process] : m_processes)
+    {
+        uint64_t base = 0x140000000;
+        uint64_t size = 0x1000000;
+        for (const auto& module : process.modules)
+        {
+            if (EqualsIgnoreCase(module.processName, process.name))
+            {
+                base = module.baseAddress;
+                size = module.imageSize;
+                break;
+            }
+        }
+
+        processList.emplace_back(processId, process.name, base, size);
+    }
+
+    return processList;
+}
+
+std::vector<ProcessInfo> SimulatedBackend::GetModuleList(uint32_t processId)
+{
+    std::shared_lock<std::shared_mutex> lock(m_mutex);
+
+    auto it = m_processes.find(processId);
+    if (it == m_processes.end())
+    {
+        return {};
+    }
+
+    return it->second.modules;
+}
+
+uint64_t SimulatedBackend::GetModuleBase(uint32_t processId, const std::string& moduleName)
+{
+    std::shared_lock<std::shared_mutex> lock(m_mutex);
+
+    auto it = m_processes.find(processId);
+    if (it == m_processes.end())
+    {
+        return 0;
+    }
+
+    for (const auto& module : it->second.modules)
+    {
+        if (EqualsIgnoreCase(module.processName, moduleName))
+        {
+            return module.baseAddress;
+        }
+    }
+
+    return 0;
+}
+
+std::vector<MemoryRegion> SimulatedBackend::GetMemoryRegions(uint32_t processId)
+{
+    std::shared_lock<std::shared_mutex> lock(m_mutex);
+
+    std::vector<MemoryRegion> regions;
+    auto it = m_processes.find(processId);
+    if (it == m_processes.end())
+    {
+        return regions;
+    }
+
+    // Every simulated region is readable and writable; module images are also executable
+    for (const auto& [baseAddress, data] : it->second.regions)
+    {
+        bool image = std::any_of(it->second.modules.begin(), it->second.modules.end(),
+            [baseAddress = baseAddress](const ProcessInfo& module) { return module.baseAddress == baseAddress; });
+        regions.emplace_back(baseAddress, data.size(), true, image, image);
+    }
+
+    return regions;
+}
+
+size_t SimulatedBackend::Read(uint32_t processId, uint64_t address, void* buffer, size_t size)
+{
+    size_t bytesRead = 0;
+    {
+        std::shared_lock<std::shared_mutex> lock(m_mutex);
+
+        auto it = m_processes.find(processId);
+        if (it != m_processes.end())
+        {
+            bytesRead = ReadUnaccounted(it->second, address, buffer, size);
+        }
+    }
+
+    m_bytesRead += bytesRead;
+    AccountRoundTrip(bytesRead);
+    return bytesRead;
+}
+
+size_t SimulatedBackend::ReadScatter(uint32_t processId, ScatterRead* requests, size_t count)
+{
+    size_t totalBytesRead = 0;
+    {
+        std::shared_lock<std::shared_mutex> lock(m_mutex);
+
+        auto it = m_processes.find(processId);
+        for (size_t i = 0; i < count; ++i)
+        {
+            requests[i].bytesRead = it != m_processes.end()
+                ? ReadUnaccounted(it->second, requests[i].address, requests[i].buffer, requests[i].size)
+                : 0;
+            totalBytesRead += requests[i].bytesRead;
+        }
+    }
+
+    m_scatterEntries += count;
+    m_bytesRead += totalBytesRead;
+    AccountRoundTrip(totalBytesRead);
+    return totalBytesRead;
+}
+
+size_t SimulatedBackend::Write(uint32_t processId, uint64_t address, const void* buffer, size_t size)
+{
+    std::unique_lock<std::shared_mutex> lock(m_mutex);
+
+    auto processIt = m_processes.find(processId);
+    if (processIt == m_processes.end())
+    {
+        return 0;
+    }
+
+    auto& regions = processIt->second.regions;
+    auto it = regions.upper_bound(address);
+    if (it == regions.begin())
+    {
+        return 0;
+    }
+    --it;
+
+    uint64_t offset = address - it->first;
+    if (offset >= it->second.size())
+    {
+        return 0;
+    }
+
+    size_t bytesToWrite = std::min<size_t>(size, it->second.size() - offset);
+    std::memcpy(it->second.data() + offset, buffer, bytesToWrite);
+    return bytesToWrite;
+}
+
+size_t SimulatedBackend::ReadUnaccounted(const SimulatedProcess& process, uint64_t address, void* buffer, size_t size) const
+{
+    uint8_t* out = static_cast<uint8_t*>(buffer);
+    size_t copied = 0;
+
+    // Copy from consecutive regions until the range is satisfied or a gap is hit
+    while (copied < size)
+    {
+        uint64_t current = address + copied;
+        auto it = process.regions.upper_bound(current);
+        if (it == process.regions.begin())
+        {
+            break;
+        }
+        --it;
+
+        uint64_t offset = current - it->first;
+        if (offset >= it->second.size())
+        {
+            break;
+        }
+
+        size_t chunk = std::min<size_t>(size - copied, it->second.size() - offset);
+        std::memcpy(out + copied, it->second.data() + offset, chunk);
+        copied += chunk;
+    }
+
+    return copied;
+}
+
+void SimulatedBackend::AccountRoundTrip(size_t bytes)
+{
+    double nanos = m_linkModel.roundTripMicros * 1000.0;
+    if (m_linkModel.bytesPerSecond > 0.0)
+    {
+        nanos += static_cast<double>(bytes) * 1e9 / m_linkModel.bytesPerSecond;
+    }
+
+    m_roundTrips++;
+    m_simulatedNanos += static_cast<uint64_t>(nanos);
+
+    if (m_linkModel.realTime && nanos > 0.0)
+    {
+        std::this_thread::sleep_for(std::chrono::nanoseconds(static_cast<int64_t>(nanos)));
+    }
+}
@@ -0,0 +1,143 @@
+#pragma once
+
+#include "MemoryBackend.h"
+#include <map>
+#include <memory>
+#include <atomic>
+#include <shared_mutex>
+
+/**
+ * @struct LinkModel
+ * @brief Cost model of a simulated DMA link
+ */
+struct LinkModel
+{
+    double roundTripMicros = 0.0;   ///< Fixed cost per device round trip (single read or scatter batch)
+    double bytesPerSecond = 0.0;    ///< Link throughput, 0 for unlimited
+    bool realTime = false;          ///< Actually wait for the simulated time instead of only accounting it
+};
+
+/**
+ * @struct BackendStats
+ * @brief Counters collected by the simulated backend
+ */
+struct BackendStats
+{
+    uint64_t roundTrips = 0;        ///< Device round trips (reads + scatter batches)
+    uint64_t scatterEntries = 0;    ///< Entries submitted through ReadScatter
+    uint64_t bytesRead = 0;         ///< Bytes returned to callers
+    uint64_t simulatedNanos = 0;    ///< Link time according to the LinkModel
+};
+
+/**
+ * @class SimulatedBackend
+ * @brief Memory backend serving processes and modules from in-memory images
+ *
+ * Used for benchmarks and headless runs without a DMA device. Set up all
+ * processes, modules and regions before handing the backend to DMAManager;
+ * reads are thread-safe, setup calls are not meant to race with reads.
+ */
+class SimulatedBackend : public MemoryBackend
+{
+public:
+    /**
+     * @brief Constructor
+     */
+    SimulatedBackend();
+
+    /**
+     * @brief Add a simulated process
+     * @param processName Process executable name
+     * @param processId Requested PID, 0 to assign one automatically
+     * @return PID of the new process
+     */
+    uint32_t AddProcess(const std::string& processName, uint32_t processId = 0);
+
+    /**
+     * @brief Add a module image to a process (the image is also mapped as memory)
+     * @param processId Target process ID
+     * @param moduleName Module name
+     * @param baseAddress Module base address
+     * @param image Module bytes as laid out in memory
+     */
+    void AddModule(uint32_t processId, const std::string& moduleName, uint64_t baseAddress, std::vector<uint8_t> image);
+
+    /**
+     * @brief Map a readable memory region into a process
+     * @param processId Target process ID
+     * @param baseAddress Region start address
+     * @param data Region contents
+     */
+    void AddRegion(uint32_t processId, uint64_t baseAddress, std::vector<uint8_t> data);
+
+    /**
+     * @brief Load a raw memory dump of a module from disk
+     * @param processId Target process ID
+     * @param moduleName Module name
+     * @param baseAddress Module base address
+     * @param filename Dump file (module bytes as laid out in memory)
+     * @return true if successful, false otherwise
+     */
+    bool LoadModuleDump(uint32_t processId, const std::string& moduleName, uint64_t baseAddress, const std::string& filename);
+
+    /**
+     * @brief Set the link cost model
+     * @param model Link model
+     */
+    void SetLinkModel(const LinkModel& model);
+
+    /**
+     * @brief Get collected counters
+     * @return Counter snapshot
+     */
+    BackendStats GetStats() const;
+
+    /**
+     * @brief Reset collected counters
+     */
+    void ResetStats();
+
+    std::string GetName() const override;
+    std::vector<ProcessInfo> GetProcessList() override;
+    std::vector<ProcessInfo> GetModuleList(uint32_t processId) override;
+    uint64_t GetModuleBase(uint32_t processId, const std::string& moduleName) override;
+    std::vector<MemoryRegion> GetMemoryRegions(uint32_t processId) override;
+    size_t Read(uint32_t processId, uint64_t address, void* buffer, size_t size) override;
+    size_t ReadScatter(uint32_t processId, ScatterRead* requests, size_t count) override;
+    size_t Write(uint32_t processId, uint64_t address, const void* buffer, size_t size) override;
+
+private:
+    /**
+     * @struct SimulatedProcess
+     * @brief Process state: module list and mapped regions
+     */
+    struct SimulatedProcess
+    {
+        std::string name;                                   ///< Process name
+        std::vector<ProcessInfo> modules;                   ///< Loaded modules
+        std::map<uint64_t, std::vector<uint8_t>> regions;   ///< Mapped memory keyed by start address
+    };
+
+    /**
+     * @brief Copy memory out of a process without accounting
+     * @return Number of bytes copied
+     */
+    size_t ReadUnaccounted(const SimulatedProcess& process, uint64_t address, void* buffer, size_t size) const;
+
+    /**
+     * @brief Account one device round trip transferring the given bytes
+     * @param bytes Bytes transferred
+     */
+    void AccountRoundTrip(size_t bytes);
+
+private:
+    mutable std::shared_mutex m_mutex;                  ///< Guards process state
+    std::map<uint32_t, SimulatedProcess> m_processes;   ///< Processes keyed by PID
+    uint32_t m_nextProcessId;                           ///< Next auto-assigned PID
+    LinkModel m_linkModel;                              ///< Link cost model
+
+    std::atomic<uint64_t> m_roundTrips;                 ///< Round trip counter
+    std::atomic<uint64_t> m_scatterEntries;             ///< Scatter entry counter
+    std::atomic<uint64_t> m_bytesRead;                  ///< Byte counter
+    std::atomic<uint64_t> m_simulatedNanos;             ///< Simulated link time
+};
@@ -0,0 +1,361 @@
+#include "VmmBackend.h"
+#include "../Core/Trace.h"
+#include <leechcore.h>
+#include <vmmdll.h>
+#include <iostream>
+#include <fstream>
+#include <vector>
+
+VmmBackend::VmmBackend()
+    : m_hLeechCore(nullptr)
+    , m_hVMM(nullptr)
+{
+}
+
+VmmBackend::~VmmBackend()
+{
+    Close();
+}
+
+bool VmmBackend::Initialize()
+{
+    try
+    {
+        std::cout << "Initializing DMA device..." << std::endl;
+
+        // First try with memory map, then fallback without
+        bool success = false;
+
+        // Try with memory map first
+        if (CheckMemoryMapExists())
+        {
+            std::cout << "Found memory map, attempting initialization with mmap.txt..." << std::endl;
+            success = InitializeWithArgs(true);
+        }
+
+        // Fallback without memory map if first attempt failed
+        if (!success)
+        {
+            std::cout << "Attempting initialization without memory map..." << std::endl;
+            success = InitializeWithArgs(false);
+        }
+
+        if (success)
+        {
+            std::cout << "DMA device initialized successfully!" << std::endl;
+            return true;
+        }
+        else
+        {
+            std::cerr << "Failed to initialize DMA device" << std::endl;
+            return false;
+        }
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << "Exception during device initialization: " << e.what() << std::endl;
+        return false;
+    }
+}
+
+void VmmBackend::Close()
+{
+    if (m_hVMM)
+    {
+        std::cout << "Closing VMM handle..." << std::endl;
+        VMMDLL_Close(static_cast<VMM_HANDLE>(m_hVMM));
+        m_hVMM = nullptr;
+        std::cout << "DMA device cleanup complete" << std::endl;
+    }
+
+    if (m_hLeechCore)
+    {
+        // LeechCore is typically closed automatically when VMM is closed
+        m_hLeechCore = nullptr;
+    }
+}
+
+std::string VmmBackend::GetName() const
+{
+    return "vmmdll";
+}
+
+std::vector<ProcessInfo> VmmBackend::GetProcessList()
+{
+    std::vector<ProcessInfo> processList;
+
+    if (!m_hVMM)
+    {
+        return processList;
+    }
+
+    // Get every process in one call instead of one VMMDLL_ProcessGetInformation per PID
+    PVMMDLL_PROCESS_INFORMATION pProcessInfoAll = NULL;
+    DWORD cProcessInfo = 0;
+
+    if (!VMMDLL_ProcessGetInformationAll(static_cast<VMM_HANDLE>(m_hVMM), &pProcessInfoAll, &cProcessInfo))
+    {
+        std::cerr << "Failed to enumerate processes" << std::endl;
+        return processList;
+    }
+
+    processList.reserve(cProcessInfo);
+    for (DWORD i = 0; i < cProcessInfo; ++i)
+    {
+        const VMMDLL_PROCESS_INFORMATION& processInfo = pProcessInfoAll[i];
+
+        // Calculate approximate size (this is a rough estimate)
+        uint64_t baseSize = 0x1000000; // Default 16MB
+
+        // Add process to list
+        processList.emplace_back(
+            processInfo.dwPID,
+            processInfo.szName,
+            processInfo.win.vaPEB ? processInfo.win.vaPEB : 0x140000000,
+            baseSize
+        );
+    }
+
+    VMMDLL_MemFree(pProcessInfoAll);
+
+    return processList;
+}
+
+std::vector<ProcessInfo> VmmBackend::GetModuleList(uint32_t processId)
+{
+    std::vector<ProcessInfo> moduleList;
+
+    if (!m_hVMM)
+    {
+        return moduleList;
+    }
+
+    PVMMDLL_MAP_MODULE pModuleMap = NULL;
+
+    // Get module map using VMMDLL_Map_GetModuleU
+    if (!VMMDLL_Map_GetModuleU(static_cast<VMM_HANDLE>(m_hVMM), processId, &pModuleMap, VMMDLL_MODULE_FLAG_NORMAL))
+    {
+        return moduleList;
+    }
+
+    if (!pModuleMap || pModuleMap->cMap == 0)
+    {
+        if (pModuleMap)
+        {
+            VMMDLL_MemFree(pModuleMap);
+        }
+        return moduleList;
+    }
+
+    // Convert to ProcessInfo structures
+    for (DWORD i = 0; i < pModuleMap->cMap; ++i)
+    {
+        const auto& moduleEntry = pModuleMap->pMap[i];
+
+        moduleList.emplace_back(
+            0, // No PID for modules
+            std::string(moduleEntry.uszText),
+            moduleEntry.vaBase,
+            moduleEntry.cbImageSize
+        );
+    }
+
+    VMMDLL_MemFree(pModuleMap);
+    return moduleList;
+}
+
+std::vector<MemoryRegion> VmmBackend::GetMemoryRegions(uint32_t processId)
+{
+    std::vector<MemoryRegion> regions;
+
+    if (!m_hVMM)
+    {
+        return regions;
+    }
+
+    PVMMDLL_MAP_VAD pVadMap = NULL;
+    if (!VMMDLL_Map_GetVadU(static_cast<VMM_HANDLE>(m_hVMM), processId, false, &pVadMap))
+    {
+        std::cerr << "Failed to get VAD map for PID " << processId << std::endl;
+        return regions;
+    }
+
+    regions.reserve(pVadMap->cMap);
+    for (DWORD i = 0; i < pVadMap->cMap; ++i)
+    {
+        const auto& vad = pVadMap->pMap[i];
+
+        // Protection holds MM_* values: low 3 bits are the access, 0x10 without 0x08 is a guard page
+        uint32_t access = vad.Protection & 0x07;
+        bool guard = (vad.Protection & 0x18) == 0x10;
+        if (access == 0 || guard)
+        {
+            continue;
+        }
+
+        // Private VADs without commit charge are only reserved
+        if (vad.fPrivateMemory && vad.CommitCharge == 0)
+        {
+            continue;
+        }
+
+        bool writable = access >= 4;
+        bool executable = access == 2 || access == 3 || access == 6 || access == 7;
+        regions.emplace_back(vad.vaStart, vad.vaEnd - vad.vaStart + 1, writable, executable, vad.fImage != 0);
+    }
+
+    VMMDLL_MemFree(pVadMap);
+    return regions;
+}
+
+uint64_t VmmBackend::GetModuleBase(uint32_t processId, const std::string& moduleName)
+{
+    if (!m_hVMM)
+    {
+        return 0;
+    }
+
+    // Use VMMDLL_ProcessGetModuleBaseU for direct module base lookup
+    ULONG64 moduleBase = VMMDLL_ProcessGetModuleBaseU(
+        static_cast<VMM_HANDLE>(m_hVMM),
+        processId,
+        moduleName.c_str()
+    );
+
+    return static_cast<uint64_t>(moduleBase);
+}
+
+size_t VmmBackend::Read(uint32_t processId, uint64_t address, void* buffer, size_t size)
+{
+    if (!m_hVMM)
+    {
+        return 0;
+    }
+
+    DWORD cbRead = 0;
+    BOOL success = VMMDLL_MemReadEx(
+        static_cast<VMM_HANDLE>(m_hVMM),
+        processId,
+        address,
+        static_cast<PBYTE>(buffer),
+        static_cast<DWORD>(size),
+        &cbRead,
+        0  // flags
+    );
+
+    return success ? static_cast<size_t>(cbRead) : 0;
+}
+
+size_t VmmBackend::ReadScatter(uint32_t processId, ScatterRead* requests, size_t count)
+{
+    if (!m_hVMM || count == 0)
+    {
+        return 0;
+    }
+
+    TRACE_SCOPE("ReadScatter", "dma", "count", count);
+
+    VMMDLL_SCATTER_HANDLE hScatter = VMMDLL_Scatter_Initialize(static_cast<VMM_HANDLE>(m_hVMM), processId, 0);
+    if (!hScatter)
+    {
+        // Scatter unavailable, fall back to individual reads
+        return MemoryBackend::ReadScatter(processId, requests, count);
+    }
+
+    std::vector<DWORD> bytesRead(count, 0);
+    for (size_t i = 0; i < count; ++i)
+    {
+        requests[i].bytesRead = 0;
+        VMMDLL_Scatter_PrepareEx(hScatter, requests[i].address, static_cast<DWORD>(requests[i].size),
+            static_cast<PBYTE>(requests[i].buffer), &bytesRead[i]);
+    }
+
+    size_t totalBytesRead = 0;
+    if (VMMDLL_Scatter_ExecuteRead(hScatter))
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            requests[i].bytesRead = bytesRead[i];
+            totalBytesRead += bytesRead[i];
+        }
+    }
+
+    VMMDLL_Scatter_CloseHandle(hScatter);
+    return totalBytesRead;
+}
+
+size_t VmmBackend::Write(uint32_t processId, uint64_t address, const void* buffer, size_t size)
+{
+    if (!m_hVMM)
+    {
+        return 0;
+    }
+
+    BOOL success = VMMDLL_MemWrite(
+        static_cast<VMM_HANDLE>(m_hVMM),
+        processId,
+        address,
+        static_cast<PBYTE>(const_cast<void*>(buffer)),
+        static_cast<DWORD>(size)
+    );
+
+    return success ? size : 0;
+}
+
+bool VmmBackend::CheckMemoryMapExists()
+{
+    std::ifstream file("mmap.txt");
+    return file.good();
+}
+
+bool VmmBackend::InitializeWithArgs(bool useMemoryMap)
+{
+    // Clean up any existing VMM handle
+    if (m_hVMM)
+    {
+        std::cout << "Closing existing VMM handle..." << std::endl;
+        VMMDLL_Close(static_cast<VMM_HANDLE>(m_hVMM));
+        m_hVMM = nullptr;
+    }
+
+    // Build initialization arguments
+    std::vector<LPCSTR> initArgs;
+
+    // Device connection string for FPGA
+    initArgs.push_back("-device");
+    initArgs.push_back("fpga");
+
+    // Essential arguments
+    initArgs.push_back("-waitinitialize");    // Wait for full initialization
+    initArgs.push_back("-norefresh");         // Disable background refreshes
+    initArgs.push_back("-disable-python");   // Disable Python plugin system
+    initArgs.push_back("-disable-symbolserver"); // Disable symbol server
+    initArgs.push_back("-disable-symbols");  // Disable symbol lookups
+    initArgs.push_back("-disable-infodb");   // Disable infodb
+
+    // Add memory map if requested and available
+    if (useMemoryMap && CheckMemoryMapExists())
+    {
+        initArgs.push_back("-memmap");
+        initArgs.push_back("mmap.txt");
+    }
+
+    // Convert to array for VMMDLL_Initialize
+    std::vector<LPCSTR> argsArray(initArgs.begin(), initArgs.end());
+
+    std::cout << "Initializing DMA device with " << argsArray.size() << " arguments..." << std::endl;
+
+    // Initialize VMM
+    VMM_HANDLE hVMM = VMMDLL_Initialize(static_cast<DWORD>(argsArray.size()), argsArray.data());
+
+    if (!hVMM)
+    {
+        std::cerr << "VMMDLL_Initialize failed" << std::endl;
+        return false;
+    }
+
+    m_hVMM = hVMM;
+    std::cout << "VMM initialized successfully" << std::endl;
+
+    return true;
+}
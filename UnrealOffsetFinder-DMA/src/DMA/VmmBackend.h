@@ -0,0 +1,60 @@
+#pragma once
+
+#include "MemoryBackend.h"
+
+/**
+ * @class VmmBackend
+ * @brief Memory backend backed by an FPGA device through LeechCore/VMMDLL
+ */
+class VmmBackend : public MemoryBackend
+{
+public:
+    /**
+     * @brief Constructor
+     */
+    VmmBackend();
+
+    /**
+     * @brief Destructor - closes the VMM handle
+     */
+    ~VmmBackend() override;
+
+    /**
+     * @brief Initialize the DMA device (tries mmap.txt first, then without)
+     * @return true if successful, false otherwise
+     */
+    bool Initialize();
+
+    /**
+     * @brief Cleanup LeechCore/VMM resources
+     */
+    void Close();
+
+    std::string GetName() const override;
+    std::vector<ProcessInfo> GetProcessList() override;
+    std::vector<ProcessInfo> GetModuleList(uint32_t processId) override;
+    uint64_t GetModuleBase(uint32_t processId, const std::string& moduleName) override;
+    std::vector<MemoryRegion> GetMemoryRegions(uint32_t processId) override;
+    size_t Read(uint32_t processId, uint64_t address, void* buffer, size_t size) override;
+    size_t ReadScatter(uint32_t processId, ScatterRead* requests, size_t count) override;
+    size_t Write(uint32_t processId, uint64_t address, const void* buffer, size_t size) override;
+
+private:
+    /**
+     * @brief Check if memory map file exists
+     * @return true if mmap.txt exists, false otherwise
+     */
+    bool CheckMemoryMapExists();
+
+    /**
+     * @brief Initialize VMMDLL with specified arguments
+     * @param useMemoryMap Whether to use memory map
+     * @return true if successful, false otherwise
+     */
+    bool InitializeWithArgs(bool useMemoryMap);
+
+private:
+    // LeechCore handles (using void* to avoid including headers here)
+    void* m_hLeechCore;             ///< LeechCore device handle
+    void* m_hVMM;                   ///< VMM handle
+};
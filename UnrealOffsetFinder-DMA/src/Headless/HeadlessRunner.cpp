@@ -0,0 +1,729 @@
+#include "HeadlessRunner.h"
+#include "../DMA/DMAManager.h"
+#include "../DMA/ReplayBackend.h"
+#include "../DMA/SimulatedBackend.h"
+#include "../Core/JsonWriter.h"
+#include "../Core/PeImage.h"
+#include "../Core/Trace.h"
+#include "../Scan/PatternScanner.h"
+#include "../Scan/SignatureIndex.h"
+#include "../Unreal/LayoutIndexer.h"
+#include "../Unreal/NamePoolDumper.h"
+#include "../Unreal/ObjectEnumerator.h"
+#include "../Unreal/SymbolResolver.h"
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <sstream>
+
+namespace
+{
+    constexpr uint64_t DEFAULT_MODULE_BASE = 0x140000000;   ///< Base used for dumps without PE headers
+    constexpr const char* GLOBAL_GROUPS[] = { "GWorld", "GNames", "GObjects" };
+
+    /**
+     * @class ScopedLogRedirect
+     * @brief Keeps scanner logging off stdout so stdout carries only the JSON document
+     */
+    class ScopedLogRedirect
+    {
+    public:
+        explicit ScopedLogRedirect(bool verbose)
+            : m_format(nullptr)
+            , m_stdout(std::cout.rdbuf(verbose ? std::cerr.rdbuf() : m_sink.rdbuf()))
+        {
+            m_format.copyfmt(std::cout);
+        }
+
+        ~ScopedLogRedirect()
+        {
+            // The scanner leaves hex/fill manipulators behind
+            std::cout.copyfmt(m_format);
+            std::cout.rdbuf(m_stdout);
+        }
+
+    private:
+        std::ostringstream m_sink;
+        std::ios m_format;
+        std::streambuf* m_stdout;
+    };
+
+    /**
+     * @class Stopwatch
+     * @brief Milliseconds since construction or the last Lap
+     */
+    class Stopwatch
+    {
+    public:
+        Stopwatch() : m_start(std::chrono::steady_clock::now()) {}
+
+        double Lap()
+        {
+            auto now = std::chrono::steady_clock::now();
+            double elapsed = std::chrono::duration<double, std::milli>(now - m_start).count();
+            m_start = now;
+            return elapsed;
+        }
+
+    private:
+        std::chrono::steady_clock::time_point m_start;
+    };
+
+    const char* GetSourceName(HeadlessSource source)
+    {
+        switch (source)
+        {
+        case HeadlessSource::Device:  return "device";
+        case HeadlessSource::Session: return "session";
+        case HeadlessSource::PeFile:  return "pe";
+        case HeadlessSource::Dump:    return "dump";
+        }
+        return "unknown";
+    }
+
+    std::string FileName(const std::string& path)
+    {
+        size_t slash = path.find_last_of("/\\");
+        return slash == std::string::npos ? path : path.substr(slash + 1);
+    }
+
+    /**
+     * @brief Parse "name=pattern" (or a bare pattern, which is then its own name)
+     */
+    bool ParseSignature(const std::string& text, HeadlessSignature& signature, std::string& error)
+    {
+        size_t equals = text.find('=');
+        signature.name = equals == std::string::npos ? text : text.substr(0, equals);
+        signature.pattern = equals == std::string::npos ? text : text.substr(equals + 1);
+
+        std::vector<uint8_t> bytes;
+        std::string mask;
+        if (signature.name.empty() || !PatternScanner::ParsePattern(signature.pattern, bytes, mask))
+        {
+            error = "Invalid signature: " + text;
+            return false;
+        }
+        return true;
+    }
+
+    bool LoadSignatureFile(const std::string& filename, std::vector<HeadlessSignature>& signatures, std::string& error)
+    {
+        std::ifstream file(filename);
+        if (!file.is_open())
+        {
+            error = "Failed to open signature file: " + filename;
+            return false;
+        }
+
+        std::string line;
+        while (std::getline(file, line))
+        {
+            size_t first = line.find_first_not_of(" \t\r");
+            if (first == std::string::npos || line[first] == '#')
+                continue;
+            size_t last = line.find_last_not_of(" \t\r");
+
+            HeadlessSignature signature;
+            if (!ParseSignature(line.substr(first, last - first + 1), signature, error))
+                return false;
+            signatures.push_back(signature);
+        }
+        return true;
+    }
+
+    /**
+     * @brief Set up the DMA manager for the requested source and attach to the target
+     * @param error Receives a description of the problem on failure
+     * @param openMs Receives the time spent opening the source
+     * @param attachMs Receives the time spent attaching
+     */
+    bool OpenTarget(const HeadlessOptions& options, DMAManager& dma, std::string& error, double& openMs, double& attachMs)
+    {
+        Stopwatch stopwatch;
+        ReplayBackend* replayed = nullptr;
+        uint32_t processId = options.processId;
+
+        if (options.source == HeadlessSource::Device)
+        {
+            if (!dma.Initialize())
+            {
+                error = "Failed to initialize DMA device";
+                return false;
+            }
+        }
+        else if (options.source == HeadlessSource::Session)
+        {
+            auto replay = std::make_unique<ReplayBackend>();
+            if (!replay->Load(options.path))
+            {
+                error = "Failed to load session: " + options.path;
+                return false;
+            }
+            replayed = replay.get();
+            if (!dma.Initialize(std::move(replay)))
+            {
+                error = "Failed to initialize replay backend";
+                return false;
+            }
+        }
+        else
+        {
+            std::vector<uint8_t> image;
+            PeHeaders headers;
+            bool hasHeaders = false;
+
+            if (options.source == HeadlessSource::PeFile)
+            {
+                if (!PeImage::MapFile(options.path, image, headers))
+                {
+                    error = "Failed to map PE file: " + options.path;
+                    return false;
+                }
+                hasHeaders = true;
+            }
+            else
+            {
+                std::ifstream file(options.path, std::ios::binary);
+                image.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+                if (image.empty())
+                {
+                    error = "Failed to read module dump: " + options.path;
+                    return false;
+                }
+                hasHeaders = PeImage::ParseHeaders(image.data(), image.size(), headers);
+            }
+
+            uint64_t baseAddress = options.baseAddress;
+            if (baseAddress == 0)
+            {
+                baseAddress = hasHeaders && headers.imageBase ? headers.imageBase : DEFAULT_MODULE_BASE;
+            }
+
+            // The file becomes a process whose main module is the file itself
+            std::string moduleName = FileName(options.path);
+            auto backend = std::make_unique<SimulatedBackend>();
+            processId = backend->AddProcess(moduleName);
+            backend->AddModule(processId, moduleName, baseAddress, std::move(image));
+
+            if (!dma.Initialize(std::move(backend)))
+            {
+                error = "Failed to initialize simulated backend";
+                return false;
+            }
+        }
+        openMs = stopwatch.Lap();
+
+        bool attached = false;
+        if (processId != 0)
+        {
+            attached = dma.AttachToProcess(processId);
+        }
+        else if (!options.processName.empty())
+        {
+            attached = dma.AttachToProcess(options.processName);
+        }
+        else if (replayed && !dma.GetProcessList()->empty())
+        {
+            // Sessions remember which process was attached while recording
+            processId = static_cast<uint32_t>(replayed->GetLastMarker("attach", dma.GetProcessList()->front().processId));
+            attached = dma.AttachToProcess(processId);
+        }
+        else
+        {
+            error = "No target process given (use --process or --pid)";
+            return false;
+        }
+        attachMs = stopwatch.Lap();
+
+        if (!attached)
+        {
+            error = "Failed to attach to target process";
+            return false;
+        }
+        return true;
+    }
+
+    void WriteAddress(JsonWriter& json, uint64_t address, uint64_t moduleBase)
+    {
+        json.Bool("found", address != 0);
+        if (address != 0)
+        {
+            // Hex strings: JSON numbers lose precision above 2^53
+            json.String("address", DMAManager::FormatHexAddress(address));
+            json.String("rva", DMAManager::FormatHexAddress(address - moduleBase));
+        }
+    }
+
+    void WriteGlobal(JsonWriter& json, uint64_t address, GlobalSource source, const GlobalModule& module)
+    {
+        WriteAddress(json, address, module.base);
+        if (address != 0)
+        {
+            json.String("source", SymbolResolver::GetSourceName(source));
+            json.String("module", module.name);
+        }
+    }
+}
+
+bool HeadlessRunner::ParseArgs(const std::vector<std::string>& args, HeadlessOptions& options, std::string& error)
+{
+    int sources = 0;
+    bool deviceTarget = false;
+
+    for (size_t i = 0; i < args.size(); ++i)
+    {
+        const std::string& arg = args[i];
+        auto next = [&]() -> std::string
+        {
+            if (i + 1 >= args.size())
+            {
+                error = "Missing value for " + arg;
+                return "";
+            }
+            return args[++i];
+        };
+
+        try
+        {
+            if (arg == "--process") { options.processName = next(); deviceTarget = true; }
+            else if (arg == "--pid") { options.processId = static_cast<uint32_t>(std::stoul(next())); deviceTarget = true; }
+            else if (arg == "--session") { options.source = HeadlessSource::Session; options.path = next(); sources++; }
+            else if (arg == "--pe") { options.source = HeadlessSource::PeFile; options.path = next(); sources++; }
+            else if (arg == "--dump") { options.source = HeadlessSource::Dump; options.path = next(); sources++; }
+            else if (arg == "--base") { options.baseAddress = DMAManager::ParseHexAddress(next()); }
+            else if (arg == "--signature")
+            {
+                HeadlessSignature signature;
+                std::string text = next();
+                if (!error.empty() || !ParseSignature(text, signature, error))
+                    return false;
+                options.signatures.push_back(signature);
+            }
+            else if (arg == "--signature-file")
+            {
+                std::string filename = next();
+                if (!error.empty() || !LoadSignatureFile(filename, options.signatures, error))
+                    return false;
+            }
+            else if (arg == "--out") options.outputPath = next();
+            else if (arg == "--trace") options.tracePath = next();
+            else if (arg == "--names") options.namesPath = next();
+            else if (arg == "--objects") options.objectsPath = next();
+            else if (arg == "--layouts") options.layoutsPath = next();
+            else if (arg == "--layout-cache") options.layoutCacheDir = next();
+            else if (arg == "--signature-stats") options.signatureStatsPath = next();
+            else if (arg == "--pdb") options.pdbPath = next();
+            else if (arg == "--all-modules") options.allModules = true;
+            else if (arg == "--index") options.indexSignatures = true;
+            else if (arg == "--no-globals") options.skipGlobals = true;
+            else if (arg == "--verbose") options.verbose = true;
+            else
+            {
+                error = "Unknown argument: " + arg;
+                return false;
+            }
+        }
+        catch (const std::exception&)
+        {
+            error = "Invalid value for " + arg;
+            return false;
+        }
+
+        if (!error.empty())
+            return false;
+    }
+
+    if (sources > 1)
+    {
+        error = "Only one of --session, --pe and --dump can be given";
+        return false;
+    }
+    if (options.source == HeadlessSource::Device && !deviceTarget)
+    {
+        error = "No target given (use --process, --pid, --session, --pe or --dump)";
+        return false;
+    }
+    if ((options.source == HeadlessSource::PeFile || options.source == HeadlessSource::Dump) && deviceTarget)
+    {
+        error = "--process/--pid cannot be combined with --pe or --dump";
+        return false;
+    }
+    if (options.skipGlobals && !options.namesPath.empty())
+    {
+        error = "--names needs the globals scan (GNames)";
+        return false;
+    }
+    if (options.skipGlobals && !options.objectsPath.empty())
+    {
+        error = "--objects needs the globals scan (GObjects)";
+        return false;
+    }
+    if (options.skipGlobals && options.signatures.empty())
+    {
+        error = "--no-globals needs at least one --signature";
+        return false;
+    }
+    return true;
+}
+
+void HeadlessRunner::PrintUsage()
+{
+    std::cerr << "Usage: UnrealOffsetFinder-DMA --headless <target> [options]\n"
+              << "Targets:\n"
+              << "  --process <name>          Attach to a live process through the DMA device\n"
+              << "  --pid <pid>               Attach to a live process by PID\n"
+              << "  --session <file>          Replay a recorded DMA session (.uofrec); --process/--pid\n"
+              << "                            pick the process, default is the one recorded\n"
+              << "  --pe <file>               Scan an executable on disk (sections mapped as in memory)\n"
+              << "  --dump <file>             Scan a raw module dump (module bytes as in memory)\n"
+              << "Options:\n"
+              << "  --base <hex>              Module base for --pe/--dump (default: PE ImageBase)\n"
+              << "  --signature <name=pat>    Also scan the main module for a pattern (repeatable)\n"
+              << "  --signature-file <file>   Read name=pattern lines ('#' starts a comment)\n"
+              << "  --no-globals              Skip the GWorld/GNames/GObjects scan\n"
+              << "  --out <file>              Write the JSON document to a file instead of stdout\n"
+              << "  --trace <file>            Export a Chrome trace of the run\n"
+              << "  --names <file>            Dump every GNames entry as 'index<TAB>name' lines\n"
+              << "  --objects <file>          Write every live GObjects entry (with names if --names is given)\n"
+              << "  --layouts <file>          Write every class and struct layout; loaded from the build's cache\n"
+              << "                            when present, otherwise walked (dumping names and objects) and cached\n"
+              << "  --layout-cache <dir>      Directory of the layout caches (default: .)\n"
+              << "  --signature-stats <file>  Try signature variants in order of their hits on the detected\n"
+              << "                            engine version, and count this run's hits in the file\n"
+              << "  --pdb <file>              Resolve globals from this PDB when it matches the module; the\n"
+              << "                            export table is always tried first, the signature scan last\n"
+              << "  --all-modules             Signature scan every loaded module, not only the executable; RVAs\n"
+              << "                            are relative to the module holding each global\n"
+              << "  --index                   Capture and index the main module once, then answer the extra\n"
+              << "                            signatures from the index\n"
+              << "  --verbose                 Forward scanner logs to stderr\n"
+              << "Exit codes: 0 everything found, 2 something not found, 1 error" << std::endl;
+}
+
+int HeadlessRunner::Main(const std::vector<std::string>& args)
+{
+    HeadlessOptions options;
+    std::string error;
+    if (!ParseArgs(args, options, error))
+    {
+        std::cerr << error << std::endl;
+        PrintUsage();
+        return EXIT_FAILED;
+    }
+    return Run(options);
+}
+
+int HeadlessRunner::Run(const HeadlessOptions& options)
+{
+    Stopwatch total;
+    JsonWriter json(true);
+    std::string error;
+    bool complete = true;
+
+    {
+        ScopedLogRedirect redirect(options.verbose);
+        if (!options.tracePath.empty())
+        {
+            TraceRecorder::Get().SetCurrentThreadName("Headless");
+            TraceRecorder::Get().Start();
+        }
+
+        json.BeginObject();
+        json.UInt("schema_version", JSON_SCHEMA_VERSION);
+
+        json.BeginObject("source");
+        json.String("kind", GetSourceName(options.source));
+        if (!options.path.empty())
+            json.String("path", options.path);
+        json.EndObject();
+
+        DMAManager dma;
+        double openMs = 0.0;
+        double attachMs = 0.0;
+        double globalsMs = 0.0;
+        double signaturesMs = 0.0;
+        double namesMs = 0.0;
+        double objectsMs = 0.0;
+        double layoutsMs = 0.0;
+
+        if (!options.signatureStatsPath.empty() && !dma.SetSignatureStatsFile(options.signatureStatsPath))
+        {
+            error = "Invalid signature stats file: " + options.signatureStatsPath;
+        }
+        else if (!options.pdbPath.empty() && !dma.SetPdbFile(options.pdbPath))
+        {
+            error = "Invalid PDB: " + options.pdbPath;
+        }
+        else if (OpenTarget(options, dma, error, openMs, attachMs))
+        {
+            ProcessInfo process = dma.GetCurrentProcessInfo();
+            uint64_t moduleBase = dma.GetMainModuleBase();
+
+            json.BeginObject("process");
+            json.String("name", process.processName);
+            json.UInt("pid", process.processId);
+            json.String("module_base", DMAManager::FormatHexAddress(moduleBase));
+            json.String("image_size", DMAManager::FormatHexAddress(process.imageSize));
+            json.String("engine_version", dma.GetEngineVersion().ToString());
+            json.EndObject();
+
+            uint64_t gnamesAddress = 0;
+            uint64_t gobjectsAddress = 0;
+            if (!options.skipGlobals)
+            {
+                json.BeginObject("symbols");
+                auto resolver = dma.GetSymbolResolver();
+                json.UInt("exports", resolver ? resolver->GetExportCount() : 0);
+                json.String("pdb", resolver ? resolver->GetPdbStatus() : "module headers unreadable");
+                json.EndObject();
+
+                json.BeginObject("globals");
+                if (options.allModules)
+                {
+                    // One ranked scan over every module; only the total time is known
+                    Stopwatch stopwatch;
+                    UnrealGlobals globals = dma.ScanUnrealGlobals(true);
+                    globalsMs = stopwatch.Lap();
+                    const uint64_t addresses[] = { globals.GWorld, globals.GNames, globals.GObjects };
+                    const GlobalSource sources[] = { globals.GWorldSource, globals.GNamesSource, globals.GObjectsSource };
+                    const GlobalModule* modules[] = { &globals.GWorldModule, &globals.GNamesModule, &globals.GObjectsModule };
+                    for (size_t i = 0; i < 3; ++i)
+                    {
+                        complete = complete && addresses[i] != 0;
+                        json.BeginObject(GLOBAL_GROUPS[i]);
+                        WriteGlobal(json, addresses[i], sources[i], *modules[i]);
+                        json.EndObject();
+                    }
+                    gnamesAddress = globals.GNames;
+                    gobjectsAddress = globals.GObjects;
+                }
+                else
+                {
+                    MainModuleImage image;  // Read once, by the first group that needs a signature scan
+                    for (const char* group : GLOBAL_GROUPS)
+                    {
+                        Stopwatch stopwatch;
+                        GlobalSource source = GlobalSource::None;
+                        uint64_t address = dma.ResolveUnrealGlobal(group, &source, &image);
+                        double elapsed = stopwatch.Lap();
+                        globalsMs += elapsed;
+                        complete = complete && address != 0;
+                        if (std::string(group) == "GNames")
+                            gnamesAddress = address;
+                        else if (std::string(group) == "GObjects")
+                            gobjectsAddress = address;
+
+                        json.BeginObject(group);
+                        WriteGlobal(json, address, source, { process.processName, moduleBase });
+                        json.Double("ms", elapsed);
+                        json.EndObject();
+                    }
+                }
+                json.EndObject();
+            }
+
+            NameTable names;
+            bool haveNames = false;
+            if (!options.namesPath.empty())
+            {
+                Stopwatch stopwatch;
+                NamePoolDumper dumper(dma);
+                std::string namesError;
+                haveNames = dumper.Dump(gnamesAddress, names, namesError);
+                bool dumped = haveNames && names.SaveToFile(options.namesPath);
+                namesMs = stopwatch.Lap();
+                complete = complete && dumped;
+
+                const NameDumpStats& stats = dumper.GetLastStats();
+                json.BeginObject("names");
+                json.Bool("dumped", dumped);
+                if (dumped)
+                {
+                    json.String("file", options.namesPath);
+                    json.UInt("count", stats.entries);
+                    json.UInt("wide", stats.wideEntries);
+                    json.UInt("blocks", stats.blocks);
+                    json.UInt("bytes_read", stats.bytesRead);
+                    json.UInt("table_bytes", stats.memoryBytes);
+                }
+                else
+                {
+                    json.String("error", namesError.empty() ? "Failed to write " + options.namesPath : namesError);
+                }
+                json.Double("ms", namesMs);
+                json.EndObject();
+            }
+
+            ObjectIndex objects;
+            bool haveObjects = false;
+            if (!options.objectsPath.empty())
+            {
+                Stopwatch stopwatch;
+                ObjectEnumerator enumerator(dma);
+                std::string objectsError;
+                haveObjects = enumerator.Enumerate(gobjectsAddress, objects, objectsError);
+                bool enumerated = haveObjects && objects.SaveToFile(options.objectsPath, haveNames ? &names : nullptr);
+                objectsMs = stopwatch.Lap();
+                complete = complete && enumerated;
+
+                const ObjectEnumStats& stats = enumerator.GetLastStats();
+                json.BeginObject("objects");
+                json.Bool("enumerated", enumerated);
+                if (enumerated)
+                {
+                    json.String("file", options.objectsPath);
+                    json.UInt("slots", stats.slots);
+                    json.UInt("count", stats.objects);
+                    json.UInt("stale", stats.stale);
+                    json.UInt("spans", stats.spans);
+                    json.UInt("batches", stats.batches);
+                    json.UInt("bytes_read", stats.bytesRead);
+                    json.UInt("index_bytes", stats.memoryBytes);
+                }
+                else
+                {
+                    json.String("error", objectsError.empty() ? "Failed to write " + options.objectsPath : objectsError);
+                }
+                json.Double("ms", objectsMs);
+                json.EndObject();
+            }
+
+            if (!options.layoutsPath.empty())
+            {
+                Stopwatch stopwatch;
+                LayoutIndexer indexer(dma);
+                LayoutIndex layouts;
+                std::string layoutsError;
+                bool indexed = indexer.IndexCached(nullptr, nullptr, options.layoutCacheDir, layouts, layoutsError);
+                if (!indexed && !options.skipGlobals)
+                {
+                    // Cache miss: the walk needs names and objects, taken from above when already there
+                    layoutsError.clear();
+                    if (!haveNames)
+                    {
+                        NamePoolDumper dumper(dma);
+                        haveNames = dumper.Dump(gnamesAddress, names, layoutsError);
+                    }
+                    if (haveNames && !haveObjects)
+                    {
+                        ObjectEnumerator enumerator(dma);
+                        haveObjects = enumerator.Enumerate(gobjectsAddress, objects, layoutsError);
+                    }
+                    indexed = haveNames && haveObjects &&
+                              indexer.IndexCached(&objects, &names, options.layoutCacheDir, layouts, layoutsError);
+                }
+                bool written = indexed && layouts.SaveToFile(options.layoutsPath);
+                layoutsMs = stopwatch.Lap();
+                complete = complete && written;
+
+                const LayoutIndexStats& stats = indexer.GetLastStats();
+                json.BeginObject("layouts");
+                json.Bool("indexed", written);
+                if (written)
+                {
+                    json.String("file", options.layoutsPath);
+                    json.Bool("from_cache", stats.fromCache);
+                    json.UInt("structs", stats.structs);
+                    json.UInt("properties", stats.properties);
+                    json.UInt("rounds", stats.rounds);
+                    json.UInt("batches", stats.batches);
+                    json.UInt("bytes_read", stats.bytesRead);
+                }
+                else
+                {
+                    json.String("error", layoutsError.empty() ? "Failed to write " + options.layoutsPath : layoutsError);
+                }
+                json.Double("ms", layoutsMs);
+                json.EndObject();
+            }
+
+            if (options.indexSignatures)
+            {
+                Stopwatch stopwatch;
+                std::string indexError;
+                auto index = dma.BuildSignatureIndex(indexError);
+                double elapsed = stopwatch.Lap();
+                signaturesMs += elapsed;
+                complete = complete && index != nullptr;
+
+                json.BeginObject("signature_index");
+                if (index)
+                {
+                    json.UInt("image_bytes", index->GetImageSize());
+                    json.UInt("missing_bytes", index->GetMissingBytes());
+                    json.UInt("memory_bytes", index->GetMemoryBytes());
+                }
+                else
+                {
+                    json.String("error", indexError);
+                }
+                json.Double("ms", elapsed);
+                json.EndObject();
+            }
+
+            json.BeginArray("signatures");
+            for (const auto& signature : options.signatures)
+            {
+                Stopwatch stopwatch;
+                uint64_t address = dma.ScanSignature(signature.pattern, moduleBase, process.imageSize);
+                double elapsed = stopwatch.Lap();
+                signaturesMs += elapsed;
+                complete = complete && address != 0;
+
+                json.BeginObject();
+                json.String("name", signature.name);
+                json.String("pattern", signature.pattern);
+                WriteAddress(json, address, moduleBase);
+                json.Double("ms", elapsed);
+                json.EndObject();
+            }
+            json.EndArray();
+        }
+        dma.Shutdown();
+
+        json.BeginObject("timings_ms");
+        json.Double("open", openMs);
+        json.Double("attach", attachMs);
+        json.Double("globals", globalsMs);
+        json.Double("signatures", signaturesMs);
+        json.Double("names", namesMs);
+        json.Double("objects", objectsMs);
+        json.Double("layouts", layoutsMs);
+        json.Double("total", total.Lap());
+        json.EndObject();
+
+        json.Bool("complete", error.empty() && complete);
+        if (!error.empty())
+            json.String("error", error);
+        json.EndObject();
+
+        if (!options.tracePath.empty())
+        {
+            TraceRecorder::Get().Stop();
+            TraceRecorder::Get().ExportChromeTrace(options.tracePath);
+        }
+    }
+
+    if (options.outputPath.empty())
+    {
+        std::cout << json.Str() << std::endl;
+    }
+    else
+    {
+        std::ofstream file(options.outputPath);
+        if (!file.is_open())
+        {
+            std::cerr << "Failed to open " << options.outputPath << std::endl;
+            return EXIT_FAILED;
+        }
+        file << json.Str() << std::endl;
+    }
+
+    if (!error.empty())
+    {
+        std::cerr << error << std::endl;
+        return EXIT_FAILED;
+    }
+    return complete ? EXIT_ALL_FOUND : EXIT_INCOMPLETE;
+}
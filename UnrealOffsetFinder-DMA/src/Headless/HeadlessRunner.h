@@ -0,0 +1,99 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <cstdint>
+
+/**
+ * @enum HeadlessSource
+ * @brief Where the scanned process comes from
+ */
+enum class HeadlessSource
+{
+    Device,     ///< Live process through the DMA device (by name or PID)
+    Session,    ///< Recorded DMA session (.uofrec)
+    PeFile,     ///< Executable on disk, mapped like the loader would
+    Dump        ///< Raw module dump (module bytes as in memory)
+};
+
+/**
+ * @struct HeadlessSignature
+ * @brief Extra signature requested on the command line
+ */
+struct HeadlessSignature
+{
+    std::string name;       ///< Name reported in the output
+    std::string pattern;    ///< Pattern string (e.g. "48 8B 05 ?? ?? ?? ??")
+};
+
+/**
+ * @struct HeadlessOptions
+ * @brief Command line options of a headless run
+ */
+struct HeadlessOptions
+{
+    HeadlessSource source = HeadlessSource::Device;     ///< Scan target kind
+    std::string processName;                            ///< Process to attach to (device or session)
+    uint32_t processId = 0;                             ///< PID to attach to (device or session)
+    std::string path;                                   ///< Session, PE or dump file
+    uint64_t baseAddress = 0;                           ///< Module base for PE/dump (0 = from PE headers)
+    std::vector<HeadlessSignature> signatures;          ///< Extra signatures scanned in the main module
+    std::string outputPath;                             ///< Write JSON here instead of stdout
+    std::string tracePath;                              ///< Export a Chrome trace of the run
+    std::string namesPath;                              ///< Dump every GNames entry to this file
+    std::string objectsPath;                            ///< Write every live GObjects entry to this file
+    std::string layoutsPath;                            ///< Write every class and struct layout to this file
+    std::string layoutCacheDir = ".";                   ///< Directory of the per-build layout caches
+    std::string signatureStatsPath;                     ///< Signature hit statistics to rank variants with and update
+    std::string pdbPath;                                ///< PDB of the target build, consulted before the signature scan
+    bool allModules = false;                            ///< Scan every loaded module for the globals
+    bool indexSignatures = false;                       ///< Answer the extra signatures from a main module index
+    bool skipGlobals = false;                           ///< Only scan the extra signatures
+    bool verbose = false;                               ///< Forward scanner logs to stderr
+};
+
+/**
+ * @class HeadlessRunner
+ * @brief Scans a target without any window and prints the results as JSON
+ *
+ * Meant for scripted rechecks after game patches: attach (or load a file),
+ * run the globals scan plus any extra signatures and emit one JSON document
+ * with addresses, RVAs and per-phase timings. Scanner logging goes to
+ * stderr (with --verbose) so stdout only ever contains the JSON.
+ */
+class HeadlessRunner
+{
+public:
+    /**
+     * @brief Parse command line arguments (everything after --headless)
+     * @param args Arguments
+     * @param options Receives the parsed options
+     * @param error Receives a description of the problem on failure
+     * @return true if the arguments are valid
+     */
+    static bool ParseArgs(const std::vector<std::string>& args, HeadlessOptions& options, std::string& error);
+
+    /**
+     * @brief Print command line usage to stderr
+     */
+    static void PrintUsage();
+
+    /**
+     * @brief Parse arguments and run
+     * @param args Arguments (everything after --headless)
+     * @return Process exit code (one of the EXIT_ constants)
+     */
+    static int Main(const std::vector<std::string>& args);
+
+    /**
+     * @brief Run a headless scan
+     * @param options Parsed options
+     * @return Process exit code (one of the EXIT_ constants)
+     */
+    static int Run(const HeadlessOptions& options);
+
+    static constexpr int EXIT_ALL_FOUND = 0;        ///< Every requested global and signature was found
+    static constexpr int EXIT_FAILED = 1;           ///< Bad arguments, or the target could not be opened
+    static constexpr int EXIT_INCOMPLETE = 2;       ///< Scan ran but something was not found
+    static constexpr int JSON_SCHEMA_VERSION = 1;   ///< Version of the emitted document
+};
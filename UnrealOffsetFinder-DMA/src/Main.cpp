@@ -1,6 +1,11 @@
+#ifndef UOF_HEADLESS_ONLY
 #include "Application.h"
+#endif
+#include "Headless/HeadlessRunner.h"
 #include <exception>
 #include <iostream>
+#include <string>
+#include <vector>
 
 namespace ExitCode
 {
@@ -14,13 +19,33 @@ namespace ExitCode
  * @param argc Command line argument count
  * @param argv Command line argument values
  * @return Exit code (0 for success, negative for errors)
+ *
+ * With --headless as the first argument no window is created; the remaining
+ * arguments are handled by HeadlessRunner. Headless-only builds
+ * (UOF_HEADLESS_ONLY) always run headless.
  */
 int main(int argc, char* argv[])
 {
-    try 
+    try
     {
+        std::vector<std::string> args(argv + (argc > 0 ? 1 : 0), argv + argc);
+
+#ifdef UOF_HEADLESS_ONLY
+        if (!args.empty() && args.front() == "--headless")
+        {
+            args.erase(args.begin());
+        }
+        return HeadlessRunner::Main(args);
+#else
+        if (!args.empty() && args.front() == "--headless")
+        {
+            args.erase(args.begin());
+            return HeadlessRunner::Main(args);
+        }
+
         Application app;
         return app.Run();
+#endif
     }
     catch (const std::exception& e)
     {
@@ -32,4 +57,4 @@ int main(int argc, char* argv[])
         std::cerr << "Unknown fatal error occurred" << std::endl;
         return ExitCode::UNKNOWN_ERROR;
     }
-} 
\ No newline at end of file
+}
\ No newline at end of file
@@ -0,0 +1,83 @@
+#include "ByteFrequency.h"
+#include <algorithm>
+
+namespace
+{
+    // Parts per 65536 of each byte in the .text of 148 x86-64 binaries (200 MB of code)
+    constexpr uint16_t X64_CODE_FREQUENCY[256] = {
+         7812,  1159,   422,   279,   449,   316,   160,   163,   678,   113,   102,   101,   152,   119,    72,  2409,   // 00
+          554,   151,    63,    58,   128,   162,    79,    61,   296,    49,    44,    42,    77,    67,    50,   522,   // 10
+          310,    67,    46,    39,  1531,   121,    33,    37,   263,   177,    38,    77,    67,    69,   120,    43,   // 20
+          210,   407,    34,    45,    77,   133,    35,    53,   192,   340,    47,    87,   124,   158,    39,    56,   // 30
+          552,   948,    96,   158,   795,   397,    85,   110,  4556,   700,    66,    52,  1093,   270,    47,    52,   // 40
+          218,    43,    45,   150,   217,   222,    90,    87,   121,    40,    41,   155,   176,   238,    92,    90,   // 50
+          143,    76,   297,    84,   112,    66,   835,    56,   107,    55,    47,    63,   108,    64,    68,   202,   // 60
+          224,    42,    98,    81,   520,   303,    59,    75,   120,    40,    41,    79,   199,   156,   149,   132,   // 70
+          289,   135,    52,   820,   794,   888,    54,    74,   140,  2472,    37,  1885,    60,   984,    44,    43,   // 80
+          216,    34,    32,    39,    76,    66,    30,    32,    82,    43,    25,    27,    48,    43,    26,    29,   // 90
+           88,    97,    32,    33,    39,    32,    29,    28,    81,    28,    34,    34,    51,    31,    25,    42,   // A0
+           96,    65,    25,    33,    61,    57,   145,    92,   166,    85,   164,    57,   105,    96,   185,   133,   // B0
+          676,   284,   158,   330,   263,   241,   226,   409,   140,   139,    74,    49,    82,    53,    55,    55,   // C0
+          170,    88,   165,    80,    68,    70,    74,    60,   156,    78,    67,   112,    60,    78,    91,   202,   // D0
+          179,   125,   119,    85,    93,    91,    95,   138,  1206,   513,   106,   215,   145,   127,   145,   261,   // E0
+          160,    76,   127,   184,    71,   187,   247,   171,   237,   141,   168,   156,   184,   256,   508,  3591,   // F0
+    };
+}
+
+ByteFrequency::ByteFrequency()
+    : m_byteTotal(0)
+    , m_pairTotal(0)
+{
+    for (size_t i = 0; i < 256; ++i)
+    {
+        m_bytes[i] = X64_CODE_FREQUENCY[i];
+        m_byteTotal += X64_CODE_FREQUENCY[i];
+    }
+}
+
+const ByteFrequency& ByteFrequency::GetDefault()
+{
+    static const ByteFrequency model;
+    return model;
+}
+
+void ByteFrequency::Learn(const uint8_t* buffer, size_t size, size_t maxSampleBytes)
+{
+    if (!buffer || size < 2)
+        return;
+
+    m_bytes.fill(0);
+    m_byteTotal = 0;
+    m_pairs.assign(256 * 256, 0);
+    m_pairTotal = 0;
+
+    // Evenly spaced blocks so a large image is sampled across all of its sections
+    size_t blocks = std::max<size_t>(1, std::min(size, maxSampleBytes) / SAMPLE_BLOCK);
+    size_t stride = size / blocks;
+    for (size_t block = 0; block < blocks; ++block)
+    {
+        const uint8_t* data = buffer + block * stride;
+        size_t length = std::min(SAMPLE_BLOCK, size - block * stride);
+        for (size_t i = 0; i < length; ++i)
+        {
+            m_bytes[data[i]]++;
+            if (i + 1 < length)
+                m_pairs[(data[i] << 8) | data[i + 1]]++;
+        }
+        m_byteTotal += length;
+        m_pairTotal += length - 1;
+    }
+}
+
+double ByteFrequency::GetByteRate(uint8_t value) const
+{
+    // Add-one smoothing: a byte absent from the sample is rare, not impossible
+    return (m_bytes[value] + 1.0) / (m_byteTotal + 256.0);
+}
+
+double ByteFrequency::GetPairRate(uint8_t first, uint8_t second) const
+{
+    if (m_pairTotal == 0)
+        return GetByteRate(first) * GetByteRate(second);
+    return (m_pairs[(first << 8) | second] + 1.0) / (m_pairTotal + 65536.0);
+}
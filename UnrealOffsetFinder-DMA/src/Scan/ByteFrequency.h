@@ -0,0 +1,69 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+/**
+ * @class ByteFrequency
+ * @brief How often each byte and adjacent byte pair occurs in x86-64 code
+ *
+ * Lets the pattern compiler anchor a signature on its rarest fixed bytes
+ * instead of a common opcode or REX prefix. The default model is a table
+ * measured over the .text sections of x86-64 binaries; Learn replaces it
+ * with counts from a sample of the module actually being scanned. Without
+ * learned pair counts a pair's rate is the product of its byte rates.
+ */
+class ByteFrequency
+{
+public:
+    /**
+     * @brief Constructor - built-in x86-64 code model
+     */
+    ByteFrequency();
+
+    /**
+     * @brief Get the shared built-in model
+     * @return Model
+     */
+    static const ByteFrequency& GetDefault();
+
+    /**
+     * @brief Replace the model with byte and pair counts of a buffer
+     * @param buffer Bytes to count (typically a whole module image)
+     * @param size Size of the buffer
+     * @param maxSampleBytes Bytes counted at most, in SAMPLE_BLOCK blocks spread over the buffer
+     */
+    void Learn(const uint8_t* buffer, size_t size, size_t maxSampleBytes = DEFAULT_SAMPLE_BYTES);
+
+    /**
+     * @brief Get the probability of a byte at any position
+     * @param value Byte
+     * @return Rate in (0, 1]
+     */
+    double GetByteRate(uint8_t value) const;
+
+    /**
+     * @brief Get the probability of a byte pair at any position
+     * @param first Byte at the position
+     * @param second Byte at the next position
+     * @return Rate in (0, 1]
+     */
+    double GetPairRate(uint8_t first, uint8_t second) const;
+
+    /**
+     * @brief Check if the model was learned from a buffer
+     * @return true after a Learn call on a non-empty buffer
+     */
+    bool IsLearned() const { return m_pairTotal != 0; }
+
+    static constexpr size_t DEFAULT_SAMPLE_BYTES = 0x100000;   ///< Bytes counted by Learn (1 MB)
+    static constexpr size_t SAMPLE_BLOCK = 0x1000;              ///< Contiguous bytes per sample
+
+private:
+    std::array<uint64_t, 256> m_bytes;  ///< Byte counts (built-in: parts per 65536)
+    uint64_t m_byteTotal;               ///< Sum of m_bytes
+    std::vector<uint32_t> m_pairs;      ///< Pair counts indexed first << 8 | second (learned only)
+    uint64_t m_pairTotal;               ///< Sum of m_pairs
+};
@@ -0,0 +1,470 @@
+#include "ModuleScanner.h"
+#include "PatternScanner.h"
+#include "../DMA/DMAManager.h"
+#include "../Core/StringUtils.h"
+#include "../Core/TaskExecutor.h"
+#include "../Core/Trace.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <tuple>
+
+namespace
+{
+    const char* const CORE_MODULE_SUFFIXES[] = { "-coreuobject", "-core", "-engine" };
+    const char* const UE_MODULE_PREFIXES[] = { "ue4editor-", "ue5editor-", "unrealeditor-", "ue4-", "ue5-" };
+    const char* const SYSTEM_MODULE_PREFIXES[] = { "api-ms-win-", "ext-ms-win-" };
+    const char* const SYSTEM_MODULES[] = {
+        "ntdll.dll", "kernel32.dll", "kernelbase.dll", "user32.dll", "win32u.dll", "gdi32.dll", "gdi32full.dll",
+        "msvcp_win.dll", "ucrtbase.dll", "advapi32.dll", "msvcrt.dll", "sechost.dll", "rpcrt4.dll", "combase.dll",
+        "ole32.dll", "oleaut32.dll", "shell32.dll", "shlwapi.dll", "ws2_32.dll", "bcrypt.dll", "crypt32.dll",
+        "setupapi.dll", "cfgmgr32.dll", "imm32.dll", "version.dll", "winmm.dll", "dbghelp.dll", "dxgi.dll",
+        "d3d11.dll", "d3d12.dll", "dinput8.dll", "xinput1_3.dll", "vcruntime140.dll", "vcruntime140_1.dll",
+        "msvcp140.dll"
+    };
+
+    /**
+     * @brief Module bytes owned by one chunk
+     */
+    struct Chunk
+    {
+        size_t module;      ///< Index into the ranked module list
+        uint64_t offset;    ///< Module offset of the first owned byte
+        uint64_t size;      ///< Owned bytes
+    };
+
+    /**
+     * @brief Best hit of a group so far; ordered by module rank, variant, offset
+     */
+    struct Candidate
+    {
+        size_t module = SIZE_MAX;       ///< Index into the ranked module list
+        size_t variant = SIZE_MAX;      ///< Variant index within the group
+        uint64_t offset = UINT64_MAX;   ///< Module offset of the match
+        size_t signature = SIZE_MAX;    ///< Index into the signature list
+        uint64_t address = 0;           ///< Resolved global
+
+        bool Before(const Candidate& other) const
+        {
+            return std::tie(module, variant, offset) < std::tie(other.module, other.variant, other.offset);
+        }
+    };
+
+    /**
+     * @brief Chunks read by one scatter batch
+     */
+    struct Batch
+    {
+        std::vector<Chunk> chunks;          ///< Chunks in rank order
+        std::vector<ScatterRead> reads;     ///< One read per chunk (owned bytes plus overlap)
+        std::vector<uint8_t> buffer;        ///< Storage of all reads
+    };
+
+    uint64_t GetReadBegin(const Chunk& chunk)
+    {
+        return chunk.offset - std::min(chunk.offset, ModuleScanner::CHUNK_OVERLAP);
+    }
+
+    /**
+     * @brief Threads started once per scan that split the items of each round between them
+     */
+    class RoundWorkers
+    {
+    public:
+        RoundWorkers(size_t count, std::function<void(size_t)> work)
+            : m_work(std::move(work))
+        {
+            for (size_t i = 0; i < count; ++i)
+            {
+                m_threads.emplace_back(&RoundWorkers::Run, this);
+            }
+        }
+
+        ~RoundWorkers()
+        {
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_stopping = true;
+            }
+            m_start.notify_all();
+            for (auto& thread : m_threads)
+            {
+                thread.join();
+            }
+        }
+
+        /**
+         * @brief Hand out items [0, itemCount) (the previous round must have been waited for)
+         */
+        void Begin(size_t itemCount)
+        {
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_itemCount = itemCount;
+                m_nextItem = 0;
+                m_busy = m_threads.size();
+                m_round++;
+            }
+            m_start.notify_all();
+        }
+
+        /**
+         * @brief Block until every item of the current round was processed
+         */
+        void Wait()
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_done.wait(lock, [this]() { return m_busy == 0; });
+        }
+
+    private:
+        void Run()
+        {
+            uint64_t seenRound = 0;
+            while (true)
+            {
+                size_t itemCount = 0;
+                {
+                    std::unique_lock<std::mutex> lock(m_mutex);
+                    m_start.wait(lock, [&]() { return m_stopping || m_round != seenRound; });
+                    if (m_stopping)
+                        return;
+                    seenRound = m_round;
+                    itemCount = m_itemCount;
+                }
+
+                for (size_t i = m_nextItem++; i < itemCount; i = m_nextItem++)
+                {
+                    m_work(i);
+                }
+
+                std::lock_guard<std::mutex> lock(m_mutex);
+                if (--m_busy == 0)
+                    m_done.notify_all();
+            }
+        }
+
+        std::function<void(size_t)> m_work;     ///< Processes one item
+        std::vector<std::thread> m_threads;     ///< Worker threads
+        std::mutex m_mutex;                     ///< Guards the round state below
+        std::condition_variable m_start;        ///< Signals a new round or stop
+        std::condition_variable m_done;         ///< Signals the end of a round
+        uint64_t m_round = 0;                   ///< Round counter (workers wait for it to change)
+        size_t m_itemCount = 0;                 ///< Items of the current round
+        std::atomic<size_t> m_nextItem{ 0 };    ///< Next item to hand out
+        size_t m_busy = 0;                      ///< Workers still in the current round
+        bool m_stopping = false;                ///< Workers should exit
+    };
+}
+
+ModuleScanner::ModuleScanner(const DMAManager& dmaManager)
+    : m_dmaManager(dmaManager)
+{
+}
+
+bool ModuleScanner::Scan(const std::vector<UnrealSignature>& signatures, std::vector<ModuleScanHit>& hits, std::string& error)
+{
+    TRACE_SCOPE("ScanAllModules", "scan");
+    auto startTime = std::chrono::steady_clock::now();
+    m_stats = ModuleScanStats();
+    hits.clear();
+
+    if (!m_dmaManager.IsConnected())
+    {
+        error = "Not connected to any process";
+        return false;
+    }
+    if (signatures.empty())
+    {
+        error = "No signatures to scan for";
+        return false;
+    }
+
+    std::vector<ProcessInfo> modules = RankModules(m_dmaManager.GetModuleList(), m_dmaManager.GetCurrentProcessInfo().processName);
+    m_stats.modules = modules.size();
+    if (modules.empty())
+    {
+        error = "Module list of the target process is empty";
+        return false;
+    }
+
+    // Groups in first-seen order; a variant's index within its group is its priority
+    std::vector<std::string> groups;
+    std::vector<size_t> groupOf(signatures.size());
+    std::vector<size_t> variantOf(signatures.size());
+    std::vector<size_t> variantCounts;
+    for (size_t i = 0; i < signatures.size(); ++i)
+    {
+        auto it = std::find(groups.begin(), groups.end(), signatures[i].group);
+        groupOf[i] = static_cast<size_t>(it - groups.begin());
+        if (it == groups.end())
+        {
+            groups.push_back(signatures[i].group);
+            variantCounts.push_back(0);
+        }
+        variantOf[i] = variantCounts[groupOf[i]]++;
+    }
+
+    std::vector<CompiledPattern> compiled;
+    for (const UnrealSignature& sig : signatures)
+    {
+        compiled.emplace_back(sig.pattern, sig.mask);
+    }
+
+    std::vector<Chunk> chunks;
+    uint64_t totalBytes = 0;
+    for (size_t m = 0; m < modules.size(); ++m)
+    {
+        uint64_t moduleSize = modules[m].imageSize;
+        if (moduleSize == 0 || moduleSize > MAX_MODULE_SIZE)
+            continue;
+
+        for (uint64_t offset = 0; offset < moduleSize; offset += CHUNK_SIZE)
+        {
+            chunks.push_back({ m, offset, std::min(CHUNK_SIZE, moduleSize - offset) });
+        }
+        totalBytes += moduleSize;
+    }
+
+    std::mutex bestMutex;
+    std::vector<Candidate> best(groups.size());
+
+    // A module is only worth reading while some group has no hit in a better ranked module
+    auto isNeeded = [&](size_t module)
+    {
+        std::lock_guard<std::mutex> lock(bestMutex);
+        for (const Candidate& candidate : best)
+        {
+            if (candidate.module >= module)
+                return true;
+        }
+        return false;
+    };
+
+    size_t nextChunk = 0;
+    std::vector<bool> moduleScanned(modules.size(), false);
+    auto fillBatch = [&](Batch& batch)
+    {
+        batch.chunks.clear();
+        batch.reads.clear();
+        uint64_t ownedBytes = 0;
+        while (nextChunk < chunks.size() && batch.chunks.size() < MAX_BATCH_CHUNKS && ownedBytes < BATCH_BYTES)
+        {
+            const Chunk& chunk = chunks[nextChunk++];
+            if (!isNeeded(chunk.module))
+                continue;
+
+            batch.chunks.push_back(chunk);
+            ownedBytes += chunk.size;
+            if (!moduleScanned[chunk.module])
+            {
+                moduleScanned[chunk.module] = true;
+                m_stats.modulesScanned++;
+            }
+        }
+
+        // Owned bytes plus the overlap on both sides, clipped to the module
+        size_t bufferSize = 0;
+        for (const Chunk& chunk : batch.chunks)
+        {
+            uint64_t end = std::min(chunk.offset + chunk.size + CHUNK_OVERLAP, modules[chunk.module].imageSize);
+            bufferSize += static_cast<size_t>(end - GetReadBegin(chunk));
+        }
+        batch.buffer.resize(bufferSize);
+
+        uint8_t* cursor = batch.buffer.data();
+        for (const Chunk& chunk : batch.chunks)
+        {
+            uint64_t begin = GetReadBegin(chunk);
+            uint64_t end = std::min(chunk.offset + chunk.size + CHUNK_OVERLAP, modules[chunk.module].imageSize);
+            batch.reads.emplace_back(modules[chunk.module].baseAddress + begin, cursor, static_cast<size_t>(end - begin));
+            cursor += end - begin;
+        }
+    };
+
+    auto readBatch = [&](Batch& batch)
+    {
+        TRACE_SCOPE("ReadModuleBatch", "dma", "chunks", batch.chunks.size());
+        m_stats.bytesRead += m_dmaManager.ReadMemoryBatch(batch.reads);
+        m_stats.batches++;
+    };
+
+    auto matchChunk = [&](const Batch& batch, size_t index)
+    {
+        const Chunk& chunk = batch.chunks[index];
+        const ScatterRead& read = batch.reads[index];
+        const uint8_t* data = static_cast<const uint8_t*>(read.buffer);
+        const size_t size = read.bytesRead;
+        const uint64_t readBegin = GetReadBegin(chunk);
+        const size_t ownedBegin = static_cast<size_t>(chunk.offset - readBegin);
+        const size_t ownedEnd = std::min(size, static_cast<size_t>(ownedBegin + chunk.size));
+
+        for (size_t s = 0; s < signatures.size() && ownedBegin < ownedEnd; ++s)
+        {
+            const UnrealSignature& sig = signatures[s];
+            const size_t group = groupOf[s];
+            {
+                std::lock_guard<std::mutex> lock(bestMutex);
+                const Candidate& current = best[group];
+                if (current.module < chunk.module || (current.module == chunk.module && current.variant < variantOf[s]))
+                    continue;
+            }
+
+            // First match in the owned range that resolves to a plausible global
+            for (size_t position = ownedBegin; position < ownedEnd;)
+            {
+                size_t found = compiled[s].Find(data + position, size - position);
+                if (found == SIZE_MAX || position + found >= ownedEnd)
+                    break;
+
+                size_t match = position + found;
+                uint64_t address = DMAManager::ResolveGlobalReference(data, size, match, sig.group,
+                                                                      modules[chunk.module].baseAddress + readBegin);
+                if (address != 0)
+                {
+                    Candidate candidate{ chunk.module, variantOf[s], readBegin + match, s, address };
+                    std::lock_guard<std::mutex> lock(bestMutex);
+                    if (candidate.Before(best[group]))
+                        best[group] = candidate;
+                    break;
+                }
+                position = match + 1;
+            }
+        }
+    };
+
+    // Matchers are started once (and stopped before the batches go away); this thread reads
+    // the next batch while they match the current one
+    Batch batches[2];
+    const Batch* matching = nullptr;
+    RoundWorkers matchers(std::max<size_t>(std::thread::hardware_concurrency(), 1),
+        [&](size_t index) { matchChunk(*matching, index); });
+
+    size_t current = 0;
+    uint64_t matchedBytes = 0;
+    fillBatch(batches[current]);
+    if (!batches[current].chunks.empty())
+        readBatch(batches[current]);
+
+    while (!batches[current].chunks.empty())
+    {
+        if (TaskExecutor::IsCurrentTaskCancelled())
+        {
+            error = "Module scan cancelled";
+            return false;
+        }
+
+        Batch& batch = batches[current];
+        Batch& following = batches[1 - current];
+        {
+            TRACE_SCOPE("MatchModuleBatch", "scan", "chunks", batch.chunks.size());
+            matching = &batch;
+            matchers.Begin(batch.chunks.size());
+            fillBatch(following);
+            if (!following.chunks.empty())
+                readBatch(following);
+
+            matchers.Wait();
+        }
+
+        for (const Chunk& chunk : batch.chunks)
+        {
+            matchedBytes += chunk.size;
+        }
+        TaskExecutor::ReportProgress(totalBytes ? static_cast<float>(matchedBytes) / static_cast<float>(totalBytes) : 1.0f,
+                                     std::to_string(m_stats.modulesScanned) + " of " + std::to_string(modules.size()) + " modules");
+        current = 1 - current;
+    }
+
+    // Attribute each global to the module whose image holds it (normally the one it was referenced from)
+    for (size_t g = 0; g < groups.size(); ++g)
+    {
+        const Candidate& candidate = best[g];
+        if (candidate.module == SIZE_MAX)
+            continue;
+
+        const ProcessInfo* owner = &modules[candidate.module];
+        for (const ProcessInfo& module : modules)
+        {
+            if (candidate.address >= module.baseAddress && candidate.address - module.baseAddress < module.imageSize)
+            {
+                owner = &module;
+                break;
+            }
+        }
+
+        ModuleScanHit hit;
+        hit.group = groups[g];
+        hit.signature = signatures[candidate.signature].name;
+        hit.moduleName = owner->processName;
+        hit.moduleBase = owner->baseAddress;
+        hit.address = candidate.address;
+        hit.rva = candidate.address - owner->baseAddress;
+        hits.push_back(hit);
+    }
+
+    m_stats.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+    return true;
+}
+
+std::vector<ProcessInfo> ModuleScanner::RankModules(const std::vector<ProcessInfo>& modules, const std::string& mainModuleName)
+{
+    std::vector<std::pair<int, size_t>> order;
+    for (size_t i = 0; i < modules.size(); ++i)
+    {
+        order.emplace_back(GetModuleRelevance(modules[i].processName, EqualsIgnoreCase(modules[i].processName, mainModuleName)), i);
+    }
+    std::sort(order.begin(), order.end());
+
+    std::vector<ProcessInfo> ranked;
+    ranked.reserve(modules.size());
+    for (const auto& [relevance, index] : order)
+    {
+        ranked.push_back(modules[index]);
+    }
+    return ranked;
+}
+
+int ModuleScanner::GetModuleRelevance(const std::string& moduleName, bool mainModule)
+{
+    std::string name = ToLower(moduleName);
+
+    // "<Prefix>-Core.dll", "<Prefix>-CoreUObject-Win64-Shipping.dll", ...
+    for (const char* suffix : CORE_MODULE_SUFFIXES)
+    {
+        size_t length = std::char_traits<char>::length(suffix);
+        for (size_t at = name.find(suffix); at != std::string::npos; at = name.find(suffix, at + 1))
+        {
+            char next = at + length < name.size() ? name[at + length] : '\0';
+            if (next == '.' || next == '-')
+                return 0;
+        }
+    }
+
+    if (mainModule)
+        return 1;
+
+    for (const char* prefix : UE_MODULE_PREFIXES)
+    {
+        if (name.rfind(prefix, 0) == 0)
+            return 2;
+    }
+    if (name.find("-win64-") != std::string::npos)
+        return 2;
+
+    for (const char* prefix : SYSTEM_MODULE_PREFIXES)
+    {
+        if (name.rfind(prefix, 0) == 0)
+            return 4;
+    }
+    for (const char* system : SYSTEM_MODULES)
+    {
+        if (name == system)
+            return 4;
+    }
+    return 3;
+}
@@ -0,0 +1,106 @@
+#pragma once
+
+#include "../DMA/MemoryBackend.h"
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+class DMAManager;
+struct UnrealSignature;
+
+/**
+ * @struct ModuleScanHit
+ * @brief Global found by a signature in one of the loaded modules
+ */
+struct ModuleScanHit
+{
+    std::string group;          ///< Signature group (GWorld, GNames, GObjects)
+    std::string signature;      ///< Variant that matched
+    std::string moduleName;     ///< Module owning the global
+    uint64_t moduleBase = 0;    ///< Base of that module
+    uint64_t address = 0;       ///< Address of the global
+    uint64_t rva = 0;           ///< Address relative to moduleBase
+};
+
+/**
+ * @struct ModuleScanStats
+ * @brief Counters of the last scan
+ */
+struct ModuleScanStats
+{
+    uint64_t modules = 0;           ///< Modules in the ranked list
+    uint64_t modulesScanned = 0;    ///< Modules at least partly read
+    uint64_t bytesRead = 0;         ///< Bytes transferred from the device
+    uint64_t batches = 0;           ///< Scatter batches (device round trips)
+    double seconds = 0.0;           ///< Wall time
+};
+
+/**
+ * @class ModuleScanner
+ * @brief Signature scan over every loaded module of the attached process
+ *
+ * Modular builds keep GNames, GObjects and GWorld in Core, CoreUObject
+ * and Engine DLLs, where a main module scan never looks. The module list
+ * is taken once from the cached module map and ranked (UE core modules,
+ * then the executable, other UE modules, the rest, system DLLs last).
+ * Modules are cut into CHUNK_SIZE pieces that all share one stream of
+ * scatter batches in rank order, so small modules never cost a round trip
+ * of their own. Chunks of a batch are matched on worker threads (started
+ * once per scan) while the next batch is read, and modules ranked behind the one a group was
+ * found in are no longer matched (or read, once every group is found).
+ *
+ * For each group the hit is the one in the best ranked module, then the
+ * earliest variant in the given order, then the lowest offset, so the
+ * result does not depend on thread timing.
+ */
+class ModuleScanner
+{
+public:
+    /**
+     * @brief Constructor
+     * @param dmaManager DMA manager to read through (must outlive the scanner)
+     */
+    explicit ModuleScanner(const DMAManager& dmaManager);
+
+    /**
+     * @brief Scan all modules for the given signatures
+     * @param signatures Variants of one or more groups, likeliest first within each group
+     * @param hits Receives one hit per group that was found
+     * @param error Receives the reason on failure
+     * @return false if the scan could not run or was cancelled
+     */
+    bool Scan(const std::vector<UnrealSignature>& signatures, std::vector<ModuleScanHit>& hits, std::string& error);
+
+    /**
+     * @brief Get counters of the last scan
+     * @return Stats
+     */
+    const ModuleScanStats& GetLastStats() const { return m_stats; }
+
+    /**
+     * @brief Order modules by how likely they hold Unreal globals (stable within a tier)
+     * @param modules Module list
+     * @param mainModuleName Name of the process executable
+     * @return Ranked copy of the list
+     */
+    static std::vector<ProcessInfo> RankModules(const std::vector<ProcessInfo>& modules, const std::string& mainModuleName);
+
+    /**
+     * @brief Get the relevance tier of a module (lower is scanned first)
+     * @param moduleName Module name
+     * @param mainModule Whether it is the process executable
+     * @return 0 UE core module, 1 executable, 2 other UE module, 3 other, 4 system DLL
+     */
+    static int GetModuleRelevance(const std::string& moduleName, bool mainModule);
+
+    static constexpr uint64_t CHUNK_SIZE = 0x100000;        ///< Module bytes owned by one chunk (1 MB)
+    static constexpr uint64_t CHUNK_OVERLAP = 64;           ///< Extra bytes read on both sides (patterns and instruction prefixes crossing chunks)
+    static constexpr uint64_t BATCH_BYTES = 8 * 0x100000;   ///< Bytes per scatter batch
+    static constexpr size_t MAX_BATCH_CHUNKS = 256;         ///< Reads per scatter batch (many small modules)
+    static constexpr uint64_t MAX_MODULE_SIZE = 0x80000000; ///< Sanity limit on a module's image size (2 GB)
+
+private:
+    const DMAManager& m_dmaManager; ///< Device access
+    ModuleScanStats m_stats;        ///< Counters of the last scan
+};
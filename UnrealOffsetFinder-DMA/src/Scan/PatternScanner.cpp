@@ -0,0 +1,178 @@
+#include "PatternScanner.h"
+#include <cstdint>
+#include <cstring>
+#include <sstream>
+
+bool PatternScanner::ParsePattern(const std::string& pattern, std::vector<uint8_t>& bytes, std::string& mask)
+{
+    bytes.clear();
+    mask.clear();
+
+    std::istringstream iss(pattern);
+    std::string token;
+
+    while (iss >> token)
+    {
+        if (token == "??" || token == "?")
+        {
+            // Wildcard byte
+            bytes.push_back(0x00);
+            mask += '?';
+        }
+        else
+        {
+            // Regular hex byte
+            try
+            {
+                unsigned long value = std::stoul(token, nullptr, 16);
+                if (value > 0xFF)
+                {
+                    return false; // Invalid byte value
+                }
+                bytes.push_back(static_cast<uint8_t>(value));
+                mask += 'x';
+            }
+            catch (const std::exception&)
+            {
+                return false; // Invalid hex string
+            }
+        }
+    }
+
+    return !bytes.empty();
+}
+
+size_t PatternScanner::FindPattern(const uint8_t* buffer, size_t bufferSize,
+                                   const std::vector<uint8_t>& pattern, const std::string& mask)
+{
+    if (!buffer || bufferSize == 0 || pattern.empty() || pattern.size() != mask.size())
+    {
+        return SIZE_MAX;
+    }
+
+    if (pattern.size() > bufferSize)
+    {
+        return SIZE_MAX;
+    }
+
+    for (size_t i = 0; i <= bufferSize - pattern.size(); ++i)
+    {
+        bool found = true;
+
+        for (size_t j = 0; j < pattern.size(); ++j)
+        {
+            if (mask[j] == 'x' && buffer[i + j] != pattern[j])
+            {
+                found = false;
+                break;
+            }
+        }
+
+        if (found)
+        {
+            return i;
+        }
+    }
+
+    return SIZE_MAX;
+}
+
+CompiledPattern::CompiledPattern(const std::vector<uint8_t>& pattern, const std::string& mask, const ByteFrequency& frequency)
+    : m_pattern(pattern)
+    , m_mask(mask)
+    , m_anchorOffset(0)
+    , m_anchorLength(0)
+    , m_scanOffset(0)
+    , m_checkOffset(SIZE_MAX)
+    , m_anchorRate(1.0)
+{
+    if (pattern.empty() || pattern.size() != mask.size())
+    {
+        return;
+    }
+
+    // Lowest rate wins; a pair only replaces a single byte when strictly rarer
+    for (size_t j = 0; j < mask.size(); ++j)
+    {
+        if (mask[j] != 'x')
+            continue;
+
+        double rate = frequency.GetByteRate(pattern[j]);
+        if (m_anchorLength == 0 || rate < m_anchorRate)
+        {
+            m_anchorOffset = j;
+            m_anchorLength = 1;
+            m_scanOffset = j;
+            m_checkOffset = SIZE_MAX;
+            m_anchorRate = rate;
+        }
+    }
+
+    for (size_t j = 0; j + 1 < mask.size(); ++j)
+    {
+        if (mask[j] != 'x' || mask[j + 1] != 'x')
+            continue;
+
+        double rate = frequency.GetPairRate(pattern[j], pattern[j + 1]);
+        if (rate < m_anchorRate)
+        {
+            bool firstRarer = frequency.GetByteRate(pattern[j]) <= frequency.GetByteRate(pattern[j + 1]);
+            m_anchorOffset = j;
+            m_anchorLength = 2;
+            m_scanOffset = firstRarer ? j : j + 1;
+            m_checkOffset = firstRarer ? j + 1 : j;
+            m_anchorRate = rate;
+        }
+    }
+}
+
+size_t CompiledPattern::Find(const uint8_t* buffer, size_t bufferSize, uint64_t* candidates) const
+{
+    if (m_anchorLength == 0)
+    {
+        return PatternScanner::FindPattern(buffer, bufferSize, m_pattern, m_mask);
+    }
+
+    if (!buffer || m_pattern.size() > bufferSize)
+    {
+        return SIZE_MAX;
+    }
+
+    // Anchor positions of every possible match start, in increasing order
+    const uint8_t scanByte = m_pattern[m_scanOffset];
+    const uint8_t* cursor = buffer + m_scanOffset;
+    const uint8_t* end = buffer + (bufferSize - m_pattern.size()) + m_scanOffset + 1;
+    while (cursor < end)
+    {
+        const uint8_t* hit = static_cast<const uint8_t*>(std::memchr(cursor, scanByte, static_cast<size_t>(end - cursor)));
+        if (!hit)
+            break;
+
+        const uint8_t* start = hit - m_scanOffset;
+        if (m_checkOffset == SIZE_MAX || start[m_checkOffset] == m_pattern[m_checkOffset])
+        {
+            if (candidates)
+                ++*candidates;
+            if (Verify(start))
+                return static_cast<size_t>(start - buffer);
+        }
+        cursor = hit + 1;
+    }
+
+    return SIZE_MAX;
+}
+
+bool CompiledPattern::Verify(const uint8_t* start) const
+{
+    for (size_t j = m_anchorOffset; j-- > 0;)
+    {
+        if (m_mask[j] == 'x' && start[j] != m_pattern[j])
+            return false;
+    }
+    for (size_t j = m_anchorOffset + m_anchorLength; j < m_pattern.size(); ++j)
+    {
+        if (m_mask[j] == 'x' && start[j] != m_pattern[j])
+            return false;
+    }
+    return true;
+}
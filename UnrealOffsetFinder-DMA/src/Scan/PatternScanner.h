@@ -0,0 +1,107 @@
+#pragma once
+
+#include "ByteFrequency.h"
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+/**
+ * @class PatternScanner
+ * @brief Byte signature parsing and matching over in-memory buffers
+ *
+ * Pure functions with no device access, shared by DMAManager and the
+ * headless tools.
+ */
+class PatternScanner
+{
+public:
+    /**
+     * @brief Parse a signature pattern string into bytes and wildcards
+     * @param pattern Pattern string (e.g., "48 8B 05 ?? ?? ?? ??")
+     * @param bytes Output vector for pattern bytes
+     * @param mask Output string for pattern mask ('x' = match, '?' = wildcard)
+     * @return true if pattern is valid, false otherwise
+     */
+    static bool ParsePattern(const std::string& pattern, std::vector<uint8_t>& bytes, std::string& mask);
+
+    /**
+     * @brief Search for a pattern in a memory buffer (byte-by-byte reference matcher)
+     * @param buffer Memory buffer to search in
+     * @param bufferSize Size of the buffer
+     * @param pattern Pattern bytes to search for
+     * @param mask Pattern mask ('x' = match, '?' = wildcard)
+     * @return Offset within buffer where pattern was found, SIZE_MAX if not found
+     */
+    static size_t FindPattern(const uint8_t* buffer, size_t bufferSize,
+                              const std::vector<uint8_t>& pattern, const std::string& mask);
+};
+
+/**
+ * @class CompiledPattern
+ * @brief Signature prepared for fast matching around its rarest fixed bytes
+ *
+ * Most signatures start with a wildcard or a byte every other instruction
+ * has (0x48, 0x8B, ...), so filtering on the first byte still verifies a
+ * large share of all positions. The compiler instead picks the fixed byte,
+ * or adjacent pair of fixed bytes, with the lowest rate in a ByteFrequency
+ * model as the anchor. Find locates the anchor's rarer byte with memchr,
+ * checks the other byte of a pair, then verifies the rest of the pattern
+ * backwards and forwards from the anchor. Results are identical to
+ * PatternScanner::FindPattern.
+ */
+class CompiledPattern
+{
+public:
+    /**
+     * @brief Constructor
+     * @param pattern Pattern bytes
+     * @param mask Pattern mask ('x' = match, '?' = wildcard)
+     * @param frequency Byte model used to rank anchors
+     */
+    CompiledPattern(const std::vector<uint8_t>& pattern, const std::string& mask,
+                    const ByteFrequency& frequency = ByteFrequency::GetDefault());
+
+    /**
+     * @brief Search for the pattern in a memory buffer
+     * @param buffer Memory buffer to search in
+     * @param bufferSize Size of the buffer
+     * @param candidates Incremented per position that passed the anchor and was verified (optional)
+     * @return Offset of the first match, SIZE_MAX if not found
+     */
+    size_t Find(const uint8_t* buffer, size_t bufferSize, uint64_t* candidates = nullptr) const;
+
+    /**
+     * @brief Get the pattern offset of the anchor's first byte
+     * @return Offset, 0 without a fixed byte
+     */
+    size_t GetAnchorOffset() const { return m_anchorOffset; }
+
+    /**
+     * @brief Get the number of fixed bytes in the anchor
+     * @return 1 or 2, 0 if the pattern is all wildcards (or invalid)
+     */
+    size_t GetAnchorLength() const { return m_anchorLength; }
+
+    /**
+     * @brief Get the expected anchor hits per scanned byte
+     * @return Rate from the model the pattern was compiled with
+     */
+    double GetAnchorRate() const { return m_anchorRate; }
+
+private:
+    /**
+     * @brief Compare every fixed byte except the anchor, backwards then forwards
+     * @param start First byte of the candidate match
+     * @return true if the candidate matches
+     */
+    bool Verify(const uint8_t* start) const;
+
+    std::vector<uint8_t> m_pattern;     ///< Pattern bytes
+    std::string m_mask;                 ///< Pattern mask
+    size_t m_anchorOffset;              ///< First anchor byte within the pattern
+    size_t m_anchorLength;              ///< Fixed bytes in the anchor (0 = none)
+    size_t m_scanOffset;                ///< Anchor byte searched with memchr (the rarer one of a pair)
+    size_t m_checkOffset;               ///< Other byte of a pair anchor, SIZE_MAX for a single byte
+    double m_anchorRate;                ///< Expected anchor hits per byte
+};
@@ -0,0 +1,223 @@
+#include "SignatureIndex.h"
+#include "PatternScanner.h"
+#include "../Core/Gallop.h"
+#include "../Core/Trace.h"
+#include <algorithm>
+#include <thread>
+
+bool SignatureIndex::IsIndexed(const uint8_t* data)
+{
+    return data[0] != data[1] || data[1] != data[2];
+}
+
+uint32_t SignatureIndex::Bucket(const uint8_t* data)
+{
+    uint32_t key = data[0] | data[1] << 8 | static_cast<uint32_t>(data[2]) << 16;
+    return (key * 0x9E3779B1u) >> (32 - BUCKET_BITS);
+}
+
+void SignatureIndex::Clear()
+{
+    m_image.clear();
+    m_image.shrink_to_fit();
+    m_baseAddress = 0;
+    m_missing.clear();
+    m_bucketStarts.clear();
+    m_postings.clear();
+}
+
+void SignatureIndex::Build(std::vector<uint8_t> image, uint64_t baseAddress, std::vector<std::pair<size_t, size_t>> missing)
+{
+    TRACE_SCOPE("BuildSignatureIndex", "scan", "size", image.size());
+
+    Clear();
+    m_image = std::move(image);
+    m_baseAddress = baseAddress;
+    m_missing = std::move(missing);
+    if (m_image.size() > MAX_IMAGE_SIZE)
+    {
+        m_image.resize(MAX_IMAGE_SIZE);
+    }
+
+    // Slices are counted and filled independently; per-slice cursors keep every bucket ascending
+    const size_t grams = m_image.size() >= 3 ? m_image.size() - 2 : 0;
+    const size_t sliceCount = std::clamp<size_t>(std::min<size_t>(std::thread::hardware_concurrency(), grams / MIN_SLICE), 1, 64);
+    std::vector<std::vector<uint32_t>> cursors(sliceCount, std::vector<uint32_t>(BUCKET_COUNT, 0));
+
+    auto runSlices = [&](auto&& work)
+    {
+        std::vector<std::thread> workers;
+        for (size_t slice = 1; slice < sliceCount; ++slice)
+        {
+            workers.emplace_back(work, slice);
+        }
+        work(0);
+        for (auto& thread : workers)
+        {
+            thread.join();
+        }
+    };
+
+    const uint8_t* data = m_image.data();
+    runSlices([&](size_t slice)
+    {
+        std::vector<uint32_t>& counts = cursors[slice];
+        for (size_t i = grams * slice / sliceCount; i < grams * (slice + 1) / sliceCount; ++i)
+        {
+            if (IsIndexed(data + i))
+                counts[Bucket(data + i)]++;
+        }
+    });
+
+    m_bucketStarts.assign(BUCKET_COUNT + 1, 0);
+    uint32_t total = 0;
+    for (uint32_t bucket = 0; bucket < BUCKET_COUNT; ++bucket)
+    {
+        m_bucketStarts[bucket] = total;
+        for (size_t slice = 0; slice < sliceCount; ++slice)
+        {
+            uint32_t count = cursors[slice][bucket];
+            cursors[slice][bucket] = total;
+            total += count;
+        }
+    }
+    m_bucketStarts[BUCKET_COUNT] = total;
+
+    m_postings.resize(total);
+    runSlices([&](size_t slice)
+    {
+        std::vector<uint32_t>& next = cursors[slice];
+        for (size_t i = grams * slice / sliceCount; i < grams * (slice + 1) / sliceCount; ++i)
+        {
+            if (IsIndexed(data + i))
+                m_postings[next[Bucket(data + i)]++] = static_cast<uint32_t>(i);
+        }
+    });
+}
+
+bool SignatureIndex::Matches(size_t offset, const std::vector<uint8_t>& pattern, const std::string& mask) const
+{
+    const uint8_t* data = m_image.data() + offset;
+    for (size_t j = 0; j < pattern.size(); ++j)
+    {
+        if (mask[j] == 'x' && data[j] != pattern[j])
+            return false;
+    }
+    return true;
+}
+
+bool SignatureIndex::Search(const std::vector<uint8_t>& pattern, const std::string& mask, size_t begin, size_t end,
+                            size_t maxResults, std::vector<uint32_t>& results, SignatureQueryStats* stats) const
+{
+    SignatureQueryStats local;
+    SignatureQueryStats& work = stats ? *stats : local;
+    work = SignatureQueryStats();
+    results.clear();
+
+    end = std::min(end, m_image.size());
+    if (pattern.empty() || pattern.size() != mask.size() || begin >= end || end - begin < pattern.size() || maxResults == 0)
+    {
+        return true;
+    }
+    const size_t lastStart = end - pattern.size();
+
+    // Trigrams inside fixed runs, as (bucket, offset within the pattern)
+    std::vector<std::pair<uint32_t, size_t>> grams;
+    for (size_t j = 0; j + 3 <= pattern.size(); ++j)
+    {
+        if (mask.compare(j, 3, "xxx") == 0 && IsIndexed(pattern.data() + j))
+            grams.emplace_back(Bucket(pattern.data() + j), j);
+    }
+
+    if (grams.empty() || m_bucketStarts.empty())
+    {
+        CompiledPattern compiled(pattern, mask);
+        for (size_t position = begin; position <= lastStart;)
+        {
+            size_t found = compiled.Find(m_image.data() + position, end - position, &work.candidates);
+            if (found == SIZE_MAX)
+                break;
+
+            results.push_back(static_cast<uint32_t>(position + found));
+            if (results.size() >= maxResults)
+                return false;
+            position += found + 1;
+        }
+        return true;
+    }
+
+    // Much longer lists cost more to skip through than verifying the candidates does
+    auto listSize = [this](uint32_t bucket) { return m_bucketStarts[bucket + 1] - m_bucketStarts[bucket]; };
+    std::sort(grams.begin(), grams.end(), [&](const auto& a, const auto& b)
+    {
+        return listSize(a.first) != listSize(b.first) ? listSize(a.first) < listSize(b.first) : a.second < b.second;
+    });
+    size_t keep = 1;
+    while (keep < grams.size() && keep < MAX_INTERSECTED && listSize(grams[keep].first) <= listSize(grams[0].first) * INTERSECT_RATIO)
+    {
+        keep++;
+    }
+    grams.resize(keep);
+    work.indexed = true;
+    work.lists = static_cast<uint32_t>(keep);
+
+    // Walk the shortest list; the others only move forward, so each is passed once
+    std::vector<const uint32_t*> cursors;
+    for (const auto& gram : grams)
+    {
+        cursors.push_back(m_postings.data() + m_bucketStarts[gram.first]);
+    }
+
+    const uint32_t* last = m_postings.data() + m_bucketStarts[grams[0].first + 1];
+    const size_t anchor = grams[0].second;
+    for (const uint32_t* posting = Gallop(cursors[0], last, static_cast<uint32_t>(begin + anchor)); posting != last; ++posting)
+    {
+        work.postings++;
+        const size_t start = *posting - anchor;
+        if (start > lastStart)
+            break;
+
+        bool agreed = true;
+        for (size_t k = 1; k < grams.size() && agreed; ++k)
+        {
+            const uint32_t* listEnd = m_postings.data() + m_bucketStarts[grams[k].first + 1];
+            cursors[k] = Gallop(cursors[k], listEnd, static_cast<uint32_t>(start + grams[k].second));
+            agreed = cursors[k] != listEnd && *cursors[k] == start + grams[k].second;
+        }
+        if (!agreed)
+            continue;
+
+        work.candidates++;
+        if (Matches(start, pattern, mask))
+        {
+            results.push_back(static_cast<uint32_t>(start));
+            if (results.size() >= maxResults)
+                return false;
+        }
+    }
+    return true;
+}
+
+bool SignatureIndex::IsCaptured(size_t begin, size_t end) const
+{
+    // First missing range ending after begin
+    auto it = std::upper_bound(m_missing.begin(), m_missing.end(), begin,
+                               [](size_t offset, const std::pair<size_t, size_t>& range) { return offset < range.second; });
+    return it == m_missing.end() || it->first >= end;
+}
+
+uint64_t SignatureIndex::GetMissingBytes() const
+{
+    uint64_t bytes = 0;
+    for (const auto& range : m_missing)
+    {
+        bytes += range.second - range.first;
+    }
+    return bytes;
+}
+
+uint64_t SignatureIndex::GetMemoryBytes() const
+{
+    return m_image.capacity() + (m_bucketStarts.capacity() + m_postings.capacity()) * sizeof(uint32_t) +
+           m_missing.capacity() * sizeof(m_missing[0]);
+}
@@ -0,0 +1,156 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * @struct SignatureQueryStats
+ * @brief Work done by one SignatureIndex query
+ */
+struct SignatureQueryStats
+{
+    bool indexed = false;       ///< Answered from postings (false: no indexable trigram, linear scan of the image)
+    uint32_t lists = 0;         ///< Posting lists intersected
+    uint64_t postings = 0;      ///< Postings of the shortest list walked
+    uint64_t candidates = 0;    ///< Positions verified against the full pattern
+};
+
+/**
+ * @class SignatureIndex
+ * @brief Trigram postings over a captured module image for repeated signature queries
+ *
+ * Build() takes a copy of the module and records, for every 3-byte n-gram,
+ * the offsets it occurs at (hashed into BUCKET_COUNT buckets, postings
+ * stored back to back in ascending order). The image is split into slices
+ * that are counted and filled on worker threads. Runs of one repeated byte
+ * (zero fill, int3 padding) are not indexed; they are the bulk of the
+ * postings and say nothing about a match.
+ *
+ * A query takes the trigrams fully inside the pattern's fixed runs, walks
+ * the shortest posting list, keeps positions every other chosen list agrees
+ * on and verifies the survivors against the image; hash collisions only
+ * cost a verification. Patterns without an indexable trigram (no fixed run
+ * of three bytes) fall back to a linear scan of the cached image.
+ *
+ * Pages that could not be captured are recorded as missing ranges; callers
+ * check IsCaptured() and read ranges touching them from the device instead.
+ *
+ * The index is a snapshot: code patched in memory after Build() is not seen.
+ */
+class SignatureIndex
+{
+public:
+    /**
+     * @brief Index a module image (replaces the previous contents)
+     * @param image Module bytes (moved into the index, which answers queries from it)
+     * @param baseAddress Virtual address of image[0]
+     * @param missing Image ranges [begin, end) that could not be read, ascending and disjoint
+     */
+    void Build(std::vector<uint8_t> image, uint64_t baseAddress, std::vector<std::pair<size_t, size_t>> missing = {});
+
+    /**
+     * @brief Remove the image and postings
+     */
+    void Clear();
+
+    /**
+     * @brief Find matches of a pattern
+     * @param pattern Pattern bytes
+     * @param mask Pattern mask ('x' = match, '?' = wildcard)
+     * @param begin First image offset a match may start at
+     * @param end Image offset every match must end before (clamped to the image)
+     * @param maxResults Stop after this many results
+     * @param results Receives the image offsets of the matches in ascending order
+     * @param stats Receives the work done (optional)
+     * @return true if every match was returned, false if the search stopped at maxResults
+     */
+    bool Search(const std::vector<uint8_t>& pattern, const std::string& mask, size_t begin, size_t end,
+                size_t maxResults, std::vector<uint32_t>& results, SignatureQueryStats* stats = nullptr) const;
+
+    /**
+     * @brief Get the virtual address the image was captured at
+     * @return Base address
+     */
+    uint64_t GetBaseAddress() const { return m_baseAddress; }
+
+    /**
+     * @brief Get the size of the captured image
+     * @return Bytes
+     */
+    size_t GetImageSize() const { return m_image.size(); }
+
+    /**
+     * @brief Get the captured image (unread pages are zero)
+     * @return Module bytes
+     */
+    const std::vector<uint8_t>& GetImage() const { return m_image; }
+
+    /**
+     * @brief Check that a range of the image was read in full
+     * @param begin First image offset
+     * @param end Image offset after the range
+     * @return true if no missing range overlaps [begin, end)
+     */
+    bool IsCaptured(size_t begin, size_t end) const;
+
+    /**
+     * @brief Get the number of image bytes that could not be read
+     * @return Bytes in missing ranges
+     */
+    uint64_t GetMissingBytes() const;
+
+    /**
+     * @brief Get the memory held by the index, image included
+     * @return Allocated bytes
+     */
+    uint64_t GetMemoryBytes() const;
+
+    static constexpr uint32_t BUCKET_BITS = 20;                     ///< log2 of the trigram buckets
+    static constexpr uint32_t BUCKET_COUNT = 1u << BUCKET_BITS;     ///< Trigram buckets
+    static constexpr size_t MAX_INTERSECTED = 4;                    ///< Posting lists intersected per query
+    static constexpr uint32_t INTERSECT_RATIO = 8;                  ///< Longest list intersected, relative to the shortest
+    static constexpr size_t MIN_SLICE = 0x100000;                   ///< Smallest image slice given to a build thread (1 MB)
+
+    /**
+     * @brief Largest image indexed (offsets are stored in 32 bits)
+     *
+     * Memory is the image plus a 4-byte posting for nearly every image byte
+     * and 4 MB of bucket starts: about 5x the module, e.g. 152 MB for a
+     * 32 MB image. Postings stay uncompressed so queries can gallop through
+     * them; GetMemoryBytes() reports the actual figure.
+     */
+    static constexpr size_t MAX_IMAGE_SIZE = 0xFFFFFFFF;
+
+private:
+    /**
+     * @brief Check if the trigram at an image offset is posted
+     * @param data Pointer to the first byte
+     * @return false for a run of one repeated byte
+     */
+    static bool IsIndexed(const uint8_t* data);
+
+    /**
+     * @brief Hash three bytes into a bucket
+     * @param data Pointer to the first byte
+     * @return Bucket index
+     */
+    static uint32_t Bucket(const uint8_t* data);
+
+    /**
+     * @brief Compare every fixed byte of a pattern at an image offset
+     * @param offset Image offset of the candidate (pattern must fit)
+     * @param pattern Pattern bytes
+     * @param mask Pattern mask
+     * @return true if the pattern matches there
+     */
+    bool Matches(size_t offset, const std::vector<uint8_t>& pattern, const std::string& mask) const;
+
+    std::vector<uint8_t> m_image;               ///< Captured module bytes
+    uint64_t m_baseAddress = 0;                 ///< Virtual address of m_image[0]
+    std::vector<std::pair<size_t, size_t>> m_missing;   ///< Unread image ranges [begin, end), ascending
+    std::vector<uint32_t> m_bucketStarts;       ///< First posting of each bucket, plus the end of the last one
+    std::vector<uint32_t> m_postings;           ///< Image offsets per bucket, ascending
+};
@@ -0,0 +1,887 @@
+#include "ValueScanner.h"
+#include "../DMA/DMAManager.h"
+#include "../Core/TaskExecutor.h"
+#include "../Core/Trace.h"
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <cstring>
+#include <iomanip>
+#include <sstream>
+
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64)
+#include <emmintrin.h>
+#define UOF_VALUE_SCAN_SSE2 1
+#endif
+
+namespace
+{
+    const char* const TYPE_NAMES[] = { "int32", "int64", "float", "double", "pointer" };
+    const char* const COMPARE_NAMES[] = { "Exact", "Range", "Unknown", "Changed", "Unchanged", "Increased", "Decreased" };
+
+    /**
+     * @struct ScalarLanes
+     * @brief One value per step: 64-bit integers and the tails of the SIMD loops
+     *
+     * Lanes types provide Load/Broadcast and comparisons returning one bit per lane.
+     */
+    template<typename T>
+    struct ScalarLanes
+    {
+        using Value = T;
+        using Vector = T;
+        static constexpr size_t WIDTH = 1;
+
+        static Vector Load(const uint8_t* data) { T value; std::memcpy(&value, data, sizeof(T)); return value; }
+        static Vector Broadcast(T value) { return value; }
+        static uint32_t Equal(Vector a, Vector b) { return a == b ? 1u : 0u; }
+        static uint32_t Greater(Vector a, Vector b) { return a > b ? 1u : 0u; }
+    };
+
+#ifdef UOF_VALUE_SCAN_SSE2
+    // SSE2 is the x86-64 baseline; it has no 64-bit integer compare, so int64/pointer stay scalar
+    struct Int32Lanes
+    {
+        using Value = int32_t;
+        using Vector = __m128i;
+        static constexpr size_t WIDTH = 4;
+
+        static Vector Load(const uint8_t* data) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(data)); }
+        static Vector Broadcast(Value value) { return _mm_set1_epi32(value); }
+        static uint32_t Equal(Vector a, Vector b) { return _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(a, b))); }
+        static uint32_t Greater(Vector a, Vector b) { return _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpgt_epi32(a, b))); }
+    };
+
+    struct FloatLanes
+    {
+        using Value = float;
+        using Vector = __m128;
+        static constexpr size_t WIDTH = 4;
+
+        static Vector Load(const uint8_t* data) { return _mm_loadu_ps(reinterpret_cast<const float*>(data)); }
+        static Vector Broadcast(Value value) { return _mm_set1_ps(value); }
+        static uint32_t Equal(Vector a, Vector b) { return _mm_movemask_ps(_mm_cmpeq_ps(a, b)); }
+        static uint32_t Greater(Vector a, Vector b) { return _mm_movemask_ps(_mm_cmpgt_ps(a, b)); }
+    };
+
+    struct DoubleLanes
+    {
+        using Value = double;
+        using Vector = __m128d;
+        static constexpr size_t WIDTH = 2;
+
+        static Vector Load(const uint8_t* data) { return _mm_loadu_pd(reinterpret_cast<const double*>(data)); }
+        static Vector Broadcast(Value value) { return _mm_set1_pd(value); }
+        static uint32_t Equal(Vector a, Vector b) { return _mm_movemask_pd(_mm_cmpeq_pd(a, b)); }
+        static uint32_t Greater(Vector a, Vector b) { return _mm_movemask_pd(_mm_cmpgt_pd(a, b)); }
+    };
+#else
+    using Int32Lanes = ScalarLanes<int32_t>;
+    using FloatLanes = ScalarLanes<float>;
+    using DoubleLanes = ScalarLanes<double>;
+#endif
+
+    /// Match bits of one step; previous is only read by the compare modes that need it
+    template<ScanCompare C, typename Lanes>
+    inline uint32_t MatchLanes(typename Lanes::Vector current, const uint8_t* previous,
+                               typename Lanes::Vector low, typename Lanes::Vector high)
+    {
+        constexpr uint32_t ALL = (1u << Lanes::WIDTH) - 1;
+
+        if constexpr (C == ScanCompare::Exact)
+            return Lanes::Equal(current, low);
+        else if constexpr (C == ScanCompare::Range)
+            // Equal(x, x) rejects NaN, which compares false both ways
+            return ~(Lanes::Greater(low, current) | Lanes::Greater(current, high)) & Lanes::Equal(current, current) & ALL;
+        else if constexpr (C == ScanCompare::Unknown)
+            return ALL;
+        else if constexpr (C == ScanCompare::Changed)
+            return ~Lanes::Equal(current, Lanes::Load(previous)) & ALL;
+        else if constexpr (C == ScanCompare::Unchanged)
+            return Lanes::Equal(current, Lanes::Load(previous));
+        else if constexpr (C == ScanCompare::Increased)
+            return Lanes::Greater(current, Lanes::Load(previous));
+        else
+            return Lanes::Greater(Lanes::Load(previous), current);
+    }
+
+    template<ScanCompare C, typename Lanes>
+    void CompareKernel(const uint8_t* current, const uint8_t* previous, size_t count,
+                       typename Lanes::Value low, typename Lanes::Value high, uint64_t* mask)
+    {
+        using Value = typename Lanes::Value;
+        using Scalar = ScalarLanes<Value>;
+        constexpr size_t SIZE = sizeof(Value);
+        constexpr bool READS_PREVIOUS = C >= ScanCompare::Changed;
+
+        // WIDTH divides 64, so a step never straddles two mask words
+        auto lowVector = Lanes::Broadcast(low);
+        auto highVector = Lanes::Broadcast(high);
+        size_t i = 0;
+        for (; i + Lanes::WIDTH <= count; i += Lanes::WIDTH)
+        {
+            const uint8_t* previousAt = READS_PREVIOUS ? previous + i * SIZE : nullptr;
+            uint32_t bits = MatchLanes<C, Lanes>(Lanes::Load(current + i * SIZE), previousAt, lowVector, highVector);
+            mask[i / 64] |= static_cast<uint64_t>(bits) << (i % 64);
+        }
+        for (; i < count; ++i)
+        {
+            const uint8_t* previousAt = READS_PREVIOUS ? previous + i * SIZE : nullptr;
+            uint32_t bits = MatchLanes<C, Scalar>(Scalar::Load(current + i * SIZE), previousAt, low, high);
+            mask[i / 64] |= static_cast<uint64_t>(bits) << (i % 64);
+        }
+    }
+
+    template<typename Lanes>
+    void DispatchCompare(ScanCompare compare, const uint8_t* current, const uint8_t* previous, size_t count,
+                         uint64_t value, uint64_t upper, uint64_t* mask)
+    {
+        using Value = typename Lanes::Value;
+        Value low;
+        Value high;
+        std::memcpy(&low, &value, sizeof(Value));
+        std::memcpy(&high, &upper, sizeof(Value));
+
+        switch (compare)
+        {
+        case ScanCompare::Exact:     CompareKernel<ScanCompare::Exact, Lanes>(current, previous, count, low, high, mask); break;
+        case ScanCompare::Range:     CompareKernel<ScanCompare::Range, Lanes>(current, previous, count, low, high, mask); break;
+        case ScanCompare::Unknown:   CompareKernel<ScanCompare::Unknown, Lanes>(current, previous, count, low, high, mask); break;
+        case ScanCompare::Changed:   CompareKernel<ScanCompare::Changed, Lanes>(current, previous, count, low, high, mask); break;
+        case ScanCompare::Unchanged: CompareKernel<ScanCompare::Unchanged, Lanes>(current, previous, count, low, high, mask); break;
+        case ScanCompare::Increased: CompareKernel<ScanCompare::Increased, Lanes>(current, previous, count, low, high, mask); break;
+        case ScanCompare::Decreased: CompareKernel<ScanCompare::Decreased, Lanes>(current, previous, count, low, high, mask); break;
+        default: break;
+        }
+    }
+
+    void AppendVarint(std::vector<uint8_t>& out, uint64_t value)
+    {
+        while (value >= 0x80)
+        {
+            out.push_back(static_cast<uint8_t>(value) | 0x80);
+            value >>= 7;
+        }
+        out.push_back(static_cast<uint8_t>(value));
+    }
+
+    uint64_t ReadVarint(const uint8_t*& cursor)
+    {
+        uint64_t value = 0;
+        for (int shift = 0; ; shift += 7)
+        {
+            uint8_t byte = *cursor++;
+            value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+            if ((byte & 0x80) == 0)
+                return value;
+        }
+    }
+
+    /**
+     * @struct ReadChunk
+     * @brief Piece of a region read by a first scan
+     */
+    struct ReadChunk
+    {
+        size_t region;      ///< Region index
+        uint64_t offset;    ///< Offset within the region (multiple of CHUNK_SIZE)
+    };
+
+    /**
+     * @struct ReadSpan
+     * @brief Pages holding consecutive candidates of one block, read by a next scan
+     */
+    struct ReadSpan
+    {
+        size_t block;               ///< Block index
+        uint64_t address;           ///< First byte read
+        uint64_t size;              ///< Bytes read
+        size_t firstSlot;           ///< Index of the span's first candidate in the batch slot list
+        size_t slotCount;           ///< Candidates in the span
+        uint64_t firstCandidate;    ///< Candidate index of the first one within its block
+    };
+
+    std::string FormatMegabytes(uint64_t bytes)
+    {
+        std::ostringstream ss;
+        ss << std::fixed << std::setprecision(1) << static_cast<double>(bytes) / (1024.0 * 1024.0) << " MB";
+        return ss.str();
+    }
+
+    /// Trim, then pick base 16 for a 0x prefix (after an optional sign)
+    std::string PrepareNumber(const std::string& text, int& base)
+    {
+        size_t first = text.find_first_not_of(" \t");
+        size_t last = text.find_last_not_of(" \t");
+        std::string trimmed = first == std::string::npos ? "" : text.substr(first, last - first + 1);
+        size_t digits = (!trimmed.empty() && (trimmed[0] == '-' || trimmed[0] == '+')) ? 1 : 0;
+        base = (trimmed.size() > digits + 1 && trimmed[digits] == '0' && (trimmed[digits + 1] == 'x' || trimmed[digits + 1] == 'X')) ? 16 : 10;
+        return trimmed;
+    }
+}
+
+ValueScanner::ValueScanner(const DMAManager& dmaManager)
+    : m_dmaManager(dmaManager)
+    , m_type(ScanValueType::Int32)
+    , m_hasScan(false)
+    , m_memoryLimit(DEFAULT_MEMORY_LIMIT)
+{
+}
+
+ValueScanner::BlockBuilder::BlockBuilder(uint64_t base, uint64_t slotCount, size_t valueSize)
+    : m_valueSize(valueSize)
+    , m_nextSlot(0)
+{
+    m_block.base = base;
+    m_block.slotCount = slotCount;
+}
+
+void ValueScanner::BlockBuilder::Add(uint64_t slot, const uint8_t* value)
+{
+    if (m_block.bitmap.empty())
+    {
+        AppendVarint(m_block.deltas, slot - m_nextSlot);
+
+        // Switch once the list outgrows a bitmap of the whole region
+        size_t words = static_cast<size_t>((m_block.slotCount + 63) / 64);
+        if (m_block.deltas.size() > words * sizeof(uint64_t))
+        {
+            m_block.bitmap.assign(words, 0);
+            const uint8_t* cursor = m_block.deltas.data();
+            const uint8_t* end = cursor + m_block.deltas.size();
+            for (uint64_t current = 0; cursor < end; ++current)
+            {
+                current += ReadVarint(cursor);
+                m_block.bitmap[current / 64] |= 1ull << (current % 64);
+            }
+            m_block.deltas.clear();
+            m_block.deltas.shrink_to_fit();
+        }
+    }
+    else
+    {
+        m_block.bitmap[slot / 64] |= 1ull << (slot % 64);
+    }
+
+    m_block.values.insert(m_block.values.end(), value, value + m_valueSize);
+    m_block.count++;
+    m_nextSlot = slot + 1;
+}
+
+ValueScanner::CandidateBlock ValueScanner::BlockBuilder::Finish()
+{
+    m_block.deltas.shrink_to_fit();
+    m_block.values.shrink_to_fit();
+    return std::move(m_block);
+}
+
+template<typename Visitor>
+void ValueScanner::ForEachCandidate(const CandidateBlock& block, Visitor&& visit)
+{
+    uint64_t index = 0;
+    if (!block.bitmap.empty())
+    {
+        for (size_t word = 0; word < block.bitmap.size(); ++word)
+        {
+            for (uint64_t bits = block.bitmap[word]; bits != 0; bits &= bits - 1)
+            {
+                if (!visit(word * 64 + std::countr_zero(bits), index++))
+                    return;
+            }
+        }
+        return;
+    }
+
+    const uint8_t* cursor = block.deltas.data();
+    const uint8_t* end = cursor + block.deltas.size();
+    for (uint64_t slot = 0; cursor < end; ++slot)
+    {
+        slot += ReadVarint(cursor);
+        if (!visit(slot, index++))
+            return;
+    }
+}
+
+bool ValueScanner::FirstScan(const ValueScanQuery& query, std::string& error)
+{
+    std::lock_guard<std::mutex> scanLock(m_scanMutex);
+    TRACE_SCOPE("ValueFirstScan", "scan", GetTypeName(query.type));
+
+    if (query.type >= ScanValueType::Count || query.compare >= ScanCompare::Count)
+    {
+        error = "Invalid scan parameters";
+        return false;
+    }
+    if (NeedsPreviousValues(query.compare))
+    {
+        error = std::string(GetCompareName(query.compare)) + " needs a previous scan; start with Exact, Range or Unknown";
+        return false;
+    }
+    if (!m_dmaManager.IsConnected())
+    {
+        error = "Not connected to any process";
+        return false;
+    }
+
+    auto startTime = std::chrono::steady_clock::now();
+    const size_t valueSize = GetTypeSize(query.type);
+
+    std::vector<MemoryRegion> regions = m_dmaManager.GetMemoryRegions();
+    std::erase_if(regions, [&](const MemoryRegion& region)
+    {
+        return region.size < valueSize || (query.writableOnly && !region.writable);
+    });
+    if (regions.empty())
+    {
+        error = "No readable memory regions to scan";
+        return false;
+    }
+
+    uint64_t totalBytes = 0;
+    for (const auto& region : regions)
+    {
+        totalBytes += region.size;
+    }
+
+    ValueScanStats stats;
+    std::vector<CandidateBlock> blocks;
+    std::unique_ptr<BlockBuilder> builder;
+    size_t builderRegion = SIZE_MAX;
+    uint64_t finishedBytes = 0;
+
+    auto finishBlock = [&]()
+    {
+        if (builder)
+        {
+            CandidateBlock block = builder->Finish();
+            if (block.count > 0)
+            {
+                finishedBytes += block.GetStorageBytes();
+                stats.candidates += block.count;
+                blocks.push_back(std::move(block));
+            }
+            builder.reset();
+        }
+    };
+
+    std::vector<uint8_t> buffer(BATCH_BYTES);
+    std::vector<uint64_t> mask((CHUNK_SIZE / sizeof(uint32_t) + 63) / 64);
+    std::vector<ScatterRead> requests;
+    std::vector<ReadChunk> chunks;
+    size_t regionIndex = 0;
+    uint64_t regionOffset = 0;
+    uint64_t scannedBytes = 0;
+
+    while (regionIndex < regions.size())
+    {
+        if (TaskExecutor::IsCurrentTaskCancelled())
+        {
+            error = "Scan cancelled";
+            return false;
+        }
+
+        // Consecutive chunks of one or more regions in a single batch
+        requests.clear();
+        chunks.clear();
+        uint64_t batchBytes = 0;
+        while (regionIndex < regions.size() && requests.size() < MAX_BATCH_ENTRIES)
+        {
+            const MemoryRegion& region = regions[regionIndex];
+            uint64_t size = std::min(CHUNK_SIZE, region.size - regionOffset);
+            if (batchBytes + size > BATCH_BYTES)
+                break;
+
+            requests.emplace_back(region.baseAddress + regionOffset, buffer.data() + batchBytes, static_cast<size_t>(size));
+            chunks.push_back({ regionIndex, regionOffset });
+            batchBytes += size;
+            regionOffset += size;
+            if (regionOffset >= region.size)
+            {
+                regionIndex++;
+                regionOffset = 0;
+            }
+        }
+
+        m_dmaManager.ReadMemoryBatch(requests);
+        stats.batches++;
+
+        for (size_t i = 0; i < requests.size(); ++i)
+        {
+            const ScatterRead& request = requests[i];
+            const ReadChunk& chunk = chunks[i];
+            if (chunk.region != builderRegion)
+            {
+                finishBlock();
+                const MemoryRegion& region = regions[chunk.region];
+                builder = std::make_unique<BlockBuilder>(region.baseAddress, region.size / valueSize, valueSize);
+                builderRegion = chunk.region;
+            }
+
+            stats.bytesRead += request.bytesRead;
+            size_t count = request.bytesRead / valueSize;
+            if (count == 0)
+                continue;
+
+            const uint8_t* data = static_cast<const uint8_t*>(request.buffer);
+            size_t words = (count + 63) / 64;
+            std::fill_n(mask.begin(), words, 0);
+            CompareValues(query.type, query.compare, data, nullptr, count, query.value, query.upper, mask.data());
+
+            uint64_t firstSlot = chunk.offset / valueSize;
+            for (size_t word = 0; word < words; ++word)
+            {
+                for (uint64_t bits = mask[word]; bits != 0; bits &= bits - 1)
+                {
+                    size_t index = word * 64 + std::countr_zero(bits);
+                    builder->Add(firstSlot + index, data + index * valueSize);
+                }
+            }
+        }
+
+        if (!CheckMemoryLimit(finishedBytes + (builder ? builder->GetStorageBytes() : 0), error))
+        {
+            return false;
+        }
+
+        scannedBytes += batchBytes;
+        TaskExecutor::ReportProgress(static_cast<float>(scannedBytes) / static_cast<float>(totalBytes),
+            "Scanned " + FormatMegabytes(scannedBytes) + " of " + FormatMegabytes(totalBytes));
+    }
+    finishBlock();
+
+    stats.regions = regions.size();
+    stats.storageBytes = finishedBytes;
+    stats.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+    Publish(std::move(blocks), query.type, stats);
+    return true;
+}
+
+bool ValueScanner::NextScan(const ValueScanQuery& query, std::string& error)
+{
+    std::lock_guard<std::mutex> scanLock(m_scanMutex);
+    TRACE_SCOPE("ValueNextScan", "scan", GetCompareName(query.compare));
+
+    std::shared_ptr<const std::vector<CandidateBlock>> previous;
+    uint64_t previousCount = 0;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (!m_hasScan)
+        {
+            error = "Run a first scan before a next scan";
+            return false;
+        }
+        if (query.type != m_type)
+        {
+            error = std::string("Value type must match the first scan (") + GetTypeName(m_type) + ")";
+            return false;
+        }
+        previous = m_blocks;
+        previousCount = m_stats.candidates;
+    }
+    if (query.compare >= ScanCompare::Count)
+    {
+        error = "Invalid scan parameters";
+        return false;
+    }
+    if (!m_dmaManager.IsConnected())
+    {
+        error = "Not connected to any process";
+        return false;
+    }
+
+    auto startTime = std::chrono::steady_clock::now();
+    const size_t valueSize = GetTypeSize(query.type);
+
+    ValueScanStats stats;
+    std::vector<CandidateBlock> blocks;
+    std::unique_ptr<BlockBuilder> builder;
+    size_t builderBlock = SIZE_MAX;
+    uint64_t finishedBytes = 0;
+
+    auto finishBlock = [&]()
+    {
+        if (builder)
+        {
+            CandidateBlock block = builder->Finish();
+            if (block.count > 0)
+            {
+                finishedBytes += block.GetStorageBytes();
+                stats.candidates += block.count;
+                blocks.push_back(std::move(block));
+            }
+            builder.reset();
+        }
+    };
+
+    std::vector<uint8_t> buffer(BATCH_BYTES);
+    std::vector<ScatterRead> requests;
+    std::vector<ReadSpan> spans;
+    std::vector<uint64_t> slots;
+    std::vector<uint8_t> current;
+    std::vector<uint64_t> mask;
+    uint64_t batchBytes = 0;
+    uint64_t processedCandidates = 0;
+
+    // Read the batched spans and filter their candidates against the previous values
+    auto processBatch = [&]() -> bool
+    {
+        if (spans.empty())
+            return true;
+        if (TaskExecutor::IsCurrentTaskCancelled())
+        {
+            error = "Scan cancelled";
+            return false;
+        }
+
+        requests.clear();
+        uint64_t offset = 0;
+        for (const auto& span : spans)
+        {
+            requests.emplace_back(span.address, buffer.data() + offset, static_cast<size_t>(span.size));
+            offset += span.size;
+        }
+        m_dmaManager.ReadMemoryBatch(requests);
+        stats.batches++;
+
+        for (size_t s = 0; s < spans.size(); ++s)
+        {
+            const ReadSpan& span = spans[s];
+            const ScatterRead& request = requests[s];
+            const CandidateBlock& block = (*previous)[span.block];
+            if (span.block != builderBlock)
+            {
+                finishBlock();
+                builder = std::make_unique<BlockBuilder>(block.base, block.slotCount, valueSize);
+                builderBlock = span.block;
+            }
+            stats.bytesRead += request.bytesRead;
+
+            // Gather the current values next to the packed previous ones; candidates past the bytes read drop out
+            const uint8_t* data = static_cast<const uint8_t*>(request.buffer);
+            current.resize(span.slotCount * valueSize);
+            size_t readable = 0;
+            for (; readable < span.slotCount; ++readable)
+            {
+                uint64_t valueOffset = block.base + slots[span.firstSlot + readable] * valueSize - span.address;
+                if (valueOffset + valueSize > request.bytesRead)
+                    break;
+                std::memcpy(current.data() + readable * valueSize, data + valueOffset, valueSize);
+            }
+            if (readable == 0)
+                continue;
+
+            size_t words = (readable + 63) / 64;
+            mask.assign(words, 0);
+            CompareValues(query.type, query.compare, current.data(), block.values.data() + span.firstCandidate * valueSize,
+                          readable, query.value, query.upper, mask.data());
+
+            for (size_t word = 0; word < words; ++word)
+            {
+                for (uint64_t bits = mask[word]; bits != 0; bits &= bits - 1)
+                {
+                    size_t index = word * 64 + std::countr_zero(bits);
+                    builder->Add(slots[span.firstSlot + index], current.data() + index * valueSize);
+                }
+            }
+        }
+
+        processedCandidates += slots.size();
+        spans.clear();
+        slots.clear();
+        batchBytes = 0;
+
+        TaskExecutor::ReportProgress(previousCount ? static_cast<float>(processedCandidates) / static_cast<float>(previousCount) : 1.0f,
+            "Checked " + std::to_string(processedCandidates) + " of " + std::to_string(previousCount) + " candidates");
+        return CheckMemoryLimit(finishedBytes + (builder ? builder->GetStorageBytes() : 0), error);
+    };
+
+    bool failed = false;
+    for (size_t b = 0; b < previous->size() && !failed; ++b)
+    {
+        const CandidateBlock& block = (*previous)[b];
+        const uint64_t regionEnd = block.base + block.slotCount * valueSize;
+
+        // Coalesce the pages of nearby candidates into spans of up to CHUNK_SIZE
+        ForEachCandidate(block, [&](uint64_t slot, uint64_t index)
+        {
+            uint64_t address = block.base + slot * valueSize;
+            uint64_t pageStart = std::max(address & ~(PAGE_SIZE - 1), block.base);
+            uint64_t pageEnd = std::min((address + valueSize + PAGE_SIZE - 1) & ~(PAGE_SIZE - 1), regionEnd);
+
+            bool extend = false;
+            if (!spans.empty() && spans.back().block == b && pageStart <= spans.back().address + spans.back().size)
+            {
+                uint64_t size = std::max(spans.back().size, pageEnd - spans.back().address);
+                uint64_t growth = size - spans.back().size;
+                if (size <= CHUNK_SIZE && batchBytes + growth <= BATCH_BYTES)
+                {
+                    spans.back().size = size;
+                    batchBytes += growth;
+                    extend = true;
+                }
+            }
+
+            if (!extend)
+            {
+                uint64_t size = pageEnd - pageStart;
+                if (spans.size() >= MAX_BATCH_ENTRIES || batchBytes + size > BATCH_BYTES)
+                {
+                    if (!processBatch())
+                    {
+                        failed = true;
+                        return false;
+                    }
+                }
+                spans.push_back({ b, pageStart, size, slots.size(), 0, index });
+                batchBytes += size;
+            }
+
+            slots.push_back(slot);
+            spans.back().slotCount++;
+            return true;
+        });
+    }
+
+    if (failed || !processBatch())
+    {
+        return false;
+    }
+    finishBlock();
+
+    stats.regions = blocks.size();
+    stats.storageBytes = finishedBytes;
+    stats.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+    Publish(std::move(blocks), query.type, stats);
+    return true;
+}
+
+void ValueScanner::Reset()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_blocks.reset();
+    m_hasScan = false;
+    m_stats = ValueScanStats();
+}
+
+bool ValueScanner::HasScan() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_hasScan;
+}
+
+ScanValueType ValueScanner::GetValueType() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_type;
+}
+
+uint64_t ValueScanner::GetCandidateCount() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_stats.candidates;
+}
+
+std::vector<ValueScanResult> ValueScanner::GetResults(size_t maxCount) const
+{
+    std::shared_ptr<const std::vector<CandidateBlock>> blocks;
+    ScanValueType type;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        blocks = m_blocks;
+        type = m_type;
+    }
+
+    std::vector<ValueScanResult> results;
+    if (!blocks)
+    {
+        return results;
+    }
+
+    const size_t valueSize = GetTypeSize(type);
+    for (const auto& block : *blocks)
+    {
+        ForEachCandidate(block, [&](uint64_t slot, uint64_t index)
+        {
+            if (results.size() >= maxCount)
+                return false;
+
+            uint64_t raw = 0;
+            std::memcpy(&raw, block.values.data() + index * valueSize, valueSize);
+            results.push_back({ block.base + slot * valueSize, raw });
+            return true;
+        });
+
+        if (results.size() >= maxCount)
+            break;
+    }
+    return results;
+}
+
+ValueScanStats ValueScanner::GetLastStats() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_stats;
+}
+
+void ValueScanner::SetMemoryLimit(uint64_t bytes)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_memoryLimit = bytes;
+}
+
+bool ValueScanner::CheckMemoryLimit(uint64_t bytes, std::string& error) const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (bytes <= m_memoryLimit)
+    {
+        return true;
+    }
+
+    error = "Candidates exceed the " + FormatMegabytes(m_memoryLimit) + " limit; narrow the scan with an exact value or a range";
+    return false;
+}
+
+void ValueScanner::Publish(std::vector<CandidateBlock> blocks, ScanValueType type, ValueScanStats stats)
+{
+    auto published = std::make_shared<const std::vector<CandidateBlock>>(std::move(blocks));
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_blocks = std::move(published);
+    m_type = type;
+    m_hasScan = true;
+    m_stats = stats;
+}
+
+size_t ValueScanner::GetTypeSize(ScanValueType type)
+{
+    return (type == ScanValueType::Int32 || type == ScanValueType::Float) ? 4 : 8;
+}
+
+const char* ValueScanner::GetTypeName(ScanValueType type)
+{
+    size_t index = static_cast<size_t>(type);
+    return index < static_cast<size_t>(ScanValueType::Count) ? TYPE_NAMES[index] : "";
+}
+
+const char* ValueScanner::GetCompareName(ScanCompare compare)
+{
+    size_t index = static_cast<size_t>(compare);
+    return index < static_cast<size_t>(ScanCompare::Count) ? COMPARE_NAMES[index] : "";
+}
+
+bool ValueScanner::NeedsPreviousValues(ScanCompare compare)
+{
+    return compare >= ScanCompare::Changed && compare < ScanCompare::Count;
+}
+
+bool ValueScanner::ParseValue(ScanValueType type, const std::string& text, uint64_t& raw)
+{
+    int base = 10;
+    std::string number = PrepareNumber(text, base);
+    if (number.empty())
+    {
+        return false;
+    }
+
+    try
+    {
+        size_t consumed = 0;
+        switch (type)
+        {
+        case ScanValueType::Int32:
+        {
+            // Accept the signed and the unsigned range; both map to the same bits
+            long long value = std::stoll(number, &consumed, base);
+            if (value < INT32_MIN || value > static_cast<long long>(UINT32_MAX))
+                return false;
+            raw = static_cast<uint32_t>(value);
+            break;
+        }
+        case ScanValueType::Int64:
+            raw = number[0] == '-' ? static_cast<uint64_t>(std::stoll(number, &consumed, base)) : std::stoull(number, &consumed, base);
+            break;
+        case ScanValueType::Float:
+        {
+            float value = std::stof(number, &consumed);
+            uint32_t bits;
+            std::memcpy(&bits, &value, sizeof(bits));
+            raw = bits;
+            break;
+        }
+        case ScanValueType::Double:
+        {
+            double value = std::stod(number, &consumed);
+            std::memcpy(&raw, &value, sizeof(raw));
+            break;
+        }
+        case ScanValueType::Pointer:
+            // Pointers are always hex, with or without the 0x prefix
+            raw = std::stoull(number, &consumed, 16);
+            break;
+        default:
+            return false;
+        }
+        return consumed == number.size();
+    }
+    catch (const std::exception&)
+    {
+        return false;
+    }
+}
+
+std::string ValueScanner::FormatValue(ScanValueType type, uint64_t raw)
+{
+    std::ostringstream ss;
+    switch (type)
+    {
+    case ScanValueType::Int32:
+        ss << static_cast<int32_t>(static_cast<uint32_t>(raw));
+        break;
+    case ScanValueType::Int64:
+        ss << static_cast<int64_t>(raw);
+        break;
+    case ScanValueType::Float:
+    {
+        uint32_t bits = static_cast<uint32_t>(raw);
+        float value;
+        std::memcpy(&value, &bits, sizeof(value));
+        ss << std::setprecision(6) << value;
+        break;
+    }
+    case ScanValueType::Double:
+    {
+        double value;
+        std::memcpy(&value, &raw, sizeof(value));
+        ss << std::setprecision(10) << value;
+        break;
+    }
+    default:
+        return DMAManager::FormatHexAddress(raw);
+    }
+    return ss.str();
+}
+
+void ValueScanner::CompareValues(ScanValueType type, ScanCompare compare, const uint8_t* current, const uint8_t* previous,
+                                 size_t count, uint64_t value, uint64_t upper, uint64_t* mask)
+{
+    switch (type)
+    {
+    case ScanValueType::Int32:
+        DispatchCompare<Int32Lanes>(compare, current, previous, count, value, upper, mask);
+        break;
+    case ScanValueType::Int64:
+        DispatchCompare<ScalarLanes<int64_t>>(compare, current, previous, count, value, upper, mask);
+        break;
+    case ScanValueType::Float:
+        DispatchCompare<FloatLanes>(compare, current, previous, count, value, upper, mask);
+        break;
+    case ScanValueType::Double:
+        DispatchCompare<DoubleLanes>(compare, current, previous, count, value, upper, mask);
+        break;
+    case ScanValueType::Pointer:
+        DispatchCompare<ScalarLanes<uint64_t>>(compare, current, previous, count, value, upper, mask);
+        break;
+    default:
+        break;
+    }
+}
@@ -0,0 +1,324 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+class DMAManager;
+
+/**
+ * @enum ScanValueType
+ * @brief Type of the values a value scan looks for
+ */
+enum class ScanValueType : uint8_t
+{
+    Int32 = 0,
+    Int64,
+    Float,
+    Double,
+    Pointer,
+    Count
+};
+
+/**
+ * @enum ScanCompare
+ * @brief How a value scan filters candidates
+ *
+ * Exact, Range and Unknown work on any scan; the others compare against
+ * the value each candidate had at the previous scan.
+ */
+enum class ScanCompare : uint8_t
+{
+    Exact = 0,      ///< Equal to the query value
+    Range,          ///< Between the query value and upper bound (inclusive)
+    Unknown,        ///< Every value (first scan) / keep every candidate (next scan)
+    Changed,        ///< Differs from the previous scan
+    Unchanged,      ///< Same as the previous scan
+    Increased,      ///< Greater than at the previous scan
+    Decreased,      ///< Less than at the previous scan
+    Count
+};
+
+/**
+ * @struct ValueScanQuery
+ * @brief Parameters of a first or next scan
+ */
+struct ValueScanQuery
+{
+    ScanValueType type = ScanValueType::Int32;  ///< Value type (a next scan must use the first scan's type)
+    ScanCompare compare = ScanCompare::Exact;   ///< Filter
+    uint64_t value = 0;                         ///< Exact value or lower bound (raw bits, see ParseValue)
+    uint64_t upper = 0;                         ///< Upper bound for Range (raw bits)
+    bool writableOnly = true;                   ///< First scan: skip regions that cannot be written
+};
+
+/**
+ * @struct ValueScanResult
+ * @brief One candidate address
+ */
+struct ValueScanResult
+{
+    uint64_t address;   ///< Candidate address
+    uint64_t value;     ///< Value at the last scan (raw bits)
+};
+
+/**
+ * @struct ValueScanStats
+ * @brief Counters of the last scan
+ */
+struct ValueScanStats
+{
+    uint64_t candidates = 0;    ///< Candidates left
+    uint64_t regions = 0;       ///< Regions scanned (first scan) or holding candidates (next scan)
+    uint64_t bytesRead = 0;     ///< Bytes transferred from the device
+    uint64_t batches = 0;       ///< Scatter batches (device round trips)
+    uint64_t storageBytes = 0;  ///< Memory used by the candidate set
+    double seconds = 0.0;       ///< Wall time
+};
+
+/**
+ * @class ValueScanner
+ * @brief Cheat Engine style first-scan / next-scan over the process's memory regions
+ *
+ * A first scan streams every committed, readable region in scatter batches
+ * of CHUNK_SIZE pieces and filters aligned values with SIMD compare kernels.
+ * Candidates are kept per region either as a bitmap (one bit per aligned
+ * slot) or as a LEB128 delta list, whichever is smaller, together with
+ * their last values. Next scans only read the pages that still hold
+ * candidates, coalesced into spans and batched the same way, so they get
+ * cheaper as the set shrinks. A scan that fails or is cancelled leaves the
+ * previous candidate set untouched.
+ *
+ * Scans are serialised; the candidate set is replaced, never modified, so
+ * the result accessors may be called from any thread, even during a scan.
+ */
+class ValueScanner
+{
+public:
+    /**
+     * @brief Constructor
+     * @param dmaManager DMA manager to read through (must outlive the scanner)
+     */
+    explicit ValueScanner(const DMAManager& dmaManager);
+
+    /**
+     * @brief Scan all regions and replace the candidate set
+     * @param query Scan parameters (compare must be Exact, Range or Unknown)
+     * @param error Receives the reason on failure
+     * @return true if successful, false otherwise
+     */
+    bool FirstScan(const ValueScanQuery& query, std::string& error);
+
+    /**
+     * @brief Filter the current candidates
+     * @param query Scan parameters (type must match the first scan)
+     * @param error Receives the reason on failure
+     * @return true if successful, false otherwise
+     */
+    bool NextScan(const ValueScanQuery& query, std::string& error);
+
+    /**
+     * @brief Drop the candidate set
+     */
+    void Reset();
+
+    /**
+     * @brief Check whether a first scan produced a candidate set
+     * @return true if next scans are possible
+     */
+    bool HasScan() const;
+
+    /**
+     * @brief Get the value type of the current candidate set
+     * @return Value type
+     */
+    ScanValueType GetValueType() const;
+
+    /**
+     * @brief Get the number of candidates
+     * @return Candidate count
+     */
+    uint64_t GetCandidateCount() const;
+
+    /**
+     * @brief Get candidates in address order
+     * @param maxCount Maximum number of results
+     * @return Results
+     */
+    std::vector<ValueScanResult> GetResults(size_t maxCount) const;
+
+    /**
+     * @brief Get counters of the last successful scan
+     * @return Stats
+     */
+    ValueScanStats GetLastStats() const;
+
+    /**
+     * @brief Limit the memory used by the candidate set
+     * @param bytes Limit; a scan exceeding it fails
+     */
+    void SetMemoryLimit(uint64_t bytes);
+
+    /**
+     * @brief Get the size of a value type in bytes (also its alignment)
+     * @param type Value type
+     * @return Size
+     */
+    static size_t GetTypeSize(ScanValueType type);
+
+    /**
+     * @brief Get the display name of a value type
+     * @param type Value type
+     * @return Name, e.g. "int32"
+     */
+    static const char* GetTypeName(ScanValueType type);
+
+    /**
+     * @brief Get the display name of a compare mode
+     * @param compare Compare mode
+     * @return Name, e.g. "Increased"
+     */
+    static const char* GetCompareName(ScanCompare compare);
+
+    /**
+     * @brief Check whether a compare mode needs the values of a previous scan
+     * @param compare Compare mode
+     * @return true for Changed, Unchanged, Increased and Decreased
+     */
+    static bool NeedsPreviousValues(ScanCompare compare);
+
+    /**
+     * @brief Parse a value typed by the user
+     * @param type Value type
+     * @param text Decimal (or 0x-prefixed hex for integers and pointers)
+     * @param raw Receives the raw bits (little endian, zero extended)
+     * @return true if valid
+     */
+    static bool ParseValue(ScanValueType type, const std::string& text, uint64_t& raw);
+
+    /**
+     * @brief Format raw value bits
+     * @param type Value type
+     * @param raw Raw bits
+     * @return Formatted value
+     */
+    static std::string FormatValue(ScanValueType type, uint64_t raw);
+
+    /**
+     * @brief Compare packed values (the filter kernel)
+     * @param type Value type
+     * @param compare Compare mode
+     * @param current Current values, packed
+     * @param previous Previous values, packed (may be null unless NeedsPreviousValues)
+     * @param count Number of values
+     * @param value Query value / lower bound (raw bits)
+     * @param upper Range upper bound (raw bits)
+     * @param mask Receives bit i set for matching value i; (count + 63) / 64 words, zeroed by the caller
+     */
+    static void CompareValues(ScanValueType type, ScanCompare compare, const uint8_t* current, const uint8_t* previous,
+                              size_t count, uint64_t value, uint64_t upper, uint64_t* mask);
+
+    static constexpr uint64_t PAGE_SIZE = 0x1000;                   ///< Next scans read whole pages
+    static constexpr uint64_t CHUNK_SIZE = 0x100000;                ///< Largest single read (1 MB)
+    static constexpr uint64_t BATCH_BYTES = 8 * 0x100000;           ///< Bytes per scatter batch
+    static constexpr size_t MAX_BATCH_ENTRIES = 1024;               ///< Reads per scatter batch
+    static constexpr uint64_t DEFAULT_MEMORY_LIMIT = 512ull << 20;  ///< Default candidate set limit (512 MB)
+
+private:
+    /**
+     * @struct CandidateBlock
+     * @brief Candidates of one region
+     */
+    struct CandidateBlock
+    {
+        uint64_t base = 0;              ///< Region start; slot i is at base + i * value size
+        uint64_t slotCount = 0;         ///< Aligned value slots in the region
+        uint64_t count = 0;             ///< Candidates
+        std::vector<uint64_t> bitmap;   ///< Dense encoding: one bit per slot (empty when sparse)
+        std::vector<uint8_t> deltas;    ///< Sparse encoding: LEB128 gaps between candidate slots
+        std::vector<uint8_t> values;    ///< Value of every candidate at the last scan, packed
+
+        /**
+         * @brief Get the memory held by the block
+         * @return Bytes
+         */
+        uint64_t GetStorageBytes() const { return bitmap.size() * sizeof(uint64_t) + deltas.size() + values.size(); }
+    };
+
+    /**
+     * @class BlockBuilder
+     * @brief Collects candidates of one region in ascending order
+     *
+     * Starts as a delta list and switches to a bitmap once the list would
+     * be larger, so the encoding is always the smaller of the two.
+     */
+    class BlockBuilder
+    {
+    public:
+        BlockBuilder(uint64_t base, uint64_t slotCount, size_t valueSize);
+
+        /**
+         * @brief Add a candidate (slots must be ascending)
+         * @param slot Slot index
+         * @param value Current value (valueSize bytes)
+         */
+        void Add(uint64_t slot, const uint8_t* value);
+
+        /**
+         * @brief Finish the block
+         * @return Block (moved out)
+         */
+        CandidateBlock Finish();
+
+        /**
+         * @brief Get the memory held so far
+         * @return Bytes
+         */
+        uint64_t GetStorageBytes() const { return m_block.GetStorageBytes(); }
+
+        /**
+         * @brief Get the region start address
+         * @return Address
+         */
+        uint64_t GetBase() const { return m_block.base; }
+
+    private:
+        CandidateBlock m_block;     ///< Block being built
+        size_t m_valueSize;         ///< Bytes per value
+        uint64_t m_nextSlot;        ///< Slot after the last added one (delta origin)
+    };
+
+    /**
+     * @brief Visit the candidates of a block in ascending order
+     * @param block Block
+     * @param visit Called with (slot, candidate index); return false to stop
+     */
+    template<typename Visitor>
+    static void ForEachCandidate(const CandidateBlock& block, Visitor&& visit);
+
+    /**
+     * @brief Check the candidate set size against the memory limit
+     * @param bytes Candidate set size so far
+     * @param error Receives the reason when over the limit
+     * @return true if within the limit
+     */
+    bool CheckMemoryLimit(uint64_t bytes, std::string& error) const;
+
+    /**
+     * @brief Replace the candidate set
+     */
+    void Publish(std::vector<CandidateBlock> blocks, ScanValueType type, ValueScanStats stats);
+
+private:
+    const DMAManager& m_dmaManager;             ///< Source of memory reads
+    std::mutex m_scanMutex;                     ///< Serialises scans
+    mutable std::mutex m_mutex;                 ///< Guards everything below
+    std::shared_ptr<const std::vector<CandidateBlock>> m_blocks;   ///< Candidate set, one block per region with candidates (immutable)
+    ScanValueType m_type;                       ///< Value type of the candidate set
+    bool m_hasScan;                             ///< A first scan succeeded since the last Reset
+    ValueScanStats m_stats;                     ///< Counters of the last scan
+    uint64_t m_memoryLimit;                     ///< Candidate set limit
+};
@@ -0,0 +1,874 @@
+#include "SyntheticImage.h"
+#include "../Core/JsonWriter.h"
+#include "../Core/PdbFile.h"
+#include "../Scan/PatternScanner.h"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+namespace
+{
+    /**
+     * @brief SplitMix64 - small, fast and good enough for filler bytes
+     */
+    struct Random
+    {
+        uint64_t state;
+
+        explicit Random(uint64_t seed) : state(seed) {}
+
+        uint64_t Next()
+        {
+            uint64_t z = (state += 0x9E3779B97F4A7C15ULL);
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+            return z ^ (z >> 31);
+        }
+
+        uint32_t Below(uint32_t bound) { return static_cast<uint32_t>(Next() % bound); }
+        uint8_t Byte() { return static_cast<uint8_t>(Next()); }
+    };
+
+    uint64_t MixSeed(uint64_t seed, uint64_t stream, uint64_t index)
+    {
+        Random mixer(seed ^ (stream * 0xD1B54A32D192ED03ULL) ^ (index * 0x8CB92BA72F3D8DD7ULL));
+        return mixer.Next();
+    }
+
+    void Put16(std::vector<uint8_t>& out, size_t offset, uint16_t value) { std::memcpy(&out[offset], &value, sizeof(value)); }
+    void Put32(std::vector<uint8_t>& out, size_t offset, uint32_t value) { std::memcpy(&out[offset], &value, sizeof(value)); }
+    void Put64(std::vector<uint8_t>& out, size_t offset, uint64_t value) { std::memcpy(&out[offset], &value, sizeof(value)); }
+
+    /**
+     * @brief PE fields are 32-bit; images beyond 4 GB saturate instead of wrapping
+     */
+    uint32_t Clamp32(uint64_t value)
+    {
+        return value > 0xFFFFF000ULL ? 0xFFFFF000U : static_cast<uint32_t>(value);
+    }
+
+    /**
+     * @brief Instruction prefixes the scanner resolves per group (mirrors AdjustFoundOffsetForGroup)
+     */
+    std::vector<std::vector<uint8_t>> GetGroupPrefixes(const std::string& group)
+    {
+        if (group == "GWorld")
+            return { { 0x48, 0x89, 0x05 } };
+        if (group == "GNames")
+            return { { 0x48, 0x8D, 0x0D }, { 0x48, 0x8B, 0x05 } };
+        if (group == "GObjects")
+            return { { 0x4C, 0x8B, 0x0D } };
+        return {};
+    }
+
+    /**
+     * @brief Offset of the rip-relative instruction inside a signature (0 if it has none)
+     */
+    size_t FindInstructionOffset(const UnrealSignature& sig)
+    {
+        for (const auto& prefix : GetGroupPrefixes(sig.group))
+        {
+            for (size_t i = 0; i + prefix.size() <= sig.pattern.size(); ++i)
+            {
+                bool match = true;
+                for (size_t j = 0; j < prefix.size(); ++j)
+                {
+                    if (sig.mask[i + j] != 'x' || sig.pattern[i + j] != prefix[j])
+                    {
+                        match = false;
+                        break;
+                    }
+                }
+
+                if (match)
+                    return i;
+            }
+        }
+
+        return 0;
+    }
+
+    /**
+     * @brief Filler for wildcard bytes that never forms an instruction prefix
+     */
+    uint8_t WildcardByte(Random& rng)
+    {
+        uint8_t value = rng.Byte();
+        return (value == 0x48 || value == 0x4C || value == 0xCC) ? 0x90 : value;
+    }
+
+    const char* RDATA_STRINGS[] = {
+        "UObject", "UClass", "UStruct", "UFunction", "AActor", "APawn", "ACharacter",
+        "UWorld", "ULevel", "UGameInstance", "APlayerController", "UEngine",
+        "/Script/Engine", "/Script/CoreUObject", "Default__", "FName", "None",
+        "LogTemp", "Shipping", "%s.%s", "Unknown", "Transient", "Package",
+        "ScriptStruct", "EnumProperty", "ObjectProperty", "BoolProperty"
+    };
+}
+
+SyntheticImage::SyntheticImage(const SyntheticImageOptions& options)
+    : m_branchName{ 0, {} }
+    , m_directories{ 0, {} }
+    , m_textEnd(0)
+    , m_rdataEnd(0)
+{
+    m_manifest.options = options;
+
+    // Page aligned, at least 1 MB so all planted patterns fit
+    uint64_t imageSize = std::max<uint64_t>(options.imageSize, 0x100000) & ~0xFFFULL;
+    m_manifest.options.imageSize = imageSize;
+
+    uint64_t textSize = (imageSize * 8 / 10) & ~0xFFFULL;
+    uint64_t rdataSize = (imageSize / 10) & ~0xFFFULL;
+    m_textEnd = HEADER_SIZE + textSize;
+    m_rdataEnd = m_textEnd + rdataSize;
+
+    m_manifest.sections.push_back({ ".text", HEADER_SIZE, textSize });
+    m_manifest.sections.push_back({ ".rdata", m_textEnd, rdataSize });
+    m_manifest.sections.push_back({ ".data", m_rdataEnd, imageSize - m_rdataEnd });
+
+    // Engine branch name as BuildSettings stores it (UTF-16), halfway into .rdata
+    if (!options.engineVersion.empty())
+    {
+        std::string branch = "++UE" + options.engineVersion.substr(0, options.engineVersion.find('.')) + "+Release-" + options.engineVersion;
+        m_branchName.offset = (m_textEnd + rdataSize / 2) & ~0xFULL;
+        for (char c : branch)
+        {
+            m_branchName.bytes.push_back(static_cast<uint8_t>(c));
+            m_branchName.bytes.push_back(0);
+        }
+        m_branchName.bytes.insert(m_branchName.bytes.end(), 2, 0);
+    }
+
+    // Exports point at the globals the references resolve to, so the plan comes first
+    PlanPatterns();
+    BuildDirectories();
+    BuildHeaders();
+}
+
+void SyntheticImage::BuildDirectories()
+{
+    const SyntheticImageOptions& options = m_manifest.options;
+    UnrealGlobals& expected = m_manifest.expected;
+    const char* groups[] = { "GWorld", "GNames", "GObjects" };
+    uint64_t addresses[] = { expected.GWorld, expected.GNames, expected.GObjects };
+    GlobalSource* sources[] = { &expected.GWorldSource, &expected.GNamesSource, &expected.GObjectsSource };
+    std::vector<std::pair<std::string, uint32_t>> exports;
+    for (size_t i = 0; i < 3; ++i)
+    {
+        if (addresses[i] == 0)
+            continue;
+
+        bool exported = std::find(options.exports.begin(), options.exports.end(), groups[i]) != options.exports.end();
+        *sources[i] = exported ? GlobalSource::Export : GlobalSource::Signature;
+        if (exported)
+            exports.emplace_back(GetDecoratedSymbol(groups[i]), static_cast<uint32_t>(addresses[i] - options.imageBase));
+    }
+
+    if (exports.empty() && !options.codeView)
+        return;
+
+    // Loaders binary search the name table, so names are sorted
+    std::sort(exports.begin(), exports.end());
+    std::vector<uint8_t>& bytes = m_directories.bytes;
+    const uint32_t base = static_cast<uint32_t>(m_textEnd);
+    m_directories.offset = m_textEnd;
+    auto append = [&](const void* data, size_t size)
+    {
+        uint32_t rva = base + static_cast<uint32_t>(bytes.size());
+        bytes.insert(bytes.end(), static_cast<const uint8_t*>(data), static_cast<const uint8_t*>(data) + size);
+        return rva;
+    };
+    auto align = [&]() { bytes.resize((bytes.size() + 3) & ~size_t(3)); };
+
+    if (!exports.empty())
+    {
+        // Directory, function RVAs, name RVAs, ordinals, then the strings - as the linker lays them out
+        uint32_t count = static_cast<uint32_t>(exports.size());
+        bytes.resize(40 + count * 10);
+        align();
+        const char moduleName[] = "Synthetic-Win64-Shipping.exe";
+        uint32_t moduleNameRva = append(moduleName, sizeof(moduleName));
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            uint32_t nameRva = append(exports[i].first.c_str(), exports[i].first.size() + 1);
+            Put32(bytes, 40 + i * 4, exports[i].second);
+            Put32(bytes, 40 + count * 4 + i * 4, nameRva);
+            Put16(bytes, 40 + count * 8 + i * 2, static_cast<uint16_t>(i));
+        }
+        Put32(bytes, 4, static_cast<uint32_t>(0x60000000 + (options.seed & 0xFFFFFF)));
+        Put32(bytes, 12, moduleNameRva);
+        Put32(bytes, 16, 1);                        // Ordinal base
+        Put32(bytes, 20, count);
+        Put32(bytes, 24, count);
+        Put32(bytes, 28, base + 40);
+        Put32(bytes, 32, base + 40 + count * 4);
+        Put32(bytes, 36, base + 40 + count * 8);
+        align();
+        m_exportDirectory = { base, static_cast<uint32_t>(bytes.size()) };
+    }
+
+    if (options.codeView)
+    {
+        // GUID from the seed: a new seed is a new build whose PDB must not match
+        PeCodeView& codeView = m_manifest.codeView;
+        Random rng(MixSeed(options.seed, 0xC0DE, 0));
+        for (uint8_t& value : codeView.guid)
+            value = rng.Byte();
+        codeView.age = 1;
+        codeView.pdbPath = "C:\\Build\\Synthetic\\Binaries\\Win64\\Synthetic-Win64-Shipping.pdb";
+
+        size_t entry = bytes.size();
+        bytes.resize(entry + 28);
+        uint32_t recordRva = append("RSDS", 4);
+        append(codeView.guid.data(), codeView.guid.size());
+        append(&codeView.age, 4);
+        append(codeView.pdbPath.c_str(), codeView.pdbPath.size() + 1);
+        align();
+
+        Put32(bytes, entry + 4, static_cast<uint32_t>(0x60000000 + (options.seed & 0xFFFFFF)));
+        Put32(bytes, entry + 12, 2);                // IMAGE_DEBUG_TYPE_CODEVIEW
+        Put32(bytes, entry + 16, static_cast<uint32_t>(24 + codeView.pdbPath.size() + 1));
+        Put32(bytes, entry + 20, recordRva);
+        Put32(bytes, entry + 24, recordRva);        // Memory layout: file offsets equal RVAs
+        m_debugDirectory = { base + static_cast<uint32_t>(entry), 28 };
+    }
+}
+
+void SyntheticImage::BuildHeaders()
+{
+    const SyntheticImageOptions& options = m_manifest.options;
+    m_headers.assign(HEADER_SIZE, 0);
+
+    // DOS header and stub
+    m_headers[0] = 'M';
+    m_headers[1] = 'Z';
+    Put32(m_headers, 0x3C, 0x80);
+    const char stub[] = "This program cannot be run in DOS mode.";
+    std::memcpy(&m_headers[0x4E], stub, sizeof(stub) - 1);
+
+    // NT headers
+    const size_t nt = 0x80;
+    std::memcpy(&m_headers[nt], "PE\0\0", 4);
+
+    const size_t file = nt + 4;
+    Put16(m_headers, file + 0, 0x8664);                                 // Machine: AMD64
+    Put16(m_headers, file + 2, static_cast<uint16_t>(m_manifest.sections.size()));
+    Put32(m_headers, file + 4, static_cast<uint32_t>(0x60000000 + (options.seed & 0xFFFFFF)));  // TimeDateStamp
+    Put16(m_headers, file + 16, 0xF0);                                  // SizeOfOptionalHeader
+    Put16(m_headers, file + 18, 0x22);                                  // Executable, large address aware
+
+    const size_t opt = file + 20;
+    uint64_t textSize = m_manifest.sections[0].size;
+    Put16(m_headers, opt + 0, 0x20B);                                   // PE32+
+    m_headers[opt + 2] = 14;                                            // Linker version
+    m_headers[opt + 3] = 36;
+    Put32(m_headers, opt + 4, Clamp32(textSize));                       // SizeOfCode
+    Put32(m_headers, opt + 8, Clamp32(options.imageSize - m_textEnd));  // SizeOfInitializedData
+    Put32(m_headers, opt + 16, static_cast<uint32_t>(HEADER_SIZE + 0x10));  // AddressOfEntryPoint
+    Put32(m_headers, opt + 20, static_cast<uint32_t>(HEADER_SIZE));     // BaseOfCode
+    Put64(m_headers, opt + 24, options.imageBase);
+    Put32(m_headers, opt + 32, 0x1000);                                 // SectionAlignment
+    Put32(m_headers, opt + 36, 0x200);                                  // FileAlignment
+    Put16(m_headers, opt + 40, 6);                                      // OS version
+    Put16(m_headers, opt + 48, 6);                                      // Subsystem version
+    Put32(m_headers, opt + 56, Clamp32(options.imageSize));             // SizeOfImage
+    Put32(m_headers, opt + 60, static_cast<uint32_t>(HEADER_SIZE));     // SizeOfHeaders
+    Put16(m_headers, opt + 68, 2);                                      // Subsystem: Windows GUI
+    Put16(m_headers, opt + 70, 0x8160);                                 // DllCharacteristics
+    Put64(m_headers, opt + 72, 0x100000);                               // Stack reserve
+    Put64(m_headers, opt + 80, 0x1000);                                 // Stack commit
+    Put64(m_headers, opt + 88, 0x100000);                               // Heap reserve
+    Put64(m_headers, opt + 96, 0x1000);                                 // Heap commit
+    Put32(m_headers, opt + 108, 16);                                    // NumberOfRvaAndSizes
+    Put32(m_headers, opt + 112, m_exportDirectory.virtualAddress);      // Export directory
+    Put32(m_headers, opt + 116, m_exportDirectory.size);
+    Put32(m_headers, opt + 160, m_debugDirectory.virtualAddress);       // Debug directory
+    Put32(m_headers, opt + 164, m_debugDirectory.size);
+
+    // Section table (memory layout: raw offsets equal RVAs)
+    const uint32_t characteristics[] = { 0x60000020, 0x40000040, 0xC0000040 };
+    size_t sectionHeader = opt + 0xF0;
+    for (size_t i = 0; i < m_manifest.sections.size(); ++i)
+    {
+        const SyntheticSection& section = m_manifest.sections[i];
+        std::memcpy(&m_headers[sectionHeader], section.name.c_str(), std::min<size_t>(section.name.size(), 8));
+        Put32(m_headers, sectionHeader + 8, Clamp32(section.size));
+        Put32(m_headers, sectionHeader + 12, Clamp32(section.virtualAddress));
+        Put32(m_headers, sectionHeader + 16, Clamp32(section.size));
+        Put32(m_headers, sectionHeader + 20, Clamp32(section.virtualAddress));
+        Put32(m_headers, sectionHeader + 36, characteristics[i]);
+        sectionHeader += 40;
+    }
+}
+
+void SyntheticImage::PlanPatterns()
+{
+    const SyntheticImageOptions& options = m_manifest.options;
+    auto signatures = DMAManager::GetUnrealSignatures();
+
+    struct Job
+    {
+        PlantKind kind;
+        size_t signature;
+        size_t variant;     ///< Index among jobs of the same kind/signature
+    };
+
+    std::vector<Job> jobs;
+    std::vector<bool> referenced(signatures.size(), false);
+    for (size_t s = 0; s < signatures.size(); ++s)
+    {
+        const UnrealSignature& sig = signatures[s];
+        bool selected = options.variants.empty()
+            || std::find(options.variants.begin(), options.variants.end(), sig.name) != options.variants.end();
+
+        // Identical signatures share one reference (its first match is the earlier plant)
+        bool duplicate = false;
+        for (size_t e = 0; e < s; ++e)
+        {
+            if (referenced[e] && signatures[e].pattern == sig.pattern && signatures[e].mask == sig.mask)
+                duplicate = true;
+        }
+
+        if (selected && !duplicate)
+        {
+            referenced[s] = true;
+            jobs.push_back({ PlantKind::Reference, s, 0 });
+        }
+
+        for (size_t i = 0; i < options.nearMissesPerSignature; ++i)
+            jobs.push_back({ PlantKind::NearMiss, s, i });
+        for (size_t i = 0; i < options.decoysPerSignature; ++i)
+            jobs.push_back({ PlantKind::Decoy, s, i });
+    }
+
+    // Interleave kinds deterministically
+    Random rng(MixSeed(options.seed, 'p', 0));
+    for (size_t i = jobs.size(); i > 1; --i)
+    {
+        std::swap(jobs[i - 1], jobs[rng.Below(static_cast<uint32_t>(i))]);
+    }
+
+    const uint64_t textStart = HEADER_SIZE;
+    const uint64_t minSlot = 2 * PLANT_PADDING + 64;
+
+    uint64_t regionStart = textStart + 0x1000;
+    uint64_t slotSize = jobs.empty() ? 0 : (m_textEnd - regionStart) / jobs.size();
+    if (options.placeAtEnd || slotSize < minSlot)
+    {
+        slotSize = minSlot;
+        regionStart = m_textEnd - jobs.size() * slotSize;
+    }
+    slotSize &= ~0xFULL;
+
+    uint64_t nextTarget = m_rdataEnd + 0x800;
+    for (size_t j = 0; j < jobs.size(); ++j)
+    {
+        const Job& job = jobs[j];
+        const UnrealSignature& sig = signatures[job.signature];
+        size_t instructionRel = FindInstructionOffset(sig);
+
+        PlantedPattern planted;
+        planted.kind = job.kind;
+        planted.signature = sig.name;
+        planted.group = sig.group;
+        planted.offset = (regionStart + j * slotSize + PLANT_PADDING + 0xF) & ~0xFULL;
+        planted.instructionOffset = planted.offset + instructionRel;
+
+        std::vector<uint8_t> bytes(sig.pattern.size());
+        for (size_t i = 0; i < bytes.size(); ++i)
+        {
+            bytes[i] = sig.mask[i] == 'x' ? sig.pattern[i] : WildcardByte(rng);
+        }
+
+        // Point the displacement at a .data slot; fixed displacement bytes win
+        uint64_t target = nextTarget;
+        nextTarget += 0x40;
+        if (target + 8 > options.imageSize)
+            target = m_rdataEnd;
+
+        uint64_t nextInstruction = options.imageBase + planted.instructionOffset + 7;
+        int32_t displacement = static_cast<int32_t>(static_cast<int64_t>(options.imageBase + target) - static_cast<int64_t>(nextInstruction));
+        uint8_t displacementBytes[4];
+        std::memcpy(displacementBytes, &displacement, sizeof(displacement));
+        for (size_t i = 0; i < 4; ++i)
+        {
+            size_t position = instructionRel + 3 + i;
+            if (position < bytes.size() && sig.mask[position] != 'x')
+                bytes[position] = displacementBytes[i];
+            else if (position < bytes.size())
+                displacementBytes[i] = bytes[position];
+        }
+        std::memcpy(&displacement, displacementBytes, sizeof(displacement));
+        planted.targetAddress = nextInstruction + displacement;
+
+        if (job.kind == PlantKind::NearMiss)
+        {
+            // Break one fixed byte outside the instruction prefix, rotating through them
+            std::vector<size_t> fixed;
+            for (size_t i = 0; i < bytes.size(); ++i)
+            {
+                bool inPrefix = i >= instructionRel && i < instructionRel + 3;
+                if (sig.mask[i] == 'x' && !inPrefix)
+                    fixed.push_back(i);
+            }
+            size_t position = fixed.empty() ? instructionRel : fixed[job.variant % fixed.size()];
+            bytes[position] ^= 0x5A;
+            planted.targetAddress = 0;
+        }
+        else if (job.kind == PlantKind::Decoy)
+        {
+            // Keep the instruction and half of the remaining pattern
+            size_t keep = instructionRel + 7 + (bytes.size() - std::min(bytes.size(), instructionRel + 7)) / 2;
+            bytes.resize(std::min(keep, bytes.size() - 1));
+            planted.targetAddress = 0;
+        }
+
+        PlantBytes plant;
+        plant.offset = planted.offset - PLANT_PADDING;
+        plant.bytes.assign(PLANT_PADDING, 0xCC);
+        plant.bytes.insert(plant.bytes.end(), bytes.begin(), bytes.end());
+        plant.bytes.insert(plant.bytes.end(), PLANT_PADDING, 0xCC);
+
+        m_plants.push_back(std::move(plant));
+        m_manifest.planted.push_back(planted);
+    }
+
+    // Plants are laid out in slot order, so both lists are already sorted by offset
+
+    // Expected scan result: first variant (in scan order) of each group with a reference. Without
+    // hits the scan order is the version hint, then table order
+    EngineVersion version;
+    EngineVersion::Parse(m_manifest.options.engineVersion, version);
+    std::vector<UnrealSignature> ranked = signatures;
+    SignatureStats().Rank(version, ranked);
+    for (const auto& sig : ranked)
+    {
+        uint64_t* slot = sig.group == "GWorld" ? &m_manifest.expected.GWorld
+            : sig.group == "GNames" ? &m_manifest.expected.GNames
+            : sig.group == "GObjects" ? &m_manifest.expected.GObjects : nullptr;
+        if (!slot || *slot != 0)
+            continue;
+
+        for (const auto& planted : m_manifest.planted)
+        {
+            if (planted.kind != PlantKind::Reference)
+                continue;
+
+            const UnrealSignature* plantedSig = nullptr;
+            for (const auto& candidate : signatures)
+            {
+                if (candidate.name == planted.signature)
+                    plantedSig = &candidate;
+            }
+
+            if (plantedSig && plantedSig->pattern == sig.pattern && plantedSig->mask == sig.mask)
+            {
+                *slot = planted.targetAddress;
+                break;
+            }
+        }
+    }
+}
+
+void SyntheticImage::GenerateBlock(uint64_t blockIndex, uint8_t* block) const
+{
+    const uint64_t blockStart = blockIndex * BLOCK_SIZE;
+    const uint64_t imageSize = m_manifest.options.imageSize;
+    const uint64_t dataRva = m_rdataEnd;
+    const uint64_t dataSize = imageSize - m_rdataEnd;
+
+    std::memset(block, 0, BLOCK_SIZE);
+
+    Random rng(MixSeed(m_manifest.options.seed, 'b', blockIndex));
+
+    uint64_t position = blockStart;
+    const uint64_t blockEnd = std::min(blockStart + BLOCK_SIZE, imageSize);
+
+    // .text: stream of common x64 instruction forms
+    uint8_t instruction[24];
+    while (position < std::min(blockEnd, m_textEnd))
+    {
+        if (position < HEADER_SIZE)
+        {
+            position = HEADER_SIZE;
+            continue;
+        }
+
+        size_t length = 0;
+        auto emit = [&](std::initializer_list<uint8_t> bytes)
+        {
+            for (uint8_t value : bytes)
+                instruction[length++] = value;
+        };
+        auto emit32 = [&](uint32_t value)
+        {
+            std::memcpy(&instruction[length], &value, sizeof(value));
+            length += 4;
+        };
+        auto ripTo = [&](uint64_t rva, size_t instructionLength)
+        {
+            return static_cast<uint32_t>(static_cast<int64_t>(rva) - static_cast<int64_t>(position + instructionLength));
+        };
+
+        uint8_t reg = static_cast<uint8_t>(rng.Below(8));
+        uint8_t rm = static_cast<uint8_t>(rng.Below(8));
+        if (rm == 4)
+            rm = 3;     // Avoid SIB forms
+
+        uint32_t pick = rng.Below(100);
+        if (pick < 13)
+            emit({ 0x48, 0x8B, static_cast<uint8_t>(0x40 | (reg << 3) | rm), static_cast<uint8_t>(rng.Below(32) * 8) });
+        else if (pick < 21)
+            emit({ 0x48, 0x89, static_cast<uint8_t>(0x40 | (reg << 3) | rm), static_cast<uint8_t>(rng.Below(32) * 8) });
+        else if (pick < 26)
+            emit({ 0x48, 0x8D, static_cast<uint8_t>(0x40 | (reg << 3) | rm), static_cast<uint8_t>(rng.Below(16) * 8) });
+        else if (pick < 30)
+            emit({ 0x4C, static_cast<uint8_t>(rng.Below(2) ? 0x8B : 0x89), static_cast<uint8_t>(0x40 | (reg << 3) | rm), static_cast<uint8_t>(rng.Below(32) * 8) });
+        else if (pick < 36)
+            emit({ 0x8B, static_cast<uint8_t>(0xC0 | (reg << 3) | rm) });
+        else if (pick < 40)
+            emit({ 0x89, static_cast<uint8_t>(0xC0 | (reg << 3) | rm) });
+        else if (pick < 47)
+        {
+            emit({ 0xE8 });
+            emit32(ripTo(HEADER_SIZE + rng.Next() % (m_textEnd - HEADER_SIZE), 5));
+        }
+        else if (pick < 50)
+        {
+            emit({ 0xFF, 0x15 });
+            emit32(ripTo(m_textEnd + (rng.Next() % std::max<uint64_t>(m_rdataEnd - m_textEnd, 8) & ~7ULL), 6));
+        }
+        else if (pick < 55)
+        {
+            // rip-relative global access, the instruction forms the signatures are built on
+            static const uint8_t forms[][3] = {
+                { 0x48, 0x8B, 0x05 }, { 0x48, 0x8B, 0x0D }, { 0x48, 0x8B, 0x15 }, { 0x48, 0x8B, 0x1D },
+                { 0x48, 0x89, 0x05 }, { 0x48, 0x89, 0x0D }, { 0x48, 0x8D, 0x0D }, { 0x48, 0x8D, 0x15 },
+                { 0x48, 0x8D, 0x05 }, { 0x4C, 0x8B, 0x05 }, { 0x4C, 0x8B, 0x0D }
+            };
+            const uint8_t* form = forms[rng.Below(sizeof(forms) / sizeof(forms[0]))];
+            emit({ form[0], form[1], form[2] });
+            emit32(ripTo(dataRva + (rng.Next() % std::max<uint64_t>(dataSize, 8) & ~7ULL), 7));
+        }
+        else if (pick < 59)
+        {
+            static const uint8_t forms[][3] = {
+                { 0x48, 0x85, 0xC0 }, { 0x85, 0xC0, 0 }, { 0x33, 0xC0, 0 }, { 0x84, 0xC0, 0 },
+                { 0x33, 0xD2, 0 }, { 0x45, 0x33, 0xC0 }, { 0x48, 0x85, 0xC9 }, { 0x85, 0xDB, 0 }
+            };
+            const uint8_t* form = forms[rng.Below(sizeof(forms) / sizeof(forms[0]))];
+            emit({ form[0], form[1] });
+            if (form[2] != 0)
+                emit({ form[2] });
+        }
+        else if (pick < 65)
+            emit({ static_cast<uint8_t>(0x70 | (rng.Below(2) ? 0x4 : 0x5 + rng.Below(11))), static_cast<uint8_t>(rng.Below(0x60)) });
+        else if (pick < 68)
+        {
+            emit({ 0x0F, static_cast<uint8_t>(rng.Below(2) ? 0x84 : 0x85) });
+            emit32(rng.Below(0x2000));
+        }
+        else if (pick < 70)
+            emit({ 0xEB, static_cast<uint8_t>(rng.Below(0x80)) });
+        else if (pick < 74)
+            emit({ 0x48, 0x83, static_cast<uint8_t>(0xC0 | (rng.Below(8) << 3) | rm), static_cast<uint8_t>(rng.Below(0x40)) });
+        else if (pick < 77)
+        {
+            static const uint8_t pushes[][2] = {
+                { 0x40, 0x53 }, { 0x55, 0 }, { 0x56, 0 }, { 0x57, 0 }, { 0x5B, 0 }, { 0x5D, 0 },
+                { 0x5E, 0 }, { 0x5F, 0 }, { 0x41, 0x56 }, { 0x41, 0x57 }, { 0x41, 0x5E }, { 0x41, 0x5F }
+            };
+            const uint8_t* form = pushes[rng.Below(sizeof(pushes) / sizeof(pushes[0]))];
+            emit({ form[0] });
+            if (form[1] != 0)
+                emit({ form[1] });
+        }
+        else if (pick < 80)
+        {
+            emit({ static_cast<uint8_t>(0xB8 | rm) });
+            emit32(rng.Below(0x400));
+        }
+        else if (pick < 83)
+            emit({ 0x48, 0x83, static_cast<uint8_t>(rng.Below(2) ? 0xEC : 0xC4), static_cast<uint8_t>(0x28 + rng.Below(12) * 8) });
+        else if (pick < 86)
+        {
+            // Function end and alignment padding
+            emit({ 0xC3 });
+            uint32_t padding = rng.Below(8);
+            for (uint32_t i = 0; i < padding; ++i)
+                emit({ 0xCC });
+        }
+        else if (pick < 89)
+        {
+            switch (rng.Below(4))
+            {
+            case 0: emit({ 0x0F, 0x1F, 0x44, 0x00, 0x00 }); break;
+            case 1: emit({ 0x66, 0x0F, 0x1F, 0x44, 0x00, 0x00 }); break;
+            case 2: emit({ 0x0F, 0x1F, 0x40, 0x00 }); break;
+            default: emit({ 0x90 }); break;
+            }
+        }
+        else if (pick < 93)
+            emit({ 0x48, static_cast<uint8_t>(rng.Below(2) ? 0x89 : 0x8B), static_cast<uint8_t>(0x44 | (reg << 3)), 0x24, static_cast<uint8_t>(8 + rng.Below(8) * 8) });
+        else if (pick < 96)
+        {
+            switch (rng.Below(3))
+            {
+            case 0: emit({ 0x0F, 0x28, static_cast<uint8_t>(0xC0 | (reg << 3) | rm) }); break;
+            case 1: emit({ 0xF3, 0x0F, 0x10, static_cast<uint8_t>(0x40 | (reg << 3) | rm), static_cast<uint8_t>(rng.Below(32) * 4) }); break;
+            default: emit({ 0x0F, 0x11, 0x44, 0x24, static_cast<uint8_t>(0x20 + rng.Below(8) * 0x10) }); break;
+            }
+        }
+        else
+        {
+            switch (rng.Below(4))
+            {
+            case 0: emit({ 0x0F, 0xB6, static_cast<uint8_t>(0xC0 | (reg << 3) | rm) }); break;
+            case 1: emit({ 0x0F, 0xB7, static_cast<uint8_t>(0xC0 | (reg << 3) | rm) }); break;
+            case 2: emit({ 0x48, 0x63, static_cast<uint8_t>(0xC0 | (reg << 3) | rm) }); break;
+            default: emit({ 0x0F, 0x44, static_cast<uint8_t>(0xC0 | (reg << 3) | rm) }); break;
+            }
+        }
+
+        size_t count = static_cast<size_t>(std::min<uint64_t>(length, std::min(blockEnd, m_textEnd) - position));
+        std::memcpy(block + (position - blockStart), instruction, count);
+        position += count;
+    }
+
+    // .rdata: strings, vtable-like pointer runs and constants
+    while (position < std::min(blockEnd, m_rdataEnd))
+    {
+        uint8_t* out = block + (position - blockStart);
+        uint64_t available = std::min(blockEnd, m_rdataEnd) - position;
+
+        uint32_t pick = rng.Below(10);
+        if (pick < 4)
+        {
+            const char* text = RDATA_STRINGS[rng.Below(sizeof(RDATA_STRINGS) / sizeof(RDATA_STRINGS[0]))];
+            size_t length = std::min<uint64_t>(std::strlen(text) + 1, available);
+            std::memcpy(out, text, length);
+            position += (length + 7) & ~7ULL;
+        }
+        else if (pick < 7)
+        {
+            // Run of function pointers into .text
+            uint64_t count = std::min<uint64_t>(1 + rng.Below(12), available / 8);
+            for (uint64_t i = 0; i < count; ++i)
+            {
+                uint64_t pointer = m_manifest.options.imageBase + HEADER_SIZE + (rng.Next() % (m_textEnd - HEADER_SIZE) & ~0xFULL);
+                std::memcpy(out + i * 8, &pointer, sizeof(pointer));
+            }
+            position += std::max<uint64_t>(count, 1) * 8;
+        }
+        else
+        {
+            position += 8 * (1 + rng.Below(4));
+        }
+    }
+
+    // .data: mostly zero-initialized globals with the occasional pointer
+    for (position = std::max(position, m_rdataEnd); position + 8 <= blockEnd; position += 8)
+    {
+        if (rng.Below(16) == 0)
+        {
+            uint64_t pointer = m_manifest.options.imageBase + m_rdataEnd + (rng.Next() % std::max<uint64_t>(dataSize, 8) & ~7ULL);
+            std::memcpy(block + (position - blockStart), &pointer, sizeof(pointer));
+        }
+    }
+}
+
+void SyntheticImage::Fill(uint64_t offset, uint8_t* buffer, size_t size) const
+{
+    const uint64_t end = offset + size;
+    std::vector<uint8_t> scratch;
+
+    for (uint64_t blockIndex = offset / BLOCK_SIZE; blockIndex * BLOCK_SIZE < end; ++blockIndex)
+    {
+        uint64_t blockStart = blockIndex * BLOCK_SIZE;
+        uint64_t copyStart = std::max(blockStart, offset);
+        uint64_t copyEnd = std::min(blockStart + BLOCK_SIZE, end);
+
+        if (copyStart == blockStart && copyEnd == blockStart + BLOCK_SIZE)
+        {
+            GenerateBlock(blockIndex, buffer + (blockStart - offset));
+            continue;
+        }
+
+        scratch.resize(BLOCK_SIZE);
+        GenerateBlock(blockIndex, scratch.data());
+        std::memcpy(buffer + (copyStart - offset), scratch.data() + (copyStart - blockStart), copyEnd - copyStart);
+    }
+
+    auto overlay = [&](uint64_t sourceOffset, const uint8_t* source, size_t sourceSize)
+    {
+        uint64_t start = std::max(sourceOffset, offset);
+        uint64_t stop = std::min(sourceOffset + sourceSize, end);
+        if (start < stop)
+            std::memcpy(buffer + (start - offset), source + (start - sourceOffset), stop - start);
+    };
+
+    overlay(0, m_headers.data(), m_headers.size());
+    overlay(m_branchName.offset, m_branchName.bytes.data(), m_branchName.bytes.size());
+    overlay(m_directories.offset, m_directories.bytes.data(), m_directories.bytes.size());
+
+    // Plants are sorted and never longer than a slot, so start one before the first overlap
+    auto it = std::lower_bound(m_plants.begin(), m_plants.end(), offset,
+        [](const PlantBytes& plant, uint64_t value) { return plant.offset < value; });
+    if (it != m_plants.begin())
+        --it;
+    for (; it != m_plants.end() && it->offset < end; ++it)
+    {
+        overlay(it->offset, it->bytes.data(), it->bytes.size());
+    }
+}
+
+std::vector<uint8_t> SyntheticImage::Generate() const
+{
+    std::vector<uint8_t> image(static_cast<size_t>(m_manifest.options.imageSize));
+    Fill(0, image.data(), image.size());
+    return image;
+}
+
+bool SyntheticImage::WriteToFile(const std::string& filename) const
+{
+    std::ofstream file(filename, std::ios::binary);
+    if (!file.is_open())
+    {
+        std::cerr << "Failed to open " << filename << " for writing" << std::endl;
+        return false;
+    }
+
+    const uint64_t CHUNK_SIZE = 16 * 1024 * 1024;
+    std::vector<uint8_t> chunk;
+    for (uint64_t offset = 0; offset < m_manifest.options.imageSize; offset += CHUNK_SIZE)
+    {
+        size_t size = static_cast<size_t>(std::min(CHUNK_SIZE, m_manifest.options.imageSize - offset));
+        chunk.resize(size);
+        Fill(offset, chunk.data(), size);
+
+        if (!file.write(reinterpret_cast<const char*>(chunk.data()), size))
+        {
+            std::cerr << "Failed to write " << filename << std::endl;
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool SyntheticImage::Verify(const std::vector<uint8_t>& image, std::vector<std::string>& errors) const
+{
+    auto signatures = DMAManager::GetUnrealSignatures();
+
+    for (const auto& planted : m_manifest.planted)
+    {
+        if (planted.kind != PlantKind::Reference)
+            continue;
+
+        for (const auto& sig : signatures)
+        {
+            if (sig.name != planted.signature)
+                continue;
+
+            size_t found = PatternScanner::FindPattern(image.data(), image.size(), sig.pattern, sig.mask);
+            if (found != planted.offset)
+            {
+                errors.push_back(sig.name + ": first match at " +
+                    (found == SIZE_MAX ? std::string("none") : DMAManager::FormatHexAddress(found)) +
+                    ", planted at " + DMAManager::FormatHexAddress(planted.offset));
+            }
+        }
+    }
+
+    return errors.empty();
+}
+
+const char* SyntheticImage::GetPlantKindName(PlantKind kind)
+{
+    switch (kind)
+    {
+    case PlantKind::Reference: return "reference";
+    case PlantKind::Decoy: return "decoy";
+    case PlantKind::NearMiss: return "near_miss";
+    }
+    return "unknown";
+}
+
+std::string SyntheticImage::GetDecoratedSymbol(const std::string& group)
+{
+    if (group == "GWorld")
+        return "?GWorld@@3VUWorldProxy@@A";
+    if (group == "GNames")
+        return "?NamePoolData@@3PAEA";
+    if (group == "GObjects")
+        return "?GUObjectArray@@3VFUObjectArray@@A";
+    return "";
+}
+
+std::string SyntheticImageManifest::ToJson() const
+{
+    JsonWriter json(true);
+    json.BeginObject();
+    json.UInt("generator_version", 1);
+    json.UInt("seed", options.seed);
+    json.UInt("image_size", options.imageSize);
+    json.String("image_base", DMAManager::FormatHexAddress(options.imageBase));
+    json.Bool("place_at_end", options.placeAtEnd);
+    json.String("engine_version", options.engineVersion);
+    json.BeginArray("exports");
+    for (const auto& group : options.exports)
+        json.String(nullptr, group);
+    json.EndArray();
+    if (codeView.age != 0)
+        json.String("pdb_id", PdbFile::FormatId(codeView.guid, codeView.age));
+
+    json.BeginArray("sections");
+    for (const auto& section : sections)
+    {
+        json.BeginObject();
+        json.String("name", section.name);
+        json.UInt("rva", section.virtualAddress);
+        json.UInt("size", section.size);
+        json.EndObject();
+    }
+    json.EndArray();
+
+    json.BeginObject("expected");
+    json.String("GWorld", DMAManager::FormatHexAddress(expected.GWorld));
+    json.String("GNames", DMAManager::FormatHexAddress(expected.GNames));
+    json.String("GObjects", DMAManager::FormatHexAddress(expected.GObjects));
+    json.EndObject();
+
+    json.BeginArray("planted");
+    for (const auto& planted : this->planted)
+    {
+        json.BeginObject();
+        json.String("kind", SyntheticImage::GetPlantKindName(planted.kind));
+        json.String("signature", planted.signature);
+        json.String("group", planted.group);
+        json.UInt("offset", planted.offset);
+        json.UInt("instruction_offset", planted.instructionOffset);
+        if (planted.kind == PlantKind::Reference)
+            json.String("target", DMAManager::FormatHexAddress(planted.targetAddress));
+        json.EndObject();
+    }
+    json.EndArray();
+
+    json.EndObject();
+    return json.Str();
+}
+
+bool SyntheticImageManifest::SaveToFile(const std::string& filename) const
+{
+    std::ofstream file(filename);
+    if (!file.is_open())
+    {
+        std::cerr << "Failed to open " << filename << " for writing" << std::endl;
+        return false;
+    }
+
+    file << ToJson() << std::endl;
+    return true;
+}
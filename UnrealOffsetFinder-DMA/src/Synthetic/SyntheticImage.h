@@ -0,0 +1,202 @@
+#pragma once
+
+#include "../DMA/DMAManager.h"
+#include "../Core/PeImage.h"
+#include <string>
+#include <vector>
+#include <cstdint>
+
+/**
+ * @struct SyntheticImageOptions
+ * @brief Parameters of a generated module image
+ */
+struct SyntheticImageOptions
+{
+    uint64_t imageSize = 64ULL * 1024 * 1024;   ///< Total image size in bytes (at least 1 MB)
+    uint64_t imageBase = 0x140000000;           ///< Virtual address the image is mapped at
+    uint64_t seed = 1;                          ///< Seed for all generated bytes
+    std::vector<std::string> variants;          ///< Signature names to plant references for (empty = all)
+    size_t decoysPerSignature = 64;             ///< Bare rip-relative prefixes per signature
+    size_t nearMissesPerSignature = 4;          ///< Full signatures with one fixed byte changed
+    bool placeAtEnd = false;                    ///< Put all planted patterns at the end of .text (worst case for linear scans)
+    std::string engineVersion;                  ///< Engine version of the branch name planted in .rdata ("4.27", empty = none)
+    std::vector<std::string> exports;           ///< Globals exported under their decorated symbol ("GObjects", ...)
+    bool codeView = false;                      ///< Plant a debug directory with a CodeView record (GUID derived from the seed)
+};
+
+/**
+ * @enum PlantKind
+ * @brief What a planted byte sequence is meant to exercise
+ */
+enum class PlantKind
+{
+    Reference,  ///< Real signature match resolving to a known global
+    Decoy,      ///< Instruction prefix of a signature without the rest of it
+    NearMiss    ///< Signature with one fixed byte changed, must not match
+};
+
+/**
+ * @struct PlantedPattern
+ * @brief A byte sequence written into .text at a known offset
+ */
+struct PlantedPattern
+{
+    PlantKind kind = PlantKind::Reference;  ///< Purpose of the sequence
+    std::string signature;                  ///< Signature name it was derived from
+    std::string group;                      ///< Signature group (GWorld, GNames, GObjects)
+    uint64_t offset = 0;                    ///< Image offset of the first pattern byte
+    uint64_t instructionOffset = 0;         ///< Image offset of the rip-relative instruction
+    uint64_t targetAddress = 0;             ///< Address the instruction resolves to
+};
+
+/**
+ * @struct SyntheticSection
+ * @brief Section of the generated PE image
+ */
+struct SyntheticSection
+{
+    std::string name;           ///< Section name
+    uint64_t virtualAddress;    ///< RVA (equal to the image offset)
+    uint64_t size;              ///< Section size in bytes
+};
+
+/**
+ * @struct SyntheticImageManifest
+ * @brief Everything a consumer needs to check scan results against a generated image
+ */
+struct SyntheticImageManifest
+{
+    SyntheticImageOptions options;          ///< Options the image was generated with
+    std::vector<SyntheticSection> sections; ///< Section layout
+    std::vector<PlantedPattern> planted;    ///< Planted sequences sorted by offset
+    UnrealGlobals expected;                 ///< What ScanUnrealGlobals must report
+    PeCodeView codeView;                    ///< CodeView record a matching PDB must carry (age 0 if none planted)
+
+    /**
+     * @brief Serialize the manifest as JSON
+     * @return JSON document
+     */
+    std::string ToJson() const;
+
+    /**
+     * @brief Write the manifest as JSON
+     * @param filename Output file
+     * @return true if successful, false otherwise
+     */
+    bool SaveToFile(const std::string& filename) const;
+};
+
+/**
+ * @class SyntheticImage
+ * @brief Deterministic generator of Unreal-like shipping module images
+ *
+ * Produces a memory-layout PE image: headers, a .text of instruction-like
+ * x64 bytes, .rdata and .data. References from the Unreal signature
+ * variants are planted at known offsets together with decoys and
+ * near-misses. Bytes are a pure function of (options, offset), so images
+ * of several GB can be streamed to disk without holding them in memory.
+ */
+class SyntheticImage
+{
+public:
+    /**
+     * @brief Constructor - lays out sections and planted patterns
+     * @param options Generation options
+     */
+    explicit SyntheticImage(const SyntheticImageOptions& options);
+
+    /**
+     * @brief Get the manifest of expected results
+     * @return Manifest
+     */
+    const SyntheticImageManifest& GetManifest() const { return m_manifest; }
+
+    /**
+     * @brief Generate a range of the image
+     * @param offset Image offset of the first byte
+     * @param buffer Output buffer
+     * @param size Number of bytes to generate
+     */
+    void Fill(uint64_t offset, uint8_t* buffer, size_t size) const;
+
+    /**
+     * @brief Generate the whole image in memory
+     * @return Image bytes
+     */
+    std::vector<uint8_t> Generate() const;
+
+    /**
+     * @brief Stream the image to a file in chunks
+     * @param filename Output file
+     * @return true if successful, false otherwise
+     */
+    bool WriteToFile(const std::string& filename) const;
+
+    /**
+     * @brief Check that every planted reference is the first match of its signature
+     * @param image Generated image bytes
+     * @param errors Receives a description of every mismatch
+     * @return true if all references are found where the manifest says
+     */
+    bool Verify(const std::vector<uint8_t>& image, std::vector<std::string>& errors) const;
+
+    /**
+     * @brief Stable name of a plant kind (used in the manifest)
+     */
+    static const char* GetPlantKindName(PlantKind kind);
+
+    /**
+     * @brief Decorated symbol a global is exported and published under
+     * @param group Global ("GWorld", "GNames", "GObjects")
+     * @return MSVC-decorated name, empty for unknown groups
+     */
+    static std::string GetDecoratedSymbol(const std::string& group);
+
+private:
+    /**
+     * @struct PlantBytes
+     * @brief Bytes of a planted sequence including its padding
+     */
+    struct PlantBytes
+    {
+        uint64_t offset;            ///< Image offset of bytes[0]
+        std::vector<uint8_t> bytes; ///< Padding + pattern + padding
+    };
+
+    /**
+     * @brief Lay out planted sequences and compute the expected globals
+     */
+    void PlanPatterns();
+
+    /**
+     * @brief Lay out the export and debug directories at the start of .rdata
+     */
+    void BuildDirectories();
+
+    /**
+     * @brief Build the PE headers
+     */
+    void BuildHeaders();
+
+    /**
+     * @brief Generate one fixed-size block of section content
+     * @param blockIndex Block number (offset / BLOCK_SIZE)
+     * @param block Output buffer of BLOCK_SIZE bytes
+     */
+    void GenerateBlock(uint64_t blockIndex, uint8_t* block) const;
+
+private:
+    SyntheticImageManifest m_manifest;  ///< Layout and expected results
+    std::vector<uint8_t> m_headers;     ///< PE headers (first HEADER_SIZE bytes)
+    std::vector<PlantBytes> m_plants;   ///< Planted sequences sorted by offset
+    PlantBytes m_branchName;            ///< Engine branch name in .rdata (empty if none)
+    PlantBytes m_directories;           ///< Export and debug directories in .rdata (empty if none)
+    PeDataDirectory m_exportDirectory;  ///< Export directory entry of the optional header
+    PeDataDirectory m_debugDirectory;   ///< Debug directory entry of the optional header
+    uint64_t m_textEnd;                 ///< End of .text
+    uint64_t m_rdataEnd;                ///< End of .rdata
+
+    static constexpr uint64_t HEADER_SIZE = 0x1000;     ///< Size of the header page
+    static constexpr uint64_t BLOCK_SIZE = 0x10000;     ///< Generation granularity
+    static constexpr size_t PLANT_PADDING = 32;         ///< int3 padding around planted sequences
+};
@@ -0,0 +1,149 @@
+#include "SyntheticNamePool.h"
+#include <cstring>
+#include <iterator>
+
+namespace
+{
+    /**
+     * @brief SplitMix64, same generator as the synthetic image
+     */
+    struct Random
+    {
+        uint64_t state;
+
+        explicit Random(uint64_t seed) : state(seed) {}
+
+        uint64_t Next()
+        {
+            uint64_t z = (state += 0x9E3779B97F4A7C15ULL);
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+            return z ^ (z >> 31);
+        }
+
+        uint32_t Below(uint32_t bound) { return static_cast<uint32_t>(Next() % bound); }
+    };
+
+    // Names every pool starts with (EName order)
+    const char* const FIRST_NAMES[] = {
+        "None", "ByteProperty", "IntProperty", "BoolProperty", "FloatProperty", "ObjectProperty",
+        "NameProperty", "DelegateProperty", "DoubleProperty", "ArrayProperty", "StructProperty",
+        "VectorProperty", "RotatorProperty", "StrProperty", "TextProperty", "InterfaceProperty",
+        "Core", "Engine", "CoreUObject", "Object", "Class", "Function", "Package", "World", "Actor",
+    };
+
+    const char* const PREFIXES[] = {
+        "BP_", "Default__", "SK_", "SM_", "MI_", "T_", "ABP_", "WBP_", "", "", "", "",
+    };
+
+    const char* const WORDS[] = {
+        "Player", "Weapon", "Character", "Controller", "Component", "Mesh", "Health", "Ammo", "Inventory",
+        "Vehicle", "Projectile", "Pawn", "Camera", "Widget", "Level", "Spawn", "Damage", "Location",
+        "Rotation", "Velocity", "Team", "State", "Ability", "Effect", "Montage", "Socket", "Bone", "Root",
+    };
+
+    // Non-ASCII pieces for wide names: Latin-1, CJK and one outside the BMP
+    const char* const WIDE_PIECES[] = { "\xC3\xA9t\xC3\xA9", "\xE5\x90\x8D\xE5\x89\x8D", "Zo\xC3\xAB", "\xF0\x9F\x98\x80" };
+
+    /**
+     * @brief Convert UTF-8 to UTF-16 code units
+     */
+    std::vector<uint16_t> ToUtf16(const std::string& text)
+    {
+        std::vector<uint16_t> out;
+        for (size_t i = 0; i < text.size();)
+        {
+            uint8_t lead = static_cast<uint8_t>(text[i]);
+            uint32_t codePoint;
+            size_t length;
+            if (lead < 0x80)      { codePoint = lead; length = 1; }
+            else if (lead < 0xE0) { codePoint = lead & 0x1F; length = 2; }
+            else if (lead < 0xF0) { codePoint = lead & 0x0F; length = 3; }
+            else                  { codePoint = lead & 0x07; length = 4; }
+            for (size_t j = 1; j < length; ++j)
+            {
+                codePoint = (codePoint << 6) | (static_cast<uint8_t>(text[i + j]) & 0x3F);
+            }
+            i += length;
+
+            if (codePoint >= 0x10000)
+            {
+                codePoint -= 0x10000;
+                out.push_back(static_cast<uint16_t>(0xD800 + (codePoint >> 10)));
+                out.push_back(static_cast<uint16_t>(0xDC00 + (codePoint & 0x3FF)));
+            }
+            else
+            {
+                out.push_back(static_cast<uint16_t>(codePoint));
+            }
+        }
+        return out;
+    }
+}
+
+SyntheticNamePool::SyntheticNamePool(const SyntheticNamePoolOptions& options)
+    : m_cursor(0)
+{
+    m_blocks.emplace_back(BLOCK_SIZE, 0);
+    m_names.reserve(options.nameCount);
+
+    Random random(options.seed);
+    for (size_t i = 0; i < options.nameCount; ++i)
+    {
+        if (i < std::size(FIRST_NAMES))
+        {
+            AddName(FIRST_NAMES[i], false);
+            continue;
+        }
+
+        bool wide = options.wideEvery != 0 && i % options.wideEvery == 0;
+        std::string name = PREFIXES[random.Below(std::size(PREFIXES))];
+        name += WORDS[random.Below(std::size(WORDS))];
+        if (wide)
+        {
+            name += WIDE_PIECES[random.Below(std::size(WIDE_PIECES))];
+        }
+        name += WORDS[random.Below(std::size(WORDS))];
+        name += "_" + std::to_string(i);
+        AddName(name, wide);
+    }
+}
+
+void SyntheticNamePool::AddName(const std::string& name, bool wide)
+{
+    std::vector<uint16_t> utf16 = wide ? ToUtf16(name) : std::vector<uint16_t>();
+    uint32_t length = static_cast<uint32_t>(wide ? utf16.size() : name.size());
+    uint32_t size = 2 + (wide ? length * 2 : length);
+    size = (size + STRIDE - 1) / STRIDE * STRIDE;
+
+    // Entries never straddle blocks; the rest of a full block stays zero
+    if (m_cursor + size > BLOCK_SIZE)
+    {
+        m_blocks.emplace_back(BLOCK_SIZE, 0);
+        m_cursor = 0;
+    }
+
+    uint8_t* entry = m_blocks.back().data() + m_cursor;
+    uint16_t probeHash = static_cast<uint16_t>(name.size() * 7 & 0x1F);
+    uint16_t header = static_cast<uint16_t>((length << 6) | (probeHash << 1) | (wide ? 1 : 0));
+    std::memcpy(entry, &header, sizeof(header));
+    if (wide)
+        std::memcpy(entry + 2, utf16.data(), utf16.size() * 2);
+    else
+        std::memcpy(entry + 2, name.data(), name.size());
+
+    uint32_t index = (static_cast<uint32_t>(m_blocks.size() - 1) << 16) | (m_cursor / STRIDE);
+    m_names.push_back({ index, name });
+    m_cursor += size;
+}
+
+std::vector<uint8_t> SyntheticNamePool::BuildHeader(const std::vector<uint64_t>& blockAddresses) const
+{
+    // FRWLock, CurrentBlock, CurrentByteCursor, Blocks[]
+    std::vector<uint8_t> header(0x10 + blockAddresses.size() * sizeof(uint64_t), 0);
+    uint32_t currentBlock = static_cast<uint32_t>(m_blocks.size() - 1);
+    std::memcpy(&header[8], &currentBlock, sizeof(currentBlock));
+    std::memcpy(&header[12], &m_cursor, sizeof(m_cursor));
+    std::memcpy(&header[0x10], blockAddresses.data(), blockAddresses.size() * sizeof(uint64_t));
+    return header;
+}
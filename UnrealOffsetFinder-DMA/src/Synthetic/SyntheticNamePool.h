@@ -0,0 +1,87 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+/**
+ * @struct SyntheticNamePoolOptions
+ * @brief Parameters of a generated FNamePool
+ */
+struct SyntheticNamePoolOptions
+{
+    size_t nameCount = 100000;  ///< Names including "None"
+    uint64_t seed = 1;          ///< Seed for generated names
+    size_t wideEvery = 97;      ///< Every n-th name is stored as UTF-16 (0 = none)
+};
+
+/**
+ * @struct SyntheticName
+ * @brief A generated name and the FName index it was allocated at
+ */
+struct SyntheticName
+{
+    uint32_t index;     ///< FName comparison index
+    std::string name;   ///< Name (UTF-8)
+};
+
+/**
+ * @class SyntheticNamePool
+ * @brief Deterministic generator of UE 4.23+ shipping FNamePool blocks
+ *
+ * Entries use the 2 byte header layout (bIsWide:1, LowercaseProbeHash:5,
+ * Len:10) with 2 byte alignment and move to a new block when they do not
+ * fit, like FNameEntryAllocator. Map the blocks anywhere and write
+ * BuildHeader() at the GNames address to get a pool NamePoolDumper reads.
+ */
+class SyntheticNamePool
+{
+public:
+    /**
+     * @brief Constructor - generates all names and blocks
+     * @param options Generation options
+     */
+    explicit SyntheticNamePool(const SyntheticNamePoolOptions& options);
+
+    /**
+     * @brief Get the pool blocks (the last one only holds GetCurrentCursor() used bytes)
+     * @return Blocks of BLOCK_SIZE bytes
+     */
+    const std::vector<std::vector<uint8_t>>& GetBlocks() const { return m_blocks; }
+
+    /**
+     * @brief Get the generated names in allocation order
+     * @return Names
+     */
+    const std::vector<SyntheticName>& GetNames() const { return m_names; }
+
+    /**
+     * @brief Build the FNameEntryAllocator header (lock, cursors, block pointers)
+     * @param blockAddresses Address each block is mapped at
+     * @return Header bytes
+     */
+    std::vector<uint8_t> BuildHeader(const std::vector<uint64_t>& blockAddresses) const;
+
+    /**
+     * @brief Get the byte cursor of the last block
+     * @return Used bytes of the last block
+     */
+    uint32_t GetCurrentCursor() const { return m_cursor; }
+
+    static constexpr uint32_t STRIDE = 2;                   ///< Entry alignment
+    static constexpr uint64_t BLOCK_SIZE = STRIDE << 16;    ///< Bytes per block
+
+private:
+    /**
+     * @brief Allocate one entry
+     * @param name Name (UTF-8 when ASCII, otherwise converted to UTF-16)
+     * @param wide Store as UTF-16
+     */
+    void AddName(const std::string& name, bool wide);
+
+private:
+    std::vector<std::vector<uint8_t>> m_blocks;     ///< Pool blocks
+    std::vector<SyntheticName> m_names;             ///< Expected names
+    uint32_t m_cursor;                              ///< Byte cursor in the last block
+};
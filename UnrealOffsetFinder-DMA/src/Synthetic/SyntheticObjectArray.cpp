@@ -0,0 +1,270 @@
+#include "SyntheticObjectArray.h"
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+
+namespace
+{
+    /**
+     * @brief SplitMix64, same generator as the synthetic image
+     */
+    struct Random
+    {
+        uint64_t state;
+
+        explicit Random(uint64_t seed) : state(seed) {}
+
+        uint64_t Next()
+        {
+            uint64_t z = (state += 0x9E3779B97F4A7C15ULL);
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+            return z ^ (z >> 31);
+        }
+
+        uint32_t Below(uint32_t bound) { return static_cast<uint32_t>(Next() % bound); }
+    };
+
+    // Typical UObject allocation sizes (UObject, components, actors, functions, properties)
+    constexpr uint32_t OBJECT_SIZES[] = { 0x30, 0x38, 0x40, 0x58, 0x80, 0xC0, 0x30, 0x40 };
+
+    constexpr uint64_t CHUNKS_OFFSET = 0x100000;        // Item chunks follow the chunk table
+    constexpr uint64_t CHUNK_STRIDE = 0x200000;         // Each chunk is its own allocation
+    constexpr uint64_t POOLS_OFFSET = 0x40000000;       // Object pools start 1 GB above the base
+    constexpr uint64_t OBJECT_VTABLE = 0x140100000;     // Any non-null vtable pointer
+    constexpr uint32_t PACKAGE_EVERY = 64;              // Objects between two packages
+    constexpr uint32_t ROOT_PACKAGE_SLOT = 0;
+    constexpr uint32_t CLASS_CLASS_SLOT = 1;
+    constexpr uint32_t PACKAGE_CLASS_SLOT = 2;
+    constexpr uint32_t RF_PUBLIC = 0x1;
+
+    void Store(uint8_t* data, const void* value, size_t size)
+    {
+        std::memcpy(data, value, size);
+    }
+}
+
+SyntheticObjectArray::SyntheticObjectArray(const SyntheticObjectArrayOptions& options)
+    : m_chunkTable(options.baseAddress)
+    , m_slotCount(static_cast<uint32_t>(options.slotCount))
+    , m_chunkCount((static_cast<uint32_t>(options.slotCount) + ELEMENTS_PER_CHUNK - 1) / ELEMENTS_PER_CHUNK)
+{
+    Random random(options.seed);
+    const uint32_t classCount = std::max<uint32_t>(options.classCount, PACKAGE_CLASS_SLOT + 2);
+    m_classCount = classCount;
+    m_slotStates.assign(m_slotCount, 0);
+
+    std::vector<uint64_t>& chunkAddresses = m_chunkAddresses;
+    chunkAddresses.resize(m_chunkCount);
+    std::vector<SyntheticRegion> chunks(m_chunkCount);
+    for (uint32_t chunk = 0; chunk < m_chunkCount; ++chunk)
+    {
+        chunkAddresses[chunk] = options.baseAddress + CHUNKS_OFFSET + chunk * CHUNK_STRIDE;
+        chunks[chunk] = { chunkAddresses[chunk], std::vector<uint8_t>(static_cast<size_t>(ELEMENTS_PER_CHUNK) * ITEM_SIZE, 0) };
+    }
+
+    SyntheticRegion table{ m_chunkTable, std::vector<uint8_t>(chunkAddresses.size() * sizeof(uint64_t), 0) };
+    std::memcpy(table.bytes.data(), chunkAddresses.data(), table.bytes.size());
+    m_regions.push_back(std::move(table));
+
+    // Objects are generated first, then written into pools in allocation order
+    std::vector<SyntheticObject> allocated;
+    allocated.reserve(m_slotCount);
+
+    uint64_t poolAddress = options.baseAddress + POOLS_OFFSET;
+    uint64_t poolCursor = 0;
+    int32_t currentPackage = ROOT_PACKAGE_SLOT;
+    for (uint32_t slot = 0; slot < m_slotCount; ++slot)
+    {
+        if (options.freeEvery != 0 && slot > classCount && slot % options.freeEvery == 0)
+        {
+            continue;
+        }
+
+        SyntheticObject object;
+        object.slot = static_cast<int32_t>(slot);
+        object.nameIndex = options.nameIndices.empty()
+            ? random.Below(0x400000)
+            : options.nameIndices[random.Below(static_cast<uint32_t>(options.nameIndices.size()))];
+        object.nameNumber = random.Below(4) == 0 ? random.Below(16) : 0;
+
+        if (slot == ROOT_PACKAGE_SLOT)
+        {
+            object.classSlot = PACKAGE_CLASS_SLOT;
+            object.outerSlot = -1;
+        }
+        else if (slot < classCount)
+        {
+            object.classSlot = CLASS_CLASS_SLOT;
+            object.outerSlot = ROOT_PACKAGE_SLOT;
+        }
+        else if (slot % PACKAGE_EVERY == 0)
+        {
+            object.classSlot = PACKAGE_CLASS_SLOT;
+            object.outerSlot = -1;
+            currentPackage = object.slot;
+        }
+        else
+        {
+            object.classSlot = static_cast<int32_t>(PACKAGE_CLASS_SLOT + 1 + random.Below(classCount - PACKAGE_CLASS_SLOT - 1));
+            // Most objects live in the current package; some are subobjects of the previous object
+            object.outerSlot = random.Below(4) == 0 && !allocated.empty() ? allocated.back().slot : currentPackage;
+        }
+
+        uint32_t size = OBJECT_SIZES[random.Below(static_cast<uint32_t>(std::size(OBJECT_SIZES)))];
+        if (poolCursor + size > POOL_SIZE)
+        {
+            poolAddress += POOL_SIZE;
+            poolCursor = 0;
+        }
+        object.address = poolAddress + poolCursor;
+        poolCursor += size;
+
+        allocated.push_back(object);
+    }
+
+    // Object pools with UObjectBase headers
+    std::vector<uint64_t> addressOfSlot(m_slotCount, 0);
+    for (const SyntheticObject& object : allocated)
+    {
+        addressOfSlot[object.slot] = object.address;
+    }
+
+    uint64_t firstPool = options.baseAddress + POOLS_OFFSET;
+    for (size_t i = 0; i < allocated.size(); ++i)
+    {
+        const SyntheticObject& object = allocated[i];
+        uint64_t pool = firstPool + (object.address - firstPool) / POOL_SIZE * POOL_SIZE;
+        if (m_regions.back().address != pool)
+        {
+            m_regions.push_back({ pool, std::vector<uint8_t>(static_cast<size_t>(POOL_SIZE), 0) });
+        }
+
+        uint8_t* header = m_regions.back().bytes.data() + (object.address - pool);
+        uint64_t classAddress = addressOfSlot[object.classSlot];
+        uint64_t outerAddress = object.outerSlot >= 0 ? addressOfSlot[object.outerSlot] : 0;
+        Store(header, &OBJECT_VTABLE, 8);
+        Store(header + 0x8, &RF_PUBLIC, 4);
+        Store(header + 0xC, &object.slot, 4);
+        Store(header + 0x10, &classAddress, 8);
+        Store(header + 0x18, &object.nameIndex, 4);
+        Store(header + 0x1C, &object.nameNumber, 4);
+        Store(header + 0x20, &outerAddress, 8);
+    }
+
+    // Items; a stale item points at the object of its predecessor slot
+    for (size_t i = 0; i < allocated.size(); ++i)
+    {
+        const SyntheticObject& object = allocated[i];
+        bool stale = options.staleEvery != 0 && i > 0 && object.slot > static_cast<int32_t>(classCount) &&
+                     i % options.staleEvery == 0;
+        uint64_t address = stale ? allocated[i - 1].address : object.address;
+
+        uint8_t* item = chunks[object.slot / ELEMENTS_PER_CHUNK].bytes.data() +
+                        static_cast<size_t>(object.slot % ELEMENTS_PER_CHUNK) * ITEM_SIZE;
+        Store(item, &address, 8);
+        m_slotStates[object.slot] = stale ? 2 : 1;
+        if (!stale)
+        {
+            m_objects.push_back(object);
+        }
+    }
+
+    // Dropping a stale object leaves references to it dangling, exactly like the enumerator sees them
+    std::vector<uint8_t> live(m_slotCount, 0);
+    for (const SyntheticObject& object : m_objects)
+    {
+        live[object.slot] = 1;
+    }
+    for (SyntheticObject& object : m_objects)
+    {
+        if (!live[object.classSlot])
+            object.classSlot = -1;
+        if (object.outerSlot >= 0 && !live[object.outerSlot])
+            object.outerSlot = -1;
+    }
+
+    for (SyntheticRegion& chunk : chunks)
+    {
+        m_regions.push_back(std::move(chunk));
+    }
+}
+
+std::vector<uint8_t> SyntheticObjectArray::BuildHeader() const
+{
+    // ObjFirstGCIndex, ObjLastNonGCIndex, MaxObjectsNotConsideredByGC, OpenForDisregardForGC,
+    // then Objects, PreAllocatedObjects, MaxElements, NumElements, MaxChunks, NumChunks
+    std::vector<uint8_t> header(0x30, 0);
+    int32_t maxElements = static_cast<int32_t>(m_chunkCount * ELEMENTS_PER_CHUNK);
+    int32_t numElements = static_cast<int32_t>(m_slotCount);
+    int32_t chunkCount = static_cast<int32_t>(m_chunkCount);
+    std::memcpy(&header[0x10], &m_chunkTable, sizeof(m_chunkTable));
+    std::memcpy(&header[0x20], &maxElements, sizeof(maxElements));
+    std::memcpy(&header[0x24], &numElements, sizeof(numElements));
+    std::memcpy(&header[0x28], &chunkCount, sizeof(chunkCount));
+    std::memcpy(&header[0x2C], &chunkCount, sizeof(chunkCount));
+    return header;
+}
+
+SyntheticChurn SyntheticObjectArray::BuildChurn(size_t every, uint64_t spareAddress) const
+{
+    SyntheticChurn churn;
+    churn.objects.address = spareAddress;
+
+    auto addressOf = [this](int32_t slot) -> uint64_t
+    {
+        auto it = std::lower_bound(m_objects.begin(), m_objects.end(), slot,
+            [](const SyntheticObject& object, int32_t value) { return object.slot < value; });
+        return it != m_objects.end() && it->slot == slot ? it->address : 0;
+    };
+    auto newObject = [&](int32_t slot) -> uint64_t
+    {
+        // Same header layout as the generated objects: an instance of the first game class
+        size_t offset = churn.objects.bytes.size();
+        churn.objects.bytes.resize(offset + 0x40, 0);
+        uint8_t* header = churn.objects.bytes.data() + offset;
+        uint64_t classAddress = addressOf(PACKAGE_CLASS_SLOT + 1);
+        uint32_t nameIndex = static_cast<uint32_t>(slot) * 2;
+        Store(header, &OBJECT_VTABLE, 8);
+        Store(header + 0x8, &RF_PUBLIC, 4);
+        Store(header + 0xC, &slot, 4);
+        Store(header + 0x10, &classAddress, 8);
+        Store(header + 0x18, &nameIndex, 4);
+        return spareAddress + offset;
+    };
+
+    size_t touched = 0;
+    for (uint32_t slot = m_classCount + 1; slot < m_slotCount; slot += static_cast<uint32_t>(every))
+    {
+        uint64_t item = m_chunkAddresses[slot / ELEMENTS_PER_CHUNK] + static_cast<uint64_t>(slot % ELEMENTS_PER_CHUNK) * ITEM_SIZE;
+        uint64_t original = addressOf(static_cast<int32_t>(slot));
+        if (m_slotStates[slot] == 0)
+        {
+            churn.apply.push_back({ item, newObject(static_cast<int32_t>(slot)), 8 });
+            churn.revert.push_back({ item, 0, 8 });
+            churn.added++;
+        }
+        else if (m_slotStates[slot] == 1)
+        {
+            switch (touched++ % 3)
+            {
+            case 0:
+                churn.apply.push_back({ item, 0, 8 });
+                churn.removed++;
+                break;
+            case 1:
+                churn.apply.push_back({ item, newObject(static_cast<int32_t>(slot)), 8 });
+                churn.changed++;
+                break;
+            default:
+                // Freed and reallocated at the same address: only the serial number tells
+                churn.apply.push_back({ item + 0x10, 1, 4 });
+                churn.revert.push_back({ item + 0x10, 0, 4 });
+                churn.changed++;
+                continue;
+            }
+            churn.revert.push_back({ item, original, 8 });
+        }
+    }
+    return churn;
+}
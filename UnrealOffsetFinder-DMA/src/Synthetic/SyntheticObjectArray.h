@@ -0,0 +1,130 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+/**
+ * @struct SyntheticObjectArrayOptions
+ * @brief Parameters of a generated GObjects array
+ */
+struct SyntheticObjectArrayOptions
+{
+    size_t slotCount = 100000;              ///< GObjects NumElements
+    uint64_t seed = 1;                      ///< Seed for classes, outers, names and object sizes
+    size_t freeEvery = 53;                  ///< Every n-th slot is free (null item, 0 = none)
+    size_t staleEvery = 0;                  ///< Every n-th item points at an object of another slot (0 = none)
+    uint32_t classCount = 256;              ///< Class objects allocated right after the root package
+    uint64_t baseAddress = 0x300000000;     ///< Chunk table, chunks and object pools are mapped from here
+    std::vector<uint32_t> nameIndices;      ///< FName indices to pick names from (empty = arbitrary)
+};
+
+/**
+ * @struct SyntheticObject
+ * @brief A generated live object as ObjectEnumerator should report it
+ */
+struct SyntheticObject
+{
+    int32_t slot;           ///< GObjects index
+    uint64_t address;       ///< UObject address
+    int32_t classSlot;      ///< Slot of ClassPrivate
+    int32_t outerSlot;      ///< Slot of OuterPrivate (-1 = none)
+    uint32_t nameIndex;     ///< FName comparison index
+    uint32_t nameNumber;    ///< FName number
+};
+
+/**
+ * @struct SyntheticRegion
+ * @brief Bytes to map at an address
+ */
+struct SyntheticRegion
+{
+    uint64_t address;               ///< Base address
+    std::vector<uint8_t> bytes;     ///< Contents
+};
+
+/**
+ * @struct SyntheticWrite
+ * @brief A small memory write (item pointer or serial number)
+ */
+struct SyntheticWrite
+{
+    uint64_t address;   ///< Target address
+    uint64_t value;     ///< Value (little endian)
+    uint32_t size;      ///< Bytes of value written (4 or 8)
+};
+
+/**
+ * @struct SyntheticChurn
+ * @brief Objects created and destroyed between two GObjects snapshots
+ */
+struct SyntheticChurn
+{
+    SyntheticRegion objects;                ///< New objects (map before applying)
+    std::vector<SyntheticWrite> apply;      ///< Item writes that perform the churn
+    std::vector<SyntheticWrite> revert;     ///< Item writes that restore the original array
+    size_t added = 0;                       ///< Free slots that receive an object
+    size_t removed = 0;                     ///< Live slots that are freed
+    size_t changed = 0;                     ///< Live slots reused by another object
+};
+
+/**
+ * @class SyntheticObjectArray
+ * @brief Deterministic generator of a UE 4.20+ FUObjectArray
+ *
+ * Builds the chunk pointer table, 0x18 byte FUObjectItem chunks of 64K
+ * entries and objects of mixed sizes packed into 16 MB pools the way
+ * FUObjectAllocator hands them out. Map GetRegions() and write
+ * BuildHeader() at the GObjects address to get an array ObjectEnumerator
+ * walks.
+ */
+class SyntheticObjectArray
+{
+public:
+    /**
+     * @brief Constructor - generates all items and objects
+     * @param options Generation options
+     */
+    explicit SyntheticObjectArray(const SyntheticObjectArrayOptions& options);
+
+    /**
+     * @brief Get the memory to map (chunk table, item chunks, object pools)
+     * @return Regions
+     */
+    const std::vector<SyntheticRegion>& GetRegions() const { return m_regions; }
+
+    /**
+     * @brief Get the live objects in slot order (stale items excluded)
+     * @return Objects
+     */
+    const std::vector<SyntheticObject>& GetObjects() const { return m_objects; }
+
+    /**
+     * @brief Build the FUObjectArray bytes (GC fields, then the chunked array)
+     * @return Header bytes
+     */
+    std::vector<uint8_t> BuildHeader() const;
+
+    /**
+     * @brief Build a churn of every n-th slot: free slots get an object, live ones are
+     *        freed, replaced by a new object or get a new serial number in turn
+     * @param every Slot interval (100 touches about 1% of the slots)
+     * @param spareAddress Where the new objects are mapped
+     * @return Writes to apply and revert the churn
+     */
+    SyntheticChurn BuildChurn(size_t every, uint64_t spareAddress) const;
+
+    static constexpr uint32_t ELEMENTS_PER_CHUNK = 64 * 1024;   ///< NumElementsPerChunk
+    static constexpr uint32_t ITEM_SIZE = 0x18;                 ///< sizeof(FUObjectItem)
+    static constexpr uint64_t POOL_SIZE = 16 * 0x100000;        ///< Bytes per object pool
+
+private:
+    std::vector<SyntheticRegion> m_regions;     ///< Mapped memory
+    std::vector<SyntheticObject> m_objects;     ///< Expected objects
+    std::vector<uint64_t> m_chunkAddresses;     ///< Address of every item chunk
+    std::vector<uint8_t> m_slotStates;          ///< Per slot: 0 free, 1 live, 2 stale item
+    uint32_t m_classCount;                      ///< Class objects after the root package
+    uint64_t m_chunkTable;                      ///< Address of the chunk pointer table
+    uint32_t m_slotCount;                       ///< NumElements
+    uint32_t m_chunkCount;                      ///< NumChunks
+};
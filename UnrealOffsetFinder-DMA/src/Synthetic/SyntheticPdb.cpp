@@ -0,0 +1,232 @@
+#include "SyntheticPdb.h"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+namespace
+{
+    constexpr char MSF_MAGIC[] = "Microsoft C/C++ MSF 7.00\r\n\x1A" "DS\0\0";
+    constexpr uint16_t NO_STREAM = 0xFFFF;
+    constexpr uint16_t SYMBOL_RECORD_STREAM = 5;
+    constexpr uint16_t SECTION_HEADER_STREAM = 6;
+    constexpr uint16_t S_PUB32 = 0x110E;
+
+    template<typename T>
+    void Append(std::vector<uint8_t>& out, T value)
+    {
+        size_t offset = out.size();
+        out.resize(offset + sizeof(T));
+        std::memcpy(&out[offset], &value, sizeof(T));
+    }
+
+    void Append16(std::vector<uint8_t>& out, uint16_t value) { Append(out, value); }
+    void Append32(std::vector<uint8_t>& out, uint32_t value) { Append(out, value); }
+
+    /**
+     * @brief TPI/IPI header of a stream without type records
+     */
+    std::vector<uint8_t> BuildEmptyTypeStream()
+    {
+        std::vector<uint8_t> stream;
+        Append32(stream, 20040203);     // Version: V80
+        Append32(stream, 56);           // Header size
+        Append32(stream, 0x1000);       // First type index
+        Append32(stream, 0x1000);       // One past the last type index
+        Append32(stream, 0);            // Type record bytes
+        Append16(stream, NO_STREAM);    // Hash stream
+        Append16(stream, NO_STREAM);    // Auxiliary hash stream
+        Append32(stream, 4);            // Hash key size
+        Append32(stream, 0x3FFFF);      // Hash buckets
+        stream.resize(56);              // Empty hash value, index offset and adjuster buffers
+        return stream;
+    }
+}
+
+SyntheticPdb::SyntheticPdb(const PeCodeView& codeView, const std::vector<SyntheticSection>& sections)
+    : m_codeView(codeView)
+    , m_sections(sections)
+{
+}
+
+void SyntheticPdb::AddSymbol(const SyntheticPdbSymbol& symbol)
+{
+    m_symbols.push_back(symbol);
+}
+
+std::vector<uint8_t> SyntheticPdb::Generate() const
+{
+    std::vector<std::vector<uint8_t>> streams(7);
+
+    // 1: PDB info - version, signature, age, GUID, empty named stream map, VC140 feature
+    std::vector<uint8_t>& info = streams[1];
+    Append32(info, 20000404);
+    Append32(info, 0x60000000);
+    Append32(info, m_codeView.age);
+    info.insert(info.end(), m_codeView.guid.begin(), m_codeView.guid.end());
+    Append32(info, 0);      // Name buffer size
+    Append32(info, 0);      // Hash table size
+    Append32(info, 1);      // Hash table capacity
+    Append32(info, 0);      // Present bit vector words
+    Append32(info, 0);      // Deleted bit vector words
+    Append32(info, 20140508);
+
+    streams[2] = BuildEmptyTypeStream();
+    streams[4] = BuildEmptyTypeStream();
+
+    // 6: section headers as in the image
+    std::vector<uint8_t>& sectionHeaders = streams[SECTION_HEADER_STREAM];
+    for (const SyntheticSection& section : m_sections)
+    {
+        size_t header = sectionHeaders.size();
+        sectionHeaders.resize(header + 40);
+        std::memcpy(&sectionHeaders[header], section.name.c_str(), std::min<size_t>(section.name.size(), 8));
+        uint32_t fields[] = { static_cast<uint32_t>(section.size), static_cast<uint32_t>(section.virtualAddress),
+                              static_cast<uint32_t>(section.size), static_cast<uint32_t>(section.virtualAddress) };
+        std::memcpy(&sectionHeaders[header + 8], fields, sizeof(fields));
+    }
+
+    // 5: S_PUB32 records addressed as section:offset, padded to 4 bytes
+    std::vector<uint8_t>& records = streams[SYMBOL_RECORD_STREAM];
+    for (const SyntheticPdbSymbol& symbol : m_symbols)
+    {
+        uint16_t segment = 0;
+        uint32_t offset = symbol.rva;
+        for (size_t i = 0; i < m_sections.size(); ++i)
+        {
+            if (symbol.rva >= m_sections[i].virtualAddress && symbol.rva < m_sections[i].virtualAddress + m_sections[i].size)
+            {
+                segment = static_cast<uint16_t>(i + 1);
+                offset = static_cast<uint32_t>(symbol.rva - m_sections[i].virtualAddress);
+            }
+        }
+
+        size_t size = (14 + symbol.name.size() + 1 + 3) & ~size_t(3);
+        Append16(records, static_cast<uint16_t>(size - 2));
+        Append16(records, S_PUB32);
+        Append32(records, symbol.function ? 0x2 : 0x0);
+        Append32(records, offset);
+        Append16(records, segment);
+        records.insert(records.end(), symbol.name.begin(), symbol.name.end());
+        records.resize(records.size() + size - 14 - symbol.name.size(), 0);
+    }
+
+    // 3: DBI - no modules; the optional debug header points at the section headers
+    std::vector<uint8_t>& dbi = streams[3];
+    Append32(dbi, 0xFFFFFFFF);          // Version signature
+    Append32(dbi, 19990903);            // Version: V70
+    Append32(dbi, m_codeView.age);
+    Append16(dbi, NO_STREAM);           // Global symbol hash stream
+    Append16(dbi, 0x8E00);              // Build number: new format, toolset 14.0
+    Append16(dbi, NO_STREAM);           // Public symbol hash stream
+    Append16(dbi, 0);                   // PDB DLL version
+    Append16(dbi, SYMBOL_RECORD_STREAM);
+    Append16(dbi, 0);                   // PDB DLL rebuild
+    Append32(dbi, 0);                   // Module info size
+    Append32(dbi, 4);                   // Section contribution size
+    Append32(dbi, 4);                   // Section map size
+    Append32(dbi, 4);                   // Source info size
+    Append32(dbi, 0);                   // Type server map size
+    Append32(dbi, 0);                   // MFC type server index
+    Append32(dbi, 22);                  // Optional debug header size
+    Append32(dbi, 0);                   // EC substream size
+    Append16(dbi, 0);                   // Flags
+    Append16(dbi, 0x8664);              // Machine: AMD64
+    Append32(dbi, 0);
+    Append32(dbi, 0xEFFE0000 + 19970605);   // Section contributions: V60, none
+    Append32(dbi, 0);                   // Section map: no segments
+    Append32(dbi, 0);                   // Source info: no modules, no files
+    for (uint16_t index = 0; index < 11; ++index)
+    {
+        Append16(dbi, index == 5 ? SECTION_HEADER_STREAM : NO_STREAM);
+    }
+
+    // Block 0 super block, 1-2 free block maps, then the streams, the directory and the block map
+    std::vector<std::vector<uint32_t>> streamBlocks(streams.size());
+    uint32_t nextBlock = 3;
+    for (size_t i = 0; i < streams.size(); ++i)
+    {
+        for (size_t done = 0; done < streams[i].size(); done += BLOCK_SIZE)
+        {
+            streamBlocks[i].push_back(nextBlock++);
+        }
+    }
+
+    std::vector<uint8_t> directory;
+    Append32(directory, static_cast<uint32_t>(streams.size()));
+    for (const auto& stream : streams)
+    {
+        Append32(directory, static_cast<uint32_t>(stream.size()));
+    }
+    for (const auto& blocks : streamBlocks)
+    {
+        for (uint32_t block : blocks)
+        {
+            Append32(directory, block);
+        }
+    }
+
+    std::vector<uint8_t> blockMap;
+    for (size_t done = 0; done < directory.size(); done += BLOCK_SIZE)
+    {
+        Append32(blockMap, nextBlock++);
+    }
+    uint32_t blockMapBlock = nextBlock++;
+    uint32_t blockCount = nextBlock;
+
+    std::vector<uint8_t> file(static_cast<size_t>(blockCount) * BLOCK_SIZE, 0);
+    auto write = [&](uint32_t block, const std::vector<uint8_t>& data, size_t offset)
+    {
+        size_t size = std::min<size_t>(BLOCK_SIZE, data.size() - offset);
+        std::memcpy(&file[static_cast<size_t>(block) * BLOCK_SIZE], data.data() + offset, size);
+    };
+
+    std::memcpy(file.data(), MSF_MAGIC, 32);
+    uint32_t superBlock[] = { BLOCK_SIZE, 1, blockCount, static_cast<uint32_t>(directory.size()), 0, blockMapBlock };
+    std::memcpy(file.data() + 32, superBlock, sizeof(superBlock));
+
+    // Free block maps: a set bit is a free block
+    for (uint32_t map = 1; map <= 2; ++map)
+    {
+        uint8_t* bits = &file[static_cast<size_t>(map) * BLOCK_SIZE];
+        std::memset(bits, 0xFF, BLOCK_SIZE);
+        for (uint32_t block = 0; block < blockCount; ++block)
+        {
+            bits[block / 8] &= static_cast<uint8_t>(~(1u << (block % 8)));
+        }
+    }
+
+    for (size_t i = 0; i < streams.size(); ++i)
+    {
+        for (size_t j = 0; j < streamBlocks[i].size(); ++j)
+        {
+            write(streamBlocks[i][j], streams[i], j * BLOCK_SIZE);
+        }
+    }
+    for (size_t j = 0; j < blockMap.size() / 4; ++j)
+    {
+        uint32_t block;
+        std::memcpy(&block, &blockMap[j * 4], 4);
+        write(block, directory, j * BLOCK_SIZE);
+    }
+    write(blockMapBlock, blockMap, 0);
+    return file;
+}
+
+bool SyntheticPdb::WriteToFile(const std::string& filename) const
+{
+    std::ofstream file(filename, std::ios::binary);
+    if (!file.is_open())
+    {
+        std::cerr << "Failed to open " << filename << " for writing" << std::endl;
+        return false;
+    }
+
+    std::vector<uint8_t> bytes = Generate();
+    if (!file.write(reinterpret_cast<const char*>(bytes.data()), bytes.size()))
+    {
+        std::cerr << "Failed to write " << filename << std::endl;
+        return false;
+    }
+    return true;
+}
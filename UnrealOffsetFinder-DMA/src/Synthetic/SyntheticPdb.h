@@ -0,0 +1,63 @@
+#pragma once
+
+#include "SyntheticImage.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @struct SyntheticPdbSymbol
+ * @brief Public symbol written to a generated PDB
+ */
+struct SyntheticPdbSymbol
+{
+    std::string name;       ///< Decorated name
+    uint32_t rva;           ///< RVA of the symbol
+    bool function;          ///< Marked as code (PdbFile ignores these)
+};
+
+/**
+ * @class SyntheticPdb
+ * @brief Writer of minimal MSF 7.0 PDBs for generated images
+ *
+ * Emits the streams PdbFile and llvm-pdbutil need: PDB info (GUID, age),
+ * empty TPI/IPI, a DBI stream without modules whose optional debug header
+ * names the section header stream, the section headers and a symbol record
+ * stream of S_PUB32 records. No hash or address map streams are written.
+ */
+class SyntheticPdb
+{
+public:
+    /**
+     * @brief Constructor - a PDB for an image with these sections and CodeView record
+     * @param codeView GUID and age the PDB must carry to match the image
+     * @param sections Image sections (symbols are stored as section:offset)
+     */
+    SyntheticPdb(const PeCodeView& codeView, const std::vector<SyntheticSection>& sections);
+
+    /**
+     * @brief Add a public symbol
+     * @param symbol Symbol
+     */
+    void AddSymbol(const SyntheticPdbSymbol& symbol);
+
+    /**
+     * @brief Build the PDB file contents
+     * @return File bytes
+     */
+    std::vector<uint8_t> Generate() const;
+
+    /**
+     * @brief Write the PDB to a file
+     * @param filename Output file
+     * @return true if successful, false otherwise
+     */
+    bool WriteToFile(const std::string& filename) const;
+
+    static constexpr uint32_t BLOCK_SIZE = 0x1000;  ///< MSF block size
+
+private:
+    PeCodeView m_codeView;                      ///< GUID and age
+    std::vector<SyntheticSection> m_sections;   ///< Section table
+    std::vector<SyntheticPdbSymbol> m_symbols;  ///< Public symbols
+};
@@ -0,0 +1,245 @@
+#include "SyntheticReflection.h"
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+#include <string>
+
+namespace
+{
+    /**
+     * @brief SplitMix64, same generator as the synthetic image
+     */
+    struct Random
+    {
+        uint64_t state;
+
+        explicit Random(uint64_t seed) : state(seed) {}
+
+        uint64_t Next()
+        {
+            uint64_t z = (state += 0x9E3779B97F4A7C15ULL);
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+            return z ^ (z >> 31);
+        }
+
+        uint32_t Below(uint32_t bound) { return static_cast<uint32_t>(Next() % bound); }
+    };
+
+    struct PropertyType
+    {
+        const char* name;
+        int32_t size;
+        int32_t alignment;
+    };
+
+    constexpr PropertyType PROPERTY_TYPES[] = {
+        { "IntProperty", 4, 4 },    { "FloatProperty", 4, 4 },      { "BoolProperty", 1, 1 },
+        { "ByteProperty", 1, 1 },   { "NameProperty", 8, 4 },       { "ObjectProperty", 8, 8 },
+        { "StrProperty", 0x10, 8 }, { "ArrayProperty", 0x10, 8 },   { "StructProperty", 0xC, 4 },
+        { "DoubleProperty", 8, 8 },
+    };
+
+    // Engine classes every build has, all instances of Class
+    struct EngineClass
+    {
+        const char* name;
+        int32_t superSlot;
+        int32_t size;
+    };
+
+    constexpr int32_t PACKAGE_SLOT = 0;
+    constexpr int32_t OBJECT_SLOT = 1;
+    constexpr int32_t CLASS_SLOT = 4;
+    constexpr int32_t SCRIPT_STRUCT_SLOT = 5;
+    constexpr int32_t PACKAGE_CLASS_SLOT = 6;
+    constexpr int32_t FUNCTION_SLOT = 7;
+    constexpr int32_t BLUEPRINT_CLASS_SLOT = 8;
+    constexpr EngineClass ENGINE_CLASSES[] = {
+        { "Object", -1, 0x28 },     { "Field", 1, 0x30 },       { "Struct", 2, 0xB0 },
+        { "Class", 3, 0x230 },      { "ScriptStruct", 3, 0xC0 }, { "Package", 1, 0x180 },
+        { "Function", 3, 0xE0 },    { "BlueprintGeneratedClass", 4, 0x330 },
+    };
+
+    constexpr uint32_t MEMBER_NAMES = 1024;
+    constexpr uint64_t FIELD_CLASSES_OFFSET = 0x1000000;   // FFieldClasses follow the structs
+    constexpr uint64_t FIELDS_OFFSET = 0x10000000;          // FProperties 256 MB above the base
+    constexpr uint64_t INSTANCES_OFFSET = 0x40000000;       // Plain objects are never read
+    constexpr uint64_t FIELD_CLASS_STRIDE = 0x40;
+    constexpr uint64_t OBJECT_VTABLE = 0x140100000;
+    constexpr uint64_t PROPERTY_VTABLE = 0x140200000;
+    constexpr uint32_t RF_PUBLIC = 0x1;
+    constexpr uint64_t CPF_EDIT = 0x1;
+
+    void Store(uint8_t* data, const void* value, size_t size)
+    {
+        std::memcpy(data, value, size);
+    }
+
+    int32_t AlignUp(int32_t value, int32_t alignment)
+    {
+        return (value + alignment - 1) / alignment * alignment;
+    }
+}
+
+SyntheticReflection::SyntheticReflection(const SyntheticReflectionOptions& options)
+{
+    Random random(options.seed);
+
+    // Names get ascending indices in creation order
+    uint32_t nextName = 0;
+    auto addName = [&](const std::string& name)
+    {
+        uint32_t index = nextName++;
+        m_names.Append(index, name);
+        return index;
+    };
+    addName("None");
+    addName("/Script/CoreUObject");
+
+    SyntheticRegion fieldClasses{ options.baseAddress + FIELD_CLASSES_OFFSET,
+                                  std::vector<uint8_t>(std::size(PROPERTY_TYPES) * FIELD_CLASS_STRIDE, 0) };
+    for (size_t i = 0; i < std::size(PROPERTY_TYPES); ++i)
+    {
+        uint32_t nameIndex = addName(PROPERTY_TYPES[i].name);
+        Store(fieldClasses.bytes.data() + i * FIELD_CLASS_STRIDE, &nameIndex, 4);
+    }
+    uint32_t firstMember = nextName;
+    for (uint32_t i = 0; i < MEMBER_NAMES; ++i)
+    {
+        addName("Member_" + std::to_string(i));
+    }
+
+    struct Node
+    {
+        uint64_t address;
+        int32_t classSlot;
+        int32_t superSlot;
+        uint32_t nameIndex;
+        int32_t size;
+        bool isStruct;
+    };
+    std::vector<Node> nodes;
+    uint64_t nextStruct = options.baseAddress;
+    auto addStruct = [&](const std::string& name, int32_t classSlot, int32_t superSlot, int32_t size)
+    {
+        nodes.push_back({ nextStruct, classSlot, superSlot, addName(name), size, true });
+        nextStruct += STRUCT_STRIDE;
+        return static_cast<int32_t>(nodes.size() - 1);
+    };
+
+    nodes.push_back({ options.baseAddress + INSTANCES_OFFSET, PACKAGE_CLASS_SLOT, -1, 1, 0, false });
+    for (const EngineClass& engineClass : ENGINE_CLASSES)
+    {
+        addStruct(engineClass.name, CLASS_SLOT, engineClass.superSlot, engineClass.size);
+    }
+
+    // Native classes mostly derive from recent classes, which builds deep shared hierarchies
+    int32_t firstGameClass = static_cast<int32_t>(nodes.size());
+    for (uint32_t i = 0; i < options.classCount; ++i)
+    {
+        int32_t gameClasses = static_cast<int32_t>(nodes.size()) - firstGameClass;
+        int32_t super = gameClasses == 0 || random.Below(8) == 0
+            ? OBJECT_SLOT
+            : firstGameClass + gameClasses - 1 - static_cast<int32_t>(random.Below(std::min(gameClasses, 64)));
+        addStruct("GameClass_" + std::to_string(i), CLASS_SLOT, super, 0);
+    }
+    int32_t firstStruct = static_cast<int32_t>(nodes.size());
+    for (uint32_t i = 0; i < options.structCount; ++i)
+    {
+        int32_t structs = static_cast<int32_t>(nodes.size()) - firstStruct;
+        int32_t super = structs > 0 && random.Below(8) == 0 ? firstStruct + static_cast<int32_t>(random.Below(structs)) : -1;
+        addStruct("GameStruct_" + std::to_string(i), SCRIPT_STRUCT_SLOT, super, 0);
+    }
+    for (uint32_t i = 0; options.classCount > 0 && i < options.blueprintCount; ++i)
+    {
+        int32_t super = firstGameClass + static_cast<int32_t>(random.Below(options.classCount));
+        addStruct("BP_Actor_" + std::to_string(i) + "_C", BLUEPRINT_CLASS_SLOT, super, 0);
+    }
+    for (uint32_t i = 0; i < options.instanceCount; ++i)
+    {
+        int32_t classSlot = options.classCount > 0 && random.Below(16) != 0
+            ? firstGameClass + static_cast<int32_t>(random.Below(options.classCount))
+            : FUNCTION_SLOT;
+        uint32_t nameIndex = firstMember + random.Below(MEMBER_NAMES);
+        nodes.push_back({ options.baseAddress + INSTANCES_OFFSET + (i + 1) * 0x40ULL, classSlot, -1, nameIndex, 0, false });
+    }
+
+    // UStructs with their property chains; chains run against offset order like many real builds
+    SyntheticRegion structs{ options.baseAddress, std::vector<uint8_t>(static_cast<size_t>(nextStruct - options.baseAddress), 0) };
+    SyntheticRegion fields{ options.baseAddress + FIELDS_OFFSET, {} };
+    for (size_t slot = 0; slot < nodes.size(); ++slot)
+    {
+        Node& node = nodes[slot];
+        if (!node.isStruct)
+        {
+            continue;
+        }
+
+        uint32_t propertyCount = 0;
+        if (static_cast<int32_t>(slot) >= firstGameClass)
+        {
+            propertyCount = random.Below(100) == 0 ? 100 + random.Below(100) : random.Below(24);
+        }
+
+        int32_t offset = node.superSlot >= 0 ? nodes[node.superSlot].size : 0;
+        uint64_t head = 0;
+        for (uint32_t i = 0; i < propertyCount; ++i)
+        {
+            uint32_t type = random.Below(static_cast<uint32_t>(std::size(PROPERTY_TYPES)));
+            int32_t arrayDim = random.Below(32) == 0 ? 2 + static_cast<int32_t>(random.Below(7)) : 1;
+            uint32_t nameIndex = firstMember + random.Below(MEMBER_NAMES);
+            offset = AlignUp(offset, PROPERTY_TYPES[type].alignment);
+
+            size_t position = fields.bytes.size();
+            fields.bytes.resize(position + FIELD_STRIDE, 0);
+            uint8_t* field = fields.bytes.data() + position;
+            uint64_t fieldClass = fieldClasses.address + type * FIELD_CLASS_STRIDE;
+            Store(field, &PROPERTY_VTABLE, 8);
+            Store(field + 0x8, &fieldClass, 8);
+            Store(field + 0x10, &node.address, 8);
+            Store(field + 0x20, &head, 8);
+            Store(field + 0x28, &nameIndex, 4);
+            Store(field + 0x38, &arrayDim, 4);
+            Store(field + 0x3C, &PROPERTY_TYPES[type].size, 4);
+            Store(field + 0x40, &CPF_EDIT, 8);
+            Store(field + 0x4C, &offset, 4);
+            head = fields.address + position;
+
+            offset += PROPERTY_TYPES[type].size * arrayDim;
+        }
+        if (node.size == 0)
+        {
+            node.size = AlignUp(std::max(offset, 1), 8);
+        }
+        m_propertyCount += propertyCount;
+
+        uint8_t* header = structs.bytes.data() + (node.address - options.baseAddress);
+        int32_t internalIndex = static_cast<int32_t>(slot);
+        uint64_t classAddress = nodes[node.classSlot].address;
+        uint64_t outerAddress = nodes[PACKAGE_SLOT].address;
+        uint64_t superAddress = node.superSlot >= 0 ? nodes[node.superSlot].address : 0;
+        Store(header, &OBJECT_VTABLE, 8);
+        Store(header + 0x8, &RF_PUBLIC, 4);
+        Store(header + 0xC, &internalIndex, 4);
+        Store(header + 0x10, &classAddress, 8);
+        Store(header + 0x18, &node.nameIndex, 4);
+        Store(header + 0x20, &outerAddress, 8);
+        Store(header + 0x40, &superAddress, 8);
+        Store(header + 0x50, &head, 8);
+        Store(header + 0x58, &node.size, 4);
+
+        m_structs.push_back({ node.address, superAddress, node.nameIndex, nodes[node.classSlot].nameIndex, node.size, propertyCount });
+    }
+
+    m_objects.Reserve(nodes.size());
+    for (size_t slot = 0; slot < nodes.size(); ++slot)
+    {
+        m_objects.Add(static_cast<int32_t>(slot), nodes[slot].address, RF_PUBLIC, 0, nodes[slot].nameIndex, 0);
+        m_objects.SetReferences(slot, nodes[slot].classSlot, slot == PACKAGE_SLOT ? -1 : PACKAGE_SLOT);
+    }
+
+    m_regions.push_back(std::move(structs));
+    m_regions.push_back(std::move(fieldClasses));
+    m_regions.push_back(std::move(fields));
+}
@@ -0,0 +1,96 @@
+#pragma once
+
+#include "SyntheticObjectArray.h"
+#include "../Unreal/NameTable.h"
+#include "../Unreal/ObjectIndex.h"
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+/**
+ * @struct SyntheticReflectionOptions
+ * @brief Parameters of generated reflection data
+ */
+struct SyntheticReflectionOptions
+{
+    uint32_t classCount = 20000;            ///< Native game classes (instances of Class)
+    uint32_t structCount = 6000;            ///< Script structs (instances of ScriptStruct)
+    uint32_t blueprintCount = 2000;         ///< Blueprint classes (instances of BlueprintGeneratedClass)
+    uint32_t instanceCount = 50000;         ///< Plain objects and functions that must not be indexed
+    uint64_t seed = 1;                      ///< Seed for hierarchy, property counts and types
+    uint64_t baseAddress = 0x500000000;     ///< Structs, fields and field classes are mapped from here
+};
+
+/**
+ * @struct SyntheticStruct
+ * @brief A generated UStruct as LayoutIndexer should report it
+ */
+struct SyntheticStruct
+{
+    uint64_t address;           ///< UStruct address
+    uint64_t superAddress;      ///< SuperStruct (0 = none)
+    uint32_t nameIndex;         ///< FName comparison index
+    uint32_t kindIndex;         ///< FName index of its metaclass
+    int32_t size;               ///< PropertiesSize
+    uint32_t propertyCount;     ///< Own properties
+};
+
+/**
+ * @class SyntheticReflection
+ * @brief Deterministic generator of UE 4.25+ reflection data
+ *
+ * Builds a class hierarchy rooted at Object (engine classes, native game
+ * classes deriving from each other, script structs and blueprint classes
+ * whose metaclass derives from Class), each UStruct with a ChildProperties
+ * chain of FProperties. The object index and name table that describe it
+ * stand in for an enumerated GObjects and a dumped FNamePool.
+ */
+class SyntheticReflection
+{
+public:
+    /**
+     * @brief Constructor - generates all structs and properties
+     * @param options Generation options
+     */
+    explicit SyntheticReflection(const SyntheticReflectionOptions& options);
+
+    /**
+     * @brief Get the memory to map (structs, FFields, FFieldClasses)
+     * @return Regions
+     */
+    const std::vector<SyntheticRegion>& GetRegions() const { return m_regions; }
+
+    /**
+     * @brief Get the objects, as an ObjectEnumerator would report them
+     * @return Object index
+     */
+    const ObjectIndex& GetObjects() const { return m_objects; }
+
+    /**
+     * @brief Get the names of all objects, properties and field classes
+     * @return Name table
+     */
+    const NameTable& GetNames() const { return m_names; }
+
+    /**
+     * @brief Get every struct that should be indexed, in slot order
+     * @return Structs
+     */
+    const std::vector<SyntheticStruct>& GetStructs() const { return m_structs; }
+
+    /**
+     * @brief Get the number of properties over all structs
+     * @return Properties
+     */
+    size_t GetPropertyCount() const { return m_propertyCount; }
+
+    static constexpr uint64_t STRUCT_STRIDE = 0x100;    ///< Bytes reserved per UStruct
+    static constexpr uint64_t FIELD_STRIDE = 0x78;      ///< sizeof(FProperty)
+
+private:
+    std::vector<SyntheticRegion> m_regions;     ///< Mapped memory
+    ObjectIndex m_objects;                      ///< Objects describing the structs
+    NameTable m_names;                          ///< Names
+    std::vector<SyntheticStruct> m_structs;     ///< Expected structs
+    size_t m_propertyCount = 0;                 ///< Expected properties
+};
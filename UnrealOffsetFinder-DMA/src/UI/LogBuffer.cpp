@@ -0,0 +1,116 @@
+#include "LogBuffer.h"
+#include "../Core/StringUtils.h"
+#include <algorithm>
+#include <cstring>
+
+namespace
+{
+    const char* const LEVEL_TAGS[] = { "[INFO]", "[SUCCESS]", "[WARNING]", "[ERROR]" };
+}
+
+LogBuffer::LogBuffer(size_t capacity)
+    : m_entries(std::max<size_t>(capacity, 1))
+    , m_count(0)
+    , m_nextSequence(0)
+    , m_version(0)
+    , m_levelMask(ALL_LEVELS)
+{
+}
+
+void LogBuffer::Add(const std::string& message)
+{
+    LogLevel level = LogLevel::Info;
+    size_t textStart = 0;
+    for (size_t i = 0; i < static_cast<size_t>(LogLevel::Count); ++i)
+    {
+        size_t tagLength = std::strlen(LEVEL_TAGS[i]);
+        if (message.compare(0, tagLength, LEVEL_TAGS[i]) == 0)
+        {
+            level = static_cast<LogLevel>(i);
+            textStart = tagLength;
+            if (textStart < message.size() && message[textStart] == ' ')
+                textStart++;
+            break;
+        }
+    }
+
+    // Overwrite the oldest line once full, dropping it from the filtered view too
+    if (m_count == m_entries.size())
+    {
+        uint64_t evicted = m_nextSequence - m_count;
+        if (!m_filtered.empty() && m_filtered.front() == evicted)
+        {
+            m_filtered.pop_front();
+        }
+    }
+    else
+    {
+        m_count++;
+    }
+
+    LogEntry& entry = m_entries[m_nextSequence % m_entries.size()];
+    entry.sequence = m_nextSequence++;
+    entry.level = level;
+    entry.text.assign(message, textStart, std::string::npos);
+
+    if (Matches(entry))
+    {
+        m_filtered.push_back(entry.sequence);
+    }
+    m_version++;
+}
+
+void LogBuffer::Clear()
+{
+    for (auto& entry : m_entries)
+    {
+        entry.text.clear();
+        entry.text.shrink_to_fit();
+    }
+    m_count = 0;
+    m_nextSequence = 0;
+    m_filtered.clear();
+    m_version++;
+}
+
+void LogBuffer::SetFilter(uint32_t levelMask, const std::string& text)
+{
+    std::string filterText = ToLower(text);
+    if (levelMask == m_levelMask && filterText == m_filterText)
+    {
+        return;
+    }
+
+    m_levelMask = levelMask;
+    m_filterText = std::move(filterText);
+
+    m_filtered.clear();
+    for (uint64_t sequence = m_nextSequence - m_count; sequence < m_nextSequence; ++sequence)
+    {
+        if (Matches(GetBySequence(sequence)))
+        {
+            m_filtered.push_back(sequence);
+        }
+    }
+    m_version++;
+}
+
+const LogEntry& LogBuffer::GetFiltered(size_t index) const
+{
+    return GetBySequence(m_filtered[index]);
+}
+
+const char* LogBuffer::GetLevelTag(LogLevel level)
+{
+    size_t index = static_cast<size_t>(level);
+    return index < static_cast<size_t>(LogLevel::Count) ? LEVEL_TAGS[index] : "";
+}
+
+bool LogBuffer::Matches(const LogEntry& entry) const
+{
+    if (!(m_levelMask & (1u << static_cast<uint32_t>(entry.level))))
+    {
+        return false;
+    }
+    return m_filterText.empty() || ToLower(entry.text).find(m_filterText) != std::string::npos;
+}
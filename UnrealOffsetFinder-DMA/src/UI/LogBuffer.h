@@ -0,0 +1,126 @@
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <vector>
+
+/**
+ * @enum LogLevel
+ * @brief Severity of a status log line
+ */
+enum class LogLevel : uint8_t
+{
+    Info = 0,       ///< "[INFO]"
+    Success,        ///< "[SUCCESS]"
+    Warning,        ///< "[WARNING]"
+    Error,          ///< "[ERROR]"
+    Count
+};
+
+/**
+ * @struct LogEntry
+ * @brief One status log line
+ */
+struct LogEntry
+{
+    uint64_t sequence = 0;              ///< Position in the log since the last Clear()
+    LogLevel level = LogLevel::Info;    ///< Severity (the tag is not stored in the text)
+    std::string text;                   ///< Message without its severity tag
+};
+
+/**
+ * @class LogBuffer
+ * @brief Fixed-capacity ring of status log lines with an incremental filter index
+ *
+ * The oldest line is overwritten once the buffer is full. Lines matching the
+ * current filter are indexed as they are added, so drawing a filtered view
+ * costs only the visible lines; the index is rebuilt only when the filter
+ * changes.
+ */
+class LogBuffer
+{
+public:
+    /**
+     * @brief Constructor
+     * @param capacity Maximum number of lines kept
+     */
+    explicit LogBuffer(size_t capacity = DEFAULT_CAPACITY);
+
+    /**
+     * @brief Add a line
+     * @param message Message, optionally starting with a "[LEVEL]" tag (untagged lines are Info)
+     */
+    void Add(const std::string& message);
+
+    /**
+     * @brief Remove all lines
+     */
+    void Clear();
+
+    /**
+     * @brief Set the filter applied to the indexed view
+     * @param levelMask Bit (1 << level) per visible level
+     * @param text Case-insensitive substring the line must contain (empty = any)
+     */
+    void SetFilter(uint32_t levelMask, const std::string& text);
+
+    /**
+     * @brief Get the number of lines passing the filter
+     * @return Filtered line count
+     */
+    size_t GetFilteredCount() const { return m_filtered.size(); }
+
+    /**
+     * @brief Get a line passing the filter
+     * @param index Index into the filtered view (0 = oldest)
+     * @return Log entry
+     */
+    const LogEntry& GetFiltered(size_t index) const;
+
+    /**
+     * @brief Get the number of lines kept
+     * @return Line count
+     */
+    size_t GetCount() const { return m_count; }
+
+    /**
+     * @brief Get a counter that changes whenever a line is added or the log is cleared
+     * @return Version
+     */
+    uint64_t GetVersion() const { return m_version; }
+
+    /**
+     * @brief Get the tag of a level
+     * @param level Level
+     * @return Interned tag, e.g. "[INFO]"
+     */
+    static const char* GetLevelTag(LogLevel level);
+
+    static constexpr size_t DEFAULT_CAPACITY = 5000;                                ///< Lines kept by default
+    static constexpr uint32_t ALL_LEVELS = (1u << static_cast<uint32_t>(LogLevel::Count)) - 1; ///< Mask showing every level
+
+private:
+    /**
+     * @brief Check a line against the current filter
+     * @param entry Line to check
+     * @return true if visible
+     */
+    bool Matches(const LogEntry& entry) const;
+
+    /**
+     * @brief Get the line with the given sequence number (must still be kept)
+     * @param sequence Sequence number
+     * @return Log entry
+     */
+    const LogEntry& GetBySequence(uint64_t sequence) const { return m_entries[sequence % m_entries.size()]; }
+
+private:
+    std::vector<LogEntry> m_entries;    ///< Ring storage, line N lives at N % capacity
+    size_t m_count;                     ///< Lines kept
+    uint64_t m_nextSequence;            ///< Sequence number of the next line
+    uint64_t m_version;                 ///< Bumped on every change
+    uint32_t m_levelMask;               ///< Visible levels
+    std::string m_filterText;           ///< Lower-case text filter
+    std::deque<uint64_t> m_filtered;    ///< Sequence numbers of kept lines passing the filter, oldest first
+};
@@ -0,0 +1,225 @@
+#include "MemoryViewer.h"
+#include "LogBuffer.h"
+#include "../DMA/DMAManager.h"
+#include <imgui.h>
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+MemoryViewer::MemoryViewer()
+    : m_dmaManager(nullptr)
+    , m_windowBase(0)
+    , m_firstVisibleRow(0)
+    , m_pendingScrollRow(-1)
+    , m_renderedVersion(0)
+    , m_lastGeneration(0)
+    , m_liveRefresh(true)
+    , m_refreshRate(4)
+{
+    memset(m_addressBuffer, 0, sizeof(m_addressBuffer));
+}
+
+MemoryViewer::~MemoryViewer()
+{
+    m_cache.reset();
+}
+
+void MemoryViewer::SetDMAManager(DMAManager* dmaManager)
+{
+    m_cache.reset();
+    m_dmaManager = dmaManager;
+    if (m_dmaManager)
+    {
+        m_cache = std::make_unique<PageCache>(*m_dmaManager);
+    }
+}
+
+void MemoryViewer::Pause()
+{
+    if (m_cache)
+    {
+        m_cache->SetView(0, 0);
+    }
+}
+
+bool MemoryViewer::WantsRedraw() const
+{
+    return m_cache && m_cache->GetVersion() != m_renderedVersion;
+}
+
+void MemoryViewer::GoTo(uint64_t address)
+{
+    address = std::min(address, MAX_ADDRESS) & ~(BYTES_PER_ROW - 1);
+
+    // Put the target in the middle of the scroll window so both directions have room
+    uint64_t halfWindow = (VIEW_WINDOW_ROWS / 2) * BYTES_PER_ROW;
+    m_windowBase = address > halfWindow ? address - halfWindow : 0;
+    m_pendingScrollRow = static_cast<int64_t>((address - m_windowBase) / BYTES_PER_ROW);
+    snprintf(m_addressBuffer, sizeof(m_addressBuffer), "0x%llX", static_cast<unsigned long long>(address));
+}
+
+void MemoryViewer::Render(bool* open, LogBuffer& log)
+{
+    ImGui::SetNextWindowSize(ImVec2(720, 480), ImGuiCond_FirstUseEver);
+
+    if (!ImGui::Begin("Memory Viewer", open))
+    {
+        ImGui::End();
+        Pause();
+        return;
+    }
+
+    if (!m_dmaManager || !m_cache)
+    {
+        ImGui::Text("DMA Manager not available");
+        ImGui::End();
+        return;
+    }
+
+    // Start at the main module of a newly attached process
+    auto snapshot = m_dmaManager->GetProcessSnapshot();
+    if (snapshot->generation != m_lastGeneration)
+    {
+        m_lastGeneration = snapshot->generation;
+        if (snapshot->process.processId != 0)
+        {
+            GoTo(snapshot->GetMainModuleBase());
+        }
+    }
+
+    ImGui::SetNextItemWidth(180.0f);
+    bool go = ImGui::InputText("Address", m_addressBuffer, sizeof(m_addressBuffer), ImGuiInputTextFlags_EnterReturnsTrue);
+    ImGui::SameLine();
+    go |= ImGui::Button("Go");
+    if (go)
+    {
+        uint64_t address = DMAManager::ParseHexAddress(m_addressBuffer);
+        if (address != 0)
+        {
+            GoTo(address);
+        }
+        else
+        {
+            log.Add("[ERROR] Invalid address format");
+        }
+    }
+
+    ImGui::SameLine();
+    ImGui::Checkbox("Live", &m_liveRefresh);
+    ImGui::SameLine();
+    ImGui::SetNextItemWidth(120.0f);
+    ImGui::SliderInt("Hz", &m_refreshRate, 1, 30);
+    m_cache->SetRefreshInterval(m_liveRefresh ? 1.0f / m_refreshRate : 0.0f);
+
+    ImGui::Separator();
+
+    if (!m_dmaManager->IsConnected())
+    {
+        ImGui::Text("Not connected to any process");
+        ImGui::End();
+        Pause();
+        return;
+    }
+
+    RenderRows();
+    m_renderedVersion = m_cache->GetVersion();
+
+    ImGui::End();
+}
+
+void MemoryViewer::RenderRows()
+{
+    ImGui::BeginChild("HexRows", ImVec2(0, 0), false, ImGuiWindowFlags_NoMove);
+
+    float rowHeight = ImGui::GetTextLineHeightWithSpacing();
+    if (m_pendingScrollRow >= 0)
+    {
+        ImGui::SetScrollY(m_pendingScrollRow * rowHeight);
+        m_pendingScrollRow = -1;
+    }
+
+    // Report exactly what is on screen; the cache adds the prefetch margin
+    uint64_t firstRow = static_cast<uint64_t>(ImGui::GetScrollY() / rowHeight);
+    uint64_t rowCount = static_cast<uint64_t>(ImGui::GetWindowHeight() / rowHeight) + 1;
+    uint64_t viewStart = m_windowBase + firstRow * BYTES_PER_ROW;
+    m_cache->SetView(viewStart, viewStart + rowCount * BYTES_PER_ROW);
+    m_firstVisibleRow = firstRow;
+
+    ImVec4 changedColor(1.0f, 0.45f, 0.35f, 1.0f);
+    ImVec4 missingColor(0.45f, 0.5f, 0.55f, 1.0f);
+    auto now = std::chrono::steady_clock::now();
+
+    ImGuiListClipper clipper;
+    clipper.Begin(static_cast<int>(VIEW_WINDOW_ROWS), rowHeight);
+    while (clipper.Step())
+    {
+        std::shared_ptr<const PageCache::Page> page;
+        for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; ++row)
+        {
+            uint64_t rowAddress = m_windowBase + static_cast<uint64_t>(row) * BYTES_PER_ROW;
+            if (!page || rowAddress - page->address >= PageCache::PAGE_SIZE)
+            {
+                page = m_cache->GetPage(rowAddress);
+            }
+
+            ImGui::Text("%012llX ", static_cast<unsigned long long>(rowAddress));
+
+            size_t offset = page ? static_cast<size_t>(rowAddress - page->address) : 0;
+            bool highlight = page && std::chrono::duration<float>(now - page->changeTime).count() < CHANGE_HIGHLIGHT_TIME;
+            char ascii[BYTES_PER_ROW + 1] = {};
+            for (uint64_t i = 0; i < BYTES_PER_ROW; ++i)
+            {
+                ImGui::SameLine(0.0f, i == 8 ? 10.0f : 6.0f);
+                if (!page)
+                {
+                    ImGui::TextColored(missingColor, "..");
+                    ascii[i] = ' ';
+                }
+                else if (offset + i >= page->bytesRead)
+                {
+                    ImGui::TextColored(missingColor, "??");
+                    ascii[i] = ' ';
+                }
+                else
+                {
+                    uint8_t value = page->data[offset + i];
+                    if (highlight && page->changed[offset + i])
+                        ImGui::TextColored(changedColor, "%02X", value);
+                    else
+                        ImGui::Text("%02X", value);
+                    ascii[i] = (value >= 0x20 && value < 0x7F) ? static_cast<char>(value) : '.';
+                }
+            }
+
+            ImGui::SameLine(0.0f, 16.0f);
+            ImGui::TextUnformatted(ascii, ascii + BYTES_PER_ROW);
+        }
+    }
+    clipper.End();
+
+    RecenterWindow(rowHeight);
+
+    ImGui::EndChild();
+}
+
+void MemoryViewer::RecenterWindow(float rowHeight)
+{
+    // Shift the window by a quarter when the view gets within an eighth of an edge
+    const uint64_t margin = VIEW_WINDOW_ROWS / 8;
+    const uint64_t shiftRows = VIEW_WINDOW_ROWS / 4;
+    const uint64_t shiftBytes = shiftRows * BYTES_PER_ROW;
+    uint64_t windowEnd = m_windowBase + VIEW_WINDOW_ROWS * BYTES_PER_ROW;
+
+    if (m_firstVisibleRow < margin && m_windowBase > 0)
+    {
+        uint64_t shift = std::min(m_windowBase, shiftBytes);
+        m_windowBase -= shift;
+        ImGui::SetScrollY(ImGui::GetScrollY() + (shift / BYTES_PER_ROW) * rowHeight);
+    }
+    else if (m_firstVisibleRow > VIEW_WINDOW_ROWS - margin && windowEnd < MAX_ADDRESS)
+    {
+        uint64_t shift = std::min(MAX_ADDRESS - windowEnd, shiftBytes) & ~(BYTES_PER_ROW - 1);
+        m_windowBase += shift;
+        ImGui::SetScrollY(ImGui::GetScrollY() - (shift / BYTES_PER_ROW) * rowHeight);
+    }
+}
@@ -0,0 +1,91 @@
+#pragma once
+
+#include "../DMA/PageCache.h"
+#include <cstdint>
+#include <memory>
+
+class DMAManager;
+class LogBuffer;
+
+/**
+ * @class MemoryViewer
+ * @brief Hex/ASCII view of target memory backed by a PageCache
+ *
+ * Only the rows on screen are drawn. The scroll area covers a window of
+ * VIEW_WINDOW_ROWS rows that is re-centred as the user scrolls near its
+ * edges, so the whole address space scrolls without running into float
+ * precision limits. Drawing only reads cached pages; missing bytes show as
+ * ".." until the background fetch lands.
+ */
+class MemoryViewer
+{
+public:
+    /**
+     * @brief Constructor
+     */
+    MemoryViewer();
+
+    /**
+     * @brief Destructor - stops page fetching
+     */
+    ~MemoryViewer();
+
+    /**
+     * @brief Set the DMA manager to read through (creates the page cache)
+     * @param dmaManager DMA manager, nullptr to detach
+     */
+    void SetDMAManager(DMAManager* dmaManager);
+
+    /**
+     * @brief Draw the viewer window
+     * @param open Window open flag (cleared when the user closes the window)
+     * @param log Status log for user-facing messages
+     */
+    void Render(bool* open, LogBuffer& log);
+
+    /**
+     * @brief Stop fetching while the window is closed
+     */
+    void Pause();
+
+    /**
+     * @brief Check whether fetched pages arrived since the last Render()
+     * @return true if a redraw would show new data
+     */
+    bool WantsRedraw() const;
+
+    /**
+     * @brief Scroll to an address
+     * @param address Address to show at the top
+     */
+    void GoTo(uint64_t address);
+
+    static constexpr uint64_t BYTES_PER_ROW = 16;               ///< Bytes per row
+    static constexpr uint64_t VIEW_WINDOW_ROWS = 0x10000;       ///< Rows in the scroll area (1 MB)
+    static constexpr uint64_t MAX_ADDRESS = 0x7FFFFFFFFFFF;     ///< Highest user-mode address
+    static constexpr float CHANGE_HIGHLIGHT_TIME = 1.5f;        ///< How long changed bytes stay highlighted (seconds)
+
+private:
+    /**
+     * @brief Draw the visible rows
+     */
+    void RenderRows();
+
+    /**
+     * @brief Move the scroll window when the view is near one of its edges
+     * @param rowHeight Row height in pixels
+     */
+    void RecenterWindow(float rowHeight);
+
+private:
+    DMAManager* m_dmaManager;               ///< DMA manager (not owned)
+    std::unique_ptr<PageCache> m_cache;     ///< Page cache of the viewer
+    uint64_t m_windowBase;                  ///< Address of row 0 of the scroll area
+    uint64_t m_firstVisibleRow;             ///< First row on screen last frame
+    int64_t m_pendingScrollRow;             ///< Row to scroll to next frame (-1 = none)
+    uint64_t m_renderedVersion;             ///< Cache version drawn by the last frame
+    uint64_t m_lastGeneration;              ///< Process snapshot generation the view was set up for
+    bool m_liveRefresh;                     ///< Re-read visible pages periodically
+    int m_refreshRate;                      ///< Live refresh rate (Hz)
+    char m_addressBuffer[32];               ///< Address input
+};
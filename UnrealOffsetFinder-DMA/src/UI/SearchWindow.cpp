@@ -0,0 +1,312 @@
+#include "SearchWindow.h"
+#include "../DMA/DMAManager.h"
+#include "../Unreal/NameTable.h"
+#include "../Unreal/ObjectIndex.h"
+#include <imgui.h>
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <string>
+
+namespace
+{
+    double MicrosSince(std::chrono::steady_clock::time_point start)
+    {
+        return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+    }
+}
+
+SearchWindow::SearchWindow()
+    : m_complete(true)
+    , m_queryMicros(0.0)
+    , m_buildMillis(0.0)
+    , m_dirty(false)
+    , m_mode(0)
+    , m_prefix(false)
+{
+    memset(m_queryBuffer, 0, sizeof(m_queryBuffer));
+    memset(m_classBuffer, 0, sizeof(m_classBuffer));
+}
+
+void SearchWindow::SetNames(std::shared_ptr<const NameTable> names)
+{
+    auto start = std::chrono::steady_clock::now();
+    m_names = std::move(names);
+    if (m_names)
+    {
+        const NameTable& table = *m_names;
+        m_nameIndex.Build(table.GetCount(), [&table](size_t i) { return table.GetNameAt(i); });
+    }
+    else
+    {
+        m_nameIndex.Clear();
+    }
+    m_buildMillis = MicrosSince(start) / 1000.0;
+    m_dirty = true;
+}
+
+void SearchWindow::SetObjects(std::shared_ptr<const ObjectIndex> objects)
+{
+    m_objects = std::move(objects);
+    m_objectsByName.clear();
+    m_groupNames.clear();
+    if (m_objects)
+    {
+        // Objects sharing an FName are contiguous, so a matching name expands to its objects with one lookup
+        const std::vector<uint32_t>& nameIndices = m_objects->GetNameIndices();
+        m_objectsByName.resize(m_objects->GetCount());
+        for (uint32_t i = 0; i < static_cast<uint32_t>(m_objectsByName.size()); ++i)
+        {
+            m_objectsByName[i] = i;
+        }
+        std::stable_sort(m_objectsByName.begin(), m_objectsByName.end(),
+            [&nameIndices](uint32_t a, uint32_t b) { return nameIndices[a] < nameIndices[b]; });
+
+        m_groupNames.resize(m_objectsByName.size());
+        for (size_t i = 0; i < m_objectsByName.size(); ++i)
+        {
+            m_groupNames[i] = nameIndices[m_objectsByName[i]];
+        }
+    }
+    m_dirty = true;
+}
+
+void SearchWindow::RunQuery()
+{
+    auto start = std::chrono::steady_clock::now();
+    m_results.clear();
+    m_complete = true;
+    TextMatch match = m_prefix ? TextMatch::Prefix : TextMatch::Substring;
+
+    if (m_mode == 0)
+    {
+        if (m_names)
+        {
+            m_complete = m_nameIndex.Search(m_queryBuffer, match, MAX_RESULTS, m_results);
+        }
+        m_queryMicros = MicrosSince(start);
+        return;
+    }
+
+    if (!m_objects)
+    {
+        m_queryMicros = MicrosSince(start);
+        return;
+    }
+
+    auto objectsNamed = [this](uint32_t nameIndex)
+    {
+        auto range = std::equal_range(m_groupNames.begin(), m_groupNames.end(), nameIndex);
+        return std::make_pair(m_objectsByName.begin() + (range.first - m_groupNames.begin()),
+                              m_objectsByName.begin() + (range.second - m_groupNames.begin()));
+    };
+
+    // Class filter: slots of the objects whose name is exactly the class text
+    std::vector<int32_t> classSlots;
+    size_t classLength = strlen(m_classBuffer);
+    if (classLength != 0 && m_names)
+    {
+        std::vector<uint32_t> classNames;
+        m_nameIndex.Search(m_classBuffer, TextMatch::Prefix, MAX_RESULTS, classNames,
+            [this, classLength](uint32_t position) { return m_names->GetNameAt(position).size() == classLength; });
+        for (uint32_t position : classNames)
+        {
+            auto [first, last] = objectsNamed(m_names->GetIndexAt(position));
+            for (auto it = first; it != last; ++it)
+            {
+                classSlots.push_back(m_objects->GetSlots()[*it]);
+            }
+        }
+        std::sort(classSlots.begin(), classSlots.end());
+    }
+
+    const std::vector<int32_t>& objectClasses = m_objects->GetClassSlots();
+    auto accept = [&](uint32_t position)
+    {
+        return classLength == 0 || std::binary_search(classSlots.begin(), classSlots.end(), objectClasses[position]);
+    };
+
+    if (m_queryBuffer[0] == '\0')
+    {
+        for (uint32_t position = 0; position < static_cast<uint32_t>(m_objects->GetCount()); ++position)
+        {
+            if (accept(position))
+            {
+                m_results.push_back(position);
+                if (m_results.size() >= MAX_RESULTS)
+                {
+                    m_complete = false;
+                    break;
+                }
+            }
+        }
+    }
+    else if (m_names)
+    {
+        std::vector<uint32_t> nameMatches;
+        m_complete = m_nameIndex.Search(m_queryBuffer, match, MAX_RESULTS, nameMatches);
+        for (size_t i = 0; i < nameMatches.size() && m_results.size() < MAX_RESULTS; ++i)
+        {
+            auto [first, last] = objectsNamed(m_names->GetIndexAt(nameMatches[i]));
+            for (auto it = first; it != last && m_results.size() < MAX_RESULTS; ++it)
+            {
+                if (accept(*it))
+                {
+                    m_results.push_back(*it);
+                }
+            }
+        }
+        m_complete = m_complete && m_results.size() < MAX_RESULTS;
+    }
+    m_queryMicros = MicrosSince(start);
+}
+
+void SearchWindow::Render(bool* open)
+{
+    ImGui::SetNextWindowSize(ImVec2(640, 560), ImGuiCond_FirstUseEver);
+
+    if (!ImGui::Begin("Search", open))
+    {
+        ImGui::End();
+        return;
+    }
+
+    m_dirty |= ImGui::RadioButton("Names", &m_mode, 0);
+    ImGui::SameLine();
+    m_dirty |= ImGui::RadioButton("Objects", &m_mode, 1);
+    ImGui::SameLine();
+    m_dirty |= ImGui::Checkbox("Prefix", &m_prefix);
+
+    ImGui::SetNextItemWidth(m_mode == 1 ? ImGui::GetContentRegionAvail().x * 0.6f : -1.0f);
+    m_dirty |= ImGui::InputTextWithHint("##SearchQuery", "Name contains...", m_queryBuffer, sizeof(m_queryBuffer));
+    if (m_mode == 1)
+    {
+        ImGui::SameLine();
+        ImGui::SetNextItemWidth(-1.0f);
+        m_dirty |= ImGui::InputTextWithHint("##SearchClass", "Class (exact)", m_classBuffer, sizeof(m_classBuffer));
+    }
+
+    if (m_dirty)
+    {
+        RunQuery();
+        m_dirty = false;
+    }
+
+    if (!m_names && (m_mode == 0 || m_queryBuffer[0] != '\0' || m_classBuffer[0] != '\0'))
+    {
+        ImGui::TextDisabled("Dump GNames first (Tools > Dump GNames)");
+    }
+    else if (m_mode == 1 && !m_objects)
+    {
+        ImGui::TextDisabled("Enumerate GObjects first (Tools > Enumerate GObjects)");
+    }
+    else
+    {
+        ImGui::Text("%zu%s results in %.0f us", m_results.size(), m_complete ? "" : "+", m_queryMicros);
+        ImGui::SameLine();
+        ImGui::TextDisabled("(index: %.1f ms, %.1f MB)", m_buildMillis, m_nameIndex.GetMemoryBytes() / (1024.0 * 1024.0));
+    }
+    ImGui::Separator();
+
+    if (m_mode == 0)
+        RenderNameResults();
+    else
+        RenderObjectResults();
+
+    ImGui::End();
+}
+
+void SearchWindow::RenderNameResults()
+{
+    if (!m_names)
+        return;
+
+    ImGuiTableFlags flags = ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_ScrollY;
+    if (ImGui::BeginTable("NameResults", 2, flags))
+    {
+        ImGui::TableSetupScrollFreeze(0, 1);
+        ImGui::TableSetupColumn("Index", ImGuiTableColumnFlags_WidthFixed, 100.0f);
+        ImGui::TableSetupColumn("Name");
+        ImGui::TableHeadersRow();
+
+        ImGuiListClipper clipper;
+        clipper.Begin(static_cast<int>(m_results.size()));
+        while (clipper.Step())
+        {
+            for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; ++row)
+            {
+                uint32_t position = m_results[row];
+                std::string_view name = m_names->GetNameAt(position);
+                ImGui::TableNextRow();
+
+                ImGui::TableSetColumnIndex(0);
+                ImGui::Text("0x%X", m_names->GetIndexAt(position));
+
+                ImGui::TableSetColumnIndex(1);
+                ImGui::TextUnformatted(name.data(), name.data() + name.size());
+            }
+        }
+        clipper.End();
+
+        ImGui::EndTable();
+    }
+}
+
+void SearchWindow::RenderObjectResults()
+{
+    if (!m_objects)
+        return;
+
+    ImGuiTableFlags flags = ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_ScrollY;
+    if (ImGui::BeginTable("ObjectResults", 4, flags))
+    {
+        ImGui::TableSetupScrollFreeze(0, 1);
+        ImGui::TableSetupColumn("Slot", ImGuiTableColumnFlags_WidthFixed, 70.0f);
+        ImGui::TableSetupColumn("Address", ImGuiTableColumnFlags_WidthFixed, 140.0f);
+        ImGui::TableSetupColumn("Class", ImGuiTableColumnFlags_WidthFixed, 160.0f);
+        ImGui::TableSetupColumn("Path");
+        ImGui::TableHeadersRow();
+
+        // Names and paths are only resolved for the visible rows
+        ImGuiListClipper clipper;
+        clipper.Begin(static_cast<int>(m_results.size()));
+        while (clipper.Step())
+        {
+            for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; ++row)
+            {
+                uint32_t position = m_results[row];
+                ImGui::PushID(row);
+                ImGui::TableNextRow();
+
+                ImGui::TableSetColumnIndex(0);
+                ImGui::Text("%d", m_objects->GetSlots()[position]);
+
+                ImGui::TableSetColumnIndex(1);
+                std::string address = DMAManager::FormatHexAddress(m_objects->GetAddresses()[position]);
+                if (ImGui::Selectable(address.c_str(), false, ImGuiSelectableFlags_AllowDoubleClick) &&
+                    ImGui::IsMouseDoubleClicked(ImGuiMouseButton_Left))
+                {
+                    ImGui::SetClipboardText(address.c_str());
+                }
+
+                ImGui::TableSetColumnIndex(2);
+                int64_t classPosition = m_objects->FindSlot(m_objects->GetClassSlots()[position]);
+                if (m_names && classPosition >= 0)
+                    ImGui::TextUnformatted(m_objects->GetName(static_cast<size_t>(classPosition), *m_names).c_str());
+                else
+                    ImGui::TextDisabled("[%d]", m_objects->GetClassSlots()[position]);
+
+                ImGui::TableSetColumnIndex(3);
+                if (m_names)
+                    ImGui::TextUnformatted(m_objects->GetPathName(position, *m_names).c_str());
+                else
+                    ImGui::TextDisabled("FName 0x%X", m_objects->GetNameIndices()[position]);
+
+                ImGui::PopID();
+            }
+        }
+        clipper.End();
+
+        ImGui::EndTable();
+    }
+}
@@ -0,0 +1,79 @@
+#pragma once
+
+#include "../Core/TextIndex.h"
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+class NameTable;
+class ObjectIndex;
+
+/**
+ * @class SearchWindow
+ * @brief Instant name and object search over the last GNames dump and GObjects walk
+ *
+ * The name table is indexed once per dump (TextIndex), objects are grouped
+ * by FName once per walk; every keystroke then only touches the matching
+ * names. Results are listed through a clipper, so a query matching a
+ * million entries costs as much to draw as one matching ten.
+ */
+class SearchWindow
+{
+public:
+    /**
+     * @brief Constructor
+     */
+    SearchWindow();
+
+    /**
+     * @brief Index a new name table (nullptr to drop it)
+     * @param names Dumped names
+     */
+    void SetNames(std::shared_ptr<const NameTable> names);
+
+    /**
+     * @brief Group a new object index by name (nullptr to drop it)
+     * @param objects Enumerated objects
+     */
+    void SetObjects(std::shared_ptr<const ObjectIndex> objects);
+
+    /**
+     * @brief Draw the search window
+     * @param open Window open flag (cleared when the user closes the window)
+     */
+    void Render(bool* open);
+
+    static constexpr size_t MAX_RESULTS = 1000000;  ///< Results kept per query
+
+private:
+    /**
+     * @brief Run the current query against names or objects
+     */
+    void RunQuery();
+
+    /**
+     * @brief Draw the name results
+     */
+    void RenderNameResults();
+
+    /**
+     * @brief Draw the object results
+     */
+    void RenderObjectResults();
+
+private:
+    std::shared_ptr<const NameTable> m_names;       ///< Names of the last dump
+    std::shared_ptr<const ObjectIndex> m_objects;   ///< Objects of the last walk
+    TextIndex m_nameIndex;                          ///< Trigram index over m_names
+    std::vector<uint32_t> m_objectsByName;          ///< Object positions ordered by FName index, then slot
+    std::vector<uint32_t> m_groupNames;             ///< FName index of each m_objectsByName entry
+    std::vector<uint32_t> m_results;                ///< Name positions or object positions of the last query
+    bool m_complete;                                ///< The last query returned every match
+    double m_queryMicros;                           ///< Duration of the last query
+    double m_buildMillis;                           ///< Duration of the last index build
+    bool m_dirty;                                   ///< Query inputs changed since the last run
+    int m_mode;                                     ///< 0 = names, 1 = objects
+    bool m_prefix;                                  ///< Prefix instead of substring match
+    char m_queryBuffer[256];                        ///< Query input
+    char m_classBuffer[128];                        ///< Class name filter (objects, exact)
+};
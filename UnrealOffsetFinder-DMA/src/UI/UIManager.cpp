@@ -1,29 +1,83 @@
 #include "UIManager.h"
 #include "../DMA/DMAManager.h"
+#include "../Core/Trace.h"
+#include "../Unreal/LayoutIndex.h"
+#include "../Unreal/NameTable.h"
+#include "../Unreal/ObjectEnumerator.h"
+#include "../Unreal/SymbolResolver.h"
 #include <imgui.h>
 #include <algorithm>
 #include <cctype>
 #include <cmath>
+#include <cstdio>
 #include <ctime>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
 #include <sstream>
+#include <tuple>
+
+namespace
+{
+    /// Format a pointer chain for editing, e.g. "0x10, 0x2A8"
+    std::string FormatPointerChain(const std::vector<uint64_t>& chain, const char* separator)
+    {
+        std::string text;
+        for (size_t i = 0; i < chain.size(); ++i)
+        {
+            if (i > 0)
+                text += separator;
+            text += DMAManager::FormatHexAddress(chain[i]);
+        }
+        return text;
+    }
+
+    /// Parse hex offsets separated by commas, semicolons or spaces
+    std::vector<uint64_t> ParsePointerChain(const std::string& text)
+    {
+        std::string normalized = text;
+        std::replace_if(normalized.begin(), normalized.end(), [](char c) { return c == ',' || c == ';'; }, ' ');
+        
+        std::vector<uint64_t> chain;
+        std::string token;
+        std::stringstream ss(normalized);
+        while (ss >> token)
+        {
+            chain.push_back(DMAManager::ParseHexAddress(token));
+        }
+        return chain;
+    }
+}
 
 UIManager::UIManager()
     : m_showControlPanel(true)
     , m_showOffsetFinder(true)
     , m_showMemoryViewer(false)
+    , m_showValueScanner(false)
+    , m_showSearch(false)
     , m_showProcessSelector(false)
     , m_showStatusWindow(true)
     , m_showAboutDialog(false)
+    , m_nextOffsetId(1)
+    , m_offsetTargetsDirty(false)
+    , m_syncedOffsetCount(0)
+    , m_renderedOffsetVersion(0)
+    , m_liveOffsets(true)
+    , m_scanAllModules(false)
+    , m_offsetRefreshRate(5)
+    , m_logLevelMask(LogBuffer::ALL_LEVELS)
     , m_selectedProcess("")
     , m_dmaManager(nullptr)
     , m_progressSpinner(0.0f)
+    , m_lastTraceExportCount(0)
+    , m_renderedLogVersion(0)
+    , m_gnamesAddress(0)
+    , m_gobjectsAddress(0)
 {
     memset(m_processNameBuffer, 0, sizeof(m_processNameBuffer));
     memset(m_offsetNameBuffer, 0, sizeof(m_offsetNameBuffer));
     memset(m_offsetAddressBuffer, 0, sizeof(m_offsetAddressBuffer));
+    memset(m_logFilterBuffer, 0, sizeof(m_logFilterBuffer));
 }
 
 UIManager::~UIManager()
@@ -33,7 +87,7 @@ UIManager::~UIManager()
 
 bool UIManager::Initialize()
 {
-    m_logMessages.push_back("[INFO] UI Manager initialized successfully");
+    m_log.Add("[INFO] UI Manager initialized successfully");
     
     std::cout << "UI Manager initialized" << std::endl;
     return true;
@@ -44,10 +98,20 @@ void UIManager::Update(float deltaTime)
     m_progressSpinner += deltaTime * 6.0f; // Smooth spin speed
     if (m_progressSpinner > 2.0f * 3.14159f)
         m_progressSpinner -= 2.0f * 3.14159f;
+    
+    uint32_t traceExportCount = TraceRecorder::Get().GetExportCount();
+    if (traceExportCount != m_lastTraceExportCount)
+    {
+        m_lastTraceExportCount = traceExportCount;
+        m_log.Add("[SUCCESS] Trace written to " + TraceRecorder::Get().GetLastExportPath() + " (open in Perfetto or chrome://tracing)");
+    }
 }
 
 void UIManager::Render()
 {
+    // One process snapshot per frame; rendering never calls into the device
+    m_processSnapshot = m_dmaManager ? m_dmaManager->GetProcessSnapshot() : nullptr;
+    
     ImGuiIO& io = ImGui::GetIO();
     float windowWidth = io.DisplaySize.x;
     float windowHeight = io.DisplaySize.y;
@@ -67,18 +131,48 @@ void UIManager::Render()
     
     if (m_showMemoryViewer)
         RenderMemoryViewer();
+    else
+        m_memoryViewer.Pause();
+    
+    if (m_showValueScanner)
+        RenderValueScanner();
+    
+    if (m_showSearch)
+        m_searchWindow.Render(&m_showSearch);
         
     if (m_showProcessSelector)
         RenderProcessSelector();
         
     if (m_showAboutDialog)
         RenderAboutDialog();
+    
+    m_renderedLogVersion = m_log.GetVersion();
+}
+
+bool UIManager::WantsRedraw() const
+{
+    return m_log.GetVersion() != m_renderedLogVersion ||
+           (m_showMemoryViewer && m_memoryViewer.WantsRedraw()) ||
+           (m_offsetRefresher && m_offsetRefresher->GetVersion() != m_renderedOffsetVersion) ||
+           TraceRecorder::Get().GetExportCount() != m_lastTraceExportCount;
+}
+
+void UIManager::AddLogMessage(const std::string& message)
+{
+    m_log.Add(message);
 }
 
 void UIManager::Shutdown()
 {
     m_offsetEntries.clear();
-    m_logMessages.clear();
+    m_log.Clear();
+    m_memoryViewer.SetDMAManager(nullptr);
+    m_valueScanner.SetDMAManager(nullptr);
+    m_offsetRefresher.reset();
+    m_objectEnumerator.reset();
+    m_objectIndex.reset();
+    m_searchWindow.SetObjects(nullptr);
+    m_layoutIndex.reset();
     m_dmaManager = nullptr;
     
     std::cout << "UI Manager shutdown complete" << std::endl;
@@ -87,6 +181,33 @@ void UIManager::Shutdown()
 void UIManager::SetDMAManager(DMAManager* dmaManager)
 {
     m_dmaManager = dmaManager;
+    m_memoryViewer.SetDMAManager(dmaManager);
+    m_valueScanner.SetDMAManager(dmaManager);
+    
+    m_offsetRefresher.reset();
+    m_objectEnumerator.reset();
+    m_objectIndex.reset();
+    m_searchWindow.SetObjects(nullptr);
+    m_layoutIndex.reset();
+    if (dmaManager)
+    {
+        m_offsetRefresher = std::make_unique<OffsetRefresher>(*dmaManager);
+        m_objectEnumerator = std::make_shared<ObjectEnumerator>(*dmaManager);
+        m_offsetTargetsDirty = true;
+        if (!dmaManager->SetSignatureStatsFile(SIGNATURE_STATS_FILE))
+        {
+            m_log.Add(std::string("[ERROR] Ignoring unreadable ") + SIGNATURE_STATS_FILE + "; variants are tried in table order");
+        }
+
+        // Optional PDB of the game build; used only when its GUID and age match the attached module
+        if (std::ifstream(PDB_FILE).is_open())
+        {
+            if (dmaManager->SetPdbFile(PDB_FILE))
+                m_log.Add(std::string("[INFO] Using ") + PDB_FILE + " for symbol lookups");
+            else
+                m_log.Add(std::string("[ERROR] Ignoring unreadable ") + PDB_FILE);
+        }
+    }
 }
 
 void UIManager::RenderMenuBar()
@@ -123,7 +244,7 @@ void UIManager::RenderMenuBar()
             
             if (ImGui::MenuItem("Exit", "Alt+F4"))
             {
-                    m_logMessages.push_back("[INFO] Exit requested");
+                    m_log.Add("[INFO] Exit requested");
             }
             
             ImGui::EndMenu();
@@ -138,6 +259,8 @@ void UIManager::RenderMenuBar()
             ImGui::Separator();
             
                 ImGui::MenuItem("Memory Viewer", nullptr, &m_showMemoryViewer);
+            ImGui::MenuItem("Value Scanner", nullptr, &m_showValueScanner);
+            ImGui::MenuItem("Search", nullptr, &m_showSearch);
             ImGui::MenuItem("Process Selector", nullptr, &m_showProcessSelector);
             
             ImGui::EndMenu();
@@ -151,57 +274,69 @@ void UIManager::RenderMenuBar()
                 {
                     if (!m_dmaManager->HasPendingOperations())
                     {
-                        m_logMessages.push_back("[INFO] Starting async Unreal Engine globals scan from menu...");
+                        m_log.Add("[INFO] Starting async Unreal Engine globals scan from menu...");
                         
                         m_dmaManager->ScanUnrealGlobalsAsync(
-                            [this](const AsyncResult<UnrealGlobals>& result) {
-                                if (result.isSuccess)
-                                {
-                                    m_logMessages.push_back("[SUCCESS] " + result.logMessage);
-                                    
-                                    const auto& globals = result.result;
-                                    
-                                    uint64_t mainBase = m_dmaManager->GetMainModuleBase();
-                                    
-                                    if (globals.GWorld != 0)
-                                    {
-                                        uint64_t offset = globals.GWorld - mainBase;
-                                        std::string offsetStr = m_dmaManager->FormatHexAddress(offset);
-                                        std::string absoluteStr = m_dmaManager->FormatHexAddress(globals.GWorld);
-                                        m_offsetEntries.emplace_back("GWorld", offsetStr, absoluteStr);
-                                        m_logMessages.push_back("[INFO] GWorld offset: " + offsetStr + " (absolute: " + absoluteStr + ")");
-                                    }
-                                    if (globals.GNames != 0)
-                                    {
-                                        uint64_t offset = globals.GNames - mainBase;
-                                        std::string offsetStr = m_dmaManager->FormatHexAddress(offset);
-                                        std::string absoluteStr = m_dmaManager->FormatHexAddress(globals.GNames);
-                                        m_offsetEntries.emplace_back("GNames", offsetStr, absoluteStr);
-                                        m_logMessages.push_back("[INFO] GNames offset: " + offsetStr + " (absolute: " + absoluteStr + ")");
-                                    }
-                                    if (globals.GObjects != 0)
-                                    {
-                                        uint64_t offset = globals.GObjects - mainBase;
-                                        std::string offsetStr = m_dmaManager->FormatHexAddress(offset);
-                                        std::string absoluteStr = m_dmaManager->FormatHexAddress(globals.GObjects);
-                                        m_offsetEntries.emplace_back("GObjects", offsetStr, absoluteStr);
-                                        m_logMessages.push_back("[INFO] GObjects offset: " + offsetStr + " (absolute: " + absoluteStr + ")");
-                                    }
-                                }
-                                else
-                                {
-                                    m_logMessages.push_back("[ERROR] " + result.errorMessage);
-                                }
-                            });
+                            [this](const AsyncResult<UnrealGlobals>& result) { OnUnrealGlobalsScanned(result); }, m_scanAllModules);
                     }
                     else
                     {
-                        m_logMessages.push_back("[INFO] Please wait for current operations to complete");
+                        m_log.Add("[INFO] Please wait for current operations to complete");
                     }
                 }
                 else
                 {
-                    m_logMessages.push_back("[ERROR] Not connected to any process");
+                    m_log.Add("[ERROR] Not connected to any process");
+                }
+            }
+            
+            if (ImGui::MenuItem("Index Main Module", nullptr, false, m_dmaManager && m_dmaManager->IsConnected()))
+            {
+                // Later signature scans in the main module are answered from the captured image
+                m_log.Add("[INFO] Indexing main module for signature queries...");
+                m_dmaManager->BuildSignatureIndexAsync(
+                    [this](const AsyncResult<std::shared_ptr<const SignatureIndex>>& result)
+                    {
+                        m_log.Add(result.isSuccess ? "[SUCCESS] " + result.logMessage : "[ERROR] " + result.errorMessage);
+                    });
+            }
+            
+            if (ImGui::MenuItem("Dump GNames", nullptr, false, m_gnamesAddress != 0))
+            {
+                if (m_dmaManager && m_dmaManager->IsConnected())
+                {
+                    m_log.Add("[INFO] Dumping GNames at " + DMAManager::FormatHexAddress(m_gnamesAddress) + "...");
+                    m_dmaManager->DumpNamesAsync(m_gnamesAddress,
+                        [this](const AsyncResult<std::shared_ptr<const NameTable>>& result) { OnNamesDumped(result); });
+                }
+                else
+                {
+                    m_log.Add("[ERROR] Not connected to any process");
+                }
+            }
+            
+            if (ImGui::MenuItem("Enumerate GObjects", nullptr, false, m_gobjectsAddress != 0))
+            {
+                StartObjectEnumeration(false);
+            }
+            
+            if (ImGui::MenuItem("Resync GObjects", nullptr, false, m_objectIndex != nullptr))
+            {
+                StartObjectEnumeration(true);
+            }
+            
+            // Without GObjects and names only a cached build can be loaded
+            if (ImGui::MenuItem("Index Layouts"))
+            {
+                if (m_dmaManager && m_dmaManager->IsConnected())
+                {
+                    m_log.Add("[INFO] Indexing class layouts...");
+                    m_dmaManager->IndexLayoutsAsync(m_objectIndex, m_nameTable, ".",
+                        [this](const AsyncResult<std::shared_ptr<const LayoutIndex>>& result) { OnLayoutsIndexed(result); });
+                }
+                else
+                {
+                    m_log.Add("[ERROR] Not connected to any process");
                 }
             }
             
@@ -209,19 +344,50 @@ void UIManager::RenderMenuBar()
             
             if (ImGui::MenuItem("Scan Memory"))
             {
-                m_logMessages.push_back("[INFO] Memory scan functionality not yet implemented");
+                m_log.Add("[INFO] Memory scan functionality not yet implemented");
+            }
+            
+            bool traceArmed = TraceRecorder::Get().IsArmedForNextTask();
+            if (ImGui::MenuItem("Record Trace of Next Task", nullptr, traceArmed))
+            {
+                TraceRecorder::Get().SetArmedForNextTask(!traceArmed);
+                m_log.Add(traceArmed 
+                    ? "[INFO] Trace recording disarmed" 
+                    : "[INFO] Trace armed - the next DMA task will be recorded");
+            }
+            
+            bool sessionRecording = m_dmaManager && m_dmaManager->IsSessionRecording();
+            if (ImGui::MenuItem("Record DMA Session", nullptr, sessionRecording, m_dmaManager != nullptr))
+            {
+                if (sessionRecording)
+                {
+                    m_dmaManager->StopSessionRecording();
+                    m_log.Add("[INFO] DMA session recording stopped");
+                }
+                else
+                {
+                    std::string filename = "session_" + std::to_string(time(nullptr)) + ".uofrec";
+                    if (m_dmaManager->StartSessionRecording(filename))
+                    {
+                        m_log.Add("[INFO] Recording DMA session to " + filename);
+                    }
+                    else
+                    {
+                        m_log.Add("[ERROR] Failed to start DMA session recording");
+                    }
+                }
             }
             
             if (ImGui::MenuItem("Refresh Process List"))
             {
-                m_logMessages.push_back("[INFO] Refreshing process list...");
+                m_log.Add("[INFO] Refreshing process list...");
                 if (m_dmaManager)
                 {
-                    m_logMessages.push_back("[INFO] Process list will be refreshed automatically");
+                    m_dmaManager->RequestProcessListRefresh();
                 }
                 else
                 {
-                    m_logMessages.push_back("[ERROR] DMA Manager not available");
+                    m_log.Add("[ERROR] DMA Manager not available");
                 }
             }
             
@@ -284,7 +450,7 @@ void UIManager::RenderControlPanel()
             if (!processName.empty())
             {
                 m_selectedProcess = processName;
-                m_logMessages.push_back("[INFO] Attempting to attach to process: " + processName);
+                m_log.Add("[INFO] Attempting to attach to process: " + processName);
                 
                 if (m_dmaManager)
                 {
@@ -292,12 +458,12 @@ void UIManager::RenderControlPanel()
                         [this, processName](const AsyncResult<bool>& result) {
                             if (result.isSuccess)
                             {
-                                m_logMessages.push_back("[SUCCESS] " + result.logMessage);
+                                m_log.Add("[SUCCESS] " + result.logMessage);
                                 m_selectedProcess = processName;
                             }
                             else
                             {
-                                m_logMessages.push_back("[ERROR] " + result.errorMessage);
+                                m_log.Add("[ERROR] " + result.errorMessage);
                                 m_selectedProcess = "";
                             }
                         });
@@ -305,7 +471,7 @@ void UIManager::RenderControlPanel()
             }
             else
             {
-                m_logMessages.push_back("[ERROR] Please enter a process name");
+                m_log.Add("[ERROR] Please enter a process name");
             }
         }
         
@@ -314,12 +480,12 @@ void UIManager::RenderControlPanel()
         
         DrawSectionHeader("Process Status");
         
-        bool isConnected = m_dmaManager && m_dmaManager->IsConnected();
+        bool isConnected = m_dmaManager && m_dmaManager->IsConnected() && m_processSnapshot;
         
         if (isConnected)
         {
-            auto processInfo = m_dmaManager->GetCurrentProcessInfo();
-            uint64_t mainBase = m_dmaManager->GetMainModuleBase();
+            const ProcessInfo& processInfo = m_processSnapshot->process;
+            uint64_t mainBase = m_processSnapshot->GetMainModuleBase();
             
             DrawStatusIndicator("Connected", true);
             
@@ -370,6 +536,22 @@ void UIManager::RenderControlPanel()
             DrawSpinner(SPINNER_RADIUS, 2.5f);
             ImGui::SameLine();
             ImGui::TextColored(ImVec4(0.28f, 0.56f, 1.00f, 1.0f), "Operations pending: %zu", pending);
+            
+            for (const auto& status : m_dmaManager->GetOperationStatus())
+            {
+                if (!status.running)
+                    continue;
+                
+                std::string label = status.cancelled ? "Cancelling..." : status.progressText;
+                if (status.progress >= 0.0f)
+                {
+                    ImGui::ProgressBar(status.progress, ImVec2(-1, 0), label.empty() ? nullptr : label.c_str());
+                }
+                else
+                {
+                    ImGui::TextColored(ImVec4(0.7f, 0.7f, 0.7f, 1.0f), "%s", status.description.c_str());
+                }
+            }
         }
         
         ImGui::Spacing();
@@ -385,58 +567,26 @@ void UIManager::RenderControlPanel()
             {
                 if (!hasOperations)
                 {
-                    m_logMessages.push_back("[INFO] Starting async Unreal Engine globals scan...");
+                    m_log.Add("[INFO] Starting async Unreal Engine globals scan...");
                     
                     m_dmaManager->ScanUnrealGlobalsAsync(
-                        [this](const AsyncResult<UnrealGlobals>& result) {
-                            if (result.isSuccess)
-                            {
-                                m_logMessages.push_back("[SUCCESS] " + result.logMessage);
-                                
-                                const auto& globals = result.result;
-                                uint64_t mainBase = m_dmaManager->GetMainModuleBase();
-                                
-                                if (globals.GWorld != 0)
-                                {
-                                    uint64_t offset = globals.GWorld - mainBase;
-                                    std::string offsetStr = m_dmaManager->FormatHexAddress(offset);
-                                    std::string absoluteStr = m_dmaManager->FormatHexAddress(globals.GWorld);
-                                    m_offsetEntries.emplace_back("GWorld", offsetStr, absoluteStr);
-                                    m_logMessages.push_back("[INFO] GWorld offset: " + offsetStr + " (absolute: " + absoluteStr + ")");
-                                }
-                                if (globals.GNames != 0)
-                                {
-                                    uint64_t offset = globals.GNames - mainBase;
-                                    std::string offsetStr = m_dmaManager->FormatHexAddress(offset);
-                                    std::string absoluteStr = m_dmaManager->FormatHexAddress(globals.GNames);
-                                    m_offsetEntries.emplace_back("GNames", offsetStr, absoluteStr);
-                                    m_logMessages.push_back("[INFO] GNames offset: " + offsetStr + " (absolute: " + absoluteStr + ")");
-                                }
-                                if (globals.GObjects != 0)
-                                {
-                                    uint64_t offset = globals.GObjects - mainBase;
-                                    std::string offsetStr = m_dmaManager->FormatHexAddress(offset);
-                                    std::string absoluteStr = m_dmaManager->FormatHexAddress(globals.GObjects);
-                                    m_offsetEntries.emplace_back("GObjects", offsetStr, absoluteStr);
-                                    m_logMessages.push_back("[INFO] GObjects offset: " + offsetStr + " (absolute: " + absoluteStr + ")");
-                                }
-                            }
-                            else
-                            {
-                                m_logMessages.push_back("[ERROR] " + result.errorMessage);
-                            }
-                        });
+                        [this](const AsyncResult<UnrealGlobals>& result) { OnUnrealGlobalsScanned(result); }, m_scanAllModules);
                 }
                 else
                 {
-                    m_logMessages.push_back("[INFO] Please wait for current operations to complete");
+                    m_log.Add("[INFO] Please wait for current operations to complete");
                 }
             }
             else
             {
-                m_logMessages.push_back("[ERROR] Not connected to any process");
+                m_log.Add("[ERROR] Not connected to any process");
             }
         }
+        ImGui::Checkbox("All modules", &m_scanAllModules);
+        if (ImGui::IsItemHovered())
+        {
+            ImGui::SetTooltip("Also scan the DLLs of modular builds (Core, CoreUObject, Engine, ...)");
+        }
         
         if (DrawButton("Get Module Base", ImVec2(-1, 0), !hasOperations))
         {
@@ -444,38 +594,38 @@ void UIManager::RenderControlPanel()
             {
                 if (!hasOperations)
                 {
-                    m_logMessages.push_back("[INFO] Getting main module base address...");
+                    m_log.Add("[INFO] Getting main module base address...");
                     
                     m_dmaManager->GetMainModuleBaseAsync(
                         [this](const AsyncResult<uint64_t>& result) {
                             if (result.isSuccess)
                             {
-                                m_logMessages.push_back("[SUCCESS] " + result.logMessage);
+                                m_log.Add("[SUCCESS] " + result.logMessage);
                                 std::string absoluteStr = m_dmaManager->FormatHexAddress(result.result);
                                 m_offsetEntries.emplace_back("Main Module Base", "0x0", absoluteStr);
-                                m_logMessages.push_back("[INFO] Main module base: " + absoluteStr + " (offset: 0x0)");
+                                m_log.Add("[INFO] Main module base: " + absoluteStr + " (offset: 0x0)");
                             }
                             else
                             {
-                                m_logMessages.push_back("[ERROR] " + result.errorMessage);
+                                m_log.Add("[ERROR] " + result.errorMessage);
                             }
                         });
                 }
                 else
                 {
-                    m_logMessages.push_back("[INFO] Please wait for current operations to complete");
+                    m_log.Add("[INFO] Please wait for current operations to complete");
                 }
             }
             else
             {
-                m_logMessages.push_back("[ERROR] Not connected to any process");
+                m_log.Add("[ERROR] Not connected to any process");
             }
         }
         
         if (DrawButton("Clear All Offsets", ImVec2(-1, 0)))
         {
             m_offsetEntries.clear();
-            m_logMessages.push_back("[INFO] Cleared all offset entries");
+            m_log.Add("[INFO] Cleared all offset entries");
         }
         
         if (hasOperations)
@@ -483,7 +633,7 @@ void UIManager::RenderControlPanel()
             if (DrawButton("Cancel Operations", ImVec2(-1, 0)))
             {
                 m_dmaManager->CancelAllOperations();
-                m_logMessages.push_back("[INFO] Cancelled all pending operations");
+                m_log.Add("[INFO] Cancelling all pending and running operations");
             }
         }
     }
@@ -555,81 +705,167 @@ void UIManager::RenderOffsetFinder()
         
         DrawSectionHeader("Current Offsets");
         
-        if (ImGui::BeginTable("OffsetsTable", 5, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_Resizable))
+        SyncOffsetTargets();
+        
+        ImGui::Checkbox("Live", &m_liveOffsets);
+        ImGui::SameLine();
+        ImGui::SetNextItemWidth(120.0f);
+        ImGui::SliderInt("Hz", &m_offsetRefreshRate, 1, 30);
+        if (m_offsetRefresher)
         {
-            ImGui::TableSetupColumn("Name", ImGuiTableColumnFlags_WidthFixed, 200.0f);
-            ImGui::TableSetupColumn("Offset", ImGuiTableColumnFlags_WidthFixed, 120.0f);
-            ImGui::TableSetupColumn("Absolute Address", ImGuiTableColumnFlags_WidthFixed, 140.0f);
+            m_offsetRefresher->SetInterval(m_liveOffsets ? 1.0f / m_offsetRefreshRate : 0.0f);
+        }
+        
+        // Version first: values published in between are picked up by the next frame
+        uint64_t offsetVersion = m_offsetRefresher ? m_offsetRefresher->GetVersion() : 0;
+        auto values = m_offsetRefresher ? m_offsetRefresher->GetValues() : std::make_shared<const OffsetRefresher::ValueMap>();
+        auto now = std::chrono::steady_clock::now();
+        std::vector<uint64_t> visibleIds;
+        size_t removeIndex = m_offsetEntries.size();
+        
+        ImGuiTableFlags tableFlags = ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_Resizable | ImGuiTableFlags_ScrollY;
+        if (ImGui::BeginTable("OffsetsTable", 8, tableFlags))
+        {
+            ImGui::TableSetupScrollFreeze(0, 1);
+            ImGui::TableSetupColumn("Name", ImGuiTableColumnFlags_WidthFixed, 160.0f);
+            ImGui::TableSetupColumn("Offset", ImGuiTableColumnFlags_WidthFixed, 100.0f);
+            ImGui::TableSetupColumn("Absolute Address", ImGuiTableColumnFlags_WidthFixed, 130.0f);
+            ImGui::TableSetupColumn("Type", ImGuiTableColumnFlags_WidthFixed, 80.0f);
+            ImGui::TableSetupColumn("Pointer Chain", ImGuiTableColumnFlags_WidthFixed, 140.0f);
+            ImGui::TableSetupColumn("Value", ImGuiTableColumnFlags_WidthFixed, 150.0f);
             ImGui::TableSetupColumn("Status", ImGuiTableColumnFlags_WidthFixed, 80.0f);
-            ImGui::TableSetupColumn("Actions", ImGuiTableColumnFlags_WidthFixed, 120.0f);
+            ImGui::TableSetupColumn("Actions", ImGuiTableColumnFlags_WidthFixed, 110.0f);
             ImGui::TableHeadersRow();
             
-            for (size_t i = 0; i < m_offsetEntries.size(); ++i)
+            ImVec4 changedColor(1.0f, 0.45f, 0.35f, 1.0f);
+            
+            ImGuiListClipper clipper;
+            clipper.Begin(static_cast<int>(m_offsetEntries.size()));
+            while (clipper.Step())
             {
-                ImGui::TableNextRow();
-                OffsetEntry& entry = m_offsetEntries[i];
-                
-                ImGui::TableNextColumn();
-                ImGui::Text("%s", entry.name.c_str());
-                
-                ImGui::TableNextColumn();
-                ImGui::Text("%s", entry.address.c_str());
-                
-                ImGui::TableNextColumn();
-                ImGui::Text("%s", entry.value.c_str());
-                
-                ImGui::TableNextColumn();
-                DrawStatusIndicator(entry.isValid ? "Valid" : "Invalid", entry.isValid);
-                
-                ImGui::TableNextColumn();
-                
-                std::string readId = "Read##" + std::to_string(i);
-                std::string removeId = "Remove##" + std::to_string(i);
-                
-                if (ImGui::SmallButton(readId.c_str()))
-                {
-                    m_logMessages.push_back("[INFO] Reading value at " + entry.address);
-                    // TODO: Implement read functionality
-                    entry.value = "0xDEADBEEF"; // Placeholder
-                    entry.isValid = true;
-                }
-                
-                ImGui::SameLine();
-                
-                if (ImGui::SmallButton(removeId.c_str()))
+                for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; ++row)
                 {
-                    RemoveOffsetEntry(i);
-                    break; // Break to avoid iterator invalidation
+                    size_t i = static_cast<size_t>(row);
+                    OffsetEntry& entry = m_offsetEntries[i];
+                    visibleIds.push_back(entry.id);
+                    
+                    ImGui::TableNextRow();
+                    ImGui::PushID(static_cast<int>(i));
+                    
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%s", entry.name.c_str());
+                    
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%s", entry.address.c_str());
+                    
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%s", entry.value.c_str());
+                    
+                    ImGui::TableNextColumn();
+                    ImGui::SetNextItemWidth(-FLT_MIN);
+                    if (ImGui::BeginCombo("##Type", OffsetRefresher::GetTypeName(entry.valueType)))
+                    {
+                        for (size_t t = 0; t < static_cast<size_t>(OffsetValueType::Count); ++t)
+                        {
+                            OffsetValueType type = static_cast<OffsetValueType>(t);
+                            if (ImGui::Selectable(OffsetRefresher::GetTypeName(type), type == entry.valueType))
+                            {
+                                entry.valueType = type;
+                                m_offsetTargetsDirty = true;
+                            }
+                        }
+                        ImGui::EndCombo();
+                    }
+                    
+                    ImGui::TableNextColumn();
+                    char chainBuffer[128];
+                    snprintf(chainBuffer, sizeof(chainBuffer), "%s", FormatPointerChain(entry.pointerChain, ", ").c_str());
+                    ImGui::SetNextItemWidth(-FLT_MIN);
+                    if (ImGui::InputTextWithHint("##Chain", "none", chainBuffer, sizeof(chainBuffer), ImGuiInputTextFlags_EnterReturnsTrue))
+                    {
+                        entry.pointerChain = ParsePointerChain(chainBuffer);
+                        m_offsetTargetsDirty = true;
+                    }
+                    
+                    auto value = values->find(entry.id);
+                    bool hasValue = value != values->end();
+                    
+                    ImGui::TableNextColumn();
+                    if (!hasValue)
+                    {
+                        ImGui::TextDisabled("...");
+                    }
+                    else if (value->second.valid &&
+                             std::chrono::duration<float>(now - value->second.lastChange).count() < MemoryViewer::CHANGE_HIGHLIGHT_TIME)
+                    {
+                        ImGui::TextColored(changedColor, "%s", value->second.text.c_str());
+                    }
+                    else
+                    {
+                        ImGui::Text("%s", value->second.text.c_str());
+                    }
+                    if (hasValue && value->second.address != 0 && ImGui::IsItemHovered())
+                    {
+                        ImGui::SetTooltip("At %s", DMAManager::FormatHexAddress(value->second.address).c_str());
+                    }
+                    
+                    ImGui::TableNextColumn();
+                    if (hasValue)
+                        DrawStatusIndicator(value->second.valid ? "Valid" : "Invalid", value->second.valid);
+                    else
+                        ImGui::TextDisabled("Pending");
+                    
+                    ImGui::TableNextColumn();
+                    if (ImGui::SmallButton("Read") && m_offsetRefresher)
+                    {
+                        m_log.Add("[INFO] Reading value at " + entry.address);
+                        m_offsetRefresher->RefreshNow();
+                    }
+                    
+                    ImGui::SameLine();
+                    
+                    if (ImGui::SmallButton("Remove"))
+                    {
+                        removeIndex = i;
+                    }
+                    
+                    ImGui::PopID();
                 }
             }
+            clipper.End();
             
             ImGui::EndTable();
         }
+        
+        if (m_offsetRefresher)
+        {
+            m_offsetRefresher->SetVisible(std::move(visibleIds));
+        }
+        m_renderedOffsetVersion = offsetVersion;
+        
+        if (removeIndex < m_offsetEntries.size())
+        {
+            RemoveOffsetEntry(removeIndex);
+        }
     }
     ImGui::End();
 }
 
 void UIManager::RenderMemoryViewer()
 {
-    ImGui::SetNextWindowSize(ImVec2(600, 400), ImGuiCond_FirstUseEver);
-    
-    if (ImGui::Begin("Memory Viewer", &m_showMemoryViewer))
+    m_memoryViewer.Render(&m_showMemoryViewer, m_log);
+}
+
+void UIManager::RenderValueScanner()
+{
+    uint64_t address = m_valueScanner.Render(&m_showValueScanner, m_log);
+    if (address != 0)
     {
-        ImGui::Text("Memory Viewer - Not Yet Implemented");
-        ImGui::Separator();
-        
-        static char addressBuffer[32] = "0x00000000";
-        ImGui::InputText("Address", addressBuffer, sizeof(addressBuffer));
-        
-        if (DrawButton("Read Memory"))
-        {
-            m_logMessages.push_back("[INFO] Memory viewer functionality will be implemented");
-        }
-        
-        ImGui::Spacing();
-        ImGui::Text("Memory dump will be displayed here...");
+        // Goes through the regular add path so module addresses become offsets
+        snprintf(m_offsetNameBuffer, sizeof(m_offsetNameBuffer), "Scan result");
+        snprintf(m_offsetAddressBuffer, sizeof(m_offsetAddressBuffer), "%s", DMAManager::FormatHexAddress(address).c_str());
+        AddOffsetEntry();
     }
-    ImGui::End();
 }
 
 void UIManager::RenderProcessSelector()
@@ -647,12 +883,13 @@ void UIManager::RenderProcessSelector()
         ImGui::Text("Available Processes");
         ImGui::Separator();
         
-        static int selectedProcess = -1;
+        static uint32_t selectedProcessId = 0;
         static std::string selectedProcessName;
         
         if (m_dmaManager)
         {
-            std::vector<ProcessInfo> processes = m_dmaManager->GetProcessList();
+            // Shared snapshot: entries stay valid while the list is refreshed in the background
+            auto processes = m_dmaManager->GetProcessList();
             
             static char searchBuffer[256] = "";
             ImGui::InputText("Filter", searchBuffer, sizeof(searchBuffer));
@@ -664,27 +901,26 @@ void UIManager::RenderProcessSelector()
             
             ImGui::BeginChild("ProcessList", ImVec2(0, -reservedHeight));
             
+            // Same engine as the name search; rebuilt only when the background refresh publishes a new list
+            if (m_indexedProcesses != processes)
+            {
+                m_indexedProcesses = processes;
+                m_processSearch.Build(processes->size(), [&processes](size_t i) { return std::string_view((*processes)[i].processName); });
+            }
             std::string filterStr = std::string(searchBuffer);
-            std::transform(filterStr.begin(), filterStr.end(), filterStr.begin(), ::tolower);
+            std::vector<uint32_t> matches;
+            m_processSearch.Search(filterStr, TextMatch::Substring, processes->size(), matches);
             
             int displayIndex = 0;
-            for (int i = 0; i < processes.size(); ++i)
+            for (uint32_t match : matches)
             {
-                const auto& process = processes[i];
-                
-                if (!filterStr.empty())
-                {
-                    std::string processName = process.processName;
-                    std::transform(processName.begin(), processName.end(), processName.begin(), ::tolower);
-                    if (processName.find(filterStr) == std::string::npos)
-                        continue;
-                }
+                const ProcessInfo& process = (*processes)[match];
                 
                 std::string displayText = "[" + std::to_string(process.processId) + "] " + process.processName;
                 
-                if (ImGui::Selectable(displayText.c_str(), selectedProcess == i))
+                if (ImGui::Selectable(displayText.c_str(), selectedProcessId == process.processId))
                 {
-                    selectedProcess = i;
+                    selectedProcessId = process.processId;
                     selectedProcessName = process.processName;
                     strcpy_s(m_processNameBuffer, process.processName.c_str());
                 }
@@ -696,11 +932,11 @@ void UIManager::RenderProcessSelector()
             
             if (!filterStr.empty())
             {
-                ImGui::Text("Found %d processes (%d shown)", (int)processes.size(), displayIndex);
+                ImGui::Text("Found %d processes (%d shown)", (int)processes->size(), displayIndex);
             }
             else
             {
-                ImGui::Text("Found %d processes", (int)processes.size());
+                ImGui::Text("Found %d processes", (int)processes->size());
             }
         }
         else
@@ -712,10 +948,10 @@ void UIManager::RenderProcessSelector()
         
         float availableWidth = ImGui::GetContentRegionAvail().x;
         float buttonWidth = (availableWidth - ImGui::GetStyle().ItemSpacing.x * 2) / 3.0f; 
-        if (DrawButton("Select Process", ImVec2(buttonWidth, 0)) && selectedProcess >= 0 && !selectedProcessName.empty())
+        if (DrawButton("Select Process", ImVec2(buttonWidth, 0)) && selectedProcessId != 0 && !selectedProcessName.empty())
         {
             m_showProcessSelector = false;
-            m_logMessages.push_back("[INFO] Selected process: " + selectedProcessName);
+            m_log.Add("[INFO] Selected process: " + selectedProcessName);
             
             if (m_dmaManager)
             {
@@ -725,19 +961,19 @@ void UIManager::RenderProcessSelector()
                     [this, processName](const AsyncResult<bool>& result) {
                         if (result.isSuccess)
                         {
-                            m_logMessages.push_back("[SUCCESS] " + result.logMessage);
+                            m_log.Add("[SUCCESS] " + result.logMessage);
                             m_selectedProcess = processName;
                         }
                         else
                         {
-                            m_logMessages.push_back("[ERROR] " + result.errorMessage);
+                            m_log.Add("[ERROR] " + result.errorMessage);
                             m_selectedProcess = "";
                         }
                     });
             }
             else
             {
-                m_logMessages.push_back("[ERROR] DMA Manager not available");
+                m_log.Add("[ERROR] DMA Manager not available");
             }
         }
         
@@ -747,8 +983,8 @@ void UIManager::RenderProcessSelector()
         {
             if (m_dmaManager)
             {
-                m_logMessages.push_back("[INFO] Refreshing process list...");
-                // The process list will be refreshed automatically by the DMA manager
+                m_log.Add("[INFO] Refreshing process list...");
+                m_dmaManager->RequestProcessListRefresh();
             }
         }
         
@@ -780,18 +1016,54 @@ void UIManager::RenderStatusWindow()
     {
         if (DrawButton("Clear Logs"))
         {
-            m_logMessages.clear();
+            m_log.Clear();
         }
         
+        // Level and text filter; the buffer only re-indexes when they change
+        static const ImVec4 levelColors[] = {
+            ImVec4(0.8f, 0.9f, 1.0f, 1.0f),     // Info
+            ImVec4(0.4f, 0.9f, 0.4f, 1.0f),     // Success
+            ImVec4(1.0f, 0.8f, 0.3f, 1.0f),     // Warning
+            ImVec4(1.0f, 0.4f, 0.4f, 1.0f)      // Error
+        };
+        for (uint32_t level = 0; level < static_cast<uint32_t>(LogLevel::Count); ++level)
+        {
+            ImGui::SameLine();
+            bool visible = (m_logLevelMask & (1u << level)) != 0;
+            if (ImGui::Checkbox(LogBuffer::GetLevelTag(static_cast<LogLevel>(level)), &visible))
+            {
+                m_logLevelMask ^= 1u << level;
+            }
+        }
+        ImGui::SameLine();
+        ImGui::SetNextItemWidth(200.0f);
+        ImGui::InputTextWithHint("##LogFilter", "Filter", m_logFilterBuffer, sizeof(m_logFilterBuffer));
+        m_log.SetFilter(m_logLevelMask, m_logFilterBuffer);
+        
+        ImGui::SameLine();
+        ImGui::TextDisabled("%zu / %zu lines", m_log.GetFilteredCount(), m_log.GetCount());
+        
         ImGui::Separator();
         
-        ImGui::BeginChild("LogArea");
-        for (const auto& message : m_logMessages)
+        ImGui::BeginChild("LogArea", ImVec2(0, 0), false, ImGuiWindowFlags_HorizontalScrollbar);
+        
+        // Only the visible lines are laid out; lines are unwrapped so they all have the same height
+        bool atBottom = ImGui::GetScrollY() >= ImGui::GetScrollMaxY();
+        ImGuiListClipper clipper;
+        clipper.Begin(static_cast<int>(m_log.GetFilteredCount()));
+        while (clipper.Step())
         {
-            ImGui::TextWrapped("%s", message.c_str());
+            for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; ++i)
+            {
+                const LogEntry& entry = m_log.GetFiltered(i);
+                ImGui::TextColored(levelColors[static_cast<size_t>(entry.level)], "%s", LogBuffer::GetLevelTag(entry.level));
+                ImGui::SameLine();
+                ImGui::TextUnformatted(entry.text.c_str(), entry.text.c_str() + entry.text.size());
+            }
         }
+        clipper.End();
         
-        if (ImGui::GetScrollY() >= ImGui::GetScrollMaxY())
+        if (atBottom)
         {
             ImGui::SetScrollHereY(1.0f);
         }
@@ -823,7 +1095,7 @@ void UIManager::RenderAboutDialog()
         ImGui::TextColored(ImVec4(0.4f, 0.8f, 1.0f, 1.0f), "Overrde");
         ImGui::Spacing();
         
-        ImGui::TextWrapped("Attempts to find GWorld, GName, and GObject with pattern scanning.");
+        ImGui::TextWrapped("Attempts to find GWorld, GName, and GObject from exports, a matching PDB, or pattern scanning.");
         ImGui::Spacing();
         
         if (DrawButton("Close", ImVec2(-1, 0)))
@@ -841,21 +1113,21 @@ void UIManager::AddOffsetEntry()
     
     if (name.empty() || addressInput.empty())
     {
-        m_logMessages.push_back("[ERROR] Please enter both name and offset");
+        m_log.Add("[ERROR] Please enter both name and offset");
         return;
     }
     
     uint64_t inputAddress = DMAManager::ParseHexAddress(addressInput);
     if (inputAddress == 0)
     {
-        m_logMessages.push_back("[ERROR] Invalid address format");
+        m_log.Add("[ERROR] Invalid address format");
         return;
     }
     
     uint64_t mainBase = 0;
-    if (m_dmaManager && m_dmaManager->IsConnected())
+    if (m_dmaManager && m_dmaManager->IsConnected() && m_processSnapshot)
     {
-        mainBase = m_dmaManager->GetMainModuleBase();
+        mainBase = m_processSnapshot->GetMainModuleBase();
     }
     
     std::string offsetStr;
@@ -866,7 +1138,7 @@ void UIManager::AddOffsetEntry()
         uint64_t offset = inputAddress - mainBase;
         offsetStr = DMAManager::FormatHexAddress(offset);
         absoluteStr = DMAManager::FormatHexAddress(inputAddress);
-        m_logMessages.push_back("[INFO] Converted absolute address " + absoluteStr + " to offset " + offsetStr);
+        m_log.Add("[INFO] Converted absolute address " + absoluteStr + " to offset " + offsetStr);
     }
     else
     {
@@ -879,7 +1151,7 @@ void UIManager::AddOffsetEntry()
         {
             absoluteStr = "Module base unknown";
         }
-        m_logMessages.push_back("[INFO] Added offset: " + offsetStr);
+        m_log.Add("[INFO] Added offset: " + offsetStr);
     }
     
     m_offsetEntries.emplace_back(name, offsetStr, absoluteStr);
@@ -888,13 +1160,177 @@ void UIManager::AddOffsetEntry()
     memset(m_offsetAddressBuffer, 0, sizeof(m_offsetAddressBuffer));
 }
 
+void UIManager::SyncOffsetTargets()
+{
+    bool added = false;
+    for (auto& entry : m_offsetEntries)
+    {
+        if (entry.id == 0)
+        {
+            entry.id = m_nextOffsetId++;
+            added = true;
+        }
+    }
+    
+    if (!added && !m_offsetTargetsDirty && m_offsetEntries.size() == m_syncedOffsetCount)
+        return;
+    
+    m_offsetTargetsDirty = false;
+    m_syncedOffsetCount = m_offsetEntries.size();
+    if (!m_offsetRefresher)
+        return;
+    
+    std::vector<OffsetTarget> targets;
+    targets.reserve(m_offsetEntries.size());
+    for (const auto& entry : m_offsetEntries)
+    {
+        OffsetTarget target;
+        target.id = entry.id;
+        target.offset = DMAManager::ParseHexAddress(entry.address);
+        target.type = entry.valueType;
+        target.pointerChain = entry.pointerChain;
+        targets.push_back(std::move(target));
+    }
+    m_offsetRefresher->SetTargets(std::move(targets));
+}
+
+void UIManager::OnUnrealGlobalsScanned(const AsyncResult<UnrealGlobals>& result)
+{
+    if (!result.isSuccess)
+    {
+        m_log.Add("[ERROR] " + result.errorMessage);
+        return;
+    }
+    
+    m_log.Add("[SUCCESS] " + result.logMessage);
+    
+    // Entries stay relative to the main module base the worker scanned against (the refresher reads
+    // main base + offset); the log names the module actually holding each global
+    const auto& globals = result.result;
+    m_log.Add("[INFO] Engine version: " + globals.engineVersion.ToString());
+    m_gnamesAddress = globals.GNames;
+    m_gobjectsAddress = globals.GObjects;
+    const std::tuple<const char*, uint64_t, GlobalSource, const GlobalModule*> found[] = {
+        { "GWorld", globals.GWorld, globals.GWorldSource, &globals.GWorldModule },
+        { "GNames", globals.GNames, globals.GNamesSource, &globals.GNamesModule },
+        { "GObjects", globals.GObjects, globals.GObjectsSource, &globals.GObjectsModule }
+    };
+    for (const auto& [name, address, source, module] : found)
+    {
+        if (address != 0)
+        {
+            std::string offsetStr = DMAManager::FormatHexAddress(address - globals.moduleBase);
+            std::string absoluteStr = DMAManager::FormatHexAddress(address);
+            m_offsetEntries.emplace_back(name, offsetStr, absoluteStr);
+            m_log.Add(std::string("[INFO] ") + name + " offset: " + offsetStr + " (absolute: " + absoluteStr + ", " +
+                      module->name + "+" + DMAManager::FormatHexAddress(address - module->base) + ", from " +
+                      SymbolResolver::GetSourceName(source) + ")");
+        }
+    }
+}
+
+void UIManager::OnNamesDumped(const AsyncResult<std::shared_ptr<const NameTable>>& result)
+{
+    if (!result.isSuccess)
+    {
+        m_log.Add("[ERROR] " + result.errorMessage);
+        return;
+    }
+    
+    m_log.Add("[SUCCESS] " + result.logMessage);
+    m_nameTable = result.result;
+    m_searchWindow.SetNames(m_nameTable);
+    
+    std::string filename = "names_" + std::to_string(time(nullptr)) + ".txt";
+    if (m_nameTable->SaveToFile(filename))
+    {
+        m_log.Add("[INFO] Names saved to " + filename);
+    }
+    else
+    {
+        m_log.Add("[ERROR] Failed to save names to " + filename);
+    }
+}
+
+void UIManager::StartObjectEnumeration(bool resync)
+{
+    if (!m_dmaManager || !m_dmaManager->IsConnected() || !m_objectEnumerator)
+    {
+        m_log.Add("[ERROR] Not connected to any process");
+        return;
+    }
+    
+    m_log.Add(std::string("[INFO] ") + (resync ? "Resyncing" : "Enumerating") + " GObjects at " +
+              DMAManager::FormatHexAddress(m_gobjectsAddress) + "...");
+    m_dmaManager->EnumerateObjectsAsync(m_objectEnumerator, m_gobjectsAddress, resync ? m_objectIndex : nullptr,
+        [this](const AsyncResult<ObjectSyncResult>& result) { OnObjectsEnumerated(result); });
+}
+
+void UIManager::OnObjectsEnumerated(const AsyncResult<ObjectSyncResult>& result)
+{
+    if (!result.isSuccess)
+    {
+        m_log.Add("[ERROR] " + result.errorMessage);
+        return;
+    }
+    
+    m_log.Add("[SUCCESS] " + result.logMessage);
+    m_objectIndex = result.result.objects;
+    m_searchWindow.SetObjects(m_objectIndex);
+    
+    // A resync only reports what changed; the first few new objects are named when possible
+    if (result.result.incremental)
+    {
+        const std::vector<int32_t>& added = result.result.delta.added;
+        for (size_t i = 0; i < added.size() && i < 5 && m_nameTable; ++i)
+        {
+            int64_t position = m_objectIndex->FindSlot(added[i]);
+            m_log.Add("[INFO] + [" + std::to_string(added[i]) + "] " + m_objectIndex->GetPathName(static_cast<size_t>(position), *m_nameTable));
+        }
+        return;
+    }
+    
+    // Names and paths need a name table; without one the raw FName indices are written
+    std::string filename = "objects_" + std::to_string(time(nullptr)) + ".txt";
+    if (m_objectIndex->SaveToFile(filename, m_nameTable.get()))
+    {
+        m_log.Add("[INFO] Objects saved to " + filename + (m_nameTable ? "" : " (dump GNames first for names)"));
+    }
+    else
+    {
+        m_log.Add("[ERROR] Failed to save objects to " + filename);
+    }
+}
+
+void UIManager::OnLayoutsIndexed(const AsyncResult<std::shared_ptr<const LayoutIndex>>& result)
+{
+    if (!result.isSuccess)
+    {
+        m_log.Add("[ERROR] " + result.errorMessage);
+        return;
+    }
+    
+    m_log.Add("[SUCCESS] " + result.logMessage);
+    m_layoutIndex = result.result;
+    
+    std::string filename = "layouts_" + std::to_string(time(nullptr)) + ".txt";
+    if (m_layoutIndex->SaveToFile(filename))
+    {
+        m_log.Add("[INFO] Layouts saved to " + filename);
+    }
+    else
+    {
+        m_log.Add("[ERROR] Failed to save layouts to " + filename);
+    }
+}
+
 void UIManager::RemoveOffsetEntry(size_t index)
 {
     if (index < m_offsetEntries.size())
     {
         std::string name = m_offsetEntries[index].name;
         m_offsetEntries.erase(m_offsetEntries.begin() + index);
-        m_logMessages.push_back("[INFO] Removed offset: " + name);
+        m_log.Add("[INFO] Removed offset: " + name);
     }
 }
 
@@ -905,12 +1341,12 @@ bool UIManager::SaveOffsets(const std::string& filename)
         std::ofstream file(filename);
         if (!file.is_open())
         {
-            m_logMessages.push_back("[ERROR] Failed to create file: " + filename);
+            m_log.Add("[ERROR] Failed to create file: " + filename);
             return false;
         }
 
         file << "# Unreal Offset Finder - Saved Offsets\n";
-        file << "# File Format Version: 1.0\n";
+        file << "# File Format Version: 1.1\n";
         
         std::time_t now = std::time(nullptr);
         char timeStr[100];
@@ -921,10 +1357,10 @@ bool UIManager::SaveOffsets(const std::string& filename)
         file << "# Build Date: " << __DATE__ << " " << __TIME__ << "\n";
         file << "#\n";
         
-        if (m_dmaManager && m_dmaManager->IsConnected())
+        if (m_dmaManager && m_dmaManager->IsConnected() && m_processSnapshot)
         {
-            ProcessInfo processInfo = m_dmaManager->GetCurrentProcessInfo();
-            uint64_t mainBase = m_dmaManager->GetMainModuleBase();
+            const ProcessInfo& processInfo = m_processSnapshot->process;
+            uint64_t mainBase = m_processSnapshot->GetMainModuleBase();
             
             file << "# === Game Information ===\n";
             file << "# Process Name: " << processInfo.processName << "\n";
@@ -946,24 +1382,26 @@ bool UIManager::SaveOffsets(const std::string& filename)
         
         file << "#\n";
         file << "# === Format Information ===\n";
-        file << "# Format: Name,Offset,AbsoluteAddress\n";
+        file << "# Format: Name,Offset,AbsoluteAddress,Type,PointerChain\n";
+        file << "# Note: PointerChain lists the offsets applied after each dereference, separated by spaces\n";
         file << "# Note: Offsets are relative to module base address\n";
         file << "# Note: Absolute addresses change with ASLR, use offsets!\n";
         file << "#\n";
 
         for (const auto& entry : m_offsetEntries)
         {
-            file << entry.name << "," << entry.address << "," << entry.value << "\n";
+            file << entry.name << "," << entry.address << "," << entry.value << ","
+                 << OffsetRefresher::GetTypeName(entry.valueType) << "," << FormatPointerChain(entry.pointerChain, " ") << "\n";
         }
 
         file.close();
         
-        m_logMessages.push_back("[SUCCESS] Saved " + std::to_string(m_offsetEntries.size()) + " offsets to " + filename);
+        m_log.Add("[SUCCESS] Saved " + std::to_string(m_offsetEntries.size()) + " offsets to " + filename);
         return true;
     }
     catch (const std::exception& e)
     {
-        m_logMessages.push_back("[ERROR] Exception while saving: " + std::string(e.what()));
+        m_log.Add("[ERROR] Exception while saving: " + std::string(e.what()));
         return false;
     }
 }
@@ -975,7 +1413,7 @@ bool UIManager::LoadOffsets(const std::string& filename)
         std::ifstream file(filename);
         if (!file.is_open())
         {
-            m_logMessages.push_back("[ERROR] Failed to open file: " + filename);
+            m_log.Add("[ERROR] Failed to open file: " + filename);
             return false;
         }
 
@@ -1000,25 +1438,35 @@ bool UIManager::LoadOffsets(const std::string& filename)
                 continue;
 
             std::stringstream ss(line);
-            std::string name, offset, absolute;
+            std::string name, offset, absolute, type, chain;
             
+            // Type and PointerChain were added in format 1.1 and are optional
             if (std::getline(ss, name, ',') && 
                 std::getline(ss, offset, ',') && 
-                std::getline(ss, absolute))
+                std::getline(ss, absolute, ','))
             {
-                    name.erase(name.find_last_not_of(" \t\r\n") + 1);
+                std::getline(ss, type, ',');
+                std::getline(ss, chain);
+                
+                name.erase(name.find_last_not_of(" \t\r\n") + 1);
                 offset.erase(offset.find_last_not_of(" \t\r\n") + 1);
                 absolute.erase(absolute.find_last_not_of(" \t\r\n") + 1);
+                type.erase(type.find_last_not_of(" \t\r\n") + 1);
 
                 if (!name.empty() && !offset.empty())
                 {
-                    m_offsetEntries.emplace_back(name, offset, absolute);
+                    OffsetEntry& entry = m_offsetEntries.emplace_back(name, offset, absolute);
+                    if (!type.empty() && !OffsetRefresher::ParseTypeName(type, entry.valueType))
+                    {
+                        m_log.Add("[WARNING] Unknown value type '" + type + "' on line " + std::to_string(lineNumber));
+                    }
+                    entry.pointerChain = ParsePointerChain(chain);
                     loadedCount++;
                 }
             }
             else
             {
-                m_logMessages.push_back("[WARNING] Skipped invalid line " + std::to_string(lineNumber) + ": " + line);
+                m_log.Add("[WARNING] Skipped invalid line " + std::to_string(lineNumber) + ": " + line);
             }
         }
 
@@ -1029,13 +1477,13 @@ bool UIManager::LoadOffsets(const std::string& filename)
         {
             successMsg += " (Game: " + gameInfo + ")";
         }
-        m_logMessages.push_back(successMsg);
+        m_log.Add(successMsg);
         
         return true;
     }
     catch (const std::exception& e)
     {
-        m_logMessages.push_back("[ERROR] Exception while loading: " + std::string(e.what()));
+        m_log.Add("[ERROR] Exception while loading: " + std::string(e.what()));
         return false;
     }
 }
@@ -3,10 +3,26 @@
 #include <string>
 #include <vector>
 #include <memory>
+#include <cstdint>
 #include <imgui.h>
+#include "LogBuffer.h"
+#include "MemoryViewer.h"
+#include "ValueScannerWindow.h"
+#include "SearchWindow.h"
+#include "../Core/TextIndex.h"
+#include "../DMA/OffsetRefresher.h"
 
 // Forward declarations
 class DMAManager;
+struct ProcessSnapshot;
+struct ProcessInfo;
+struct UnrealGlobals;
+class NameTable;
+class ObjectIndex;
+class ObjectEnumerator;
+struct ObjectSyncResult;
+class LayoutIndex;
+template<typename T> struct AsyncResult;
 
 /**
  * @struct OffsetEntry
@@ -16,11 +32,13 @@ struct OffsetEntry
 {
     std::string name;           ///< Name/description of the offset
     std::string address;        ///< Memory address (hex string)
-    std::string value;          ///< Current value at address
-    bool isValid;               ///< Whether this offset is currently valid
+    std::string value;          ///< Absolute address when added (hex string)
+    uint64_t id;                ///< Refresher ID (0 until the entry is synced)
+    OffsetValueType valueType;  ///< How the value is read and shown
+    std::vector<uint64_t> pointerChain;     ///< Offsets applied after each dereference (empty = plain value)
     
     OffsetEntry(const std::string& n = "", const std::string& addr = "", const std::string& val = "")
-        : name(n), address(addr), value(val), isValid(true) {}
+        : name(n), address(addr), value(val), id(0), valueType(OffsetValueType::UInt64) {}
 };
 
 /**
@@ -65,6 +83,18 @@ public:
      */
     void Shutdown();
 
+    /**
+     * @brief Check whether UI state changed since the last rendered frame
+     * @return true if new log lines or a finished trace export are waiting to be shown
+     */
+    bool WantsRedraw() const;
+
+    /**
+     * @brief Append a line to the status log
+     * @param message Message including its "[LEVEL]" prefix
+     */
+    void AddLogMessage(const std::string& message);
+
     /**
      * @brief Set reference to DMA manager for UI callbacks
      * @param dmaManager Pointer to the DMA manager
@@ -112,6 +142,11 @@ private:
      */
     void RenderMemoryViewer();
 
+    /**
+     * @brief Render the value scanner window
+     */
+    void RenderValueScanner();
+
     /**
      * @brief Render the process selection window
      */
@@ -132,6 +167,41 @@ private:
      */
     void AddOffsetEntry();
 
+    /**
+     * @brief Hand the offset entries to the refresher when they changed
+     */
+    void SyncOffsetTargets();
+
+    /**
+     * @brief Add the results of a globals scan to the offset list
+     * @param result Scan result (carries the module base it was scanned against)
+     */
+    void OnUnrealGlobalsScanned(const AsyncResult<UnrealGlobals>& result);
+
+    /**
+     * @brief Keep a dumped name table and save it next to the offsets
+     * @param result Dump result
+     */
+    void OnNamesDumped(const AsyncResult<std::shared_ptr<const NameTable>>& result);
+
+    /**
+     * @brief Keep an enumerated object index; full walks are saved next to the offsets
+     * @param result Enumeration or resync result
+     */
+    void OnObjectsEnumerated(const AsyncResult<ObjectSyncResult>& result);
+
+    /**
+     * @brief Queue a GObjects walk
+     * @param resync Re-read only what changed since the last walk
+     */
+    void StartObjectEnumeration(bool resync);
+
+    /**
+     * @brief Keep an indexed set of class layouts and save it next to the offsets
+     * @param result Indexing result (walked or loaded from the build cache)
+     */
+    void OnLayoutsIndexed(const AsyncResult<std::shared_ptr<const LayoutIndex>>& result);
+
     /**
      * @brief Draw a styled button with modern visuals
      * @param label Button label
@@ -166,27 +236,55 @@ private:
     bool m_showControlPanel;        ///< Show main control panel
     bool m_showOffsetFinder;        ///< Show offset finder window
     bool m_showMemoryViewer;        ///< Show memory viewer window
+    bool m_showValueScanner;        ///< Show value scanner window
+    bool m_showSearch;              ///< Show name/object search window
     bool m_showProcessSelector;     ///< Show process selector window
     bool m_showStatusWindow;        ///< Show status/log window
     bool m_showAboutDialog;         ///< Show about dialog
 
     // UI State
     std::vector<OffsetEntry> m_offsetEntries;   ///< List of offset entries
-    std::vector<std::string> m_logMessages;     ///< Log messages for status window
+    LogBuffer m_log;                            ///< Status window log (bounded)
+    MemoryViewer m_memoryViewer;                ///< Hex viewer state and page cache
+    ValueScannerWindow m_valueScanner;          ///< Value scanner state
+    SearchWindow m_searchWindow;                ///< Name and object search state
+    std::unique_ptr<OffsetRefresher> m_offsetRefresher;    ///< Live values of the offset entries
+    uint64_t m_nextOffsetId;                    ///< Next refresher ID handed to an entry
+    bool m_offsetTargetsDirty;                  ///< An entry's type or chain was edited
+    size_t m_syncedOffsetCount;                 ///< Entry count last handed to the refresher
+    uint64_t m_renderedOffsetVersion;           ///< Refresher version shown by the last rendered frame
+    bool m_liveOffsets;                         ///< Refresh visible offsets periodically
+    bool m_scanAllModules;                      ///< Globals scan covers every loaded module
+    int m_offsetRefreshRate;                    ///< Live refresh rate (Hz)
+    uint32_t m_logLevelMask;                    ///< Levels shown in the status window
     std::string m_selectedProcess;              ///< Currently selected process
     float m_progressSpinner;                    ///< Spinner animation for async operations
+    uint32_t m_lastTraceExportCount;            ///< Trace export counter last reported in the log
+    uint64_t m_renderedLogVersion;              ///< Log version shown by the last rendered frame
+    uint64_t m_gnamesAddress;                   ///< GNames found by the last globals scan (0 = unknown)
+    uint64_t m_gobjectsAddress;                 ///< GObjects found by the last globals scan (0 = unknown)
+    std::shared_ptr<const NameTable> m_nameTable;   ///< Names of the last GNames dump
+    std::shared_ptr<const ObjectIndex> m_objectIndex;   ///< Objects of the last GObjects walk
+    std::shared_ptr<ObjectEnumerator> m_objectEnumerator;   ///< Keeps the GObjects snapshot between walks
+    std::shared_ptr<const LayoutIndex> m_layoutIndex;   ///< Class and struct layouts of the attached build
+    std::shared_ptr<const std::vector<ProcessInfo>> m_indexedProcesses;  ///< Process list m_processSearch was built from
+    TextIndex m_processSearch;                  ///< Process selector filter index
     
     // Input buffers
     char m_processNameBuffer[256];              ///< Buffer for process name input
     char m_offsetNameBuffer[128];               ///< Buffer for offset name input
     char m_offsetAddressBuffer[32];             ///< Buffer for offset address input
+    char m_logFilterBuffer[128];                ///< Buffer for the log text filter
     
     // References
     DMAManager* m_dmaManager;                   ///< Reference to DMA manager
+    std::shared_ptr<const ProcessSnapshot> m_processSnapshot;  ///< Attached process as of this frame (read-only)
 
     // UI Configuration constants
     static constexpr float DEFAULT_PANEL_WIDTH = 400.0f;  ///< Default panel width
     static constexpr float DEFAULT_PANEL_HEIGHT = 600.0f; ///< Default panel height
     static constexpr float BUTTON_HEIGHT = 25.0f;         ///< Standard button height
     static constexpr float SPINNER_RADIUS = 10.0f;        ///< Default spinner radius
+    static constexpr const char* SIGNATURE_STATS_FILE = "signature_stats.txt";    ///< Signature hits per engine version
+    static constexpr const char* PDB_FILE = "target.pdb";                       ///< PDB of the game build, used if present
 }; 
\ No newline at end of file
@@ -0,0 +1,272 @@
+#include "ValueScannerWindow.h"
+#include "LogBuffer.h"
+#include "../DMA/DMAManager.h"
+#include <imgui.h>
+#include <cstring>
+
+ValueScannerWindow::ValueScannerWindow()
+    : m_dmaManager(nullptr)
+    , m_candidateCount(0)
+    , m_lastGeneration(0)
+    , m_scanning(false)
+    , m_valueType(static_cast<int>(ScanValueType::Int32))
+    , m_compare(static_cast<int>(ScanCompare::Exact))
+    , m_writableOnly(true)
+{
+    memset(m_valueBuffer, 0, sizeof(m_valueBuffer));
+    memset(m_upperBuffer, 0, sizeof(m_upperBuffer));
+}
+
+void ValueScannerWindow::SetDMAManager(DMAManager* dmaManager)
+{
+    m_dmaManager = dmaManager;
+    m_scanner = dmaManager ? std::make_shared<ValueScanner>(*dmaManager) : nullptr;
+    m_results.clear();
+    m_candidateCount = 0;
+    m_scanning = false;
+}
+
+uint64_t ValueScannerWindow::Render(bool* open, LogBuffer& log)
+{
+    ImGui::SetNextWindowSize(ImVec2(520, 560), ImGuiCond_FirstUseEver);
+
+    if (!ImGui::Begin("Value Scanner", open))
+    {
+        ImGui::End();
+        return 0;
+    }
+
+    if (!m_dmaManager || !m_scanner)
+    {
+        ImGui::Text("DMA Manager not available");
+        ImGui::End();
+        return 0;
+    }
+
+    // Candidates of another process are meaningless
+    auto snapshot = m_dmaManager->GetProcessSnapshot();
+    if (snapshot->generation != m_lastGeneration)
+    {
+        m_lastGeneration = snapshot->generation;
+        if (!m_scanning)
+        {
+            m_scanner->Reset();
+            m_results.clear();
+            m_candidateCount = 0;
+        }
+    }
+
+    bool hasScan = m_scanner->HasScan();
+
+    // The value type is fixed once candidates exist
+    if (hasScan)
+    {
+        m_valueType = static_cast<int>(m_scanner->GetValueType());
+    }
+    ImGui::SetNextItemWidth(140.0f);
+    ImGui::BeginDisabled(hasScan || m_scanning);
+    if (ImGui::BeginCombo("Type", ValueScanner::GetTypeName(static_cast<ScanValueType>(m_valueType))))
+    {
+        for (int i = 0; i < static_cast<int>(ScanValueType::Count); ++i)
+        {
+            if (ImGui::Selectable(ValueScanner::GetTypeName(static_cast<ScanValueType>(i)), m_valueType == i))
+            {
+                m_valueType = i;
+            }
+        }
+        ImGui::EndCombo();
+    }
+    ImGui::EndDisabled();
+
+    // Before the first scan only Exact, Range and Unknown make sense
+    if (!hasScan && ValueScanner::NeedsPreviousValues(static_cast<ScanCompare>(m_compare)))
+    {
+        m_compare = static_cast<int>(ScanCompare::Exact);
+    }
+    ImGui::SameLine();
+    ImGui::SetNextItemWidth(140.0f);
+    if (ImGui::BeginCombo("Compare", ValueScanner::GetCompareName(static_cast<ScanCompare>(m_compare))))
+    {
+        for (int i = 0; i < static_cast<int>(ScanCompare::Count); ++i)
+        {
+            if (!hasScan && ValueScanner::NeedsPreviousValues(static_cast<ScanCompare>(i)))
+            {
+                continue;
+            }
+            if (ImGui::Selectable(ValueScanner::GetCompareName(static_cast<ScanCompare>(i)), m_compare == i))
+            {
+                m_compare = i;
+            }
+        }
+        ImGui::EndCombo();
+    }
+
+    ScanCompare compare = static_cast<ScanCompare>(m_compare);
+    if (compare == ScanCompare::Exact || compare == ScanCompare::Range)
+    {
+        ImGui::SetNextItemWidth(180.0f);
+        ImGui::InputText(compare == ScanCompare::Range ? "From" : "Value", m_valueBuffer, sizeof(m_valueBuffer));
+        if (compare == ScanCompare::Range)
+        {
+            ImGui::SameLine();
+            ImGui::SetNextItemWidth(180.0f);
+            ImGui::InputText("To", m_upperBuffer, sizeof(m_upperBuffer));
+        }
+    }
+
+    ImGui::BeginDisabled(hasScan || m_scanning);
+    ImGui::Checkbox("Writable memory only", &m_writableOnly);
+    ImGui::EndDisabled();
+
+    bool connected = m_dmaManager->IsConnected();
+    ImGui::BeginDisabled(m_scanning || !connected);
+    if (ImGui::Button("First Scan"))
+    {
+        StartScan(false, log);
+    }
+    ImGui::SameLine();
+    ImGui::BeginDisabled(!hasScan);
+    if (ImGui::Button("Next Scan"))
+    {
+        StartScan(true, log);
+    }
+    ImGui::SameLine();
+    if (ImGui::Button("Reset"))
+    {
+        m_scanner->Reset();
+        m_results.clear();
+        m_candidateCount = 0;
+    }
+    ImGui::EndDisabled();
+    ImGui::EndDisabled();
+
+    ImGui::SameLine();
+    if (m_scanning)
+    {
+        ImGui::Text("Scanning...");
+    }
+    else if (hasScan)
+    {
+        ImGui::Text("%llu candidates", static_cast<unsigned long long>(m_candidateCount));
+    }
+
+    ImGui::Separator();
+
+    if (!connected)
+    {
+        ImGui::Text("Not connected to any process");
+        ImGui::End();
+        return 0;
+    }
+
+    uint64_t picked = RenderResults();
+
+    ImGui::End();
+    return picked;
+}
+
+void ValueScannerWindow::StartScan(bool nextScan, LogBuffer& log)
+{
+    ValueScanQuery query;
+    query.type = static_cast<ScanValueType>(m_valueType);
+    query.compare = static_cast<ScanCompare>(m_compare);
+    query.writableOnly = m_writableOnly;
+
+    if (query.compare == ScanCompare::Exact || query.compare == ScanCompare::Range)
+    {
+        if (!ValueScanner::ParseValue(query.type, m_valueBuffer, query.value) ||
+            (query.compare == ScanCompare::Range && !ValueScanner::ParseValue(query.type, m_upperBuffer, query.upper)))
+        {
+            log.Add(std::string("[ERROR] Invalid ") + ValueScanner::GetTypeName(query.type) + " value");
+            return;
+        }
+    }
+
+    m_scanning = true;
+    log.Add(std::string("[INFO] Starting ") + (nextScan ? "next" : "first") + " scan (" +
+            ValueScanner::GetCompareName(query.compare) + " " + ValueScanner::GetTypeName(query.type) + ")...");
+
+    std::shared_ptr<ValueScanner> scanner = m_scanner;
+    m_dmaManager->ValueScanAsync(scanner, query, nextScan,
+        [this, scanner, &log](const AsyncResult<uint64_t>& result) {
+            // The scanner may have been replaced while the scan ran
+            if (scanner != m_scanner)
+            {
+                return;
+            }
+
+            m_scanning = false;
+            if (result.isSuccess)
+            {
+                log.Add("[SUCCESS] " + result.logMessage);
+            }
+            else
+            {
+                log.Add("[ERROR] " + result.errorMessage);
+            }
+
+            m_candidateCount = scanner->GetCandidateCount();
+            m_results = scanner->GetResults(MAX_RESULTS);
+        });
+}
+
+uint64_t ValueScannerWindow::RenderResults()
+{
+    if (m_results.empty())
+    {
+        return 0;
+    }
+
+    if (m_candidateCount > m_results.size())
+    {
+        ImGui::Text("Showing the first %zu candidates", m_results.size());
+    }
+
+    uint64_t picked = 0;
+    ScanValueType type = static_cast<ScanValueType>(m_valueType);
+    ImGuiTableFlags flags = ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_ScrollY;
+    if (ImGui::BeginTable("ScanResults", 3, flags))
+    {
+        ImGui::TableSetupScrollFreeze(0, 1);
+        ImGui::TableSetupColumn("Address", ImGuiTableColumnFlags_WidthFixed, 160.0f);
+        ImGui::TableSetupColumn("Value at last scan");
+        ImGui::TableSetupColumn("", ImGuiTableColumnFlags_WidthFixed, 50.0f);
+        ImGui::TableHeadersRow();
+
+        ImGuiListClipper clipper;
+        clipper.Begin(static_cast<int>(m_results.size()));
+        while (clipper.Step())
+        {
+            for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; ++row)
+            {
+                const ValueScanResult& result = m_results[row];
+                ImGui::PushID(row);
+                ImGui::TableNextRow();
+
+                ImGui::TableSetColumnIndex(0);
+                std::string address = DMAManager::FormatHexAddress(result.address);
+                if (ImGui::Selectable(address.c_str(), false, ImGuiSelectableFlags_AllowDoubleClick) &&
+                    ImGui::IsMouseDoubleClicked(ImGuiMouseButton_Left))
+                {
+                    ImGui::SetClipboardText(address.c_str());
+                }
+
+                ImGui::TableSetColumnIndex(1);
+                ImGui::TextUnformatted(ValueScanner::FormatValue(type, result.value).c_str());
+
+                ImGui::TableSetColumnIndex(2);
+                if (ImGui::SmallButton("Add"))
+                {
+                    picked = result.address;
+                }
+
+                ImGui::PopID();
+            }
+        }
+        clipper.End();
+
+        ImGui::EndTable();
+    }
+
+    return picked;
+}
@@ -0,0 +1,68 @@
+#pragma once
+
+#include "../Scan/ValueScanner.h"
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+class DMAManager;
+class LogBuffer;
+
+/**
+ * @class ValueScannerWindow
+ * @brief First-scan / next-scan window on top of ValueScanner
+ *
+ * Scans run as DMA manager tasks; the window only shows a copy of the
+ * first MAX_RESULTS candidates taken when a scan completes.
+ */
+class ValueScannerWindow
+{
+public:
+    /**
+     * @brief Constructor
+     */
+    ValueScannerWindow();
+
+    /**
+     * @brief Set the DMA manager to scan through (creates the scanner)
+     * @param dmaManager DMA manager, nullptr to detach
+     */
+    void SetDMAManager(DMAManager* dmaManager);
+
+    /**
+     * @brief Draw the scanner window
+     * @param open Window open flag (cleared when the user closes the window)
+     * @param log Status log for user-facing messages
+     * @return Address the user asked to add to the offset table, 0 for none
+     */
+    uint64_t Render(bool* open, LogBuffer& log);
+
+    static constexpr size_t MAX_RESULTS = 10000;    ///< Candidates listed in the window
+
+private:
+    /**
+     * @brief Queue a first or next scan with the current inputs
+     * @param nextScan true to filter the current candidates
+     * @param log Status log
+     */
+    void StartScan(bool nextScan, LogBuffer& log);
+
+    /**
+     * @brief Draw the candidate list
+     * @return Address picked for the offset table, 0 for none
+     */
+    uint64_t RenderResults();
+
+private:
+    DMAManager* m_dmaManager;                       ///< DMA manager (not owned)
+    std::shared_ptr<ValueScanner> m_scanner;        ///< Scanner (shared with running scan tasks)
+    std::vector<ValueScanResult> m_results;         ///< Candidates shown in the list
+    uint64_t m_candidateCount;                      ///< Candidates of the last scan
+    uint64_t m_lastGeneration;                      ///< Process snapshot generation the scan belongs to
+    bool m_scanning;                                ///< A scan task is queued or running
+    int m_valueType;                                ///< Selected ScanValueType
+    int m_compare;                                  ///< Selected ScanCompare
+    bool m_writableOnly;                            ///< First scan writable regions only
+    char m_valueBuffer[64];                         ///< Value / lower bound input
+    char m_upperBuffer[64];                         ///< Range upper bound input
+};
@@ -0,0 +1,69 @@
+#include "BuildFingerprint.h"
+#include "../DMA/DMAManager.h"
+#include "../Core/PeImage.h"
+#include <cctype>
+#include <cstdio>
+#include <vector>
+
+namespace
+{
+    constexpr size_t HEADER_READ_SIZE = 0x1000;     // DOS, NT and section headers fit in the first page
+
+    void HashBytes(uint32_t& hash, const void* data, size_t size)
+    {
+        const uint8_t* bytes = static_cast<const uint8_t*>(data);
+        for (size_t i = 0; i < size; ++i)
+        {
+            hash ^= bytes[i];
+            hash *= 0x01000193u;
+        }
+    }
+}
+
+bool BuildFingerprint::Read(const DMAManager& dmaManager, BuildFingerprint& fingerprint, std::string& error)
+{
+    if (!dmaManager.IsConnected())
+    {
+        error = "Not connected to any process";
+        return false;
+    }
+
+    ProcessInfo process = dmaManager.GetCurrentProcessInfo();
+    uint64_t moduleBase = dmaManager.GetMainModuleBase();
+    std::vector<uint8_t> headerBytes(HEADER_READ_SIZE);
+    size_t bytesRead = moduleBase ? dmaManager.ReadMemory(moduleBase, headerBytes.data(), headerBytes.size()) : 0;
+
+    PeHeaders headers;
+    if (!PeImage::ParseHeaders(headerBytes.data(), bytesRead, headers))
+    {
+        error = "Main module headers are unreadable at " + DMAManager::FormatHexAddress(moduleBase);
+        return false;
+    }
+
+    // ImageBase is left out on purpose: the loader rewrites it for relocated images
+    fingerprint.moduleName = process.processName;
+    fingerprint.timeDateStamp = headers.timeDateStamp;
+    fingerprint.sizeOfImage = headers.sizeOfImage;
+    fingerprint.sectionHash = 0x811C9DC5u;
+    for (const PeSection& section : headers.sections)
+    {
+        HashBytes(fingerprint.sectionHash, section.name.data(), section.name.size());
+        HashBytes(fingerprint.sectionHash, &section.virtualAddress, sizeof(section.virtualAddress));
+        HashBytes(fingerprint.sectionHash, &section.virtualSize, sizeof(section.virtualSize));
+        HashBytes(fingerprint.sectionHash, &section.rawSize, sizeof(section.rawSize));
+    }
+    return true;
+}
+
+std::string BuildFingerprint::ToString() const
+{
+    std::string name;
+    for (char c : moduleName.substr(0, moduleName.rfind('.')))
+    {
+        name += std::isalnum(static_cast<unsigned char>(c)) || c == '-' ? c : '_';
+    }
+
+    char suffix[32];
+    snprintf(suffix, sizeof(suffix), "_%08X_%08X_%08X", timeDateStamp, sizeOfImage, sectionHash);
+    return name + suffix;
+}
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+class DMAManager;
+
+/**
+ * @struct BuildFingerprint
+ * @brief Identifies one build of the target executable
+ *
+ * Taken from the PE headers of the main module in memory: linker timestamp,
+ * image size and a hash of the section table. Two processes of the same
+ * build give the same fingerprint, so results derived from the build
+ * (reflection layouts, offsets) can be cached under it.
+ */
+struct BuildFingerprint
+{
+    std::string moduleName;         ///< Main module name
+    uint32_t timeDateStamp = 0;     ///< Linker timestamp
+    uint32_t sizeOfImage = 0;       ///< Mapped image size
+    uint32_t sectionHash = 0;       ///< FNV-1a of section names, RVAs and sizes
+
+    /**
+     * @brief Read the fingerprint of the attached process' main module
+     * @param dmaManager DMA manager attached to the process
+     * @param fingerprint Receives the fingerprint
+     * @param error Receives the reason on failure
+     * @return true if successful, false otherwise
+     */
+    static bool Read(const DMAManager& dmaManager, BuildFingerprint& fingerprint, std::string& error);
+
+    /**
+     * @brief Format as a file name friendly key ("Game-Win64-Shipping_5F3A...")
+     * @return Key
+     */
+    std::string ToString() const;
+
+    bool operator==(const BuildFingerprint& other) const
+    {
+        return moduleName == other.moduleName && timeDateStamp == other.timeDateStamp &&
+               sizeOfImage == other.sizeOfImage && sectionHash == other.sectionHash;
+    }
+    bool operator!=(const BuildFingerprint& other) const { return !(*this == other); }
+};
@@ -0,0 +1,134 @@
+#include "EngineVersion.h"
+#include "../DMA/DMAManager.h"
+#include "../Core/PeImage.h"
+#include <algorithm>
+#include <functional>
+#include <vector>
+
+namespace
+{
+    constexpr size_t HEADER_READ_SIZE = 0x1000;     // DOS, NT and section headers fit in the first page
+    constexpr char RELEASE_MARKER[] = "+Release-";
+
+    /**
+     * @brief Parse "<major>.<minor>" from characters stride bytes apart
+     * @return true if the digits form a supported version
+     */
+    bool ParseDigits(const uint8_t* data, size_t size, size_t stride, EngineVersion& version)
+    {
+        uint32_t parts[2] = { 0, 0 };
+        size_t digits[2] = { 0, 0 };
+        size_t part = 0;
+        for (size_t i = 0; i + stride <= size && digits[part] < 3; i += stride)
+        {
+            if (stride == 2 && data[i + 1] != 0)
+                break;
+            char c = static_cast<char>(data[i]);
+            if (c >= '0' && c <= '9')
+            {
+                parts[part] = parts[part] * 10 + static_cast<uint32_t>(c - '0');
+                digits[part]++;
+            }
+            else if (c == '.' && part == 0 && digits[0] != 0)
+            {
+                part = 1;
+            }
+            else
+            {
+                break;
+            }
+        }
+
+        if (digits[0] == 0 || digits[1] == 0 || parts[0] < EngineVersion::MIN_MAJOR || parts[0] > EngineVersion::MAX_MAJOR)
+            return false;
+        version.major = parts[0];
+        version.minor = parts[1];
+        return true;
+    }
+
+    /**
+     * @brief Look for the release marker encoded with the given character width
+     */
+    bool FindMarker(const uint8_t* data, size_t size, size_t stride, EngineVersion& version)
+    {
+        std::vector<uint8_t> marker;
+        for (const char* c = RELEASE_MARKER; *c; ++c)
+        {
+            marker.push_back(static_cast<uint8_t>(*c));
+            if (stride == 2)
+                marker.push_back(0);
+        }
+
+        std::boyer_moore_horspool_searcher searcher(marker.begin(), marker.end());
+        const uint8_t* end = data + size;
+        for (const uint8_t* it = std::search(data, end, searcher); it != end; it = std::search(it + 1, end, searcher))
+        {
+            const uint8_t* digits = it + marker.size();
+            if (ParseDigits(digits, static_cast<size_t>(end - digits), stride, version))
+                return true;
+        }
+        return false;
+    }
+}
+
+bool EngineVersion::Read(const DMAManager& dmaManager, EngineVersion& version, std::string& error)
+{
+    if (!dmaManager.IsConnected())
+    {
+        error = "Not connected to any process";
+        return false;
+    }
+
+    uint64_t moduleBase = dmaManager.GetMainModuleBase();
+    std::vector<uint8_t> headerBytes(HEADER_READ_SIZE);
+    size_t bytesRead = moduleBase ? dmaManager.ReadMemory(moduleBase, headerBytes.data(), headerBytes.size()) : 0;
+
+    PeHeaders headers;
+    if (!PeImage::ParseHeaders(headerBytes.data(), bytesRead, headers))
+    {
+        error = "Main module headers are unreadable at " + DMAManager::FormatHexAddress(moduleBase);
+        return false;
+    }
+
+    // The branch name is a string literal; only read-only data is read
+    auto rdata = std::find_if(headers.sections.begin(), headers.sections.end(),
+        [](const PeSection& section) { return section.name == ".rdata"; });
+    if (rdata == headers.sections.end() || rdata->virtualSize == 0)
+    {
+        error = "Main module has no .rdata section";
+        return false;
+    }
+
+    std::vector<uint8_t> data(rdata->virtualSize);
+    bytesRead = dmaManager.ReadMemoryEx(moduleBase + rdata->virtualAddress, data.data(), data.size(), 1);
+    if (bytesRead == 0)
+    {
+        error = "Failed to read .rdata at " + DMAManager::FormatHexAddress(moduleBase + rdata->virtualAddress);
+        return false;
+    }
+
+    if (!Find(data.data(), bytesRead, version))
+    {
+        error = "No engine branch name in .rdata";
+        return false;
+    }
+    return true;
+}
+
+bool EngineVersion::Find(const uint8_t* data, size_t size, EngineVersion& version)
+{
+    // BuildSettings stores TEXT() literals, so UTF-16 comes first
+    return FindMarker(data, size, 2, version) || FindMarker(data, size, 1, version);
+}
+
+bool EngineVersion::Parse(const std::string& text, EngineVersion& version)
+{
+    return ParseDigits(reinterpret_cast<const uint8_t*>(text.data()), text.size(), 1, version);
+}
+
+std::string EngineVersion::ToString() const
+{
+    if (!IsKnown())
+        return "unknown";
+    return std::to_string(major) + "." + std::to_string(minor);
+}
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <string>
+
+class DMAManager;
+
+/**
+ * @struct EngineVersion
+ * @brief Unreal Engine version a module was built from
+ *
+ * Detected from the branch name the engine compiles into every binary
+ * (BuildSettings, e.g. "++UE4+Release-4.27" or "++UE5+Release-5.1"), stored
+ * as UTF-16 in .rdata. Licensee branches that keep the "+Release-" suffix
+ * with their own numbering ("++Fortnite+Release-28.10") are not engine
+ * versions and are skipped.
+ */
+struct EngineVersion
+{
+    uint32_t major = 0;     ///< Engine major version (4 or 5), 0 if unknown
+    uint32_t minor = 0;     ///< Engine minor version
+
+    /**
+     * @brief Detect the version of the attached process' main module (reads headers and .rdata)
+     * @param dmaManager DMA manager attached to the process
+     * @param version Receives the version
+     * @param error Receives the reason on failure
+     * @return true if a version was found, false otherwise
+     */
+    static bool Read(const DMAManager& dmaManager, EngineVersion& version, std::string& error);
+
+    /**
+     * @brief Find the branch name in a block of module bytes
+     * @param data Bytes to search (typically .rdata)
+     * @param size Number of bytes
+     * @param version Receives the version
+     * @return true if a version was found, false otherwise
+     */
+    static bool Find(const uint8_t* data, size_t size, EngineVersion& version);
+
+    /**
+     * @brief Parse "4.27" style text
+     * @param text Version text
+     * @param version Receives the version
+     * @return true if the text is a supported engine version
+     */
+    static bool Parse(const std::string& text, EngineVersion& version);
+
+    /**
+     * @brief Check whether the version is known
+     * @return true if detected
+     */
+    bool IsKnown() const { return major != 0; }
+
+    /**
+     * @brief Pack into a comparable number (major * 100 + minor, 0 if unknown)
+     * @return Packed version
+     */
+    uint32_t GetCode() const { return major * 100 + minor; }
+
+    /**
+     * @brief Format as "4.27" ("unknown" if not detected)
+     * @return Version text
+     */
+    std::string ToString() const;
+
+    bool operator==(const EngineVersion& other) const { return major == other.major && minor == other.minor; }
+    bool operator!=(const EngineVersion& other) const { return !(*this == other); }
+
+    static constexpr uint32_t MIN_MAJOR = 4;    ///< Oldest supported engine major version
+    static constexpr uint32_t MAX_MAJOR = 5;    ///< Newest supported engine major version
+};
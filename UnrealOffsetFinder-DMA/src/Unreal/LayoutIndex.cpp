@@ -0,0 +1,211 @@
+#include "LayoutIndex.h"
+#include "../DMA/SessionFormat.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+void LayoutIndex::Clear()
+{
+    m_structs.clear();
+    m_properties.clear();
+    m_names.Clear();
+}
+
+uint32_t LayoutIndex::AddStruct(const LayoutStruct& entry)
+{
+    m_structs.push_back(entry);
+    return static_cast<uint32_t>(m_structs.size() - 1);
+}
+
+int64_t LayoutIndex::FindStruct(std::string_view name) const
+{
+    for (size_t i = 0; i < m_structs.size(); ++i)
+    {
+        if (m_structs[i].nameNumber == 0 && m_names.Find(m_structs[i].nameIndex) == name)
+        {
+            return static_cast<int64_t>(i);
+        }
+    }
+    return -1;
+}
+
+std::string LayoutIndex::GetName(uint32_t nameIndex, uint32_t nameNumber) const
+{
+    std::string name(m_names.Find(nameIndex));
+    if (name.empty())
+    {
+        char fallback[24];
+        snprintf(fallback, sizeof(fallback), "FName_%X", nameIndex);
+        name = fallback;
+    }
+    if (nameNumber != 0)
+    {
+        name += "_" + std::to_string(nameNumber - 1);
+    }
+    return name;
+}
+
+uint64_t LayoutIndex::GetMemoryBytes() const
+{
+    return m_structs.capacity() * sizeof(LayoutStruct) + m_properties.capacity() * sizeof(LayoutProperty) +
+           m_names.GetMemoryBytes();
+}
+
+bool LayoutIndex::SaveToFile(const std::string& filename) const
+{
+    std::ofstream file(filename, std::ios::binary);
+    if (!file.is_open())
+    {
+        std::cerr << "Failed to open layout file for writing: " << filename << std::endl;
+        return false;
+    }
+
+    std::string chunk;
+    chunk.reserve(1 << 20);
+    char line[96];
+    for (const LayoutStruct& entry : m_structs)
+    {
+        chunk += (entry.kindIndex ? GetName(entry.kindIndex, 0) : std::string("Struct")) + " " +
+                 GetName(entry.nameIndex, entry.nameNumber);
+        if (entry.superIndex >= 0)
+        {
+            const LayoutStruct& super = m_structs[entry.superIndex];
+            chunk += " : " + GetName(super.nameIndex, super.nameNumber);
+        }
+        int length = snprintf(line, sizeof(line), " // size 0x%X\n", entry.size);
+        chunk.append(line, static_cast<size_t>(length));
+
+        for (uint32_t i = 0; i < entry.propertyCount; ++i)
+        {
+            const LayoutProperty* property = &m_properties[entry.firstProperty + i];
+            length = snprintf(line, sizeof(line), "    0x%04X  0x%-4X ", property->offset,
+                              property->elementSize * std::max(property->arrayDim, 1));
+            chunk.append(line, static_cast<size_t>(length));
+            chunk += (property->typeIndex ? GetName(property->typeIndex, 0) : std::string("?")) + " " +
+                     GetName(property->nameIndex, property->nameNumber);
+            if (property->arrayDim > 1)
+            {
+                chunk += "[" + std::to_string(property->arrayDim) + "]";
+            }
+            chunk.push_back('\n');
+        }
+        chunk.push_back('\n');
+
+        if (chunk.size() >= (1 << 20))
+        {
+            file.write(chunk.data(), static_cast<std::streamsize>(chunk.size()));
+            chunk.clear();
+        }
+    }
+    file.write(chunk.data(), static_cast<std::streamsize>(chunk.size()));
+
+    return file.good();
+}
+
+bool LayoutIndex::SaveCache(const std::string& filename, const BuildFingerprint& fingerprint) const
+{
+    std::ofstream file(filename, std::ios::binary);
+    if (!file.is_open())
+    {
+        std::cerr << "Failed to open layout cache for writing: " << filename << std::endl;
+        return false;
+    }
+
+    // MAGIC, VERSION, fingerprint, structs, properties, then (index, name) pairs
+    SessionFormat::Writer writer(file);
+    writer.PutBytes(CACHE_MAGIC, sizeof(CACHE_MAGIC));
+    writer.Put<uint32_t>(CACHE_VERSION);
+    writer.PutString(fingerprint.moduleName);
+    writer.Put<uint32_t>(fingerprint.timeDateStamp);
+    writer.Put<uint32_t>(fingerprint.sizeOfImage);
+    writer.Put<uint32_t>(fingerprint.sectionHash);
+
+    writer.Put<uint32_t>(static_cast<uint32_t>(m_structs.size()));
+    writer.PutBytes(m_structs.data(), m_structs.size() * sizeof(LayoutStruct));
+    writer.Put<uint32_t>(static_cast<uint32_t>(m_properties.size()));
+    writer.PutBytes(m_properties.data(), m_properties.size() * sizeof(LayoutProperty));
+
+    writer.Put<uint32_t>(static_cast<uint32_t>(m_names.GetCount()));
+    for (size_t i = 0; i < m_names.GetCount(); ++i)
+    {
+        writer.Put<uint32_t>(m_names.GetIndexAt(i));
+        writer.PutString(std::string(m_names.GetNameAt(i)));
+    }
+
+    return file.good();
+}
+
+bool LayoutIndex::LoadCache(const std::string& filename, const BuildFingerprint& fingerprint, std::string& error)
+{
+    Clear();
+
+    std::ifstream file(filename, std::ios::binary);
+    if (!file.is_open())
+    {
+        error = "No layout cache at " + filename;
+        return false;
+    }
+    file.seekg(0, std::ios::end);
+    std::vector<uint8_t> data(static_cast<size_t>(file.tellg()));
+    file.seekg(0, std::ios::beg);
+    file.read(reinterpret_cast<char*>(data.data()), static_cast<std::streamsize>(data.size()));
+
+    SessionFormat::Reader reader(data.data(), data.size());
+    const uint8_t* magic = reader.GetBytes(sizeof(CACHE_MAGIC));
+    if (!magic || std::memcmp(magic, CACHE_MAGIC, sizeof(CACHE_MAGIC)) != 0 || reader.Get<uint32_t>() != CACHE_VERSION)
+    {
+        error = "Not a layout cache of this version: " + filename;
+        return false;
+    }
+
+    BuildFingerprint cached;
+    cached.moduleName = reader.GetString();
+    cached.timeDateStamp = reader.Get<uint32_t>();
+    cached.sizeOfImage = reader.Get<uint32_t>();
+    cached.sectionHash = reader.Get<uint32_t>();
+    if (cached != fingerprint)
+    {
+        error = "Layout cache belongs to another build (" + cached.ToString() + ")";
+        return false;
+    }
+
+    uint32_t structCount = reader.Get<uint32_t>();
+    const uint8_t* structs = reader.GetBytes(static_cast<size_t>(structCount) * sizeof(LayoutStruct));
+    uint32_t propertyCount = reader.Get<uint32_t>();
+    const uint8_t* properties = reader.GetBytes(static_cast<size_t>(propertyCount) * sizeof(LayoutProperty));
+    if (reader.Failed())
+    {
+        error = "Truncated layout cache: " + filename;
+        return false;
+    }
+    m_structs.resize(structCount);
+    std::memcpy(m_structs.data(), structs, m_structs.size() * sizeof(LayoutStruct));
+    m_properties.resize(propertyCount);
+    std::memcpy(m_properties.data(), properties, m_properties.size() * sizeof(LayoutProperty));
+
+    uint32_t nameCount = reader.Get<uint32_t>();
+    for (uint32_t i = 0; i < nameCount && !reader.Failed(); ++i)
+    {
+        uint32_t index = reader.Get<uint32_t>();
+        std::string name = reader.GetString();
+        m_names.Append(index, name);
+    }
+
+    // Every reference has to stay inside the arrays, whatever the file says
+    bool consistent = !reader.Failed();
+    for (size_t i = 0; consistent && i < m_structs.size(); ++i)
+    {
+        const LayoutStruct& entry = m_structs[i];
+        consistent = entry.superIndex < static_cast<int32_t>(m_structs.size()) &&
+                     static_cast<uint64_t>(entry.firstProperty) + entry.propertyCount <= m_properties.size();
+    }
+    if (!consistent)
+    {
+        Clear();
+        error = "Corrupt layout cache: " + filename;
+        return false;
+    }
+    return true;
+}
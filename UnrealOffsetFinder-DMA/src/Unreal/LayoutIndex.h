@@ -0,0 +1,146 @@
+#pragma once
+
+#include "NameTable.h"
+#include "BuildFingerprint.h"
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * @struct LayoutStruct
+ * @brief One UStruct (class or script struct) and the range of its own properties
+ */
+struct LayoutStruct
+{
+    uint64_t address;           ///< UStruct address in the walked process
+    int32_t superIndex;         ///< Index of the super struct (-1 = none)
+    uint32_t nameIndex;         ///< FName comparison index
+    uint32_t nameNumber;        ///< FName number
+    uint32_t kindIndex;         ///< FName index of the metaclass (Class, ScriptStruct, ...; 0 = unknown)
+    int32_t size;               ///< PropertiesSize
+    uint32_t firstProperty;     ///< First own property in the property array
+    uint32_t propertyCount;     ///< Own properties (inherited ones live on the supers)
+    uint32_t reserved;          ///< Keeps the record free of padding
+};
+
+/**
+ * @struct LayoutProperty
+ * @brief One FProperty of a struct
+ */
+struct LayoutProperty
+{
+    uint64_t flags;             ///< EPropertyFlags
+    uint32_t nameIndex;         ///< FName comparison index
+    uint32_t nameNumber;        ///< FName number
+    uint32_t typeIndex;         ///< FName index of the FFieldClass (IntProperty, ...; 0 = unknown)
+    int32_t offset;             ///< Offset_Internal
+    int32_t elementSize;        ///< ElementSize
+    int32_t arrayDim;           ///< ArrayDim
+};
+
+static_assert(sizeof(LayoutStruct) == 40, "LayoutStruct is stored raw in cache files");
+static_assert(sizeof(LayoutProperty) == 32, "LayoutProperty is stored raw in cache files");
+
+/**
+ * @class LayoutIndex
+ * @brief Reflected layouts of every class and script struct of a build
+ *
+ * Each struct is stored once with its own properties; inherited members are
+ * reached through superIndex, so a super shared by thousands of classes
+ * costs nothing extra. Names are kept as FName indices plus the subset of
+ * the name table they use, which makes the index self-contained and lets
+ * it be cached per build fingerprint.
+ */
+class LayoutIndex
+{
+public:
+    /**
+     * @brief Remove all structs, properties and names
+     */
+    void Clear();
+
+    /**
+     * @brief Append a struct
+     * @param entry Struct record
+     * @return Index of the struct
+     */
+    uint32_t AddStruct(const LayoutStruct& entry);
+
+    /**
+     * @brief Append a property (callers keep each struct's properties contiguous and sorted by offset)
+     * @param property Property record
+     */
+    void AddProperty(const LayoutProperty& property) { m_properties.push_back(property); }
+
+    /**
+     * @brief Get a struct for modification
+     * @param index Struct index
+     * @return Struct record
+     */
+    LayoutStruct& GetStruct(uint32_t index) { return m_structs[index]; }
+
+    const std::vector<LayoutStruct>& GetStructs() const { return m_structs; }           ///< All structs
+    const std::vector<LayoutProperty>& GetProperties() const { return m_properties; }   ///< All properties
+    const NameTable& GetNames() const { return m_names; }                               ///< Names used by the index
+
+    /**
+     * @brief Set the name subset used by the structs and properties
+     * @param names Names (ascending FName indices)
+     */
+    void SetNames(NameTable&& names) { m_names = std::move(names); }
+
+    /**
+     * @brief Find a struct by name
+     * @param name Struct name without prefix ("Actor", "Vector")
+     * @return Struct index, -1 if not found
+     */
+    int64_t FindStruct(std::string_view name) const;
+
+    /**
+     * @brief Get a display name ("Name" or "Name_<number - 1>")
+     * @param nameIndex FName comparison index
+     * @param nameNumber FName number
+     * @return Name
+     */
+    std::string GetName(uint32_t nameIndex, uint32_t nameNumber) const;
+
+    /**
+     * @brief Get the memory held by the index
+     * @return Allocated bytes
+     */
+    uint64_t GetMemoryBytes() const;
+
+    /**
+     * @brief Write every struct with its properties sorted by offset as text
+     * @param filename Output file
+     * @return true if successful, false otherwise
+     */
+    bool SaveToFile(const std::string& filename) const;
+
+    /**
+     * @brief Write the index to a binary cache file
+     * @param filename Cache file
+     * @param fingerprint Build the index was taken from
+     * @return true if successful, false otherwise
+     */
+    bool SaveCache(const std::string& filename, const BuildFingerprint& fingerprint) const;
+
+    /**
+     * @brief Load a cache file written by SaveCache
+     * @param filename Cache file
+     * @param fingerprint Build the cache must belong to
+     * @param error Receives the reason on failure (missing, other build, corrupt)
+     * @return true if successful, false otherwise
+     */
+    bool LoadCache(const std::string& filename, const BuildFingerprint& fingerprint, std::string& error);
+
+    static constexpr char CACHE_MAGIC[8] = { 'U', 'O', 'F', 'L', 'A', 'Y', 'T', '\0' };
+    static constexpr uint32_t CACHE_VERSION = 1;
+
+private:
+    std::vector<LayoutStruct> m_structs;        ///< Structs in walk order
+    std::vector<LayoutProperty> m_properties;   ///< Properties grouped by struct, by offset inside a struct
+    NameTable m_names;                          ///< Names referenced by structs and properties
+};
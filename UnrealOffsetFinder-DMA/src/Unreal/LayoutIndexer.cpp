@@ -0,0 +1,451 @@
+#include "LayoutIndexer.h"
+#include "ObjectIndex.h"
+#include "NameTable.h"
+#include "../DMA/DMAManager.h"
+#include "../Core/TaskExecutor.h"
+#include "../Core/Trace.h"
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace
+{
+    constexpr uint64_t MIN_USER_ADDRESS = 0x10000;
+    constexpr uint64_t MAX_USER_ADDRESS = 0x7FFFFFFFFFFF;
+    constexpr int32_t STRUCT_PENDING = -2;      // Queued for reading
+    constexpr int32_t STRUCT_REJECTED = -1;     // Read, but not a plausible UStruct
+    constexpr int32_t MAX_ARRAY_DIM = 0x10000;
+
+    bool IsUserPointer(uint64_t address)
+    {
+        return address >= MIN_USER_ADDRESS && address <= MAX_USER_ADDRESS;
+    }
+
+    template<typename T>
+    T Load(const uint8_t* data)
+    {
+        T value;
+        std::memcpy(&value, data, sizeof(T));
+        return value;
+    }
+
+    double SecondsSince(std::chrono::steady_clock::time_point start)
+    {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+}
+
+LayoutIndexer::LayoutIndexer(const DMAManager& dmaManager)
+    : m_dmaManager(dmaManager)
+{
+}
+
+bool LayoutIndexer::ReadBatched(std::vector<ScatterRead>& requests)
+{
+    std::vector<ScatterRead> batch;
+    batch.reserve(MAX_BATCH_ENTRIES);
+
+    size_t first = 0;
+    while (first < requests.size())
+    {
+        if (TaskExecutor::IsCurrentTaskCancelled())
+        {
+            return false;
+        }
+
+        batch.clear();
+        uint64_t batchBytes = 0;
+        size_t end = first;
+        while (end < requests.size() && batch.size() < MAX_BATCH_ENTRIES &&
+               (batch.empty() || batchBytes + requests[end].size <= BATCH_BYTES))
+        {
+            batch.push_back(requests[end]);
+            batchBytes += requests[end].size;
+            ++end;
+        }
+
+        m_stats.bytesRead += m_dmaManager.ReadMemoryBatch(batch);
+        m_stats.batches++;
+        for (size_t i = 0; i < batch.size(); ++i)
+        {
+            requests[first + i].bytesRead = batch[i].bytesRead;
+        }
+        first = end;
+    }
+    return true;
+}
+
+bool LayoutIndexer::Index(const ObjectIndex& objects, const NameTable& names, LayoutIndex& layouts, std::string& error)
+{
+    TRACE_SCOPE("IndexLayouts", "scan");
+
+    auto start = std::chrono::steady_clock::now();
+    m_stats = LayoutIndexStats();
+    layouts.Clear();
+
+    if (!m_dmaManager.IsConnected())
+    {
+        error = "Not connected to any process";
+        return false;
+    }
+
+    const std::vector<int32_t>& slots = objects.GetSlots();
+    const std::vector<int32_t>& classSlots = objects.GetClassSlots();
+    const std::vector<uint64_t>& addresses = objects.GetAddresses();
+    if (slots.empty())
+    {
+        error = "Object index is empty; enumerate GObjects first";
+        return false;
+    }
+
+    // UClass is the one object named Class that is an instance of itself
+    std::vector<uint64_t> addressOfSlot(static_cast<size_t>(slots.back()) + 1, 0);
+    int32_t classClassSlot = -1;
+    for (size_t i = 0; i < slots.size(); ++i)
+    {
+        addressOfSlot[slots[i]] = addresses[i];
+        if (classSlots[i] == slots[i] && names.Find(objects.GetNameIndices()[i]) == "Class")
+        {
+            classClassSlot = slots[i];
+        }
+    }
+    if (classClassSlot < 0)
+    {
+        error = "No Class object in GObjects; the name table or object index does not match the process";
+        return false;
+    }
+
+    uint64_t classClass = addressOfSlot[classClassSlot];
+    uint64_t scriptStructClass = 0;
+    for (size_t i = 0; i < slots.size(); ++i)
+    {
+        if (classSlots[i] == classClassSlot && names.Find(objects.GetNameIndices()[i]) == "ScriptStruct")
+        {
+            scriptStructClass = addresses[i];
+            break;
+        }
+    }
+
+    // Metaclasses are Class, ScriptStruct and every class deriving from either; their instances are the candidates
+    std::unordered_set<uint64_t> metaclasses = { classClass };
+    if (scriptStructClass != 0)
+    {
+        metaclasses.insert(scriptStructClass);
+    }
+    std::vector<uint64_t> newMetaclasses(metaclasses.begin(), metaclasses.end());
+
+    std::unordered_map<uint64_t, int32_t> structIndices;
+    std::vector<uint64_t> superAddresses;
+    std::vector<uint64_t> classAddresses;
+    std::vector<uint64_t> childProperties;
+    std::vector<uint8_t> isMetaclass;
+    std::vector<uint64_t> pending;
+    std::vector<uint8_t> buffer;
+    std::vector<ScatterRead> requests;
+    size_t candidates = 0;
+
+    TaskExecutor::ReportProgress(0.1f, "Reading structs");
+    for (uint32_t round = 0; round < MAX_STRUCT_ROUNDS; ++round)
+    {
+        if (!newMetaclasses.empty())
+        {
+            std::unordered_set<uint64_t> fresh(newMetaclasses.begin(), newMetaclasses.end());
+            for (size_t i = 0; i < slots.size(); ++i)
+            {
+                if (classSlots[i] >= 0 && fresh.count(addressOfSlot[classSlots[i]]) != 0 &&
+                    structIndices.try_emplace(addresses[i], STRUCT_PENDING).second)
+                {
+                    pending.push_back(addresses[i]);
+                    candidates++;
+                }
+            }
+            newMetaclasses.clear();
+        }
+        if (pending.empty())
+        {
+            break;
+        }
+
+        // One batched read for every struct of the round
+        buffer.assign(pending.size() * m_layout.structReadSize, 0);
+        requests.clear();
+        for (size_t i = 0; i < pending.size(); ++i)
+        {
+            requests.emplace_back(pending[i], buffer.data() + i * m_layout.structReadSize, m_layout.structReadSize);
+        }
+        if (!ReadBatched(requests))
+        {
+            error = "Layout indexing cancelled";
+            return false;
+        }
+        m_stats.rounds++;
+
+        std::vector<uint64_t> supers;
+        for (size_t i = 0; i < pending.size(); ++i)
+        {
+            const uint8_t* data = buffer.data() + i * m_layout.structReadSize;
+            uint64_t super = Load<uint64_t>(data + m_layout.superOffset);
+            uint64_t children = Load<uint64_t>(data + m_layout.childPropertiesOffset);
+            int32_t size = Load<int32_t>(data + m_layout.propertiesSizeOffset);
+            if (requests[i].bytesRead != m_layout.structReadSize || size < 0 || size > MAX_STRUCT_SIZE ||
+                (super != 0 && !IsUserPointer(super)) || (children != 0 && !IsUserPointer(children)))
+            {
+                structIndices[pending[i]] = STRUCT_REJECTED;
+                m_stats.rejected++;
+                continue;
+            }
+
+            LayoutStruct entry = {};
+            entry.address = pending[i];
+            entry.superIndex = -1;
+            entry.nameIndex = Load<uint32_t>(data + m_layout.nameOffset);
+            entry.nameNumber = Load<uint32_t>(data + m_layout.nameOffset + 4);
+            entry.size = size;
+            structIndices[pending[i]] = static_cast<int32_t>(layouts.AddStruct(entry));
+            superAddresses.push_back(super);
+            classAddresses.push_back(Load<uint64_t>(data + m_layout.classOffset));
+            childProperties.push_back(children);
+            isMetaclass.push_back(metaclasses.count(pending[i]) != 0);
+
+            // A super shared by many structs is queued once
+            if (super != 0 && structIndices.try_emplace(super, STRUCT_PENDING).second)
+            {
+                supers.push_back(super);
+            }
+        }
+        m_stats.discovered += supers.size();
+        pending = std::move(supers);
+
+        // Classes reaching Class or ScriptStruct through their supers are metaclasses as well
+        for (size_t i = 0; i < superAddresses.size(); ++i)
+        {
+            if (isMetaclass[i] || classAddresses[i] != classClass)
+            {
+                continue;
+            }
+            uint64_t super = superAddresses[i];
+            for (uint32_t depth = 0; super != 0 && depth < MAX_STRUCT_ROUNDS; ++depth)
+            {
+                if (metaclasses.count(super) != 0)
+                {
+                    isMetaclass[i] = 1;
+                    metaclasses.insert(layouts.GetStructs()[i].address);
+                    newMetaclasses.push_back(layouts.GetStructs()[i].address);
+                    break;
+                }
+                auto it = structIndices.find(super);
+                super = it != structIndices.end() && it->second >= 0 ? superAddresses[it->second] : 0;
+            }
+        }
+    }
+
+    size_t structCount = layouts.GetStructs().size();
+    for (size_t i = 0; i < structCount; ++i)
+    {
+        LayoutStruct& entry = layouts.GetStruct(static_cast<uint32_t>(i));
+        auto super = structIndices.find(superAddresses[i]);
+        entry.superIndex = super != structIndices.end() && super->second >= 0 ? super->second : -1;
+        auto kind = structIndices.find(classAddresses[i]);
+        entry.kindIndex = kind != structIndices.end() && kind->second >= 0 ? layouts.GetStructs()[kind->second].nameIndex : 0;
+    }
+
+    // Property chains advance one FField per struct and round
+    TaskExecutor::ReportProgress(0.5f, std::to_string(structCount) + " structs");
+    std::vector<uint32_t> owners;
+    std::vector<LayoutProperty> found;
+    std::vector<uint64_t> fieldClasses;
+    std::vector<uint32_t> counts(structCount, 0);
+    std::vector<uint32_t> active;
+    for (size_t i = 0; i < structCount; ++i)
+    {
+        if (childProperties[i] != 0)
+        {
+            active.push_back(static_cast<uint32_t>(i));
+        }
+    }
+
+    while (!active.empty())
+    {
+        buffer.assign(active.size() * m_layout.fieldReadSize, 0);
+        requests.clear();
+        for (size_t i = 0; i < active.size(); ++i)
+        {
+            requests.emplace_back(childProperties[active[i]], buffer.data() + i * m_layout.fieldReadSize, m_layout.fieldReadSize);
+        }
+        if (!ReadBatched(requests))
+        {
+            error = "Layout indexing cancelled";
+            return false;
+        }
+        m_stats.rounds++;
+
+        size_t kept = 0;
+        for (size_t i = 0; i < active.size(); ++i)
+        {
+            uint32_t owner = active[i];
+            const uint8_t* data = buffer.data() + i * m_layout.fieldReadSize;
+            LayoutProperty property = {};
+            property.flags = Load<uint64_t>(data + m_layout.propertyFlagsOffset);
+            property.nameIndex = Load<uint32_t>(data + m_layout.fieldNameOffset);
+            property.nameNumber = Load<uint32_t>(data + m_layout.fieldNameOffset + 4);
+            property.offset = Load<int32_t>(data + m_layout.offsetOffset);
+            property.elementSize = Load<int32_t>(data + m_layout.elementSizeOffset);
+            property.arrayDim = Load<int32_t>(data + m_layout.arrayDimOffset);
+            uint64_t fieldClass = Load<uint64_t>(data + m_layout.fieldClassOffset);
+            if (requests[i].bytesRead != m_layout.fieldReadSize || !IsUserPointer(fieldClass) ||
+                property.offset < 0 || property.offset > MAX_STRUCT_SIZE || property.elementSize < 0 ||
+                property.arrayDim < 1 || property.arrayDim > MAX_ARRAY_DIM)
+            {
+                continue;
+            }
+
+            owners.push_back(owner);
+            found.push_back(property);
+            fieldClasses.push_back(fieldClass);
+
+            uint64_t next = Load<uint64_t>(data + m_layout.fieldNextOffset);
+            if (IsUserPointer(next) && ++counts[owner] < MAX_PROPERTIES_PER_STRUCT)
+            {
+                childProperties[owner] = next;
+                active[kept++] = owner;
+            }
+        }
+        active.resize(kept);
+    }
+
+    // FFieldClass names, one read per distinct class
+    TaskExecutor::ReportProgress(0.8f, std::to_string(found.size()) + " properties");
+    std::vector<uint64_t> uniqueClasses = fieldClasses;
+    std::sort(uniqueClasses.begin(), uniqueClasses.end());
+    uniqueClasses.erase(std::unique(uniqueClasses.begin(), uniqueClasses.end()), uniqueClasses.end());
+    std::vector<uint32_t> classNames(uniqueClasses.size(), 0);
+    requests.clear();
+    for (size_t i = 0; i < uniqueClasses.size(); ++i)
+    {
+        requests.emplace_back(uniqueClasses[i] + m_layout.fieldClassNameOffset, &classNames[i], sizeof(uint32_t));
+    }
+    if (!ReadBatched(requests))
+    {
+        error = "Layout indexing cancelled";
+        return false;
+    }
+    m_stats.fieldClasses = uniqueClasses.size();
+
+    // Counting sort by owner, then offset order inside each struct
+    std::vector<uint32_t> firsts(structCount + 1, 0);
+    for (uint32_t owner : owners)
+    {
+        firsts[owner + 1]++;
+    }
+    for (size_t i = 0; i < structCount; ++i)
+    {
+        firsts[i + 1] += firsts[i];
+        LayoutStruct& entry = layouts.GetStruct(static_cast<uint32_t>(i));
+        entry.firstProperty = firsts[i];
+        entry.propertyCount = 0;
+    }
+
+    std::vector<LayoutProperty> placed(found.size());
+    for (size_t i = 0; i < found.size(); ++i)
+    {
+        size_t position = std::lower_bound(uniqueClasses.begin(), uniqueClasses.end(), fieldClasses[i]) - uniqueClasses.begin();
+        found[i].typeIndex = classNames[position];
+        LayoutStruct& entry = layouts.GetStruct(owners[i]);
+        placed[entry.firstProperty + entry.propertyCount++] = found[i];
+    }
+    for (size_t i = 0; i < structCount; ++i)
+    {
+        auto first = placed.begin() + firsts[i];
+        std::stable_sort(first, placed.begin() + firsts[i + 1],
+            [](const LayoutProperty& a, const LayoutProperty& b) { return a.offset < b.offset; });
+    }
+    for (const LayoutProperty& property : placed)
+    {
+        layouts.AddProperty(property);
+    }
+
+    // Keep only the names the layouts refer to
+    std::vector<uint32_t> used;
+    used.reserve(structCount * 2 + placed.size() * 2);
+    for (const LayoutStruct& entry : layouts.GetStructs())
+    {
+        used.push_back(entry.nameIndex);
+        used.push_back(entry.kindIndex);
+    }
+    for (const LayoutProperty& property : placed)
+    {
+        used.push_back(property.nameIndex);
+        used.push_back(property.typeIndex);
+    }
+    std::sort(used.begin(), used.end());
+    used.erase(std::unique(used.begin(), used.end()), used.end());
+
+    NameTable subset;
+    for (uint32_t index : used)
+    {
+        std::string_view name = names.Find(index);
+        if (!name.empty())
+        {
+            subset.Append(index, name);
+        }
+    }
+    subset.ShrinkToFit();
+    layouts.SetNames(std::move(subset));
+
+    m_stats.structs = structCount;
+    m_stats.properties = placed.size();
+    m_stats.seconds = SecondsSince(start);
+    if (structCount == 0)
+    {
+        error = "None of the " + std::to_string(candidates) + " class and struct objects had a readable UStruct";
+        return false;
+    }
+    return true;
+}
+
+std::string LayoutIndexer::GetCachePath(const std::string& cacheDirectory, const BuildFingerprint& fingerprint)
+{
+    std::string directory = cacheDirectory.empty() ? std::string(".") : cacheDirectory;
+    return directory + "/layouts_" + fingerprint.ToString() + ".uofl";
+}
+
+bool LayoutIndexer::IndexCached(const ObjectIndex* objects, const NameTable* names, const std::string& cacheDirectory,
+                                LayoutIndex& layouts, std::string& error)
+{
+    auto start = std::chrono::steady_clock::now();
+    m_stats = LayoutIndexStats();
+
+    BuildFingerprint fingerprint;
+    if (!BuildFingerprint::Read(m_dmaManager, fingerprint, error))
+    {
+        return false;
+    }
+
+    std::string path = GetCachePath(cacheDirectory, fingerprint);
+    std::string cacheError;
+    if (layouts.LoadCache(path, fingerprint, cacheError))
+    {
+        m_stats.fromCache = true;
+        m_stats.structs = layouts.GetStructs().size();
+        m_stats.properties = layouts.GetProperties().size();
+        m_stats.seconds = SecondsSince(start);
+        return true;
+    }
+
+    if (!objects || !names)
+    {
+        error = cacheError + "; enumerate GObjects and dump names to index this build";
+        return false;
+    }
+    if (!Index(*objects, *names, layouts, error))
+    {
+        return false;
+    }
+
+    // A cache that cannot be written only costs the next run a walk
+    layouts.SaveCache(path, fingerprint);
+    m_stats.seconds = SecondsSince(start);
+    return true;
+}
@@ -0,0 +1,139 @@
+#pragma once
+
+#include "LayoutIndex.h"
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+class DMAManager;
+class ObjectIndex;
+class NameTable;
+struct ScatterRead;
+
+/**
+ * @struct ReflectionLayout
+ * @brief Engine-build dependent offsets of UStruct, FField and FProperty
+ *
+ * Defaults match UE 4.25+ and UE5 shipping builds, where properties are
+ * FFields linked through ChildProperties instead of UObjects.
+ */
+struct ReflectionLayout
+{
+    uint32_t classOffset = 0x10;            ///< UObjectBase::ClassPrivate
+    uint32_t nameOffset = 0x18;             ///< UObjectBase::NamePrivate
+    uint32_t superOffset = 0x40;            ///< UStruct::SuperStruct
+    uint32_t childPropertiesOffset = 0x50;  ///< UStruct::ChildProperties
+    uint32_t propertiesSizeOffset = 0x58;   ///< UStruct::PropertiesSize
+    uint32_t structReadSize = 0x60;         ///< Bytes of UStruct read per struct
+    uint32_t fieldClassOffset = 0x8;        ///< FField::ClassPrivate
+    uint32_t fieldNextOffset = 0x20;        ///< FField::Next
+    uint32_t fieldNameOffset = 0x28;        ///< FField::NamePrivate
+    uint32_t arrayDimOffset = 0x38;         ///< FProperty::ArrayDim
+    uint32_t elementSizeOffset = 0x3C;      ///< FProperty::ElementSize
+    uint32_t propertyFlagsOffset = 0x40;    ///< FProperty::PropertyFlags
+    uint32_t offsetOffset = 0x4C;           ///< FProperty::Offset_Internal
+    uint32_t fieldReadSize = 0x50;          ///< Bytes of FProperty read per field
+    uint32_t fieldClassNameOffset = 0x0;    ///< FFieldClass::Name
+};
+
+/**
+ * @struct LayoutIndexStats
+ * @brief Counters of the last indexing
+ */
+struct LayoutIndexStats
+{
+    uint64_t structs = 0;       ///< Structs indexed
+    uint64_t properties = 0;    ///< Properties indexed
+    uint64_t discovered = 0;    ///< Supers found only through SuperStruct (not candidates)
+    uint64_t rejected = 0;      ///< Candidates whose UStruct fields were implausible
+    uint64_t rounds = 0;        ///< Breadth-first rounds (struct rounds plus field rounds)
+    uint64_t batches = 0;       ///< Scatter batches
+    uint64_t bytesRead = 0;     ///< Bytes transferred from the device
+    uint64_t fieldClasses = 0;  ///< Distinct FFieldClasses
+    bool fromCache = false;     ///< Loaded from a cache file instead of walked
+    double seconds = 0.0;       ///< Wall time
+};
+
+/**
+ * @class LayoutIndexer
+ * @brief Builds a LayoutIndex of every UClass and UScriptStruct from GObjects
+ *
+ * Structs are read in breadth-first rounds: every round reads all pending
+ * UStructs in one batched scatter, queues supers that were not candidates
+ * and metaclass instances found on the way, and each struct is stored once
+ * however many classes derive from it. Property chains are then advanced
+ * one FField per struct and round, so a build with thousands of classes
+ * costs as many rounds as its longest chain. Results are cached per build
+ * fingerprint; IndexCached only walks when the cache misses.
+ */
+class LayoutIndexer
+{
+public:
+    /**
+     * @brief Constructor
+     * @param dmaManager Connected DMA manager to read through
+     */
+    explicit LayoutIndexer(const DMAManager& dmaManager);
+
+    /**
+     * @brief Walk every class and script struct in the object index
+     * @param objects Enumerated GObjects
+     * @param names Dumped name table
+     * @param layouts Receives the structs, properties and used names
+     * @param error Receives the reason on failure
+     * @return true if successful, false otherwise
+     */
+    bool Index(const ObjectIndex& objects, const NameTable& names, LayoutIndex& layouts, std::string& error);
+
+    /**
+     * @brief Load the layouts of the attached build from cache, or walk and cache them
+     * @param objects Enumerated GObjects (may be null if the cache is expected to hit)
+     * @param names Dumped name table (may be null if the cache is expected to hit)
+     * @param cacheDirectory Directory holding the cache files
+     * @param layouts Receives the layouts
+     * @param error Receives the reason on failure
+     * @return true if successful, false otherwise
+     */
+    bool IndexCached(const ObjectIndex* objects, const NameTable* names, const std::string& cacheDirectory,
+                     LayoutIndex& layouts, std::string& error);
+
+    /**
+     * @brief Get the cache file of a build
+     * @param cacheDirectory Directory holding the cache files
+     * @param fingerprint Build fingerprint
+     * @return Cache file path
+     */
+    static std::string GetCachePath(const std::string& cacheDirectory, const BuildFingerprint& fingerprint);
+
+    /**
+     * @brief Get the counters of the last Index or IndexCached call
+     * @return Statistics
+     */
+    const LayoutIndexStats& GetLastStats() const { return m_stats; }
+
+    /**
+     * @brief Get the offsets used
+     * @return Layout
+     */
+    const ReflectionLayout& GetLayout() const { return m_layout; }
+
+    static constexpr uint64_t BATCH_BYTES = 4 * 0x100000;           ///< Bytes per scatter batch
+    static constexpr size_t MAX_BATCH_ENTRIES = 1024;               ///< Reads per scatter batch
+    static constexpr uint32_t MAX_PROPERTIES_PER_STRUCT = 4096;     ///< Guards against FField cycles
+    static constexpr int32_t MAX_STRUCT_SIZE = 0x1000000;           ///< Largest plausible PropertiesSize
+    static constexpr uint32_t MAX_STRUCT_ROUNDS = 64;               ///< Guards against SuperStruct cycles
+
+private:
+    /**
+     * @brief Read requests in scatter batches of at most BATCH_BYTES
+     * @param requests Reads to perform (bytesRead is updated)
+     * @return false if the task was cancelled
+     */
+    bool ReadBatched(std::vector<ScatterRead>& requests);
+
+private:
+    const DMAManager& m_dmaManager;     ///< Source of memory reads
+    ReflectionLayout m_layout;          ///< Offsets used
+    LayoutIndexStats m_stats;           ///< Counters of the last indexing
+};
@@ -0,0 +1,286 @@
+#include "NamePoolDumper.h"
+#include "../DMA/DMAManager.h"
+#include "../Core/TaskExecutor.h"
+#include "../Core/Trace.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <thread>
+
+namespace
+{
+    constexpr uint64_t MAX_USER_ADDRESS = 0x7FFFFFFFFFFF;
+
+    /**
+     * @brief Append UTF-16 code units as UTF-8
+     */
+    void AppendUtf8(const uint8_t* utf16, size_t length, std::string& out)
+    {
+        for (size_t i = 0; i < length; ++i)
+        {
+            uint32_t codePoint = utf16[i * 2] | (utf16[i * 2 + 1] << 8);
+            if (codePoint >= 0xD800 && codePoint < 0xDC00 && i + 1 < length)
+            {
+                uint32_t low = utf16[(i + 1) * 2] | (utf16[(i + 1) * 2 + 1] << 8);
+                if (low >= 0xDC00 && low < 0xE000)
+                {
+                    codePoint = 0x10000 + ((codePoint - 0xD800) << 10) + (low - 0xDC00);
+                    ++i;
+                }
+            }
+
+            if (codePoint < 0x80)
+            {
+                out.push_back(static_cast<char>(codePoint));
+            }
+            else if (codePoint < 0x800)
+            {
+                out.push_back(static_cast<char>(0xC0 | (codePoint >> 6)));
+                out.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+            }
+            else if (codePoint < 0x10000)
+            {
+                out.push_back(static_cast<char>(0xE0 | (codePoint >> 12)));
+                out.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+                out.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+            }
+            else
+            {
+                out.push_back(static_cast<char>(0xF0 | (codePoint >> 18)));
+                out.push_back(static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F)));
+                out.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+                out.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+            }
+        }
+    }
+
+    // Layouts tried by DetectLayout, most common first
+    const NamePoolLayout KNOWN_LAYOUTS[] = {
+        { 0, 6, 2 },    // Shipping: probe hash + Len:10
+        { 0, 1, 2 },    // Len:15
+        { 4, 6, 4 },    // ComparisonId + probe hash + Len:10
+        { 4, 1, 4 },    // ComparisonId + Len:15
+    };
+}
+
+NamePoolDumper::NamePoolDumper(const DMAManager& dmaManager)
+    : m_dmaManager(dmaManager)
+{
+}
+
+bool NamePoolDumper::DetectLayout(const uint8_t* data, size_t size, NamePoolLayout& layout)
+{
+    for (const NamePoolLayout& candidate : KNOWN_LAYOUTS)
+    {
+        NameTable first;
+        DecodeBlock(data, std::min<size_t>(size, candidate.headerOffset + 2 + 4), 0, candidate, first);
+        if (first.GetCount() == 1 && first.GetNameAt(0) == "None")
+        {
+            layout = candidate;
+            return true;
+        }
+    }
+    return false;
+}
+
+uint64_t NamePoolDumper::DecodeBlock(const uint8_t* data, size_t size, uint32_t blockIndex,
+                                     const NamePoolLayout& layout, NameTable& names)
+{
+    const uint32_t lengthMask = layout.lengthShift == 1 ? 0x7FFF : 0x3FF;
+    const uint32_t indexBase = blockIndex << 16;
+    uint64_t wideEntries = 0;
+    std::string wide;
+
+    size_t offset = 0;
+    while (offset + layout.headerOffset + 2 <= size)
+    {
+        const uint8_t* entry = data + offset + layout.headerOffset;
+        uint16_t header = static_cast<uint16_t>(entry[0] | (entry[1] << 8));
+        uint32_t length = (header >> layout.lengthShift) & lengthMask;
+        bool isWide = (header & 1) != 0;
+
+        // Zero length marks the unused tail of a block
+        if (length == 0 || length > MAX_NAME_LENGTH)
+        {
+            break;
+        }
+
+        size_t characterBytes = isWide ? length * 2 : length;
+        size_t entrySize = layout.headerOffset + 2 + characterBytes;
+        if (offset + entrySize > size)
+        {
+            break;
+        }
+
+        uint32_t index = indexBase | static_cast<uint32_t>(offset / layout.stride);
+        if (isWide)
+        {
+            wide.clear();
+            AppendUtf8(entry + 2, length, wide);
+            names.Append(index, wide);
+            wideEntries++;
+        }
+        else
+        {
+            names.Append(index, std::string_view(reinterpret_cast<const char*>(entry + 2), length));
+        }
+
+        offset += (entrySize + layout.stride - 1) / layout.stride * layout.stride;
+    }
+
+    return wideEntries;
+}
+
+bool NamePoolDumper::ReadPoolHeader(uint64_t address, uint32_t& currentBlock, uint32_t& currentCursor,
+                                    std::vector<uint64_t>& blocks) const
+{
+    uint32_t cursorFields[2] = {};
+    if (m_dmaManager.ReadMemory(address + 8, cursorFields, sizeof(cursorFields)) != sizeof(cursorFields))
+    {
+        return false;
+    }
+
+    currentBlock = cursorFields[0];
+    currentCursor = cursorFields[1];
+    if (currentBlock >= MAX_BLOCKS || currentCursor > (4u << 16))
+    {
+        return false;
+    }
+
+    // Only the pointers of blocks in use are needed
+    blocks.assign(currentBlock + 1, 0);
+    size_t pointerBytes = blocks.size() * sizeof(uint64_t);
+    if (m_dmaManager.ReadMemory(address + BLOCKS_FIELD_OFFSET, blocks.data(), pointerBytes) != pointerBytes)
+    {
+        return false;
+    }
+
+    return std::all_of(blocks.begin(), blocks.end(),
+        [](uint64_t block) { return block != 0 && block <= MAX_USER_ADDRESS && (block & 1) == 0; });
+}
+
+bool NamePoolDumper::Dump(uint64_t gnamesAddress, NameTable& names, std::string& error)
+{
+    TRACE_SCOPE("DumpNames", "scan");
+
+    m_stats = NameDumpStats();
+    names.Clear();
+
+    if (!m_dmaManager.IsConnected())
+    {
+        error = "Not connected to any process";
+        return false;
+    }
+    if (gnamesAddress == 0)
+    {
+        error = "GNames address is unknown; scan the Unreal globals first";
+        return false;
+    }
+
+    auto startTime = std::chrono::steady_clock::now();
+
+    // Some builds keep a pointer to the pool instead of the pool itself
+    uint32_t currentBlock = 0;
+    uint32_t currentCursor = 0;
+    std::vector<uint64_t> blocks;
+    uint64_t poolAddress = gnamesAddress;
+    if (!ReadPoolHeader(poolAddress, currentBlock, currentCursor, blocks))
+    {
+        poolAddress = 0;
+        if (!m_dmaManager.ReadValue(gnamesAddress, poolAddress) || poolAddress == 0 ||
+            !ReadPoolHeader(poolAddress, currentBlock, currentCursor, blocks))
+        {
+            error = "No FNamePool at " + DMAManager::FormatHexAddress(gnamesAddress);
+            return false;
+        }
+    }
+
+    uint8_t firstEntries[64] = {};
+    size_t firstBytes = m_dmaManager.ReadMemory(blocks[0], firstEntries, sizeof(firstEntries));
+    if (!DetectLayout(firstEntries, firstBytes, m_layout))
+    {
+        error = "Unknown FNamePool entry layout (block 0 does not start with \"None\")";
+        return false;
+    }
+
+    const uint64_t blockSize = m_layout.GetBlockSize();
+    if (currentCursor > blockSize)
+    {
+        error = "FNamePool cursor is past the end of its block";
+        return false;
+    }
+
+    // Full blocks before the current one, then the used part of the current one
+    const uint64_t poolBytes = currentBlock * blockSize + currentCursor;
+    names.Reserve(static_cast<size_t>(poolBytes / 16), static_cast<size_t>(poolBytes));
+
+    const size_t workerCount = std::clamp<size_t>(std::thread::hardware_concurrency(), 1, BLOCKS_PER_BATCH);
+    std::vector<uint8_t> buffer(static_cast<size_t>(BLOCKS_PER_BATCH * blockSize));
+    std::vector<NameTable> decoded(BLOCKS_PER_BATCH);
+    std::vector<uint64_t> decodedWide(BLOCKS_PER_BATCH);
+    std::vector<ScatterRead> requests;
+    requests.reserve(BLOCKS_PER_BATCH);
+
+    for (uint32_t firstBlock = 0; firstBlock <= currentBlock; firstBlock += BLOCKS_PER_BATCH)
+    {
+        if (TaskExecutor::IsCurrentTaskCancelled())
+        {
+            error = "Name dump cancelled";
+            names.Clear();
+            return false;
+        }
+
+        uint32_t blockCount = std::min<uint32_t>(BLOCKS_PER_BATCH, currentBlock + 1 - firstBlock);
+        requests.clear();
+        for (uint32_t i = 0; i < blockCount; ++i)
+        {
+            uint32_t block = firstBlock + i;
+            uint64_t used = block == currentBlock ? currentCursor : blockSize;
+            requests.emplace_back(blocks[block], buffer.data() + i * blockSize, static_cast<size_t>(used));
+        }
+
+        m_stats.bytesRead += m_dmaManager.ReadMemoryBatch(requests);
+        m_stats.batches++;
+
+        // Blocks decode independently; results are appended in block order below
+        std::atomic<uint32_t> nextBlock(0);
+        auto decodeWorker = [&]()
+        {
+            for (uint32_t i = nextBlock++; i < blockCount; i = nextBlock++)
+            {
+                decoded[i].Clear();
+                decodedWide[i] = DecodeBlock(static_cast<const uint8_t*>(requests[i].buffer), requests[i].bytesRead,
+                                             firstBlock + i, m_layout, decoded[i]);
+            }
+        };
+
+        std::vector<std::thread> workers;
+        for (size_t i = 1; i < std::min<size_t>(workerCount, blockCount); ++i)
+        {
+            workers.emplace_back(decodeWorker);
+        }
+        decodeWorker();
+        for (auto& worker : workers)
+        {
+            worker.join();
+        }
+
+        for (uint32_t i = 0; i < blockCount; ++i)
+        {
+            names.Append(decoded[i]);
+            m_stats.wideEntries += decodedWide[i];
+        }
+        m_stats.blocks += blockCount;
+
+        TaskExecutor::ReportProgress(static_cast<float>(m_stats.blocks) / static_cast<float>(currentBlock + 1),
+                                     std::to_string(names.GetCount()) + " names");
+    }
+
+    names.ShrinkToFit();
+
+    m_stats.entries = names.GetCount();
+    m_stats.memoryBytes = names.GetMemoryBytes();
+    m_stats.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+    return true;
+}
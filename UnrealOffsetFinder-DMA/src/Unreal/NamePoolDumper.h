@@ -0,0 +1,126 @@
+#pragma once
+
+#include "NameTable.h"
+#include <cstdint>
+#include <cstddef>
+#include <string>
+
+class DMAManager;
+
+/**
+ * @struct NamePoolLayout
+ * @brief Engine-build dependent layout of FNamePool entries
+ *
+ * Default is UE 4.23+/UE5 without case preserving names: a 16 bit header
+ * (bIsWide:1, LowercaseProbeHash:5, Len:10) followed by the characters,
+ * entries aligned to 2 bytes. Editor-style builds store a 4 byte
+ * ComparisonId before the header, align entries to 4 bytes and use
+ * Len:15 without the probe hash.
+ */
+struct NamePoolLayout
+{
+    uint32_t headerOffset = 0;  ///< Bytes before the entry header
+    uint32_t lengthShift = 6;   ///< Right shift of the header giving Len
+    uint32_t stride = 2;        ///< Entry alignment (FName offsets are in units of this)
+
+    /**
+     * @brief Get the size of one pool block
+     * @return Bytes (stride << 16)
+     */
+    uint64_t GetBlockSize() const { return static_cast<uint64_t>(stride) << 16; }
+};
+
+/**
+ * @struct NameDumpStats
+ * @brief Counters of the last dump
+ */
+struct NameDumpStats
+{
+    uint64_t entries = 0;       ///< Names decoded
+    uint64_t wideEntries = 0;   ///< Names stored as UTF-16
+    uint64_t blocks = 0;        ///< Pool blocks read
+    uint64_t bytesRead = 0;     ///< Bytes transferred from the device
+    uint64_t batches = 0;       ///< Scatter batches
+    uint64_t memoryBytes = 0;   ///< Memory held by the resulting table
+    double seconds = 0.0;       ///< Wall time
+};
+
+/**
+ * @class NamePoolDumper
+ * @brief Reads the whole FNamePool (GNames) into a NameTable
+ *
+ * The allocator header and block pointer array are read once, then the
+ * used part of every block is fetched in scatter batches of
+ * BLOCKS_PER_BATCH blocks. Blocks are independent, so the entries of a
+ * batch are decoded on several threads into per-block tables that are
+ * appended to the result in block order.
+ */
+class NamePoolDumper
+{
+public:
+    /**
+     * @brief Constructor
+     * @param dmaManager DMA manager to read through (must outlive the dumper)
+     */
+    explicit NamePoolDumper(const DMAManager& dmaManager);
+
+    /**
+     * @brief Dump every name of the pool
+     * @param gnamesAddress Address of the FNamePool (or of a pointer to it), as found by the GNames scan
+     * @param names Receives the names (cleared first)
+     * @param error Receives the reason on failure
+     * @return true if successful, false otherwise
+     */
+    bool Dump(uint64_t gnamesAddress, NameTable& names, std::string& error);
+
+    /**
+     * @brief Get counters of the last dump
+     * @return Stats
+     */
+    const NameDumpStats& GetLastStats() const { return m_stats; }
+
+    /**
+     * @brief Get the entry layout detected by the last dump
+     * @return Layout
+     */
+    const NamePoolLayout& GetLayout() const { return m_layout; }
+
+    /**
+     * @brief Detect the entry layout from the start of block 0 (which always holds "None")
+     * @param data Block 0 bytes
+     * @param size Number of valid bytes
+     * @param layout Receives the layout
+     * @return true if a known layout decodes "None"
+     */
+    static bool DetectLayout(const uint8_t* data, size_t size, NamePoolLayout& layout);
+
+    /**
+     * @brief Decode the entries of one block
+     * @param data Block bytes
+     * @param size Number of used bytes
+     * @param blockIndex Block number (upper bits of the FName index)
+     * @param layout Entry layout
+     * @param names Receives the entries
+     * @return Number of wide entries decoded
+     */
+    static uint64_t DecodeBlock(const uint8_t* data, size_t size, uint32_t blockIndex,
+                                const NamePoolLayout& layout, NameTable& names);
+
+    static constexpr uint32_t MAX_BLOCKS = 8192;                ///< FNameMaxBlocks
+    static constexpr uint64_t BLOCKS_FIELD_OFFSET = 0x10;       ///< Blocks[] after the lock and cursor fields
+    static constexpr size_t BLOCKS_PER_BATCH = 64;              ///< Blocks per scatter batch (8 MB with stride 2)
+    static constexpr uint32_t MAX_NAME_LENGTH = 1024;           ///< NAME_SIZE
+
+private:
+    /**
+     * @brief Read and validate the allocator header at an address
+     * @return true if it looks like an FNamePool
+     */
+    bool ReadPoolHeader(uint64_t address, uint32_t& currentBlock, uint32_t& currentCursor,
+                        std::vector<uint64_t>& blocks) const;
+
+private:
+    const DMAManager& m_dmaManager;     ///< Source of memory reads
+    NamePoolLayout m_layout;            ///< Layout of the last dump
+    NameDumpStats m_stats;              ///< Counters of the last dump
+};
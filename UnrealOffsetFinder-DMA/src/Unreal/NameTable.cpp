@@ -0,0 +1,92 @@
+#include "NameTable.h"
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+
+void NameTable::Reserve(size_t entries, size_t bytes)
+{
+    m_arena.reserve(bytes);
+    m_indices.reserve(entries);
+    m_offsets.reserve(entries + 1);
+}
+
+void NameTable::Append(uint32_t index, std::string_view name)
+{
+    m_arena.insert(m_arena.end(), name.begin(), name.end());
+    m_indices.push_back(index);
+    m_offsets.push_back(static_cast<uint32_t>(m_arena.size()));
+}
+
+void NameTable::Append(const NameTable& other)
+{
+    uint32_t base = static_cast<uint32_t>(m_arena.size());
+    m_arena.insert(m_arena.end(), other.m_arena.begin(), other.m_arena.end());
+    m_indices.insert(m_indices.end(), other.m_indices.begin(), other.m_indices.end());
+
+    m_offsets.reserve(m_offsets.size() + other.m_indices.size());
+    for (size_t i = 1; i < other.m_offsets.size(); ++i)
+    {
+        m_offsets.push_back(base + other.m_offsets[i]);
+    }
+}
+
+void NameTable::Clear()
+{
+    m_arena.clear();
+    m_indices.clear();
+    m_offsets.assign(1, 0);
+}
+
+void NameTable::ShrinkToFit()
+{
+    m_arena.shrink_to_fit();
+    m_indices.shrink_to_fit();
+    m_offsets.shrink_to_fit();
+}
+
+std::string_view NameTable::Find(uint32_t index) const
+{
+    auto it = std::lower_bound(m_indices.begin(), m_indices.end(), index);
+    if (it == m_indices.end() || *it != index)
+    {
+        return {};
+    }
+    return GetNameAt(static_cast<size_t>(it - m_indices.begin()));
+}
+
+uint64_t NameTable::GetMemoryBytes() const
+{
+    return m_arena.capacity() + (m_indices.capacity() + m_offsets.capacity()) * sizeof(uint32_t);
+}
+
+bool NameTable::SaveToFile(const std::string& filename) const
+{
+    std::ofstream file(filename, std::ios::binary);
+    if (!file.is_open())
+    {
+        std::cerr << "Failed to open name file for writing: " << filename << std::endl;
+        return false;
+    }
+
+    // Built in large chunks; one stream write per name is several times slower
+    std::string chunk;
+    chunk.reserve(1 << 20);
+    char index[16];
+    for (size_t i = 0; i < GetCount(); ++i)
+    {
+        int length = snprintf(index, sizeof(index), "%X\t", m_indices[i]);
+        chunk.append(index, static_cast<size_t>(length));
+        chunk.append(GetNameAt(i));
+        chunk.push_back('\n');
+
+        if (chunk.size() >= (1 << 20))
+        {
+            file.write(chunk.data(), static_cast<std::streamsize>(chunk.size()));
+            chunk.clear();
+        }
+    }
+    file.write(chunk.data(), static_cast<std::streamsize>(chunk.size()));
+
+    return file.good();
+}
@@ -0,0 +1,105 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * @class NameTable
+ * @brief FName index to string table backed by one contiguous arena
+ *
+ * All names are stored back to back (UTF-8, no terminators) in a single
+ * character arena; a parallel pair of arrays maps the n-th entry to its
+ * FName index and arena offset. Entries are appended in ascending index
+ * order, so lookups are a binary search and the whole table costs the
+ * name bytes plus eight bytes per entry.
+ */
+class NameTable
+{
+public:
+    /**
+     * @brief Reserve space for the expected table size
+     * @param entries Expected entry count
+     * @param bytes Expected total name bytes
+     */
+    void Reserve(size_t entries, size_t bytes);
+
+    /**
+     * @brief Append a name (indices must be ascending)
+     * @param index FName comparison index
+     * @param name Name bytes (UTF-8)
+     */
+    void Append(uint32_t index, std::string_view name);
+
+    /**
+     * @brief Append every entry of another table (its indices must follow ours)
+     * @param other Table to copy from
+     */
+    void Append(const NameTable& other);
+
+    /**
+     * @brief Remove all entries (keeps the allocated memory)
+     */
+    void Clear();
+
+    /**
+     * @brief Release unused reserved memory
+     */
+    void ShrinkToFit();
+
+    /**
+     * @brief Look up a name by FName index
+     * @param index FName comparison index
+     * @return Name, empty if the index is not an entry
+     */
+    std::string_view Find(uint32_t index) const;
+
+    /**
+     * @brief Get the number of entries
+     * @return Entry count
+     */
+    size_t GetCount() const { return m_indices.size(); }
+
+    /**
+     * @brief Get the FName index of the n-th entry
+     * @param position Entry position (0 .. GetCount() - 1)
+     * @return FName index
+     */
+    uint32_t GetIndexAt(size_t position) const { return m_indices[position]; }
+
+    /**
+     * @brief Get the name of the n-th entry
+     * @param position Entry position (0 .. GetCount() - 1)
+     * @return Name
+     */
+    std::string_view GetNameAt(size_t position) const
+    {
+        return std::string_view(m_arena.data() + m_offsets[position], m_offsets[position + 1] - m_offsets[position]);
+    }
+
+    /**
+     * @brief Get the total size of all names
+     * @return Arena bytes in use
+     */
+    size_t GetArenaSize() const { return m_arena.size(); }
+
+    /**
+     * @brief Get the memory held by the table
+     * @return Allocated bytes
+     */
+    uint64_t GetMemoryBytes() const;
+
+    /**
+     * @brief Write the table as "index<TAB>name" lines (index in hex)
+     * @param filename Output file
+     * @return true if successful, false otherwise
+     */
+    bool SaveToFile(const std::string& filename) const;
+
+private:
+    std::vector<char> m_arena;              ///< All names back to back
+    std::vector<uint32_t> m_indices;        ///< FName index of each entry (ascending)
+    std::vector<uint32_t> m_offsets = { 0 };    ///< Arena offset of each entry, plus the end of the last one
+};
@@ -0,0 +1,638 @@
+#include "ObjectEnumerator.h"
+#include "../DMA/DMAManager.h"
+#include "../Core/TaskExecutor.h"
+#include "../Core/Trace.h"
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
+namespace
+{
+    constexpr uint64_t MIN_USER_ADDRESS = 0x10000;
+    constexpr uint64_t MAX_USER_ADDRESS = 0x7FFFFFFFFFFF;
+    constexpr size_t LINK_CACHE_SIZE = 4096;    // Power of two
+
+    // Item sizes tried by DetectItemSize, most common first
+    constexpr uint32_t KNOWN_ITEM_SIZES[] = { 0x18, 0x10, 0x20 };
+
+    bool IsUserPointer(uint64_t address)
+    {
+        return address >= MIN_USER_ADDRESS && address <= MAX_USER_ADDRESS;
+    }
+
+    template<typename T>
+    T Load(const uint8_t* data)
+    {
+        T value;
+        std::memcpy(&value, data, sizeof(T));
+        return value;
+    }
+
+    double SecondsSince(std::chrono::steady_clock::time_point start)
+    {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+}
+
+ObjectEnumerator::ObjectEnumerator(const DMAManager& dmaManager)
+    : m_dmaManager(dmaManager)
+{
+}
+
+bool ObjectEnumerator::ReadArrayHeader(uint64_t address, ArrayHeader& header) const
+{
+    uint8_t raw[0x20] = {};
+    if (m_dmaManager.ReadMemory(address, raw, sizeof(raw)) != sizeof(raw))
+    {
+        return false;
+    }
+
+    header.objects = Load<uint64_t>(raw);
+    header.maxElements = Load<int32_t>(raw + 0x10);
+    header.numElements = Load<int32_t>(raw + 0x14);
+    header.maxChunks = Load<int32_t>(raw + 0x18);
+    header.numChunks = Load<int32_t>(raw + 0x1C);
+
+    int32_t neededChunks = (header.numElements + ELEMENTS_PER_CHUNK - 1) / ELEMENTS_PER_CHUNK;
+    return IsUserPointer(header.objects) &&
+           header.numElements > 0 && header.numElements <= header.maxElements &&
+           header.maxElements <= static_cast<int32_t>(MAX_OBJECTS) &&
+           header.numChunks >= neededChunks && header.numChunks <= header.maxChunks &&
+           header.maxChunks <= static_cast<int32_t>(MAX_OBJECTS / ELEMENTS_PER_CHUNK + 1);
+}
+
+bool ObjectEnumerator::DetectItemSize(const uint8_t* items, size_t size)
+{
+    for (uint32_t itemSize : KNOWN_ITEM_SIZES)
+    {
+        // Slot 0 is sometimes reserved; check the first few live objects report their own slot
+        int checked = 0;
+        bool matches = true;
+        for (uint32_t slot = 0; slot < 8 && (slot + 1) * itemSize <= size && checked < 3; ++slot)
+        {
+            uint64_t object = Load<uint64_t>(items + slot * itemSize);
+            if (object == 0)
+            {
+                continue;
+            }
+
+            int32_t internalIndex = -1;
+            if (!IsUserPointer(object) || !m_dmaManager.ReadValue(object + m_layout.indexOffset, internalIndex) ||
+                internalIndex != static_cast<int32_t>(slot))
+            {
+                matches = false;
+                break;
+            }
+            checked++;
+        }
+
+        if (matches && checked > 0)
+        {
+            m_layout.itemSize = itemSize;
+            m_layout.serialOffset = itemSize >= 0x18 ? 0x10 : 0;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool ObjectEnumerator::ReadBatched(std::vector<ScatterRead>& requests)
+{
+    std::vector<ScatterRead> batch;
+    batch.reserve(MAX_BATCH_ENTRIES);
+
+    size_t first = 0;
+    while (first < requests.size())
+    {
+        if (TaskExecutor::IsCurrentTaskCancelled())
+        {
+            return false;
+        }
+
+        batch.clear();
+        uint64_t batchBytes = 0;
+        size_t end = first;
+        while (end < requests.size() && batch.size() < MAX_BATCH_ENTRIES &&
+               (batch.empty() || batchBytes + requests[end].size <= BATCH_BYTES))
+        {
+            batch.push_back(requests[end]);
+            batchBytes += requests[end].size;
+            ++end;
+        }
+
+        m_stats.bytesRead += m_dmaManager.ReadMemoryBatch(batch);
+        m_stats.batches++;
+        for (size_t i = 0; i < batch.size(); ++i)
+        {
+            requests[first + i].bytesRead = batch[i].bytesRead;
+        }
+        first = end;
+    }
+    return true;
+}
+
+bool ObjectEnumerator::ReadItems(const ArrayHeader& header, std::vector<uint8_t>& items, std::vector<uint32_t>& readSlots, std::string& error)
+{
+    const uint32_t slotCount = static_cast<uint32_t>(header.numElements);
+    const uint32_t chunkCount = (slotCount + ELEMENTS_PER_CHUNK - 1) / ELEMENTS_PER_CHUNK;
+
+    std::vector<uint64_t> chunks(chunkCount);
+    size_t chunkTableBytes = chunks.size() * sizeof(uint64_t);
+    if (m_dmaManager.ReadMemory(header.objects, chunks.data(), chunkTableBytes) != chunkTableBytes ||
+        !std::all_of(chunks.begin(), chunks.end(), IsUserPointer))
+    {
+        error = "GObjects chunk table is unreadable";
+        return false;
+    }
+
+    if (m_layout.itemSize == 0)
+    {
+        uint8_t firstItems[8 * 0x20] = {};
+        size_t firstBytes = m_dmaManager.ReadMemory(chunks[0], firstItems,
+            std::min<size_t>(sizeof(firstItems), static_cast<size_t>(slotCount) * KNOWN_ITEM_SIZES[0]));
+        if (!DetectItemSize(firstItems, firstBytes))
+        {
+            error = "Unknown FUObjectItem layout (first objects do not report their index)";
+            return false;
+        }
+    }
+
+    const uint32_t itemSize = m_layout.itemSize;
+    items.assign(static_cast<size_t>(slotCount) * itemSize, 0);
+    std::vector<ScatterRead> requests;
+    requests.reserve(chunkCount);
+    for (uint32_t chunk = 0; chunk < chunkCount; ++chunk)
+    {
+        uint32_t firstSlot = chunk * ELEMENTS_PER_CHUNK;
+        uint32_t count = std::min(ELEMENTS_PER_CHUNK, slotCount - firstSlot);
+        requests.emplace_back(chunks[chunk], items.data() + static_cast<size_t>(firstSlot) * itemSize,
+                              static_cast<size_t>(count) * itemSize);
+    }
+    if (!ReadBatched(requests))
+    {
+        error = "Object enumeration cancelled";
+        return false;
+    }
+
+    readSlots.resize(chunkCount);
+    for (uint32_t chunk = 0; chunk < chunkCount; ++chunk)
+    {
+        readSlots[chunk] = static_cast<uint32_t>(requests[chunk].bytesRead / itemSize);
+    }
+    m_stats.chunks = chunkCount;
+    return true;
+}
+
+bool ObjectEnumerator::ReadObjects(const std::vector<LiveItem>& live, std::vector<ObjectRecord>& records,
+                                   std::vector<std::pair<uint64_t, int32_t>>& byAddress)
+{
+    std::vector<uint32_t> order(live.size());
+    for (uint32_t i = 0; i < order.size(); ++i)
+    {
+        order[i] = i;
+    }
+    std::sort(order.begin(), order.end(),
+        [&live](uint32_t a, uint32_t b) { return live[a].address < live[b].address; });
+
+    const uint32_t headerSize = m_layout.headerSize;
+    std::vector<uint64_t> headerOffsets(live.size());
+    std::vector<size_t> spanOfObject(live.size());
+    std::vector<ScatterRead> requests;
+    uint64_t totalSpanBytes = 0;
+    for (uint32_t position : order)
+    {
+        uint64_t address = live[position].address;
+        if (!requests.empty())
+        {
+            ScatterRead& span = requests.back();
+            uint64_t spanEnd = span.address + span.size;
+            if (address <= spanEnd + MAX_SPAN_GAP && address + headerSize - span.address <= MAX_SPAN_SIZE)
+            {
+                uint64_t newEnd = std::max(spanEnd, address + headerSize);
+                totalSpanBytes += newEnd - spanEnd;
+                span.size = static_cast<size_t>(newEnd - span.address);
+                headerOffsets[position] = address - span.address;
+                spanOfObject[position] = requests.size() - 1;
+                continue;
+            }
+        }
+
+        requests.emplace_back(address, nullptr, headerSize);
+        totalSpanBytes += headerSize;
+        headerOffsets[position] = 0;
+        spanOfObject[position] = requests.size() - 1;
+    }
+
+    std::vector<uint8_t> spanData(static_cast<size_t>(totalSpanBytes));
+    std::vector<uint64_t> spanStarts(requests.size());
+    uint64_t cursor = 0;
+    for (size_t i = 0; i < requests.size(); ++i)
+    {
+        requests[i].buffer = spanData.data() + cursor;
+        spanStarts[i] = cursor;
+        cursor += requests[i].size;
+    }
+    m_stats.spans += requests.size();
+
+    if (!ReadBatched(requests))
+    {
+        return false;
+    }
+
+    // Decode in slot order so records come out sorted by slot
+    std::vector<uint8_t> accepted(live.size(), 0);
+    records.clear();
+    records.reserve(live.size());
+    for (size_t position = 0; position < live.size(); ++position)
+    {
+        const ScatterRead& span = requests[spanOfObject[position]];
+        uint64_t offset = headerOffsets[position];
+        const uint8_t* object = spanData.data() + spanStarts[spanOfObject[position]] + offset;
+        if (offset + headerSize > span.bytesRead || Load<int32_t>(object + m_layout.indexOffset) != live[position].slot)
+        {
+            m_stats.stale++;
+            continue;
+        }
+
+        accepted[position] = 1;
+        records.push_back({ live[position].slot, live[position].address, live[position].itemFlags,
+                            Load<uint32_t>(object + m_layout.flagsOffset),
+                            Load<uint32_t>(object + m_layout.nameOffset), Load<uint32_t>(object + m_layout.nameOffset + 4),
+                            Load<uint64_t>(object + m_layout.classOffset), Load<uint64_t>(object + m_layout.outerOffset) });
+    }
+
+    // The span pass already ordered the objects by address
+    byAddress.clear();
+    byAddress.reserve(records.size());
+    for (uint32_t position : order)
+    {
+        if (accepted[position])
+        {
+            byAddress.emplace_back(live[position].address, live[position].slot);
+        }
+    }
+    return true;
+}
+
+void ObjectEnumerator::LinkRecords(const std::vector<ObjectRecord>& records, const std::vector<size_t>& positions, ObjectIndex& objects) const
+{
+    // Few distinct classes and outers are referenced, so a small direct-mapped cache
+    // in front of the binary search answers most lookups
+    std::vector<std::pair<uint64_t, int32_t>> cache(LINK_CACHE_SIZE, { 0, -1 });
+    auto findSlot = [&](uint64_t address) -> int32_t
+    {
+        if (address == 0)
+            return -1;
+        auto& entry = cache[(address >> 4) & (LINK_CACHE_SIZE - 1)];
+        if (entry.first == address)
+            return entry.second;
+        auto it = std::lower_bound(m_slotsByAddress.begin(), m_slotsByAddress.end(), std::make_pair(address, INT32_MIN));
+        entry = { address, (it != m_slotsByAddress.end() && it->first == address) ? it->second : -1 };
+        return entry.second;
+    };
+
+    for (size_t i = 0; i < records.size(); ++i)
+    {
+        objects.SetReferences(positions[i], findSlot(records[i].classAddress), findSlot(records[i].outerAddress));
+    }
+}
+
+uint64_t ObjectEnumerator::HashPage(const uint8_t* items, uint32_t count) const
+{
+    // FNV-1a over object pointer, flags and serial number; ClusterRootIndex churn is ignored
+    uint64_t hash = 0xCBF29CE484222325ULL;
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        const uint8_t* item = items + static_cast<size_t>(i) * m_layout.itemSize;
+        uint64_t words[2] = { Load<uint64_t>(item),
+                              (static_cast<uint64_t>(static_cast<uint32_t>(GetSerial(item))) << 32) |
+                              Load<uint32_t>(item + m_layout.itemFlagsOffset) };
+        for (uint64_t word : words)
+        {
+            hash ^= word;
+            hash *= 0x100000001B3ULL;
+        }
+    }
+    return hash;
+}
+
+int32_t ObjectEnumerator::GetSerial(const uint8_t* item) const
+{
+    return m_layout.serialOffset != 0 ? Load<int32_t>(item + m_layout.serialOffset) : 0;
+}
+
+bool ObjectEnumerator::Enumerate(uint64_t gobjectsAddress, ObjectIndex& objects, std::string& error)
+{
+    TRACE_SCOPE("EnumerateObjects", "scan");
+
+    m_stats = ObjectEnumStats();
+    m_layout = ObjectArrayLayout();
+    m_layout.itemSize = 0;
+    m_snapshotAddress = 0;
+    objects.Clear();
+
+    if (!m_dmaManager.IsConnected())
+    {
+        error = "Not connected to any process";
+        return false;
+    }
+    if (gobjectsAddress == 0)
+    {
+        error = "GObjects address is unknown; scan the Unreal globals first";
+        return false;
+    }
+
+    auto startTime = std::chrono::steady_clock::now();
+
+    // GObjects usually resolves to FUObjectArray; some signatures land on ObjObjects itself
+    ArrayHeader header;
+    if (!ReadArrayHeader(gobjectsAddress + m_layout.objectsOffset, header))
+    {
+        m_layout.objectsOffset = 0;
+        if (!ReadArrayHeader(gobjectsAddress, header))
+        {
+            error = "No FUObjectArray at " + DMAManager::FormatHexAddress(gobjectsAddress);
+            return false;
+        }
+    }
+
+    // Phase 1: the used part of every item chunk
+    const uint32_t slotCount = static_cast<uint32_t>(header.numElements);
+    m_stats.slots = slotCount;
+    std::vector<uint8_t> items;
+    std::vector<uint32_t> readSlots;
+    if (!ReadItems(header, items, readSlots, error))
+    {
+        return false;
+    }
+    m_stats.itemSeconds = SecondsSince(startTime);
+    TaskExecutor::ReportProgress(0.3f, std::to_string(slotCount) + " slots");
+
+    // Live items; slots of chunks that failed to read count as empty
+    const uint32_t itemSize = m_layout.itemSize;
+    std::vector<LiveItem> live;
+    live.reserve(slotCount);
+    for (uint32_t chunk = 0; chunk < readSlots.size(); ++chunk)
+    {
+        uint32_t firstSlot = chunk * ELEMENTS_PER_CHUNK;
+        for (uint32_t i = 0; i < readSlots[chunk]; ++i)
+        {
+            const uint8_t* item = items.data() + static_cast<size_t>(firstSlot + i) * itemSize;
+            uint64_t address = Load<uint64_t>(item);
+            if (IsUserPointer(address))
+            {
+                live.push_back({ address, static_cast<int32_t>(firstSlot + i), Load<uint32_t>(item + m_layout.itemFlagsOffset) });
+            }
+        }
+    }
+
+    // Phase 2: object headers, in address order and coalesced into spans
+    auto objectStart = std::chrono::steady_clock::now();
+    std::vector<ObjectRecord> records;
+    if (!ReadObjects(live, records, m_slotsByAddress))
+    {
+        error = "Object enumeration cancelled";
+        return false;
+    }
+    m_stats.objectSeconds = SecondsSince(objectStart);
+    TaskExecutor::ReportProgress(0.9f, std::to_string(records.size()) + " objects");
+
+    auto linkStart = std::chrono::steady_clock::now();
+    std::vector<size_t> positions(records.size());
+    objects.Reserve(records.size());
+    for (size_t i = 0; i < records.size(); ++i)
+    {
+        const ObjectRecord& record = records[i];
+        positions[i] = i;
+        objects.Add(record.slot, record.address, record.flags, record.itemFlags, record.nameIndex, record.nameNumber);
+    }
+    LinkRecords(records, positions, objects);
+    objects.ShrinkToFit();
+
+    // Snapshot for Resync; pages of unread chunks hash as empty and are compared next time
+    m_pageHashes.assign((slotCount + ITEMS_PER_PAGE - 1) / ITEMS_PER_PAGE, 0);
+    for (size_t page = 0; page < m_pageHashes.size(); ++page)
+    {
+        uint32_t firstSlot = static_cast<uint32_t>(page) * ITEMS_PER_PAGE;
+        m_pageHashes[page] = HashPage(items.data() + static_cast<size_t>(firstSlot) * itemSize,
+                                      std::min(ITEMS_PER_PAGE, slotCount - firstSlot));
+    }
+    m_serials.resize(slotCount);
+    for (uint32_t slot = 0; slot < slotCount; ++slot)
+    {
+        m_serials[slot] = GetSerial(items.data() + static_cast<size_t>(slot) * itemSize);
+    }
+    m_snapshotAddress = gobjectsAddress;
+    m_snapshotSlots = slotCount;
+    m_snapshotObjects = objects.GetCount();
+
+    m_stats.objects = objects.GetCount();
+    m_stats.memoryBytes = objects.GetMemoryBytes();
+    m_stats.linkSeconds = SecondsSince(linkStart);
+    m_stats.seconds = SecondsSince(startTime);
+    return true;
+}
+
+bool ObjectEnumerator::Resync(uint64_t gobjectsAddress, const ObjectIndex& previous, ObjectIndex& objects, ObjectDelta& delta, std::string& error)
+{
+    TRACE_SCOPE("ResyncObjects", "scan");
+
+    m_stats = ObjectEnumStats();
+    objects.Clear();
+    delta = ObjectDelta();
+
+    if (!m_dmaManager.IsConnected())
+    {
+        error = "Not connected to any process";
+        return false;
+    }
+    if (!HasSnapshot(gobjectsAddress) || previous.GetCount() != m_snapshotObjects)
+    {
+        error = "No GObjects snapshot to resync against; enumerate first";
+        return false;
+    }
+
+    auto startTime = std::chrono::steady_clock::now();
+
+    // NumElements never shrinks in a running game; if it did, the array was rebuilt
+    ArrayHeader header;
+    if (!ReadArrayHeader(gobjectsAddress + m_layout.objectsOffset, header) ||
+        static_cast<uint32_t>(header.numElements) < m_snapshotSlots)
+    {
+        m_snapshotAddress = 0;
+        error = "GObjects changed since the last walk; enumerate again";
+        return false;
+    }
+
+    const uint32_t slotCount = static_cast<uint32_t>(header.numElements);
+    m_stats.slots = slotCount;
+    std::vector<uint8_t> items;
+    std::vector<uint32_t> readSlots;
+    if (!ReadItems(header, items, readSlots, error))
+    {
+        return false;
+    }
+    m_stats.itemSeconds = SecondsSince(startTime);
+
+    // Compare page hashes; pages that were not fully read keep their snapshot
+    const uint32_t itemSize = m_layout.itemSize;
+    const uint32_t pageCount = (slotCount + ITEMS_PER_PAGE - 1) / ITEMS_PER_PAGE;
+    const std::vector<int32_t>& previousSlots = previous.GetSlots();
+    m_pageHashes.resize(pageCount, 0);
+    m_serials.resize(slotCount, 0);
+    m_stats.pages = pageCount;
+
+    std::vector<uint8_t> replaced(slotCount, 0);    // Removed or reused: the previous entry is dropped
+    std::vector<std::pair<int32_t, uint64_t>> replacedAddresses;
+    std::vector<uint8_t> pageChanged(pageCount, 0);
+    std::vector<LiveItem> live;
+    size_t previousPosition = 0;
+    for (uint32_t page = 0; page < pageCount; ++page)
+    {
+        uint32_t firstSlot = page * ITEMS_PER_PAGE;
+        uint32_t count = std::min(ITEMS_PER_PAGE, slotCount - firstSlot);
+        if (firstSlot % ELEMENTS_PER_CHUNK + count > readSlots[firstSlot / ELEMENTS_PER_CHUNK])
+        {
+            continue;
+        }
+
+        const uint8_t* pageItems = items.data() + static_cast<size_t>(firstSlot) * itemSize;
+        uint64_t hash = HashPage(pageItems, count);
+        if (hash == m_pageHashes[page])
+        {
+            continue;
+        }
+        m_pageHashes[page] = hash;
+        pageChanged[page] = 1;
+        m_stats.changedPages++;
+
+        // Walk the slots of the page alongside the previous index
+        previousPosition = std::lower_bound(previousSlots.begin() + previousPosition, previousSlots.end(),
+                                            static_cast<int32_t>(firstSlot)) - previousSlots.begin();
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            int32_t slot = static_cast<int32_t>(firstSlot + i);
+            const uint8_t* item = pageItems + static_cast<size_t>(i) * itemSize;
+            uint64_t address = Load<uint64_t>(item);
+            int32_t serial = GetSerial(item);
+
+            bool wasLive = previousPosition < previousSlots.size() && previousSlots[previousPosition] == slot;
+            bool isLive = IsUserPointer(address);
+            if (!wasLive || !isLive || address != previous.GetAddresses()[previousPosition] || serial != m_serials[slot])
+            {
+                if (wasLive)
+                {
+                    replaced[slot] = 1;
+                    replacedAddresses.emplace_back(slot, previous.GetAddresses()[previousPosition]);
+                    if (!isLive)
+                        delta.removed.push_back(slot);
+                }
+                if (isLive)
+                {
+                    live.push_back({ address, slot, Load<uint32_t>(item + m_layout.itemFlagsOffset) });
+                }
+            }
+
+            m_serials[slot] = serial;
+            if (wasLive)
+                previousPosition++;
+        }
+    }
+
+    // Object headers of added and reused slots only
+    auto objectStart = std::chrono::steady_clock::now();
+    std::vector<ObjectRecord> records;
+    std::vector<std::pair<uint64_t, int32_t>> addedByAddress;
+    if (!ReadObjects(live, records, addedByAddress))
+    {
+        // Page hashes already moved on, so the next walk has to be a full one
+        m_snapshotAddress = 0;
+        error = "Object resync cancelled";
+        return false;
+    }
+    m_stats.objectSeconds = SecondsSince(objectStart);
+
+    // A reused slot whose new object turned out stale counts as removed
+    std::vector<uint8_t> recorded(slotCount, 0);
+    for (const ObjectRecord& record : records)
+    {
+        recorded[record.slot] = 1;
+        (replaced[record.slot] ? delta.changed : delta.added).push_back(record.slot);
+    }
+    for (const LiveItem& item : live)
+    {
+        if (replaced[item.slot] && !recorded[item.slot])
+        {
+            delta.removed.push_back(item.slot);
+        }
+    }
+    std::sort(delta.removed.begin(), delta.removed.end());
+
+    // References are pointers: they go stale unless the slot's object came back at the same address
+    std::vector<uint8_t> unlinked(replaced);
+    for (const auto& [slot, oldAddress] : replacedAddresses)
+    {
+        auto it = std::lower_bound(records.begin(), records.end(), slot,
+            [](const ObjectRecord& record, int32_t value) { return record.slot < value; });
+        if (it != records.end() && it->slot == slot && it->address == oldAddress)
+        {
+            unlinked[slot] = 0;
+        }
+    }
+
+    // Merge retained entries with the new records, both in slot order
+    auto linkStart = std::chrono::steady_clock::now();
+    std::vector<size_t> positions(records.size());
+    objects.Reserve(previous.GetCount() + records.size());
+    size_t next = 0;
+    for (size_t position = 0; position <= previousSlots.size(); ++position)
+    {
+        int32_t slot = position < previousSlots.size() ? previousSlots[position] : INT32_MAX;
+        while (next < records.size() && records[next].slot < slot)
+        {
+            const ObjectRecord& record = records[next];
+            positions[next++] = objects.GetCount();
+            objects.Add(record.slot, record.address, record.flags, record.itemFlags, record.nameIndex, record.nameNumber);
+        }
+        if (position == previousSlots.size() || replaced[slot])
+        {
+            continue;
+        }
+
+        objects.Append(previous, position);
+        if (pageChanged[slot / ITEMS_PER_PAGE])
+        {
+            // Item flags of retained objects may have changed (GC marks, root set, ...)
+            const uint8_t* item = items.data() + static_cast<size_t>(slot) * itemSize;
+            objects.SetInternalFlags(objects.GetCount() - 1, Load<uint32_t>(item + m_layout.itemFlagsOffset));
+        }
+        int32_t classSlot = objects.GetClassSlots().back();
+        int32_t outerSlot = objects.GetOuterSlots().back();
+        bool classDropped = classSlot >= 0 && unlinked[classSlot];
+        bool outerDropped = outerSlot >= 0 && unlinked[outerSlot];
+        if (classDropped || outerDropped)
+        {
+            objects.SetReferences(objects.GetCount() - 1, classDropped ? -1 : classSlot, outerDropped ? -1 : outerSlot);
+        }
+    }
+
+    // Address table: drop removed and reused slots, merge in the new objects
+    auto keptEnd = std::remove_if(m_slotsByAddress.begin(), m_slotsByAddress.end(),
+        [&replaced](const std::pair<uint64_t, int32_t>& entry) { return replaced[entry.second] != 0; });
+    m_slotsByAddress.erase(keptEnd, m_slotsByAddress.end());
+    size_t keptCount = m_slotsByAddress.size();
+    m_slotsByAddress.insert(m_slotsByAddress.end(), addedByAddress.begin(), addedByAddress.end());
+    std::inplace_merge(m_slotsByAddress.begin(), m_slotsByAddress.begin() + keptCount, m_slotsByAddress.end());
+
+    LinkRecords(records, positions, objects);
+    objects.ShrinkToFit();
+
+    m_snapshotSlots = slotCount;
+    m_snapshotObjects = objects.GetCount();
+
+    m_stats.objects = objects.GetCount();
+    m_stats.memoryBytes = objects.GetMemoryBytes();
+    m_stats.linkSeconds = SecondsSince(linkStart);
+    m_stats.seconds = SecondsSince(startTime);
+    return true;
+}
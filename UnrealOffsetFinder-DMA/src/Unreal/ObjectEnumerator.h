@@ -0,0 +1,280 @@
+#pragma once
+
+#include "ObjectIndex.h"
+#include <cstdint>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+class DMAManager;
+struct ScatterRead;
+
+/**
+ * @struct ObjectArrayLayout
+ * @brief Engine-build dependent offsets of FUObjectArray, FUObjectItem and UObjectBase
+ *
+ * Defaults match UE 4.20+ and UE5 shipping builds: the chunked array sits
+ * 0x10 into FUObjectArray, items are 0x18 bytes and UObjectBase is
+ * VTable, ObjectFlags, InternalIndex, ClassPrivate, NamePrivate, OuterPrivate.
+ */
+struct ObjectArrayLayout
+{
+    uint64_t objectsOffset = 0x10;  ///< FChunkedFixedUObjectArray inside FUObjectArray (0 if GObjects points at it)
+    uint32_t itemSize = 0x18;       ///< sizeof(FUObjectItem)
+    uint32_t itemFlagsOffset = 0x8; ///< FUObjectItem::Flags
+    uint32_t serialOffset = 0x10;   ///< FUObjectItem::SerialNumber (0 = item has none)
+    uint32_t flagsOffset = 0x8;     ///< UObjectBase::ObjectFlags
+    uint32_t indexOffset = 0xC;     ///< UObjectBase::InternalIndex
+    uint32_t classOffset = 0x10;    ///< UObjectBase::ClassPrivate
+    uint32_t nameOffset = 0x18;     ///< UObjectBase::NamePrivate (comparison index, number)
+    uint32_t outerOffset = 0x20;    ///< UObjectBase::OuterPrivate
+    uint32_t headerSize = 0x28;     ///< Bytes of UObjectBase read per object
+};
+
+/**
+ * @struct ObjectEnumStats
+ * @brief Counters of the last enumeration
+ */
+struct ObjectEnumStats
+{
+    uint64_t slots = 0;         ///< GObjects NumElements
+    uint64_t objects = 0;       ///< Live objects indexed
+    uint64_t stale = 0;         ///< Items whose object did not report their slot (skipped)
+    uint64_t chunks = 0;        ///< Item chunks read
+    uint64_t spans = 0;         ///< Coalesced object header reads
+    uint64_t bytesRead = 0;     ///< Bytes transferred from the device
+    uint64_t batches = 0;       ///< Scatter batches
+    uint64_t memoryBytes = 0;   ///< Memory held by the resulting index
+    uint64_t pages = 0;         ///< Item pages compared (resync)
+    uint64_t changedPages = 0;  ///< Item pages whose hash changed (resync)
+    double itemSeconds = 0.0;   ///< Chunk table and item reads
+    double objectSeconds = 0.0; ///< Object header reads (only changed slots on resync)
+    double linkSeconds = 0.0;   ///< Class/outer resolution (and the merge on resync)
+    double seconds = 0.0;       ///< Wall time
+};
+
+/**
+ * @struct ObjectDelta
+ * @brief Slots that differ between two GObjects snapshots
+ */
+struct ObjectDelta
+{
+    std::vector<int32_t> added;     ///< Free before, live now
+    std::vector<int32_t> removed;   ///< Live before, free now
+    std::vector<int32_t> changed;   ///< Reused by another object (new address or serial number)
+
+    /**
+     * @brief Check if nothing changed
+     * @return true if all lists are empty
+     */
+    bool IsEmpty() const { return added.empty() && removed.empty() && changed.empty(); }
+};
+
+/**
+ * @struct ObjectSyncResult
+ * @brief Result of a full enumeration or an incremental resync
+ */
+struct ObjectSyncResult
+{
+    std::shared_ptr<const ObjectIndex> objects;     ///< Current objects
+    ObjectDelta delta;                              ///< Changes against the previous index (resync only)
+    bool incremental = false;                       ///< true if produced by Resync
+};
+
+/**
+ * @class ObjectEnumerator
+ * @brief Walks GObjects (FUObjectArray) into an ObjectIndex
+ *
+ * Three batched phases: the chunk pointer table, the FUObjectItem chunks
+ * (only the used part), then the UObjectBase header of every live object.
+ * Object headers are sorted by address and coalesced into spans, since
+ * objects are allocated close together, so a million objects cost a few
+ * hundred scatter entries instead of a million reads. Class and outer
+ * pointers are resolved to slots through an address-sorted table.
+ *
+ * Every walk leaves a snapshot (a hash per page of items, the serial number
+ * of every slot and the address table) that Resync diffs against: items are
+ * re-read, but only slots on pages whose hash changed are compared and only
+ * added or reused slots have their object header read again. One
+ * enumerator must not run two walks at the same time.
+ */
+class ObjectEnumerator
+{
+public:
+    /**
+     * @brief Constructor
+     * @param dmaManager DMA manager to read through (must outlive the enumerator)
+     */
+    explicit ObjectEnumerator(const DMAManager& dmaManager);
+
+    /**
+     * @brief Enumerate every live object
+     * @param gobjectsAddress GObjects address found by the globals scan
+     * @param objects Receives the objects (cleared first)
+     * @param error Receives the reason on failure
+     * @return true if successful, false otherwise
+     */
+    bool Enumerate(uint64_t gobjectsAddress, ObjectIndex& objects, std::string& error);
+
+    /**
+     * @brief Bring an index up to date by re-reading only what changed since the last walk
+     *
+     * Retained objects keep their names and object flags from the previous
+     * index; references to removed or reused slots are cleared and are not
+     * restored if an object later reappears at the old address. Fails (the
+     * caller re-enumerates) if the array shrank or moved.
+     *
+     * @param gobjectsAddress GObjects address of the last walk
+     * @param previous Index produced by this enumerator's last Enumerate or Resync
+     * @param objects Receives the updated objects (cleared first, must not be previous)
+     * @param delta Receives the changed slots
+     * @param error Receives the reason on failure
+     * @return true if successful, false otherwise
+     */
+    bool Resync(uint64_t gobjectsAddress, const ObjectIndex& previous, ObjectIndex& objects, ObjectDelta& delta, std::string& error);
+
+    /**
+     * @brief Check if a snapshot of a walk exists that Resync can diff against
+     * @param gobjectsAddress GObjects address to check for
+     * @return true if the last walk was of this array
+     */
+    bool HasSnapshot(uint64_t gobjectsAddress) const { return m_snapshotAddress != 0 && m_snapshotAddress == gobjectsAddress; }
+
+    /**
+     * @brief Get counters of the last enumeration
+     * @return Stats
+     */
+    const ObjectEnumStats& GetLastStats() const { return m_stats; }
+
+    /**
+     * @brief Get the layout detected by the last enumeration
+     * @return Layout
+     */
+    const ObjectArrayLayout& GetLayout() const { return m_layout; }
+
+    static constexpr uint32_t ELEMENTS_PER_CHUNK = 64 * 1024;   ///< NumElementsPerChunk
+    static constexpr uint32_t MAX_OBJECTS = 16 * 1024 * 1024;   ///< Sanity limit for NumElements
+    static constexpr uint64_t BATCH_BYTES = 8 * 0x100000;       ///< Bytes per scatter batch
+    static constexpr size_t MAX_BATCH_ENTRIES = 1024;           ///< Reads per scatter batch
+    static constexpr uint64_t MAX_SPAN_GAP = 0x200;             ///< Objects closer than this share a read
+    static constexpr uint64_t MAX_SPAN_SIZE = 0x10000;          ///< Largest coalesced object read
+    static constexpr uint32_t ITEMS_PER_PAGE = 256;             ///< Items covered by one snapshot hash
+
+private:
+    /**
+     * @struct ArrayHeader
+     * @brief FChunkedFixedUObjectArray fields
+     */
+    struct ArrayHeader
+    {
+        uint64_t objects = 0;       ///< FUObjectItem** chunk table
+        int32_t maxElements = 0;
+        int32_t numElements = 0;
+        int32_t maxChunks = 0;
+        int32_t numChunks = 0;
+    };
+
+    /**
+     * @struct ObjectRecord
+     * @brief Decoded item and object header of a live object
+     */
+    struct ObjectRecord
+    {
+        int32_t slot;
+        uint64_t address;
+        uint32_t itemFlags;
+        uint32_t flags;
+        uint32_t nameIndex;
+        uint32_t nameNumber;
+        uint64_t classAddress;
+        uint64_t outerAddress;
+    };
+
+    /**
+     * @struct LiveItem
+     * @brief Non-null item whose object header is to be read
+     */
+    struct LiveItem
+    {
+        uint64_t address;
+        int32_t slot;
+        uint32_t itemFlags;
+    };
+
+    /**
+     * @brief Read and validate the chunked array header
+     * @return true if plausible
+     */
+    bool ReadArrayHeader(uint64_t address, ArrayHeader& header) const;
+
+    /**
+     * @brief Issue reads in scatter batches bounded by BATCH_BYTES and MAX_BATCH_ENTRIES
+     * @return false if cancelled
+     */
+    bool ReadBatched(std::vector<ScatterRead>& requests);
+
+    /**
+     * @brief Pick the item size whose first objects report their own slot
+     * @param items Bytes of the first items
+     * @param size Number of valid bytes
+     * @return true if a known item size fits
+     */
+    bool DetectItemSize(const uint8_t* items, size_t size);
+
+    /**
+     * @brief Read the chunk table and the used part of every item chunk
+     * @param header Array header
+     * @param items Receives NumElements items
+     * @param readSlots Receives how many leading items of each chunk were read
+     * @param error Receives the reason on failure
+     * @return true if successful, false otherwise
+     */
+    bool ReadItems(const ArrayHeader& header, std::vector<uint8_t>& items, std::vector<uint32_t>& readSlots, std::string& error);
+
+    /**
+     * @brief Read the object headers of live items, coalesced into spans
+     * @param live Items in slot order
+     * @param records Receives the objects that report their own slot, in slot order
+     * @param byAddress Receives (address, slot) of those objects sorted by address
+     * @return false if cancelled
+     */
+    bool ReadObjects(const std::vector<LiveItem>& live, std::vector<ObjectRecord>& records,
+                     std::vector<std::pair<uint64_t, int32_t>>& byAddress);
+
+    /**
+     * @brief Resolve the class and outer of records through m_slotsByAddress
+     * @param records Records to resolve
+     * @param positions Index position of each record
+     * @param objects Index receiving the references
+     */
+    void LinkRecords(const std::vector<ObjectRecord>& records, const std::vector<size_t>& positions, ObjectIndex& objects) const;
+
+    /**
+     * @brief Hash the (pointer, flags, serial) of the items of one snapshot page
+     * @param items First item of the page
+     * @param count Items on the page
+     * @return Page hash
+     */
+    uint64_t HashPage(const uint8_t* items, uint32_t count) const;
+
+    /**
+     * @brief Get the serial number stored in an item
+     * @param item Item bytes
+     * @return Serial number (0 if the layout has none)
+     */
+    int32_t GetSerial(const uint8_t* item) const;
+
+private:
+    const DMAManager& m_dmaManager;     ///< Source of memory reads
+    ObjectArrayLayout m_layout;         ///< Layout of the last enumeration
+    ObjectEnumStats m_stats;            ///< Counters of the last enumeration
+
+    // Snapshot of the last walk (Resync diffs against it)
+    uint64_t m_snapshotAddress = 0;                             ///< GObjects address of the snapshot (0 = none)
+    uint32_t m_snapshotSlots = 0;                               ///< NumElements of the snapshot
+    size_t m_snapshotObjects = 0;                               ///< Objects in the index of the snapshot
+    std::vector<uint64_t> m_pageHashes;                         ///< Hash of every ITEMS_PER_PAGE items
+    std::vector<int32_t> m_serials;                             ///< Serial number of every slot
+    std::vector<std::pair<uint64_t, int32_t>> m_slotsByAddress; ///< (address, slot) of every indexed object
+};
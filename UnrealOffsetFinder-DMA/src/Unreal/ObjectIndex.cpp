@@ -0,0 +1,182 @@
+#include "ObjectIndex.h"
+#include "NameTable.h"
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+
+namespace
+{
+    constexpr int MAX_OUTER_DEPTH = 64;     ///< Guards against outer cycles in corrupt data
+}
+
+void ObjectIndex::Reserve(size_t count)
+{
+    m_slots.reserve(count);
+    m_addresses.reserve(count);
+    m_classSlots.reserve(count);
+    m_outerSlots.reserve(count);
+    m_nameIndices.reserve(count);
+    m_nameNumbers.reserve(count);
+    m_flags.reserve(count);
+    m_internalFlags.reserve(count);
+}
+
+void ObjectIndex::Clear()
+{
+    m_slots.clear();
+    m_addresses.clear();
+    m_classSlots.clear();
+    m_outerSlots.clear();
+    m_nameIndices.clear();
+    m_nameNumbers.clear();
+    m_flags.clear();
+    m_internalFlags.clear();
+}
+
+void ObjectIndex::ShrinkToFit()
+{
+    m_slots.shrink_to_fit();
+    m_addresses.shrink_to_fit();
+    m_classSlots.shrink_to_fit();
+    m_outerSlots.shrink_to_fit();
+    m_nameIndices.shrink_to_fit();
+    m_nameNumbers.shrink_to_fit();
+    m_flags.shrink_to_fit();
+    m_internalFlags.shrink_to_fit();
+}
+
+void ObjectIndex::Add(int32_t slot, uint64_t address, uint32_t flags, uint32_t internalFlags, uint32_t nameIndex, uint32_t nameNumber)
+{
+    m_slots.push_back(slot);
+    m_addresses.push_back(address);
+    m_classSlots.push_back(-1);
+    m_outerSlots.push_back(-1);
+    m_nameIndices.push_back(nameIndex);
+    m_nameNumbers.push_back(nameNumber);
+    m_flags.push_back(flags);
+    m_internalFlags.push_back(internalFlags);
+}
+
+void ObjectIndex::Append(const ObjectIndex& other, size_t position)
+{
+    m_slots.push_back(other.m_slots[position]);
+    m_addresses.push_back(other.m_addresses[position]);
+    m_classSlots.push_back(other.m_classSlots[position]);
+    m_outerSlots.push_back(other.m_outerSlots[position]);
+    m_nameIndices.push_back(other.m_nameIndices[position]);
+    m_nameNumbers.push_back(other.m_nameNumbers[position]);
+    m_flags.push_back(other.m_flags[position]);
+    m_internalFlags.push_back(other.m_internalFlags[position]);
+}
+
+int64_t ObjectIndex::FindSlot(int32_t slot) const
+{
+    auto it = std::lower_bound(m_slots.begin(), m_slots.end(), slot);
+    if (it == m_slots.end() || *it != slot)
+    {
+        return -1;
+    }
+    return it - m_slots.begin();
+}
+
+std::vector<size_t> ObjectIndex::FindByClass(int32_t classSlot) const
+{
+    std::vector<size_t> positions;
+    for (size_t i = 0; i < m_classSlots.size(); ++i)
+    {
+        if (m_classSlots[i] == classSlot)
+        {
+            positions.push_back(i);
+        }
+    }
+    return positions;
+}
+
+std::string ObjectIndex::GetName(size_t position, const NameTable& names) const
+{
+    std::string name(names.Find(m_nameIndices[position]));
+    if (m_nameNumbers[position] != 0)
+    {
+        name += "_" + std::to_string(m_nameNumbers[position] - 1);
+    }
+    return name;
+}
+
+std::string ObjectIndex::GetPathName(size_t position, const NameTable& names) const
+{
+    std::vector<size_t> chain = { position };
+    for (int depth = 0; depth < MAX_OUTER_DEPTH; ++depth)
+    {
+        int32_t outerSlot = m_outerSlots[chain.back()];
+        int64_t outer = outerSlot >= 0 ? FindSlot(outerSlot) : -1;
+        if (outer < 0)
+        {
+            break;
+        }
+        chain.push_back(static_cast<size_t>(outer));
+    }
+
+    std::string path;
+    for (auto it = chain.rbegin(); it != chain.rend(); ++it)
+    {
+        if (!path.empty())
+        {
+            path += '.';
+        }
+        path += GetName(*it, names);
+    }
+    return path;
+}
+
+uint64_t ObjectIndex::GetMemoryBytes() const
+{
+    return m_slots.capacity() * sizeof(int32_t) + m_addresses.capacity() * sizeof(uint64_t) +
+           m_classSlots.capacity() * sizeof(int32_t) + m_outerSlots.capacity() * sizeof(int32_t) +
+           m_nameIndices.capacity() * sizeof(uint32_t) + m_nameNumbers.capacity() * sizeof(uint32_t) +
+           m_flags.capacity() * sizeof(uint32_t) + m_internalFlags.capacity() * sizeof(uint32_t);
+}
+
+bool ObjectIndex::SaveToFile(const std::string& filename, const NameTable* names) const
+{
+    std::ofstream file(filename, std::ios::binary);
+    if (!file.is_open())
+    {
+        std::cerr << "Failed to open object file for writing: " << filename << std::endl;
+        return false;
+    }
+
+    std::string chunk;
+    chunk.reserve(1 << 20);
+    char fields[96];
+    for (size_t i = 0; i < GetCount(); ++i)
+    {
+        int length = snprintf(fields, sizeof(fields), "%d\t0x%llX\t%d\t%d\t%X\t",
+                              m_slots[i], static_cast<unsigned long long>(m_addresses[i]),
+                              m_classSlots[i], m_outerSlots[i], m_flags[i]);
+        chunk.append(fields, static_cast<size_t>(length));
+
+        if (names)
+        {
+            int64_t classPosition = FindSlot(m_classSlots[i]);
+            chunk += classPosition >= 0 ? GetName(static_cast<size_t>(classPosition), *names) : "?";
+            chunk += '\t';
+            chunk += GetPathName(i, *names);
+        }
+        else
+        {
+            length = snprintf(fields, sizeof(fields), "%X\t%u", m_nameIndices[i], m_nameNumbers[i]);
+            chunk.append(fields, static_cast<size_t>(length));
+        }
+        chunk.push_back('\n');
+
+        if (chunk.size() >= (1 << 20))
+        {
+            file.write(chunk.data(), static_cast<std::streamsize>(chunk.size()));
+            chunk.clear();
+        }
+    }
+    file.write(chunk.data(), static_cast<std::streamsize>(chunk.size()));
+
+    return file.good();
+}
@@ -0,0 +1,143 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+class NameTable;
+
+/**
+ * @class ObjectIndex
+ * @brief Live UObjects of GObjects as a structure of arrays
+ *
+ * Entry n of every array describes the same object; entries are in
+ * ascending GObjects slot order. Classes and outers are stored as slot
+ * indices (-1 when null or not a live object), so filters such as "all
+ * objects of class X" are a linear pass over one int32 array.
+ */
+class ObjectIndex
+{
+public:
+    /**
+     * @brief Reserve space for the expected object count
+     * @param count Expected objects
+     */
+    void Reserve(size_t count);
+
+    /**
+     * @brief Remove all entries (keeps the allocated memory)
+     */
+    void Clear();
+
+    /**
+     * @brief Release unused reserved memory
+     */
+    void ShrinkToFit();
+
+    /**
+     * @brief Append an object (slots must be ascending); class and outer start unresolved
+     * @param slot GObjects index
+     * @param address UObject address
+     * @param flags EObjectFlags
+     * @param internalFlags EInternalObjectFlags of the FUObjectItem
+     * @param nameIndex FName comparison index
+     * @param nameNumber FName number
+     */
+    void Add(int32_t slot, uint64_t address, uint32_t flags, uint32_t internalFlags, uint32_t nameIndex, uint32_t nameNumber);
+
+    /**
+     * @brief Append a copy of another index's entry (slots must stay ascending)
+     * @param other Source index
+     * @param position Entry position in other
+     */
+    void Append(const ObjectIndex& other, size_t position);
+
+    /**
+     * @brief Get the number of objects
+     * @return Object count
+     */
+    size_t GetCount() const { return m_slots.size(); }
+
+    const std::vector<int32_t>& GetSlots() const { return m_slots; }                ///< GObjects index of each object
+    const std::vector<uint64_t>& GetAddresses() const { return m_addresses; }       ///< UObject address
+    const std::vector<int32_t>& GetClassSlots() const { return m_classSlots; }      ///< Slot of ClassPrivate (-1 = none)
+    const std::vector<int32_t>& GetOuterSlots() const { return m_outerSlots; }      ///< Slot of OuterPrivate (-1 = none)
+    const std::vector<uint32_t>& GetNameIndices() const { return m_nameIndices; }   ///< FName comparison index
+    const std::vector<uint32_t>& GetNameNumbers() const { return m_nameNumbers; }   ///< FName number
+    const std::vector<uint32_t>& GetFlags() const { return m_flags; }               ///< EObjectFlags
+    const std::vector<uint32_t>& GetInternalFlags() const { return m_internalFlags; }   ///< EInternalObjectFlags
+
+    /**
+     * @brief Set the class and outer slots of an entry
+     * @param position Entry position
+     * @param classSlot Slot of the class (-1 = none)
+     * @param outerSlot Slot of the outer (-1 = none)
+     */
+    void SetReferences(size_t position, int32_t classSlot, int32_t outerSlot)
+    {
+        m_classSlots[position] = classSlot;
+        m_outerSlots[position] = outerSlot;
+    }
+
+    /**
+     * @brief Set the item flags of an entry
+     * @param position Entry position
+     * @param internalFlags EInternalObjectFlags
+     */
+    void SetInternalFlags(size_t position, uint32_t internalFlags) { m_internalFlags[position] = internalFlags; }
+
+    /**
+     * @brief Find the entry of a GObjects slot
+     * @param slot GObjects index
+     * @return Entry position, -1 if the slot holds no live object
+     */
+    int64_t FindSlot(int32_t slot) const;
+
+    /**
+     * @brief Collect the entries whose class is the given slot
+     * @param classSlot Slot of the class object
+     * @return Entry positions
+     */
+    std::vector<size_t> FindByClass(int32_t classSlot) const;
+
+    /**
+     * @brief Build "Outer.Outer.Name" for an entry (names resolved through a name table)
+     * @param position Entry position
+     * @param names Name table of the same process
+     * @return Path name
+     */
+    std::string GetPathName(size_t position, const NameTable& names) const;
+
+    /**
+     * @brief Get the memory held by the index
+     * @return Allocated bytes
+     */
+    uint64_t GetMemoryBytes() const;
+
+    /**
+     * @brief Write one tab separated line per object (slot, address, class, outer, name, flags)
+     * @param filename Output file
+     * @param names Name table for names and paths, nullptr to write raw name indices
+     * @return true if successful, false otherwise
+     */
+    bool SaveToFile(const std::string& filename, const NameTable* names) const;
+
+    /**
+     * @brief Get the display name of an entry ("Name" or "Name_<number - 1>")
+     * @param position Entry position
+     * @param names Name table
+     * @return Name
+     */
+    std::string GetName(size_t position, const NameTable& names) const;
+
+private:
+    std::vector<int32_t> m_slots;           ///< GObjects index
+    std::vector<uint64_t> m_addresses;      ///< UObject address
+    std::vector<int32_t> m_classSlots;      ///< Class slot
+    std::vector<int32_t> m_outerSlots;      ///< Outer slot
+    std::vector<uint32_t> m_nameIndices;    ///< FName comparison index
+    std::vector<uint32_t> m_nameNumbers;    ///< FName number
+    std::vector<uint32_t> m_flags;          ///< EObjectFlags
+    std::vector<uint32_t> m_internalFlags;  ///< EInternalObjectFlags
+};
@@ -0,0 +1,127 @@
+#include "SignatureStats.h"
+#include "../DMA/DMAManager.h"
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+
+void SignatureStats::Record(const EngineVersion& version, const std::string& signature)
+{
+    m_hits[{ version.ToString(), signature }]++;
+}
+
+uint32_t SignatureStats::GetHits(const EngineVersion& version, const std::string& signature) const
+{
+    if (version.IsKnown())
+    {
+        auto it = m_hits.find({ version.ToString(), signature });
+        return it != m_hits.end() ? it->second : 0;
+    }
+
+    uint32_t hits = 0;
+    for (const auto& [key, count] : m_hits)
+    {
+        if (key.second == signature)
+            hits += count;
+    }
+    return hits;
+}
+
+void SignatureStats::Rank(const EngineVersion& version, std::vector<UnrealSignature>& signatures) const
+{
+    struct Ranked
+    {
+        uint32_t hits;
+        bool hinted;
+        size_t position;
+    };
+
+    uint32_t code = version.GetCode();
+    std::vector<Ranked> keys(signatures.size());
+    for (size_t i = 0; i < signatures.size(); ++i)
+    {
+        const UnrealSignature& sig = signatures[i];
+        bool covered = version.IsKnown() && (sig.minVersion != 0 || sig.maxVersion != 0) &&
+                       code >= sig.minVersion && (sig.maxVersion == 0 || code <= sig.maxVersion);
+        keys[i] = { GetHits(version, sig.name), covered, i };
+    }
+
+    std::sort(keys.begin(), keys.end(), [](const Ranked& a, const Ranked& b)
+    {
+        if (a.hits != b.hits)
+            return a.hits > b.hits;
+        if (a.hinted != b.hinted)
+            return a.hinted;
+        return a.position < b.position;
+    });
+
+    std::vector<UnrealSignature> ranked;
+    ranked.reserve(signatures.size());
+    for (const Ranked& key : keys)
+    {
+        ranked.push_back(std::move(signatures[key.position]));
+    }
+    signatures = std::move(ranked);
+}
+
+bool SignatureStats::LoadFromFile(const std::string& filename, std::string& error)
+{
+    std::ifstream file(filename);
+    if (!file.is_open())
+    {
+        error = "Failed to open signature stats: " + filename;
+        return false;
+    }
+
+    std::map<std::pair<std::string, std::string>, uint32_t> hits;
+    std::string line;
+    size_t lineNumber = 0;
+    while (std::getline(file, line))
+    {
+        lineNumber++;
+        if (!line.empty() && line.back() == '\r')
+            line.pop_back();
+        if (line.empty() || line[0] == '#')
+            continue;
+
+        size_t first = line.find('\t');
+        size_t second = first == std::string::npos ? first : line.find('\t', first + 1);
+        if (second == std::string::npos)
+        {
+            error = filename + ":" + std::to_string(lineNumber) + ": expected <version>\\t<variant>\\t<hits>";
+            return false;
+        }
+
+        unsigned long count = 0;
+        try
+        {
+            count = std::stoul(line.substr(second + 1));
+        }
+        catch (const std::exception&)
+        {
+            error = filename + ":" + std::to_string(lineNumber) + ": invalid hit count";
+            return false;
+        }
+        hits[{ line.substr(0, first), line.substr(first + 1, second - first - 1) }] += static_cast<uint32_t>(count);
+    }
+
+    m_hits = std::move(hits);
+    return true;
+}
+
+bool SignatureStats::SaveToFile(const std::string& filename, std::string& error) const
+{
+    std::ostringstream text;
+    text << "# engine version\tsignature variant\thits\n";
+    for (const auto& [key, count] : m_hits)
+    {
+        text << key.first << '\t' << key.second << '\t' << count << '\n';
+    }
+
+    std::ofstream file(filename, std::ios::trunc);
+    if (!file.is_open() || !(file << text.str()))
+    {
+        error = "Failed to write signature stats: " + filename;
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,81 @@
+#pragma once
+
+#include "EngineVersion.h"
+#include <cstdint>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+struct UnrealSignature;
+
+/**
+ * @class SignatureStats
+ * @brief Which signature variant found each global, per engine version
+ *
+ * Which variant of a group matches depends mostly on the engine version,
+ * so hits are counted per (version, variant) and the next scan of a build
+ * of that version tries the variants in order of their hits. Variants that
+ * never hit on the version fall back to their version hints and then to
+ * table order, so ranking never drops a variant. Stored as a small text
+ * file ("<version>\t<variant>\t<hits>" per line).
+ */
+class SignatureStats
+{
+public:
+    /**
+     * @brief Count a match of a variant
+     * @param version Engine version of the scanned module (unknown is counted as its own version)
+     * @param signature Variant name
+     */
+    void Record(const EngineVersion& version, const std::string& signature);
+
+    /**
+     * @brief Get the matches of a variant
+     * @param version Engine version (unknown sums the hits of every version)
+     * @param signature Variant name
+     * @return Recorded hits
+     */
+    uint32_t GetHits(const EngineVersion& version, const std::string& signature) const;
+
+    /**
+     * @brief Order variants so the likeliest match on a version comes first
+     *
+     * Sorts by hits on the version, then by whether the variant's version
+     * hint covers the version, then by table order.
+     *
+     * @param version Engine version of the module about to be scanned
+     * @param signatures Variants to reorder in place
+     */
+    void Rank(const EngineVersion& version, std::vector<UnrealSignature>& signatures) const;
+
+    /**
+     * @brief Get the number of (version, variant) pairs with hits
+     * @return Entries
+     */
+    size_t GetCount() const { return m_hits.size(); }
+
+    /**
+     * @brief Remove all hits
+     */
+    void Clear() { m_hits.clear(); }
+
+    /**
+     * @brief Replace the hits with the contents of a stats file
+     * @param filename Stats file
+     * @param error Receives the reason on failure
+     * @return true if successful, false otherwise
+     */
+    bool LoadFromFile(const std::string& filename, std::string& error);
+
+    /**
+     * @brief Write the hits to a stats file
+     * @param filename Stats file
+     * @param error Receives the reason on failure
+     * @return true if successful, false otherwise
+     */
+    bool SaveToFile(const std::string& filename, std::string& error) const;
+
+private:
+    std::map<std::pair<std::string, std::string>, uint32_t> m_hits;    ///< Hits per (version text, variant name)
+};
@@ -0,0 +1,127 @@
+#include "SymbolResolver.h"
+#include "../DMA/DMAManager.h"
+#include "../Core/PdbFile.h"
+#include "../Core/StringUtils.h"
+#include <map>
+
+namespace
+{
+    constexpr size_t HEADER_READ_SIZE = 0x1000;     // DOS, NT and section headers fit in the first page
+}
+
+bool SymbolResolver::Load(const DMAManager& dmaManager, std::shared_ptr<const PdbFile> pdb, std::string& error)
+{
+    m_exports.clear();
+    m_exportCount = 0;
+    m_pdb.reset();
+    m_pdbStatus = "none supplied";
+
+    if (!dmaManager.IsConnected())
+    {
+        error = "Not connected to any process";
+        return false;
+    }
+
+    m_moduleBase = dmaManager.GetMainModuleBase();
+    std::vector<uint8_t> headerBytes(HEADER_READ_SIZE);
+    size_t bytesRead = m_moduleBase ? dmaManager.ReadMemory(m_moduleBase, headerBytes.data(), headerBytes.size()) : 0;
+
+    PeHeaders headers;
+    if (!PeImage::ParseHeaders(headerBytes.data(), bytesRead, headers))
+    {
+        error = "Main module headers are unreadable at " + DMAManager::FormatHexAddress(m_moduleBase);
+        return false;
+    }
+
+    uint64_t moduleBase = m_moduleBase;
+    PeRvaReader reader = [&dmaManager, moduleBase](uint32_t rva, void* buffer, size_t size)
+    {
+        return dmaManager.ReadMemoryEx(moduleBase + rva, buffer, size, 1);
+    };
+
+    // A broken export table only costs the fast path; the scan still runs
+    std::vector<PeExport> exports;
+    if (PeImage::ReadExports(headers, reader, exports))
+    {
+        m_exportCount = exports.size();
+        for (PeExport& entry : exports)
+        {
+            std::string plain = GetDecoratedGlobalName(entry.name);
+            if (!plain.empty())
+                m_exports.emplace(std::move(plain), entry.rva);
+            m_exports.emplace(std::move(entry.name), entry.rva);
+        }
+    }
+
+    if (pdb)
+    {
+        PeCodeView codeView;
+        if (!PeImage::ReadCodeView(headers, reader, codeView))
+        {
+            m_pdbStatus = "module has no CodeView record";
+        }
+        else if (!pdb->Matches(codeView))
+        {
+            m_pdbStatus = "built for " + PdbFile::FormatId(pdb->GetGuid(), pdb->GetAge()) +
+                          ", module wants " + PdbFile::FormatId(codeView.guid, codeView.age) + " (" + codeView.pdbPath + ")";
+        }
+        else
+        {
+            m_pdb = std::move(pdb);
+            m_pdbStatus = "matched";
+        }
+    }
+    return true;
+}
+
+uint64_t SymbolResolver::Resolve(const std::string& groupName, GlobalSource& source, std::string& symbol) const
+{
+    source = GlobalSource::None;
+    for (const std::string& name : GetSymbolNames(groupName))
+    {
+        auto it = m_exports.find(name);
+        if (it != m_exports.end())
+        {
+            source = GlobalSource::Export;
+            symbol = name;
+            return m_moduleBase + it->second;
+        }
+    }
+
+    uint32_t rva = 0;
+    for (const std::string& name : GetSymbolNames(groupName))
+    {
+        if (m_pdb && m_pdb->FindSymbol(name, rva))
+        {
+            source = GlobalSource::Pdb;
+            symbol = name;
+            return m_moduleBase + rva;
+        }
+    }
+    return 0;
+}
+
+const std::vector<std::string>& SymbolResolver::GetSymbolNames(const std::string& groupName)
+{
+    // GNames is the FNamePool storage (UE 4.23+) or the older global name array
+    static const std::map<std::string, std::vector<std::string>> SYMBOLS = {
+        { "GWorld", { "GWorld" } },
+        { "GNames", { "NamePoolData", "GNames" } },
+        { "GObjects", { "GUObjectArray" } },
+    };
+    static const std::vector<std::string> NONE;
+
+    auto it = SYMBOLS.find(groupName);
+    return it != SYMBOLS.end() ? it->second : NONE;
+}
+
+const char* SymbolResolver::GetSourceName(GlobalSource source)
+{
+    switch (source)
+    {
+    case GlobalSource::Export: return "export";
+    case GlobalSource::Pdb: return "pdb";
+    case GlobalSource::Signature: return "signature";
+    default: return "none";
+    }
+}
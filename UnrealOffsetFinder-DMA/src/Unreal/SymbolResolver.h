@@ -0,0 +1,82 @@
+#pragma once
+
+#include "../Core/PeImage.h"
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+class DMAManager;
+class PdbFile;
+enum class GlobalSource;
+
+/**
+ * @class SymbolResolver
+ * @brief Finds Unreal globals by name before any signature is scanned
+ *
+ * Modular and editor-like builds export GUObjectArray or GWorld, and a
+ * PDB of the exact build is sometimes at hand. Load() reads the main
+ * module's export table and CodeView record through the DMA manager (a
+ * few small reads, no module scan) and keeps the supplied PDB only if its
+ * GUID and age match the image. Resolve() then tries the exports and the
+ * PDB; the signature scan is only needed when both miss.
+ */
+class SymbolResolver
+{
+public:
+    /**
+     * @brief Read the exports and CodeView record of the attached process' main module
+     * @param dmaManager DMA manager attached to the process
+     * @param pdb PDB supplied on disk (may be null); dropped if it belongs to another build
+     * @param error Receives the reason on failure
+     * @return false if the module headers are unreadable
+     */
+    bool Load(const DMAManager& dmaManager, std::shared_ptr<const PdbFile> pdb, std::string& error);
+
+    /**
+     * @brief Look a global up in the exports, then in the PDB
+     * @param groupName Global to resolve ("GWorld", "GNames", "GObjects")
+     * @param source Receives Export, Pdb or None
+     * @param symbol Receives the symbol name that matched
+     * @return Absolute address, 0 if neither knows the global
+     */
+    uint64_t Resolve(const std::string& groupName, GlobalSource& source, std::string& symbol) const;
+
+    /**
+     * @brief Get the number of named exports of the main module
+     * @return Exports
+     */
+    size_t GetExportCount() const { return m_exportCount; }
+
+    /**
+     * @brief Check whether a matching PDB is in use
+     * @return true if the supplied PDB belongs to the module
+     */
+    bool HasPdb() const { return m_pdb != nullptr; }
+
+    /**
+     * @brief Describe the PDB state ("matched", "none supplied", or why it was dropped)
+     * @return Status text
+     */
+    const std::string& GetPdbStatus() const { return m_pdbStatus; }
+
+    /**
+     * @brief Get the symbols a global is known by, in lookup order
+     * @param groupName Global ("GWorld", "GNames", "GObjects")
+     * @return Plain symbol names (empty for unknown groups)
+     */
+    static const std::vector<std::string>& GetSymbolNames(const std::string& groupName);
+
+    /**
+     * @brief Stable name of a global source (used in logs and JSON)
+     */
+    static const char* GetSourceName(GlobalSource source);
+
+private:
+    uint64_t m_moduleBase = 0;                              ///< Main module base the RVAs are relative to
+    std::unordered_map<std::string, uint32_t> m_exports;    ///< Export RVAs by plain and decorated name
+    size_t m_exportCount = 0;                               ///< Named exports read
+    std::shared_ptr<const PdbFile> m_pdb;                   ///< Matching PDB, null if none
+    std::string m_pdbStatus;                                ///< Why m_pdb is (not) used
+};
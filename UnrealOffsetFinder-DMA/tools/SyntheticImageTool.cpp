@@ -0,0 +1,161 @@
+#include "../src/Synthetic/SyntheticImage.h"
+#include "../src/Synthetic/SyntheticPdb.h"
+#include <iostream>
+#include <string>
+#include <vector>
+
+/*
+ * Generates an Unreal-like module image plus a JSON manifest of the planted
+ * patterns and the globals ScanUnrealGlobals is expected to report.
+ *
+ *   uof_synth --out game.bin --size 2G --seed 7
+ *   uof_bench --image game.bin
+ */
+
+namespace
+{
+    void PrintUsage()
+    {
+        std::cout << "Usage: uof_synth --out <file> [options]\n"
+                  << "  --out <file>            Image output (module bytes as laid out in memory)\n"
+                  << "  --manifest <file>       Manifest output (default <out>.json)\n"
+                  << "  --size <n>[K|M|G]       Image size (default 64M, minimum 1M)\n"
+                  << "  --seed <n>              Generator seed (default 1)\n"
+                  << "  --base <hex>            Image base (default 0x140000000)\n"
+                  << "  --variant <name>        Only plant references for this signature (repeatable)\n"
+                  << "  --decoys <n>            Decoys per signature (default 64)\n"
+                  << "  --near-misses <n>       Near-misses per signature (default 4)\n"
+                  << "  --tail                  Plant everything at the end of .text\n"
+                  << "  --engine-version <v>    Plant the engine branch name of version <v> (e.g. 4.27) in .rdata\n"
+                  << "  --export <global>       Export GWorld, GNames or GObjects under its decorated name (repeatable)\n"
+                  << "  --codeview              Plant a debug directory with a CodeView record\n"
+                  << "  --pdb <file>            Also write a PDB matching the image (implies --codeview)\n"
+                  << "  --verify                Generate in memory and check every reference is the first match" << std::endl;
+    }
+
+    uint64_t ParseSize(const std::string& text)
+    {
+        size_t consumed = 0;
+        uint64_t value = std::stoull(text, &consumed);
+        std::string suffix = text.substr(consumed);
+        if (suffix == "K" || suffix == "k") return value << 10;
+        if (suffix == "M" || suffix == "m") return value << 20;
+        if (suffix == "G" || suffix == "g") return value << 30;
+        if (!suffix.empty()) throw std::invalid_argument("unknown size suffix: " + suffix);
+        return value;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    SyntheticImageOptions options;
+    std::string outPath;
+    std::string manifestPath;
+    std::string pdbPath;
+    bool verify = false;
+
+    try
+    {
+        for (int i = 1; i < argc; ++i)
+        {
+            std::string arg = argv[i];
+            auto next = [&]() -> std::string
+            {
+                if (i + 1 >= argc)
+                    throw std::invalid_argument("missing value for " + arg);
+                return argv[++i];
+            };
+
+            if (arg == "--out") outPath = next();
+            else if (arg == "--manifest") manifestPath = next();
+            else if (arg == "--size") options.imageSize = ParseSize(next());
+            else if (arg == "--seed") options.seed = std::stoull(next());
+            else if (arg == "--base") options.imageBase = std::stoull(next(), nullptr, 16);
+            else if (arg == "--variant") options.variants.push_back(next());
+            else if (arg == "--decoys") options.decoysPerSignature = std::stoul(next());
+            else if (arg == "--near-misses") options.nearMissesPerSignature = std::stoul(next());
+            else if (arg == "--tail") options.placeAtEnd = true;
+            else if (arg == "--engine-version") options.engineVersion = next();
+            else if (arg == "--export") options.exports.push_back(next());
+            else if (arg == "--codeview") options.codeView = true;
+            else if (arg == "--pdb") { pdbPath = next(); options.codeView = true; }
+            else if (arg == "--verify") verify = true;
+            else if (arg == "--help" || arg == "-h")
+            {
+                PrintUsage();
+                return 0;
+            }
+            else
+            {
+                std::cerr << "Unknown argument: " << arg << std::endl;
+                PrintUsage();
+                return 1;
+            }
+        }
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << "Invalid arguments: " << e.what() << std::endl;
+        return 1;
+    }
+
+    if (outPath.empty())
+    {
+        PrintUsage();
+        return 1;
+    }
+
+    if (manifestPath.empty())
+    {
+        manifestPath = outPath + ".json";
+    }
+
+    SyntheticImage image(options);
+    const SyntheticImageManifest& manifest = image.GetManifest();
+
+    if (verify)
+    {
+        std::vector<uint8_t> bytes = image.Generate();
+        std::vector<std::string> errors;
+        if (!image.Verify(bytes, errors))
+        {
+            for (const auto& error : errors)
+            {
+                std::cerr << "[ERROR] " << error << std::endl;
+            }
+            return 2;
+        }
+        std::cout << "[SUCCESS] All planted references are first matches" << std::endl;
+    }
+
+    if (!image.WriteToFile(outPath) || !manifest.SaveToFile(manifestPath))
+    {
+        return 1;
+    }
+
+    if (!pdbPath.empty())
+    {
+        // Every expected global as a data public, plus a function public PdbFile must skip
+        SyntheticPdb pdb(manifest.codeView, manifest.sections);
+        const char* groups[] = { "GWorld", "GNames", "GObjects" };
+        uint64_t addresses[] = { manifest.expected.GWorld, manifest.expected.GNames, manifest.expected.GObjects };
+        for (size_t i = 0; i < 3; ++i)
+        {
+            if (addresses[i] != 0)
+                pdb.AddSymbol({ SyntheticImage::GetDecoratedSymbol(groups[i]), static_cast<uint32_t>(addresses[i] - options.imageBase), false });
+        }
+        pdb.AddSymbol({ "?Tick@UWorld@@QEAAXW4ELevelTick@@M@Z", static_cast<uint32_t>(manifest.sections[0].virtualAddress + 0x10), true });
+        if (!pdb.WriteToFile(pdbPath))
+        {
+            return 1;
+        }
+        std::cout << "PDB: " << pdbPath << std::endl;
+    }
+
+    std::cout << "Wrote " << manifest.options.imageSize << " bytes to " << outPath << std::endl;
+    std::cout << "Manifest: " << manifestPath << std::endl;
+    std::cout << "  GWorld:   " << DMAManager::FormatHexAddress(manifest.expected.GWorld) << std::endl;
+    std::cout << "  GNames:   " << DMAManager::FormatHexAddress(manifest.expected.GNames) << std::endl;
+    std::cout << "  GObjects: " << DMAManager::FormatHexAddress(manifest.expected.GObjects) << std::endl;
+    return 0;
+}